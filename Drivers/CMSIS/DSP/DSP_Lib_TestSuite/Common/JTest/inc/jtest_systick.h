@@ -6,7 +6,9 @@
 /*--------------------------------------------------------------------------------*/
 
 /* Get access to the SysTick structure. */
-#if   defined ARMCM0
+#if   defined JTEST_HOST
+    #include <time.h>           /* clock_gettime() */
+#elif defined ARMCM0
     #include "ARMCM0.h"
 #elif defined ARMCM0P
     #include "ARMCM0plus.h"
@@ -57,6 +59,56 @@
  */
 #define JTEST_SYSTICK_INITIAL_VALUE 0xFFFFFF
 
+#if defined JTEST_HOST
+
+/**
+ *  Host build: SysTick is emulated with the monotonic clock. The emulated
+ *  counter decrements once per nanosecond, so the "cycles" reported by
+ *  #JTEST_COUNT_CYCLES() are nanoseconds. It saturates at zero instead of
+ *  wrapping.
+ */
+typedef struct
+{
+    uint64_t start_ns;
+} JTEST_HOST_SYSTICK_t;
+
+extern JTEST_HOST_SYSTICK_t JTEST_HOST_SYSTICK;
+
+#define SysTick (&JTEST_HOST_SYSTICK)
+
+static inline uint64_t jtest_host_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000U) + (uint64_t) ts.tv_nsec;
+}
+
+static inline uint32_t jtest_host_systick_value(JTEST_HOST_SYSTICK_t *systick)
+{
+    uint64_t elapsed = jtest_host_ns() - systick->start_ns;
+
+    return (elapsed >= JTEST_SYSTICK_INITIAL_VALUE) ?
+        0U : (uint32_t) (JTEST_SYSTICK_INITIAL_VALUE - elapsed);
+}
+
+#define JTEST_SYSTICK_RESET(systick_ptr)                    \
+    do                                                      \
+    {                                                       \
+        (systick_ptr)->start_ns = 0;                        \
+    } while (0)
+
+#define JTEST_SYSTICK_START(systick_ptr)                    \
+    do                                                      \
+    {                                                       \
+        (systick_ptr)->start_ns = jtest_host_ns();          \
+    } while (0)
+
+#define JTEST_SYSTICK_VALUE(systick_ptr)        \
+    jtest_host_systick_value(systick_ptr)
+
+#else
+
 /**
  *  Reset the SysTick, decrementing timer to it's maximum value and disable it.
  *
@@ -90,4 +142,6 @@
 #define JTEST_SYSTICK_VALUE(systick_ptr)        \
     ((systick_ptr)->VAL)
 
+#endif /* JTEST_HOST */
+
 #endif /* _JTEST_SYSTICK_H_ */
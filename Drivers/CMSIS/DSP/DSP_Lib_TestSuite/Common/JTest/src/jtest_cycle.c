@@ -7,3 +7,8 @@
 
 /* const char * JTEST_CYCLE_STRF = "Running: %s\nCycles: %" PRIu32 "\n"; */
 const char *JTEST_CYCLE_STRF = "Cycles: %" PRIu32 "\n";  /* function name + parameter string skipped */
+
+#if defined JTEST_HOST
+/* Emulated SysTick of the host build, see jtest_systick.h */
+JTEST_HOST_SYSTICK_t JTEST_HOST_SYSTICK = {0};
+#endif
@@ -27,7 +27,10 @@ void group_end( void )
 
 void dump_str( void )
 {
-//  ;
+#if defined JTEST_HOST
+    /* No debugger on the host, print the segment directly. */
+    printf( "%.*s", JTEST_STR_MAX_OUTPUT_SIZE, JTEST_FW.str_buffer );
+#endif
     JTEST_FW.dump_str++;
 }
 
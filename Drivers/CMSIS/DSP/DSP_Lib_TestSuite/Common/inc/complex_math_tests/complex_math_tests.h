@@ -7,6 +7,7 @@
 JTEST_DECLARE_GROUP( cmplx_conj_tests );
 JTEST_DECLARE_GROUP( cmplx_dot_prod_tests );
 JTEST_DECLARE_GROUP( cmplx_mag_tests );
+JTEST_DECLARE_GROUP( cmplx_mag_db_tests );
 JTEST_DECLARE_GROUP( cmplx_mag_squared_tests );
 JTEST_DECLARE_GROUP( cmplx_mult_cmplx_tests );
 JTEST_DECLARE_GROUP( cmplx_mult_real_tests );
@@ -99,4 +99,171 @@
             return JTEST_TEST_PASSED;                                   \
         }
 
+/**
+ * Number of input blocks of the vector function tests. The Q15 blocks
+ * enumerate every 16 bit value, the Q31 blocks spread the inputs over the
+ * full exponent range.
+ */
+#define FAST_MATH_PASSES_q15 (65536 / FAST_MATH_MAX_LEN)
+#define FAST_MATH_PASSES_q31 8
+
+/**
+ * Maximum errors of the vector functions, in LSB of the output format, as
+ * documented in the function descriptions.
+ */
+#define FAST_MATH_MAX_ERROR_atan2_q15 2
+#define FAST_MATH_MAX_ERROR_atan2_q31 4
+#define FAST_MATH_MAX_ERROR_log2_q15  1
+#define FAST_MATH_MAX_ERROR_log2_q31  1
+#define FAST_MATH_MAX_ERROR_ln_q15    2
+#define FAST_MATH_MAX_ERROR_ln_q31    2
+#define FAST_MATH_MAX_ERROR_exp2_q15  2
+#define FAST_MATH_MAX_ERROR_exp2_q31  1
+#define FAST_MATH_MAX_ERROR_rsqrt_q15 2
+#define FAST_MATH_MAX_ERROR_rsqrt_q31 2
+
+/**
+ *  Run a vector function under test and its reference on every input block
+ *  and compare the outputs with #TEST_ASSERT_MAX_ERROR(). The cycles of the
+ *  last block are counted for both. The statements fut_call, ref_call and
+ *  compare use the input and output buffers of the fast_math_tests.
+ */
+#define FAST_MATH_BLOCK_TEST_BODY(func, suffix, fut_call, ref_call, compare) \
+    do                                                                  \
+    {                                                                   \
+        uint32_t pass;                                                  \
+        int64_t max_error = 0;                                          \
+                                                                        \
+        for (pass = 0; pass < FAST_MATH_PASSES_##suffix; pass++)        \
+        {                                                               \
+            fast_math_fill_inputs_##suffix(pass);                       \
+            fut_call;                                                   \
+            ref_call;                                                   \
+            compare;                                                    \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error);        \
+        JTEST_COUNT_CYCLES(fut_call);                                   \
+        JTEST_COUNT_CYCLES(ref_call);                                   \
+    } while (0)
+
+#define ATAN2_TEST_TEMPLATE(suffix)                                     \
+                                                                        \
+    JTEST_DEFINE_TEST(arm_atan2_##suffix##_test, arm_atan2_##suffix)    \
+    {                                                                   \
+        FAST_MATH_BLOCK_TEST_BODY(                                      \
+            atan2, suffix,                                              \
+            arm_atan2_##suffix((suffix##_t *) fast_math_input_b,        \
+                               (suffix##_t *) fast_math_input_a,        \
+                               (suffix##_t *) fast_math_output_fut,     \
+                               FAST_MATH_MAX_LEN),                      \
+            ref_atan2_##suffix((suffix##_t *) fast_math_input_b,        \
+                               (suffix##_t *) fast_math_input_a,        \
+                               (suffix##_t *) fast_math_output_ref,     \
+                               FAST_MATH_MAX_LEN),                      \
+            TEST_ASSERT_MAX_ERROR((suffix##_t *) fast_math_output_ref,  \
+                                  (suffix##_t *) fast_math_output_fut,  \
+                                  FAST_MATH_MAX_LEN,                    \
+                                  suffix##_t,                           \
+                                  FAST_MATH_MAX_ERROR_atan2_##suffix,   \
+                                  max_error));                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+#define LOG_TEST_TEMPLATE(suffix, func)                                 \
+                                                                        \
+    JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix) \
+    {                                                                   \
+        arm_status status_fut;                                          \
+        arm_status status_ref;                                          \
+                                                                        \
+        FAST_MATH_BLOCK_TEST_BODY(                                      \
+            func, suffix,                                               \
+            status_fut = arm_##func##_##suffix(                         \
+                (suffix##_t *) fast_math_input_a,                       \
+                (suffix##_t *) fast_math_output_fut,                    \
+                FAST_MATH_MAX_LEN),                                     \
+            status_ref = ref_##func##_##suffix(                         \
+                (suffix##_t *) fast_math_input_a,                       \
+                (suffix##_t *) fast_math_output_ref,                    \
+                FAST_MATH_MAX_LEN),                                     \
+            TEST_ASSERT_EQUAL(status_fut, status_ref);                  \
+            TEST_ASSERT_MAX_ERROR((suffix##_t *) fast_math_output_ref,  \
+                                  (suffix##_t *) fast_math_output_fut,  \
+                                  FAST_MATH_MAX_LEN,                    \
+                                  int64_t,                              \
+                                  FAST_MATH_MAX_ERROR_##func##_##suffix, \
+                                  max_error));                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+#define EXP2_TEST_TEMPLATE(suffix, input)                               \
+                                                                        \
+    JTEST_DEFINE_TEST(arm_exp2_##suffix##_test, arm_exp2_##suffix)      \
+    {                                                                   \
+        FAST_MATH_BLOCK_TEST_BODY(                                      \
+            exp2, suffix,                                               \
+            arm_exp2_##suffix((suffix##_t *) input,                     \
+                              (suffix##_t *) fast_math_output_fut,      \
+                              FAST_MATH_MAX_LEN),                       \
+            ref_exp2_##suffix((suffix##_t *) input,                     \
+                              (suffix##_t *) fast_math_output_ref,      \
+                              FAST_MATH_MAX_LEN),                       \
+            TEST_ASSERT_MAX_ERROR((suffix##_t *) fast_math_output_ref,  \
+                                  (suffix##_t *) fast_math_output_fut,  \
+                                  FAST_MATH_MAX_LEN,                    \
+                                  int64_t,                              \
+                                  FAST_MATH_MAX_ERROR_exp2_##suffix,    \
+                                  max_error));                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+  The mantissas are compared at the larger of the two shifts, because a value
+  close to a power of two can be rounded to either side of it.
+*/
+#define RSQRT_TEST_TEMPLATE(suffix)                                     \
+                                                                        \
+    JTEST_DEFINE_TEST(arm_rsqrt_##suffix##_test, arm_rsqrt_##suffix)    \
+    {                                                                   \
+        arm_status status_fut;                                          \
+        arm_status status_ref;                                          \
+        suffix##_t *pFut = (suffix##_t *) fast_math_output_fut;         \
+        suffix##_t *pRef = (suffix##_t *) fast_math_output_ref;         \
+        int8_t *pShiftFut = (int8_t *) fast_math_output_f32_fut;        \
+        int8_t *pShiftRef = (int8_t *) fast_math_output_f32_ref;        \
+        int64_t err;                                                    \
+        int8_t shift;                                                   \
+        uint32_t i;                                                     \
+                                                                        \
+        FAST_MATH_BLOCK_TEST_BODY(                                      \
+            rsqrt, suffix,                                              \
+            status_fut = arm_rsqrt_##suffix(                            \
+                (suffix##_t *) fast_math_input_a, pFut, pShiftFut,      \
+                FAST_MATH_MAX_LEN),                                     \
+            status_ref = ref_rsqrt_##suffix(                            \
+                (suffix##_t *) fast_math_input_a, pRef, pShiftRef,      \
+                FAST_MATH_MAX_LEN),                                     \
+            TEST_ASSERT_EQUAL(status_fut, status_ref);                  \
+            for (i = 0; i < FAST_MATH_MAX_LEN; i++)                     \
+            {                                                           \
+                shift = (pShiftFut[i] > pShiftRef[i]) ?                 \
+                    pShiftFut[i] : pShiftRef[i];                        \
+                err = ((int64_t) pFut[i] << pShiftFut[i]) -             \
+                    ((int64_t) pRef[i] << pShiftRef[i]);                \
+                err = ((err < 0) ? -err : err) >> shift;                \
+                max_error = (err > max_error) ? err : max_error;        \
+            }                                                           \
+            if (max_error > FAST_MATH_MAX_ERROR_rsqrt_##suffix)         \
+            {                                                           \
+                JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error); \
+                return JTEST_TEST_FAILED;                               \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
 #endif /* _FAST_MATH_TEMPLATES_H_ */
@@ -22,6 +22,8 @@ extern float32_t fast_math_output_fut[FAST_MATH_MAX_LEN];
 extern float32_t fast_math_output_ref[FAST_MATH_MAX_LEN];
 extern float32_t fast_math_output_f32_fut[FAST_MATH_MAX_LEN];
 extern float32_t fast_math_output_f32_ref[FAST_MATH_MAX_LEN];
+extern float32_t fast_math_input_a[FAST_MATH_MAX_LEN];
+extern float32_t fast_math_input_b[FAST_MATH_MAX_LEN];
 extern const float32_t fast_math_f32_inputs[FAST_MATH_MAX_LEN];
 extern const q31_t fast_math_q31_inputs[FAST_MATH_MAX_LEN];
 extern const q15_t *fast_math_q15_inputs;
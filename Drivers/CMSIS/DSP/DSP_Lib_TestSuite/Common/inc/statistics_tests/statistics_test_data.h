@@ -13,6 +13,7 @@
 /*--------------------------------------------------------------------------------*/
 #define STATISTICS_MAX_INPUT_ELEMENTS 32
 #define STATISTICS_BIGGEST_INPUT_TYPE float32_t
+#define STATISTICS_MAX_WINDOW_LEN 16
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Variables */
@@ -34,6 +35,9 @@ statistics_output_f32_fut[STATISTICS_MAX_INPUT_ELEMENTS];
 /* Block Sizes */
 ARR_DESC_DECLARE( statistics_block_sizes );
 
+/* Window Lengths of the Moving Statistics */
+ARR_DESC_DECLARE( statistics_window_lens );
+
 /* Float Inputs */
 ARR_DESC_DECLARE( statistics_zeros );
 ARR_DESC_DECLARE( statistics_f_2 );
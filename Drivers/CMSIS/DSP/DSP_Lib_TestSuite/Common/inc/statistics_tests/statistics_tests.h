@@ -7,6 +7,7 @@
 JTEST_DECLARE_GROUP( max_tests );
 JTEST_DECLARE_GROUP( mean_tests );
 JTEST_DECLARE_GROUP( min_tests );
+JTEST_DECLARE_GROUP( moving_stats_tests );
 JTEST_DECLARE_GROUP( power_tests );
 JTEST_DECLARE_GROUP( rms_tests );
 JTEST_DECLARE_GROUP( std_tests );
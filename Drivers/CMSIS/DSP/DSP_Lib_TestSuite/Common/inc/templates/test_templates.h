@@ -137,6 +137,31 @@
         }                                                           \
     } while (0)                                                      \
 
+/**
+ *  Assert that the largest absolute difference between the reference and test
+ *  elements is at most threshold. The differences are computed in diff_type,
+ *  so that a narrower type wraps around (for angles). The largest difference
+ *  is also stored into max_error, which must be initialized by the caller.
+ */
+#define TEST_ASSERT_MAX_ERROR(ref_ptr, tst_ptr, block_size, diff_type,  \
+                              threshold, max_error)                     \
+    do                                                                  \
+    {                                                                   \
+        uint32_t __i;                                                   \
+        int64_t __err;                                                  \
+        for (__i = 0; __i < (block_size); __i++)                        \
+        {                                                               \
+            __err = (diff_type) ((int64_t) (tst_ptr)[__i] - (ref_ptr)[__i]); \
+            __err = (__err < 0) ? -__err : __err;                       \
+            (max_error) = (__err > (max_error)) ? __err : (max_error);  \
+        }                                                               \
+        if ((max_error) > (threshold))                                  \
+        {                                                               \
+            JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) (max_error));  \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+    } while (0)
+
 /**
  *  Compare test and reference elements by converting to float and
  *  calculating an SNR.
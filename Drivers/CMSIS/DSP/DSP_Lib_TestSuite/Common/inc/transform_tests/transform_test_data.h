@@ -39,6 +39,7 @@ ARR_DESC_DECLARE( transform_radix4_fftlens );
 ARR_DESC_DECLARE( transform_rfft_fftlens );
 ARR_DESC_DECLARE( transform_rfft_fast_fftlens );
 ARR_DESC_DECLARE( transform_dct_fftlens );
+ARR_DESC_DECLARE( transform_goertzel_blocklens );
 
 /* CFFT Structs */
 ARR_DESC_DECLARE( transform_cfft_f32_structs );
@@ -6,7 +6,9 @@
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP( cfft_tests );
 JTEST_DECLARE_GROUP( cfft_family_tests );
+JTEST_DECLARE_GROUP( cfft_bfp_tests );
 JTEST_DECLARE_GROUP( dct4_tests );
+JTEST_DECLARE_GROUP( goertzel_tests );
 JTEST_DECLARE_GROUP( rfft_tests );
 JTEST_DECLARE_GROUP( rfft_fast_tests );
 
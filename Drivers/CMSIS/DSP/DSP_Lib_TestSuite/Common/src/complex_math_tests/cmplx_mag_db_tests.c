@@ -0,0 +1,103 @@
+#include "jtest.h"
+#include "complex_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "complex_math_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define CMPLX_MAG_DB_BLOCK_LEN 256
+#define CMPLX_MAG_DB_PASSES    64
+
+/* Maximum errors in LSB of the output format, as documented */
+#define CMPLX_MAG_DB_MAX_ERROR_q31 1
+#define CMPLX_MAG_DB_MAX_ERROR_q15 1
+
+static q31_t cmplx_mag_db_input[2 * CMPLX_MAG_DB_BLOCK_LEN];
+static q31_t cmplx_mag_db_output_fut[CMPLX_MAG_DB_BLOCK_LEN];
+static q31_t cmplx_mag_db_output_ref[CMPLX_MAG_DB_BLOCK_LEN];
+
+/*
+  Builds block pass of complex samples. The real and imaginary parts are
+  scrambled values of the type with magnitudes down to one LSB, and the first
+  sample of the first block is zero.
+*/
+#define CMPLX_MAG_DB_DEFINE_FILL(suffix, type, bits)                    \
+    static void cmplx_mag_db_fill_##suffix(uint32_t pass)               \
+    {                                                                   \
+        type *pIn = (type *) cmplx_mag_db_input;                        \
+        uint32_t i, k;                                                  \
+                                                                        \
+        for (i = 0; i < CMPLX_MAG_DB_BLOCK_LEN; i++)                    \
+        {                                                               \
+            k = pass * CMPLX_MAG_DB_BLOCK_LEN + i;                      \
+            pIn[2 * i] = (type) ((type) (k * 2654435761U)               \
+                                 >> ((k * 7) % bits));                  \
+            pIn[2 * i + 1] = (type) ((type) (k * 40503U * 40503U)       \
+                                     >> ((k * 3) % bits));              \
+        }                                                               \
+    }
+
+CMPLX_MAG_DB_DEFINE_FILL( q31, q31_t, 32 );
+CMPLX_MAG_DB_DEFINE_FILL( q15, q15_t, 16 );
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare the magnitudes in dB with the reference on every block. The cycles of
+  the last block are counted for both. Arguments are: function suffix (q15/q31)
+  and type (q15_t/q31_t)
+*/
+#define CMPLX_MAG_DB_DEFINE_TEST(suffix, type)                          \
+    JTEST_DEFINE_TEST(arm_cmplx_mag_db_##suffix##_test,                 \
+                      arm_cmplx_mag_db_##suffix)                        \
+    {                                                                   \
+        type *pIn = (type *) cmplx_mag_db_input;                        \
+        type *pFut = (type *) cmplx_mag_db_output_fut;                  \
+        type *pRef = (type *) cmplx_mag_db_output_ref;                  \
+        int64_t max_error = 0;                                          \
+        uint32_t pass;                                                  \
+                                                                        \
+        for (pass = 0; pass < CMPLX_MAG_DB_PASSES; pass++)              \
+        {                                                               \
+            cmplx_mag_db_fill_##suffix(pass);                           \
+            arm_cmplx_mag_db_##suffix(pIn, pFut, CMPLX_MAG_DB_BLOCK_LEN); \
+            ref_cmplx_mag_db_##suffix(pIn, pRef, CMPLX_MAG_DB_BLOCK_LEN); \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(pRef, pFut, CMPLX_MAG_DB_BLOCK_LEN,   \
+                                  int64_t,                              \
+                                  CMPLX_MAG_DB_MAX_ERROR_##suffix,      \
+                                  max_error);                           \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error);        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_cmplx_mag_db_##suffix(pIn, pFut, CMPLX_MAG_DB_BLOCK_LEN)); \
+        JTEST_COUNT_CYCLES(                                             \
+            ref_cmplx_mag_db_##suffix(pIn, pRef, CMPLX_MAG_DB_BLOCK_LEN)); \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+CMPLX_MAG_DB_DEFINE_TEST( q31, q31_t );
+CMPLX_MAG_DB_DEFINE_TEST( q15, q15_t );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( cmplx_mag_db_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_cmplx_mag_db_q31_test );
+    JTEST_TEST_CALL( arm_cmplx_mag_db_q15_test );
+}
@@ -9,5 +9,6 @@ JTEST_DEFINE_GROUP( controller_tests )
     JTEST_GROUP_CALL( pid_reset_tests );
     JTEST_GROUP_CALL( pid_tests );
     JTEST_GROUP_CALL( sin_cos_tests );
+    JTEST_GROUP_CALL( kalman_tests );
     return;
 }
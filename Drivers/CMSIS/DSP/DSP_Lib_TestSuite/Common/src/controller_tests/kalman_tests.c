@@ -0,0 +1,276 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define KALMAN_STEPS     1000
+#define KALMAN_FRAC_BITS 24
+#define KALMAN_DT        0.125
+
+/* Maximum errors in LSB of the estimate and of the covariance */
+#define KALMAN_STATE_MAX_ERROR 512
+#define KALMAN_COV_MAX_ERROR   64
+
+static q31_t kalman_f[6 * 6];
+static q31_t kalman_q[6 * 6];
+static q31_t kalman_h[6 * 6];
+static q31_t kalman_r[6 * 6];
+static q31_t kalman_state[6];
+static q31_t kalman_cov[6 * 6];
+static q31_t kalman_scratch[3 * 6 * 6 + 6];
+static q31_t kalman_meas[6];
+static float64_t kalman_state_f64[6];
+static float64_t kalman_cov_f64[6 * 6];
+static q31_t kalman_output_ref[6 * 6];
+
+static q31_t kalman_to_q31(float64_t x)
+{
+    return (q31_t) floor(ldexp(x, KALMAN_FRAC_BITS) + 0.5);
+}
+
+/*
+  Builds the model. With 3 states, a constant acceleration model measuring the
+  position. With 2 * m states, a constant velocity model along m axes, states
+  being the positions then the velocities, measuring the positions. The process
+  noise is a white acceleration of unit variance, the measurement noise has a
+  standard deviation of 0.5, and the initial covariance is 4 * I.
+*/
+static void kalman_build_model(uint32_t n, uint32_t m)
+{
+    float64_t dt = KALMAN_DT;
+    float64_t g[3] = { dt * dt / 2, dt, 1 };
+    uint32_t i, j;
+
+    memset(kalman_f, 0, sizeof(kalman_f));
+    memset(kalman_q, 0, sizeof(kalman_q));
+    memset(kalman_h, 0, sizeof(kalman_h));
+    memset(kalman_r, 0, sizeof(kalman_r));
+    memset(kalman_cov, 0, sizeof(kalman_cov));
+    memset(kalman_state, 0, sizeof(kalman_state));
+
+    for (i = 0; i < n; i++)
+    {
+        kalman_f[i * n + i] = kalman_to_q31(1.0);
+        kalman_cov[i * n + i] = kalman_to_q31(4.0);
+    }
+
+    if (n == 3)
+    {
+        kalman_f[1] = kalman_to_q31(dt);
+        kalman_f[2] = kalman_to_q31(dt * dt / 2);
+        kalman_f[5] = kalman_to_q31(dt);
+
+        for (i = 0; i < 3; i++)
+        {
+            for (j = 0; j < 3; j++)
+            {
+                kalman_q[i * n + j] = kalman_to_q31(g[i] * g[j]);
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < m; i++)
+        {
+            kalman_f[i * n + m + i] = kalman_to_q31(dt);
+            kalman_q[i * n + i] = kalman_to_q31(g[0] * g[0]);
+            kalman_q[i * n + m + i] = kalman_to_q31(g[0] * g[1]);
+            kalman_q[(m + i) * n + i] = kalman_to_q31(g[0] * g[1]);
+            kalman_q[(m + i) * n + m + i] = kalman_to_q31(g[1] * g[1]);
+        }
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        kalman_h[i * n + i] = kalman_to_q31(1.0);
+        kalman_r[i * n + i] = kalman_to_q31(0.25);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        kalman_state_f64[i] = 0;
+
+        for (j = 0; j < n; j++)
+        {
+            kalman_cov_f64[i * n + j] = ldexp(kalman_cov[i * n + j],
+                                              -KALMAN_FRAC_BITS);
+        }
+    }
+}
+
+/*
+  Builds the measurements of a step: sine waves of different frequencies and
+  amplitudes up to 20, with a scrambled noise of up to 0.5.
+*/
+static void kalman_build_meas(uint32_t m, uint32_t step)
+{
+    uint32_t i;
+    uint32_t noise;
+
+    for (i = 0; i < m; i++)
+    {
+        noise = (step * 3 + i) * 2654435761U;
+        kalman_meas[i] = kalman_to_q31(
+            (20.0 - 5.0 * i) * sin(step * KALMAN_DT * (0.3 + 0.2 * i)) +
+            ((float64_t) (noise >> 8) / 16777216.0 - 0.5));
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Kalman filter test template. The filter runs for KALMAN_STEPS steps, and
+  after each step the estimate and the covariance are compared with a double
+  precision filter. The covariance must stay exactly symmetric with a positive
+  diagonal. Arguments are: number of states and number of measurements
+*/
+#define KALMAN_DEFINE_TEST(n, m)                                        \
+    JTEST_DEFINE_TEST(arm_kalman_##n##_##m##_q31_test,                  \
+                      arm_kalman_update_q31)                            \
+    {                                                                   \
+        arm_kalman_instance_q31 kalman_inst;                            \
+        int64_t max_state_error = 0;                                    \
+        int64_t max_cov_error = 0;                                      \
+        uint32_t step;                                                  \
+        uint32_t i, j;                                                  \
+                                                                        \
+        kalman_build_model(n, m);                                       \
+                                                                        \
+        if (arm_kalman_init_q31(&kalman_inst, n, m, KALMAN_FRAC_BITS,   \
+                                kalman_f, kalman_q, kalman_h, kalman_r, \
+                                kalman_state, kalman_cov,               \
+                                kalman_scratch)                         \
+            != ARM_MATH_SUCCESS)                                        \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("States: %d\n"                                  \
+                        "Measurements: %d\n"                            \
+                        "Steps: %d\n",                                  \
+                        (int) n, (int) m, (int) KALMAN_STEPS);          \
+                                                                        \
+        for (step = 0; step < KALMAN_STEPS; step++)                     \
+        {                                                               \
+            kalman_build_meas(m, step);                                 \
+                                                                        \
+            arm_kalman_predict_q31(&kalman_inst, NULL);                 \
+            ref_kalman_predict_q31(&kalman_inst, NULL,                  \
+                                   kalman_state_f64, kalman_cov_f64);   \
+            TEST_ASSERT_EQUAL(                                          \
+                arm_kalman_update_q31(&kalman_inst, kalman_meas),       \
+                ARM_MATH_SUCCESS);                                      \
+            ref_kalman_update_q31(&kalman_inst, kalman_meas,            \
+                                  kalman_state_f64, kalman_cov_f64);    \
+                                                                        \
+            for (i = 0; i < n; i++)                                     \
+            {                                                           \
+                kalman_output_ref[i] = kalman_to_q31(kalman_state_f64[i]); \
+            }                                                           \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(kalman_output_ref, kalman_state, n,   \
+                                  int64_t, KALMAN_STATE_MAX_ERROR,      \
+                                  max_state_error);                     \
+                                                                        \
+            for (i = 0; i < n * n; i++)                                 \
+            {                                                           \
+                kalman_output_ref[i] = kalman_to_q31(kalman_cov_f64[i]); \
+            }                                                           \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(kalman_output_ref, kalman_cov, n * n, \
+                                  int64_t, KALMAN_COV_MAX_ERROR,        \
+                                  max_cov_error);                       \
+                                                                        \
+            for (i = 0; i < n; i++)                                     \
+            {                                                           \
+                if (kalman_cov[i * n + i] <= 0)                         \
+                {                                                       \
+                    return JTEST_TEST_FAILED;                           \
+                }                                                       \
+                                                                        \
+                for (j = 0; j < i; j++)                                 \
+                {                                                       \
+                    TEST_ASSERT_EQUAL(kalman_cov[i * n + j],            \
+                                      kalman_cov[j * n + i]);           \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max State Error: %d LSB\n"                     \
+                        "Max Covariance Error: %d LSB\n",               \
+                        (int) max_state_error, (int) max_cov_error);    \
+        JTEST_COUNT_CYCLES(arm_kalman_predict_q31(&kalman_inst, NULL)); \
+        JTEST_COUNT_CYCLES(arm_kalman_update_q31(&kalman_inst,          \
+                                                 kalman_meas));         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+KALMAN_DEFINE_TEST( 3, 1 );
+KALMAN_DEFINE_TEST( 4, 2 );
+KALMAN_DEFINE_TEST( 6, 3 );
+
+/*
+  A degenerate innovation covariance must be reported, without changing the
+  estimate. Unsupported sizes must be rejected.
+*/
+JTEST_DEFINE_TEST(arm_kalman_singular_q31_test, arm_kalman_update_q31)
+{
+    arm_kalman_instance_q31 kalman_inst;
+    q31_t state[4];
+
+    kalman_build_model(4, 2);
+    memset(kalman_cov, 0, sizeof(kalman_cov));
+    memset(kalman_r, 0, sizeof(kalman_r));
+    kalman_state[0] = kalman_to_q31(1.0);
+    kalman_meas[0] = kalman_to_q31(2.0);
+    kalman_meas[1] = kalman_to_q31(3.0);
+    memcpy(state, kalman_state, sizeof(state));
+
+    TEST_ASSERT_EQUAL(
+        arm_kalman_init_q31(&kalman_inst, 5, 2, KALMAN_FRAC_BITS,
+                            kalman_f, kalman_q, kalman_h, kalman_r,
+                            kalman_state, kalman_cov, kalman_scratch),
+        ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(
+        arm_kalman_init_q31(&kalman_inst, 4, 5, KALMAN_FRAC_BITS,
+                            kalman_f, kalman_q, kalman_h, kalman_r,
+                            kalman_state, kalman_cov, kalman_scratch),
+        ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(
+        arm_kalman_init_q31(&kalman_inst, 4, 2, KALMAN_FRAC_BITS,
+                            kalman_f, kalman_q, kalman_h, kalman_r,
+                            kalman_state, kalman_cov, kalman_scratch),
+        ARM_MATH_SUCCESS);
+
+    TEST_ASSERT_EQUAL(arm_kalman_update_q31(&kalman_inst, kalman_meas),
+                      ARM_MATH_SINGULAR);
+    TEST_ASSERT_BUFFERS_EQUAL(state, kalman_state, sizeof(state));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( kalman_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_kalman_3_1_q31_test );
+    JTEST_TEST_CALL( arm_kalman_4_2_q31_test );
+    JTEST_TEST_CALL( arm_kalman_6_3_q31_test );
+    JTEST_TEST_CALL( arm_kalman_singular_q31_test );
+}
@@ -16,6 +16,66 @@ SIN_COS_TEST_TEMPLATE_ELT1( f32, float32_t, cos );
 SIN_COS_TEST_TEMPLATE_ELT1( q31, q31_t, cos );
 SIN_COS_TEST_TEMPLATE_ELT1( q15, q15_t, cos );
 
+/*--------------------------------------------------------------------------------*/
+/* Vector Function Inputs */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Fill the input buffers with block pass of the Q15 inputs. fast_math_input_a
+  enumerates every 16 bit value over the passes, fast_math_input_b is a
+  scrambled second coordinate with magnitudes down to one LSB.
+*/
+static void fast_math_fill_inputs_q15( uint32_t pass )
+{
+    q15_t *pA = ( q15_t * ) fast_math_input_a;
+    q15_t *pB = ( q15_t * ) fast_math_input_b;
+    uint32_t i, k;
+
+    for( i = 0; i < FAST_MATH_MAX_LEN; i++ )
+    {
+        k = pass * FAST_MATH_MAX_LEN + i;
+        pA[i] = ( q15_t ) k;
+        pB[i] = ( q15_t ) ( ( q15_t ) ( k * 40503U ) >> ( k % 16 ) );
+    }
+}
+
+/*
+  Fill the input buffers with block pass of the Q31 inputs. The test inputs are
+  shifted so that the blocks cover the full exponent range. fast_math_input_a
+  is positive in the first half of the passes and fast_math_input_b is
+  negative for half of the samples.
+*/
+static void fast_math_fill_inputs_q31( uint32_t pass )
+{
+    q31_t *pA = ( q31_t * ) fast_math_input_a;
+    q31_t *pB = ( q31_t * ) fast_math_input_b;
+    q31_t a, b;
+    uint32_t i;
+
+    for( i = 0; i < FAST_MATH_MAX_LEN; i++ )
+    {
+        a = fast_math_q31_inputs[i] >> ( ( i + 5 * pass ) % 31 );
+        b = fast_math_q31_inputs[( 7 * i + 3 ) % FAST_MATH_MAX_LEN] >> ( ( 3 * i + pass ) % 31 );
+        pA[i] = ( ( pass & 4 ) && ( i & 1 ) ) ? -a : a;
+        pB[i] = ( i & 2 ) ? -b : b;
+    }
+}
+
+ATAN2_TEST_TEMPLATE( q31 );
+ATAN2_TEST_TEMPLATE( q15 );
+
+LOG_TEST_TEMPLATE( q31, log2 );
+LOG_TEST_TEMPLATE( q15, log2 );
+
+LOG_TEST_TEMPLATE( q31, ln );
+LOG_TEST_TEMPLATE( q15, ln );
+
+EXP2_TEST_TEMPLATE( q31, fast_math_input_b );
+EXP2_TEST_TEMPLATE( q15, fast_math_input_a );
+
+RSQRT_TEST_TEMPLATE( q31 );
+RSQRT_TEST_TEMPLATE( q15 );
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +95,19 @@ JTEST_DEFINE_GROUP( fast_math_tests )
     JTEST_TEST_CALL( arm_cos_f32_test );
     JTEST_TEST_CALL( arm_cos_q31_test );
     JTEST_TEST_CALL( arm_cos_q15_test );
+
+    JTEST_TEST_CALL( arm_atan2_q31_test );
+    JTEST_TEST_CALL( arm_atan2_q15_test );
+
+    JTEST_TEST_CALL( arm_log2_q31_test );
+    JTEST_TEST_CALL( arm_log2_q15_test );
+
+    JTEST_TEST_CALL( arm_ln_q31_test );
+    JTEST_TEST_CALL( arm_ln_q15_test );
+
+    JTEST_TEST_CALL( arm_exp2_q31_test );
+    JTEST_TEST_CALL( arm_exp2_q15_test );
+
+    JTEST_TEST_CALL( arm_rsqrt_q31_test );
+    JTEST_TEST_CALL( arm_rsqrt_q15_test );
 }
@@ -8,6 +8,8 @@ float32_t fast_math_output_fut[FAST_MATH_MAX_LEN] = {0};
 float32_t fast_math_output_ref[FAST_MATH_MAX_LEN] = {0};
 float32_t fast_math_output_f32_fut[FAST_MATH_MAX_LEN] = {0};
 float32_t fast_math_output_f32_ref[FAST_MATH_MAX_LEN] = {0};
+float32_t fast_math_input_a[FAST_MATH_MAX_LEN] = {0};
+float32_t fast_math_input_b[FAST_MATH_MAX_LEN] = {0};
 
 const q31_t fast_math_q31_inputs[FAST_MATH_MAX_LEN] =
 {
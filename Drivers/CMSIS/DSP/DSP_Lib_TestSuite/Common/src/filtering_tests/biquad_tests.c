@@ -223,6 +223,72 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q15, df1,, q15_t );
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q31, df1, _fast, q31_t );
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST( q15, df1, _fast, q15_t );
 
+/*
+ * Bit exactness of the df1 q15 biquad against the reference. The q15
+ * coefficients are scaled down by each value of filtering_coeff_shifts so that
+ * both the 32-bit and the 64-bit accumulator paths of the Cortex-M0 kernel are
+ * run.
+ */
+JTEST_DEFINE_TEST( arm_biquad_cascade_df1_q15_bitexact_test,
+                   arm_biquad_cascade_df1_q15 )
+{
+    arm_biquad_casd_df1_inst_q15 biquad_inst_fut = { 0 };
+    arm_biquad_casd_df1_inst_q15 biquad_inst_ref = { 0 };
+    q15_t *coeffs = ( q15_t * ) filtering_scratch;
+    uint32_t i;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            numstages_idx, uint16_t, numStages, filtering_numstages
+            ,
+            TEMPLATE_DO_ARR_DESC(
+                shift_idx, uint8_t, coeffShift, filtering_coeff_shifts
+                ,
+                for( i = 0; i < 6U * numStages; i++ )
+                {
+                    coeffs[i] = filtering_coeffs_b_q15[i] >> coeffShift;
+                }
+
+                /* Display test parameter values */
+                JTEST_DUMP_STRF( "Block Size: %d\n"
+                                 "Number of Stages: %d\n"
+                                 "Coefficient Shift: %d\n",
+                                 ( int )blockSize,
+                                 ( int )numStages,
+                                 ( int )coeffShift );
+
+                /* Initialize the BIQUAD Instances */
+                arm_biquad_cascade_df1_init_q15(
+                    &biquad_inst_fut, numStages, coeffs,
+                    ( void * ) filtering_pState, 1 );
+
+                JTEST_COUNT_CYCLES(
+                    arm_biquad_cascade_df1_q15(
+                        &biquad_inst_fut,
+                        ( void * ) filtering_q15_inputs,
+                        ( void * ) filtering_output_fut,
+                        blockSize ) );
+
+                arm_biquad_cascade_df1_init_q15(
+                    &biquad_inst_ref, numStages, coeffs,
+                    ( void * ) filtering_pState, 1 );
+
+                ref_biquad_cascade_df1_q15(
+                    &biquad_inst_ref,
+                    ( void * ) filtering_q15_inputs,
+                    ( void * ) filtering_output_ref,
+                    blockSize );
+
+                TEST_ASSERT_BUFFERS_EQUAL(
+                    filtering_output_ref,
+                    filtering_output_fut,
+                    blockSize * sizeof( q15_t ) ) ) ) );
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -241,4 +307,5 @@ JTEST_DEFINE_GROUP( biquad_tests )
     JTEST_TEST_CALL( arm_biquad_cascade_df1_fast_q31_test );
     JTEST_TEST_CALL( arm_biquad_cascade_df1_fast_q15_test );
     JTEST_TEST_CALL( arm_biquad_cas_df1_32x64_q31_test );
+    JTEST_TEST_CALL( arm_biquad_cascade_df1_q15_bitexact_test );
 }
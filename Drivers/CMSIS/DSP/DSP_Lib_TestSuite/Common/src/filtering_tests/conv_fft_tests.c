@@ -0,0 +1,351 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define CONV_FFT_LEN      1000
+#define CONV_FFT_MAX_FFT  512
+#define CONV_FFT_MAX_TAPS 256
+
+/* Position of the template in the input of the matched filter test */
+#define CONV_FFT_MATCH_POS 600
+
+/*
+  FFT lengths, numbers of taps and minimum SNR of the FFT convolution. The Q15
+  FFTs scale down their data at each stage, so that the SNR of the Q15
+  convolution decreases with the FFT length.
+*/
+static const uint16_t conv_fft_lens[]     = {  32,  64, 128, 256, 512 };
+static const uint16_t conv_fft_numtaps[]  = {   1,  16,  33,  64, 256 };
+static const float32_t conv_fft_snr_q31[] = { 110, 110, 110, 110, 110 };
+static const float32_t conv_fft_snr_q15[] = {  40,  35,  35,  25,  25 };
+
+#define CONV_FFT_CASES (sizeof(conv_fft_lens) / sizeof(conv_fft_lens[0]))
+
+/* Sizes of the successive calls, cycled; 0 stands for S->blockSize */
+static const uint16_t conv_fft_chunks[] = { 1, 7, 0, 100, 333 };
+
+#define CONV_FFT_CHUNKS (sizeof(conv_fft_chunks) / sizeof(conv_fft_chunks[0]))
+
+static q31_t conv_fft_inputs_q31[CONV_FFT_LEN];
+static q15_t conv_fft_inputs_q15[CONV_FFT_LEN];
+static q31_t conv_fft_coeffs_q31[CONV_FFT_MAX_TAPS];
+static q15_t conv_fft_coeffs_q15[CONV_FFT_MAX_TAPS];
+static q31_t conv_fft_freq_q31[CONV_FFT_MAX_FFT + 2];
+static q15_t conv_fft_freq_q15[CONV_FFT_MAX_FFT + 2];
+static q31_t conv_fft_state_q31[CONV_FFT_MAX_FFT];
+static q15_t conv_fft_state_q15[CONV_FFT_MAX_FFT];
+static q31_t conv_fft_scratch_q31[3 * CONV_FFT_MAX_FFT];
+static q15_t conv_fft_scratch_q15[3 * CONV_FFT_MAX_FFT];
+static q31_t conv_fft_output_fut_q31[CONV_FFT_LEN];
+static q15_t conv_fft_output_fut_q15[CONV_FFT_LEN];
+static q31_t conv_fft_output_ref_q31[CONV_FFT_LEN];
+static q15_t conv_fft_output_ref_q15[CONV_FFT_LEN];
+static float32_t conv_fft_output_f32_fut[CONV_FFT_LEN];
+static float32_t conv_fft_output_f32_ref[CONV_FFT_LEN];
+
+/*
+  Builds the taps, a scrambled sequence decaying over numTaps, and the input,
+  a scrambled noise modulated by a slow sine of amplitude 0.25 so that the
+  level of the blocks changes. With match set, the taps divided by 8, so that
+  the correlation does not saturate, are also added to a weaker noise at
+  CONV_FFT_MATCH_POS.
+*/
+static void conv_fft_build_data(uint32_t numTaps, uint32_t match)
+{
+    uint32_t noise;
+    float64_t x;
+    uint32_t i;
+
+    for (i = 0; i < numTaps; i++)
+    {
+        noise = (i + 1) * 2654435761U;
+        x = ((float64_t) (noise >> 8) / 16777216.0 - 0.5) *
+            exp(-2.0 * i / numTaps);
+        conv_fft_coeffs_q31[i] = (q31_t) (x * 2147483648.0);
+        conv_fft_coeffs_q15[i] = (q15_t) (x * 32768.0);
+    }
+
+    for (i = 0; i < CONV_FFT_LEN; i++)
+    {
+        noise = (i + 7) * 2246822519U;
+        x = ((float64_t) (noise >> 8) / 16777216.0 - 0.5) *
+            0.5 * sin(0.01 * i);
+
+        if (match)
+        {
+            x *= 0.25;
+
+            if ((i >= CONV_FFT_MATCH_POS) &&
+                (i < CONV_FFT_MATCH_POS + numTaps))
+            {
+                x += ldexp(conv_fft_coeffs_q15[i - CONV_FFT_MATCH_POS], -18);
+            }
+        }
+
+        conv_fft_inputs_q31[i] = (q31_t) (x * 2147483648.0);
+        conv_fft_inputs_q15[i] = (q15_t) (x * 32768.0);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Streams the input in calls of the sizes in conv_fft_chunks into the instance
+  conv_fft_inst_fut, in place when in_place is set.
+*/
+#define CONV_FFT_STREAM(suffix, in_place)                                   \
+    do                                                                      \
+    {                                                                       \
+        uint32_t __pos = 0;                                                 \
+        uint32_t __call = 0;                                                \
+        uint32_t __chunk;                                                   \
+                                                                            \
+        if (in_place)                                                       \
+        {                                                                   \
+            memcpy(conv_fft_output_fut_##suffix, conv_fft_inputs_##suffix,  \
+                   sizeof(conv_fft_output_fut_##suffix));                   \
+        }                                                                   \
+                                                                            \
+        while (__pos < CONV_FFT_LEN)                                        \
+        {                                                                   \
+            __chunk = conv_fft_chunks[__call++ % CONV_FFT_CHUNKS];          \
+            __chunk = (__chunk == 0) ? conv_fft_inst_fut.blockSize : __chunk; \
+            __chunk = (__chunk > CONV_FFT_LEN - __pos) ?                    \
+                CONV_FFT_LEN - __pos : __chunk;                             \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_conv_fft_##suffix(                                      \
+                    &conv_fft_inst_fut,                                     \
+                    (in_place) ? conv_fft_output_fut_##suffix + __pos :     \
+                    conv_fft_inputs_##suffix + __pos,                       \
+                    conv_fft_output_fut_##suffix + __pos,                   \
+                    __chunk));                                              \
+                                                                            \
+            __pos += __chunk;                                               \
+        }                                                                   \
+    } while (0)
+
+/*
+  Convolution and correlation test template. For each case, the input is
+  streamed with the direct convolution, which must match the reference
+  exactly, then with the FFT, which must match it within the SNR of the
+  case, in place for the correlation. Arguments are: function name (conv or
+  correlate), type suffix, and in_place.
+*/
+#define CONV_FFT_DEFINE_TEST(fn, suffix, in_place)                          \
+    JTEST_DEFINE_TEST(arm_##fn##_fft_##suffix##_test,                       \
+                      arm_conv_fft_##suffix)                                \
+    {                                                                       \
+        arm_conv_fft_instance_##suffix conv_fft_inst_fut;                   \
+        uint32_t c;                                                         \
+                                                                            \
+        for (c = 0; c < CONV_FFT_CASES; c++)                                \
+        {                                                                   \
+            conv_fft_build_data(conv_fft_numtaps[c], 0);                    \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("FFT Length: %d\n"                              \
+                            "Number of Taps: %d\n",                         \
+                            (int) conv_fft_lens[c],                         \
+                            (int) conv_fft_numtaps[c]);                     \
+                                                                            \
+            if (arm_##fn##_fft_init_##suffix(&conv_fft_inst_fut,            \
+                                             conv_fft_lens[c],              \
+                                             conv_fft_numtaps[c],           \
+                                             conv_fft_coeffs_##suffix,      \
+                                             conv_fft_freq_##suffix,        \
+                                             conv_fft_state_##suffix,       \
+                                             conv_fft_scratch_##suffix)     \
+                != ARM_MATH_SUCCESS)                                        \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            ref_conv_fft_##suffix(&conv_fft_inst_fut,                       \
+                                  conv_fft_inputs_##suffix,                 \
+                                  conv_fft_output_ref_##suffix,             \
+                                  CONV_FFT_LEN);                            \
+                                                                            \
+            conv_fft_inst_fut.useFft = 0;                                   \
+            CONV_FFT_STREAM(suffix, in_place);                              \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(conv_fft_output_ref_##suffix,         \
+                                      conv_fft_output_fut_##suffix,         \
+                                      sizeof(conv_fft_output_fut_##suffix)); \
+                                                                            \
+            /* The state is cleared by a new initialization */              \
+            arm_##fn##_fft_init_##suffix(&conv_fft_inst_fut,                \
+                                         conv_fft_lens[c],                  \
+                                         conv_fft_numtaps[c],               \
+                                         conv_fft_coeffs_##suffix,          \
+                                         conv_fft_freq_##suffix,            \
+                                         conv_fft_state_##suffix,           \
+                                         conv_fft_scratch_##suffix);        \
+            conv_fft_inst_fut.useFft = 1;                                   \
+            CONV_FFT_STREAM(suffix, in_place);                              \
+                                                                            \
+            TEST_CONVERT_AND_ASSERT_SNR(conv_fft_output_f32_ref,            \
+                                        conv_fft_output_ref_##suffix,       \
+                                        conv_fft_output_f32_fut,            \
+                                        conv_fft_output_fut_##suffix,       \
+                                        CONV_FFT_LEN, suffix,               \
+                                        conv_fft_snr_##suffix[c]);          \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CONV_FFT_DEFINE_TEST(conv,      q31, 0);
+CONV_FFT_DEFINE_TEST(conv,      q15, 0);
+CONV_FFT_DEFINE_TEST(correlate, q31, 1);
+CONV_FFT_DEFINE_TEST(correlate, q15, 1);
+
+/*
+  Matched filter test template. The correlation of an input containing the
+  template must peak when the last sample of the template is pushed, with the
+  direct correlation and with the FFT.
+*/
+#define CONV_FFT_MATCH_DEFINE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_correlate_fft_match_##suffix##_test,              \
+                      arm_conv_fft_##suffix)                                \
+    {                                                                       \
+        arm_conv_fft_instance_##suffix conv_fft_inst_fut;                   \
+        uint32_t useFft;                                                    \
+        uint32_t index;                                                     \
+        uint32_t i;                                                         \
+                                                                            \
+        conv_fft_build_data(CONV_FFT_MAX_TAPS, 1);                          \
+                                                                            \
+        for (useFft = 0; useFft < 2; useFft++)                              \
+        {                                                                   \
+            arm_correlate_fft_init_##suffix(&conv_fft_inst_fut,             \
+                                            CONV_FFT_MAX_FFT,               \
+                                            CONV_FFT_MAX_TAPS,              \
+                                            conv_fft_coeffs_##suffix,       \
+                                            conv_fft_freq_##suffix,         \
+                                            conv_fft_state_##suffix,        \
+                                            conv_fft_scratch_##suffix);     \
+            conv_fft_inst_fut.useFft = useFft;                              \
+            CONV_FFT_STREAM(suffix, 0);                                     \
+                                                                            \
+            for (i = 1, index = 0; i < CONV_FFT_LEN; i++)                   \
+            {                                                               \
+                if (conv_fft_output_fut_##suffix[i] >                       \
+                    conv_fft_output_fut_##suffix[index])                    \
+                {                                                           \
+                    index = i;                                              \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            TEST_ASSERT_EQUAL(index,                                        \
+                              CONV_FFT_MATCH_POS + CONV_FFT_MAX_TAPS - 1);  \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CONV_FFT_MATCH_DEFINE_TEST(q31);
+CONV_FFT_MATCH_DEFINE_TEST(q15);
+
+/*
+  Initialization test template. The initialization must reject unsupported
+  FFT lengths and numbers of taps, and select the FFT from the crossover, or
+  never when the crossover is 0.
+*/
+#define CONV_FFT_INIT_DEFINE_TEST(suffix, SUFFIX)                           \
+    JTEST_DEFINE_TEST(arm_conv_fft_init_##suffix##_test,                    \
+                      arm_conv_fft_init_##suffix)                           \
+    {                                                                       \
+        arm_conv_fft_instance_##suffix conv_fft_inst_fut;                   \
+        uint16_t crossover = ARM_CONV_FFT_CROSSOVER_##SUFFIX;                \
+                                                                            \
+        TEST_ASSERT_EQUAL(arm_conv_fft_init_##suffix(                       \
+                              &conv_fft_inst_fut, 100, 16,                  \
+                              conv_fft_coeffs_##suffix,                     \
+                              conv_fft_freq_##suffix,                       \
+                              conv_fft_state_##suffix,                      \
+                              conv_fft_scratch_##suffix),                   \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_conv_fft_init_##suffix(                       \
+                              &conv_fft_inst_fut, 64, 0,                    \
+                              conv_fft_coeffs_##suffix,                     \
+                              conv_fft_freq_##suffix,                       \
+                              conv_fft_state_##suffix,                      \
+                              conv_fft_scratch_##suffix),                   \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_correlate_fft_init_##suffix(                  \
+                              &conv_fft_inst_fut, 64, 65,                   \
+                              conv_fft_coeffs_##suffix,                     \
+                              conv_fft_freq_##suffix,                       \
+                              conv_fft_state_##suffix,                      \
+                              conv_fft_scratch_##suffix),                   \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+                                                                            \
+        if (crossover == 0U)                                                \
+        {                                                                   \
+            /* The FFT is only selected on request */                       \
+            TEST_ASSERT_EQUAL(arm_conv_fft_init_##suffix(                   \
+                                  &conv_fft_inst_fut, 512, 256,             \
+                                  conv_fft_coeffs_##suffix,                 \
+                                  conv_fft_freq_##suffix,                   \
+                                  conv_fft_state_##suffix,                  \
+                                  conv_fft_scratch_##suffix),               \
+                              ARM_MATH_SUCCESS);                            \
+            TEST_ASSERT_EQUAL(conv_fft_inst_fut.useFft, 0);                 \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            TEST_ASSERT_EQUAL(arm_conv_fft_init_##suffix(                   \
+                                  &conv_fft_inst_fut, 512,                  \
+                                  crossover - 1,                            \
+                                  conv_fft_coeffs_##suffix,                 \
+                                  conv_fft_freq_##suffix,                   \
+                                  conv_fft_state_##suffix,                  \
+                                  conv_fft_scratch_##suffix),               \
+                              ARM_MATH_SUCCESS);                            \
+            TEST_ASSERT_EQUAL(conv_fft_inst_fut.useFft, 0);                 \
+            TEST_ASSERT_EQUAL(conv_fft_inst_fut.blockSize,                  \
+                              512 - crossover + 2);                         \
+                                                                            \
+            TEST_ASSERT_EQUAL(arm_conv_fft_init_##suffix(                   \
+                                  &conv_fft_inst_fut, 512,                  \
+                                  crossover,                                \
+                                  conv_fft_coeffs_##suffix,                 \
+                                  conv_fft_freq_##suffix,                   \
+                                  conv_fft_state_##suffix,                  \
+                                  conv_fft_scratch_##suffix),               \
+                              ARM_MATH_SUCCESS);                            \
+            TEST_ASSERT_EQUAL(conv_fft_inst_fut.useFft, 1);                 \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CONV_FFT_INIT_DEFINE_TEST(q31, Q31);
+CONV_FFT_INIT_DEFINE_TEST(q15, Q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(conv_fft_tests)
+{
+    JTEST_TEST_CALL(arm_conv_fft_q31_test);
+    JTEST_TEST_CALL(arm_conv_fft_q15_test);
+    JTEST_TEST_CALL(arm_correlate_fft_q31_test);
+    JTEST_TEST_CALL(arm_correlate_fft_q15_test);
+    JTEST_TEST_CALL(arm_correlate_fft_match_q31_test);
+    JTEST_TEST_CALL(arm_correlate_fft_match_q15_test);
+    JTEST_TEST_CALL(arm_conv_fft_init_q31_test);
+    JTEST_TEST_CALL(arm_conv_fft_init_q15_test);
+}
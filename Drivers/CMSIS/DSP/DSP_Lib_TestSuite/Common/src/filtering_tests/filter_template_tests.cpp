@@ -0,0 +1,357 @@
+extern "C"
+{
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+}
+#include "arm_math.hpp"         /* Templates under test */
+
+/*
+  The templates are compared with the C functions, which are the reference.
+  The unrolled kernels must match them bit for bit for the fixed-point types.
+  The cycle counts of the template and of the C function are displayed one
+  after the other.
+*/
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Windowed sinc lowpass filters, in time reversed order */
+
+static constexpr float32_t fir_template_coeffs8_f32[8] =
+{
+    -0.00691956f, 0.00000000f, 0.12964132f, 0.35714948f, 0.35714948f, 0.12964132f,
+    0.00000000f, -0.00691956f
+};
+
+static constexpr q31_t fir_template_coeffs8_q31[8] =
+{
+    -14859639, 0, 278402607, 766972672, 766972672, 278402607,
+    0, -14859639
+};
+
+static constexpr q15_t fir_template_coeffs8_q15[8] =
+{
+    -227, 0, 4248, 11703, 11703, 4248, 0, -227
+};
+
+static constexpr float32_t fir_template_coeffs30_f32[30] =
+{
+    -0.00103226f, -0.00203512f, 0.00000000f, 0.00457511f, 0.00431577f, -0.00639150f,
+    -0.01484937f, 0.00000000f, 0.02861595f, 0.02416160f, -0.03318476f, -0.07559254f,
+    0.00000000f, 0.19696072f, 0.37318668f, 0.37318668f, 0.19696072f, 0.00000000f,
+    -0.07559254f, -0.03318476f, 0.02416160f, 0.02861595f, 0.00000000f, -0.01484937f,
+    -0.00639150f, 0.00431577f, 0.00457511f, 0.00000000f, -0.00203512f, -0.00103226f
+};
+
+static constexpr q31_t fir_template_coeffs30_q31[30] =
+{
+    -2216770, -4370397, 0, 9824970, 9268035, -13725645,
+    -31888772, 0, 61452295, 51886636, -71263727, -162333742,
+    0, 422969919, 801412293, 801412293, 422969919, 0,
+    -162333742, -71263727, 51886636, 61452295, 0, -31888772,
+    -13725645, 9268035, 9824970, 0, -4370397, -2216770
+};
+
+static constexpr q15_t fir_template_coeffs30_q15[30] =
+{
+    -34, -67, 0, 150, 141, -209, -487, 0, 938, 792,
+    -1087, -2477, 0, 6454, 12229, 12229, 6454, 0, -2477, -1087,
+    792, 938, 0, -487, -209, 141, 150, 0, -67, -34
+};
+
+static constexpr float32_t fir_template_coeffs48_f32[48] =
+{
+    -0.00103057f, 0.00000000f, 0.00135657f, 0.00106327f, -0.00138371f, -0.00292900f,
+    0.00000000f, 0.00490125f, 0.00384978f, -0.00483451f, -0.00971794f, 0.00000000f,
+    0.01461981f, 0.01098552f, -0.01331914f, -0.02612851f, 0.00000000f, 0.03898188f,
+    0.02997512f, -0.03821965f, -0.08221808f, 0.00000000f, 0.19996016f, 0.37381133f,
+    0.37381133f, 0.19996016f, 0.00000000f, -0.08221808f, -0.03821965f, 0.02997512f,
+    0.03898188f, 0.00000000f, -0.02612851f, -0.01331914f, 0.01098552f, 0.01461981f,
+    0.00000000f, -0.00971794f, -0.00483451f, 0.00384978f, 0.00490125f, 0.00000000f,
+    -0.00292900f, -0.00138371f, 0.00106327f, 0.00135657f, 0.00000000f, -0.00103057f
+};
+
+static constexpr q31_t fir_template_coeffs48_q31[48] =
+{
+    -2213138, 0, 2913220, 2283361, -2971497, -6289975,
+    0, 10525359, 8267336, -10382033, -20869119, 0,
+    31395803, 23591229, -28602630, -56110543, 0, 83712944,
+    64371073, -82076070, -176561983, 0, 429411169, 802753711,
+    802753711, 429411169, 0, -176561983, -82076070, 64371073,
+    83712944, 0, -56110543, -28602630, 23591229, 31395803,
+    0, -20869119, -10382033, 8267336, 10525359, 0,
+    -6289975, -2971497, 2283361, 2913220, 0, -2213138
+};
+
+static constexpr q15_t fir_template_coeffs48_q15[48] =
+{
+    -34, 0, 44, 35, -45, -96, 0, 161, 126, -158,
+    -318, 0, 479, 360, -436, -856, 0, 1277, 982, -1252,
+    -2694, 0, 6552, 12249, 12249, 6552, 0, -2694, -1252, 982,
+    1277, 0, -856, -436, 360, 479, 0, -318, -158, 126,
+    161, 0, -96, -45, 35, 44, 0, -34
+};
+
+/* Lowpass Biquad stages, scaled by 1/2 for a post shift of 1 in fixed point */
+
+static constexpr float32_t biquad_template_coeffs2_f32[10] =
+{
+    0.01301183f, 0.02602366f, 0.01301183f, 1.60462195f, -0.65666926f,
+    0.05629143f, 0.11258285f, 0.05629143f, 1.22124469f, -0.44641040f
+};
+
+static constexpr q31_t biquad_template_coeffs2_q31[10] =
+{
+    13971344, 27942687, 13971344, 1722949696, -705093247,
+    60442459, 120884918, 60442459, 1311301499, -479329512
+};
+
+static constexpr q15_t biquad_template_coeffs2_q15[12] =
+{
+    213, 0, 426, 213, 26290, -10759,
+    922, 0, 1845, 922, 20009, -7314
+};
+
+static constexpr float32_t biquad_template_coeffs6_f32[30] =
+{
+    0.01301183f, 0.02602366f, 0.01301183f, 1.60462195f, -0.65666926f,
+    0.05629143f, 0.11258285f, 0.05629143f, 1.22124469f, -0.44641040f,
+    0.12236203f, 0.24472406f, 0.12236203f, 0.86047052f, -0.34991863f,
+    0.20832764f, 0.41665529f, 0.20832764f, 0.48547872f, -0.31878929f,
+    0.31260878f, 0.62521756f, 0.31260878f, 0.08377580f, -0.33421092f,
+    0.43349308f, 0.86698616f, 0.43349308f, -0.34533905f, -0.38863327f
+};
+
+static constexpr q31_t biquad_template_coeffs6_q31[30] =
+{
+    13971344, 27942687, 13971344, 1722949696, -705093247,
+    60442459, 120884918, 60442459, 1311301499, -479329512,
+    131385227, 262770455, 131385227, 923923188, -375722273,
+    223690104, 447380208, 223690104, 521278805, -342297396,
+    335661123, 671322245, 335661123, 89953577, -358856243,
+    465459651, 930919302, 465459651, -370804983, -417291797
+};
+
+static constexpr q15_t biquad_template_coeffs6_q15[36] =
+{
+    213, 0, 426, 213, 26290, -10759,
+    922, 0, 1845, 922, 20009, -7314,
+    2005, 0, 4010, 2005, 14098, -5733,
+    3413, 0, 6826, 3413, 7954, -5223,
+    5122, 0, 10244, 5122, 1373, -5476,
+    7102, 0, 14205, 7102, -5658, -6367
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare the outputs of the template and of the C function, bit for bit for
+  the fixed-point types and with the usual SNR threshold for float32_t.
+*/
+template <typename T> struct FilterTemplateCompare
+{
+    static JTEST_TEST_RET_t run( uint32_t length )
+    {
+        TEST_ASSERT_BUFFERS_EQUAL(
+            filtering_output_ref,
+            filtering_output_fut,
+            length * sizeof( T ) );
+
+        return JTEST_TEST_PASSED;
+    }
+};
+
+template <> struct FilterTemplateCompare<float32_t>
+{
+    static JTEST_TEST_RET_t run( uint32_t length )
+    {
+        FILTERING_SNR_COMPARE_INTERFACE(
+            length,
+            float32_t );
+
+        return JTEST_TEST_PASSED;
+    }
+};
+
+/*
+  Run the template and the C function on FILTERING_CIRC_CALLS blocks of
+  different sizes. filter is the template instance, c_filter and c_instance
+  the C function and its instance.
+*/
+#define FILTER_TEMPLATE_RUN(filter, c_filter, c_instance)                     \
+    do                                                                        \
+    {                                                                         \
+        uint32_t call;                                                        \
+        uint32_t chunk;                                                       \
+        uint32_t inCnt = 0;                                                   \
+                                                                              \
+        for (call = 0; call < FILTERING_CIRC_CALLS; call++)                   \
+        {                                                                     \
+            chunk = blockSize - (call * 5) % blockSize;                       \
+                                                                              \
+            JTEST_COUNT_CYCLES(                                               \
+                filter.process(                                               \
+                    pInputs + inCnt,                                          \
+                    (T *) filtering_output_fut + inCnt,                       \
+                    chunk));                                                  \
+                                                                              \
+            JTEST_COUNT_CYCLES(                                               \
+                c_filter(                                                     \
+                    &c_instance,                                              \
+                    const_cast<T *>(pInputs) + inCnt,                         \
+                    (T *) filtering_output_ref + inCnt,                       \
+                    chunk));                                                  \
+                                                                              \
+            inCnt += chunk;                                                   \
+        }                                                                     \
+                                                                              \
+        if (FilterTemplateCompare<T>::run(inCnt) != JTEST_TEST_PASSED)        \
+        {                                                                     \
+            return JTEST_TEST_FAILED;                                         \
+        }                                                                     \
+    } while (0)
+
+/*
+  FIR template test. The template is instantiated with NumTaps taps and the
+  coefficients Coeffs, and compared with arm_fir_q15/q31/f32().
+*/
+template <typename T, uint16_t NumTaps, const T *Coeffs>
+static JTEST_TEST_RET_t fir_template_test( const T *pInputs )
+{
+    typedef arm_math::Fir<T, NumTaps, Coeffs, FILTERING_MAX_BLOCKSIZE> Filter;
+    typedef arm_math::detail::FilterTraits<T> Traits;
+    typename Traits::fir_t fir_inst_ref;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        Filter fir_fut;
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF( "Block Size: %d\n"
+                         "Number of Taps: %d\n"
+                         "Unrolled: %d\n",
+                         ( int )blockSize,
+                         ( int )NumTaps,
+                         ( int )( NumTaps <= ARM_MATH_HPP_MAX_UNROLLED_TAPS ) );
+
+        Traits::firInit( &fir_inst_ref, NumTaps, Coeffs,
+                         ( T * ) filtering_pState, blockSize );
+
+        FILTER_TEMPLATE_RUN( fir_fut, Traits::fir, fir_inst_ref ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Biquad template test. The template is instantiated with Stages stages, the
+  coefficients Coeffs and a post shift of 1, which the float32_t filters
+  ignore, and compared with arm_biquad_cascade_df1_q15/q31/f32().
+*/
+template <typename T, uint8_t Stages, const T *Coeffs>
+static JTEST_TEST_RET_t biquad_template_test( const T *pInputs )
+{
+    typedef arm_math::Biquad<T, Stages, Coeffs, 1> Filter;
+    typedef arm_math::detail::FilterTraits<T> Traits;
+    typename Traits::biquad_t biquad_inst_ref;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        Filter biquad_fut;
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF( "Block Size: %d\n"
+                         "Number of Stages: %d\n"
+                         "Unrolled: %d\n",
+                         ( int )blockSize,
+                         ( int )Stages,
+                         ( int )( Stages <= ARM_MATH_HPP_MAX_UNROLLED_STAGES ) );
+
+        Traits::biquadInit( &biquad_inst_ref, Stages, Coeffs,
+                            ( T * ) filtering_pState, 1 );
+
+        FILTER_TEMPLATE_RUN( biquad_fut, Traits::biquad, biquad_inst_ref ) );
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  Define a test function for each type and size. The tests have C linkage so
+  that the group can be called from C.
+*/
+#define FIR_TEMPLATE_DEFINE_TEST(suffix, type, taps)                          \
+    JTEST_DEFINE_TEST(arm_fir_template##taps##_##suffix##_test,               \
+                      arm_fir_##suffix)                                       \
+    {                                                                         \
+        return fir_template_test<type, taps,                                  \
+            fir_template_coeffs##taps##_##suffix>(                            \
+                (const type *) filtering_##suffix##_inputs);                  \
+    }
+
+#define BIQUAD_TEMPLATE_DEFINE_TEST(suffix, type, stages)                     \
+    JTEST_DEFINE_TEST(arm_biquad_template##stages##_##suffix##_test,          \
+                      arm_biquad_cascade_df1_##suffix)                        \
+    {                                                                         \
+        return biquad_template_test<type, stages,                             \
+            biquad_template_coeffs##stages##_##suffix>(                       \
+                (const type *) filtering_##suffix##_inputs);                  \
+    }
+
+extern "C"
+{
+
+FIR_TEMPLATE_DEFINE_TEST( f32, float32_t, 8 );
+FIR_TEMPLATE_DEFINE_TEST( q31, q31_t, 8 );
+FIR_TEMPLATE_DEFINE_TEST( q15, q15_t, 8 );
+FIR_TEMPLATE_DEFINE_TEST( f32, float32_t, 30 );
+FIR_TEMPLATE_DEFINE_TEST( q31, q31_t, 30 );
+FIR_TEMPLATE_DEFINE_TEST( q15, q15_t, 30 );
+FIR_TEMPLATE_DEFINE_TEST( f32, float32_t, 48 );
+FIR_TEMPLATE_DEFINE_TEST( q31, q31_t, 48 );
+FIR_TEMPLATE_DEFINE_TEST( q15, q15_t, 48 );
+
+BIQUAD_TEMPLATE_DEFINE_TEST( f32, float32_t, 2 );
+BIQUAD_TEMPLATE_DEFINE_TEST( q31, q31_t, 2 );
+BIQUAD_TEMPLATE_DEFINE_TEST( q15, q15_t, 2 );
+BIQUAD_TEMPLATE_DEFINE_TEST( f32, float32_t, 6 );
+BIQUAD_TEMPLATE_DEFINE_TEST( q31, q31_t, 6 );
+BIQUAD_TEMPLATE_DEFINE_TEST( q15, q15_t, 6 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( filter_template_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_fir_template8_f32_test );
+    JTEST_TEST_CALL( arm_fir_template8_q31_test );
+    JTEST_TEST_CALL( arm_fir_template8_q15_test );
+    JTEST_TEST_CALL( arm_fir_template30_f32_test );
+    JTEST_TEST_CALL( arm_fir_template30_q31_test );
+    JTEST_TEST_CALL( arm_fir_template30_q15_test );
+    JTEST_TEST_CALL( arm_fir_template48_f32_test );
+    JTEST_TEST_CALL( arm_fir_template48_q31_test );
+    JTEST_TEST_CALL( arm_fir_template48_q15_test );
+
+    JTEST_TEST_CALL( arm_biquad_template2_f32_test );
+    JTEST_TEST_CALL( arm_biquad_template2_q31_test );
+    JTEST_TEST_CALL( arm_biquad_template2_q15_test );
+    JTEST_TEST_CALL( arm_biquad_template6_f32_test );
+    JTEST_TEST_CALL( arm_biquad_template6_q31_test );
+    JTEST_TEST_CALL( arm_biquad_template6_q15_test );
+}
+
+} /* extern "C" */
@@ -578,6 +578,12 @@ ARR_DESC_DEFINE( uint8_t,
                  CURLY(
                      0, 1, FILTERING_MAX_POSTSHIFT ) );
 
+ARR_DESC_DEFINE( uint8_t,
+                 filtering_coeff_shifts,
+                 2,
+                 CURLY(
+                     0, 5 ) );
+
 ARR_DESC_DEFINE( uint8_t,
                  filtering_Ls,
                  3,
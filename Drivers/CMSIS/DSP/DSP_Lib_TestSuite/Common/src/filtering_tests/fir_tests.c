@@ -170,6 +170,335 @@
             return JTEST_TEST_PASSED;                                      \
    }
 
+#define FIR_CIRC_DEFINE_TEST(suffix, output_type)                             \
+   JTEST_DEFINE_TEST(arm_fir_circ_##suffix##_test,                            \
+         arm_fir_circ_##suffix)                                               \
+   {                                                                          \
+      arm_fir_circ_instance_##suffix fir_inst_fut = { 0 };                    \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                         \
+      uint32_t call;                                                          \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps              \
+               ,                                                              \
+               /* Display test parameter values */                            \
+               JTEST_DUMP_STRF("Block Size: %d\n"                             \
+                               "Number of Taps: %d\n",                        \
+                               (int)blockSize,                                \
+                               (int)numTaps);                                 \
+                                                                              \
+               /* Initialize the FIR Instances */                             \
+               arm_fir_circ_init_##suffix(                                    \
+                     &fir_inst_fut, numTaps,                                  \
+                     (output_type*)filtering_coeffs_##suffix,                 \
+                     (void *) filtering_pState, blockSize);                   \
+                                                                              \
+               arm_fir_init_##suffix(                                         \
+                     &fir_inst_ref, numTaps,                                  \
+                     (output_type*)filtering_coeffs_##suffix,                 \
+                     (void *) filtering_scratch, blockSize);                  \
+                                                                              \
+               /* Several calls, to run through the circular state */         \
+               for (call = 0; call < FILTERING_CIRC_CALLS; call++)            \
+               {                                                              \
+                  JTEST_COUNT_CYCLES(                                         \
+                        arm_fir_circ_##suffix(                                \
+                              &fir_inst_fut,                                  \
+                              (output_type *) filtering_##suffix##_inputs +   \
+                              call * blockSize,                               \
+                              (output_type *) filtering_output_fut +          \
+                              call * blockSize,                               \
+                              blockSize));                                    \
+                                                                              \
+                  JTEST_COUNT_CYCLES(                                         \
+                        arm_fir_##suffix(                                     \
+                              &fir_inst_ref,                                  \
+                              (output_type *) filtering_##suffix##_inputs +   \
+                              call * blockSize,                               \
+                              (output_type *) filtering_output_ref +          \
+                              call * blockSize,                               \
+                              blockSize));                                    \
+               }                                                              \
+                                                                              \
+               TEST_ASSERT_BUFFERS_EQUAL(                                     \
+                     filtering_output_ref,                                    \
+                     filtering_output_fut,                                    \
+                     FILTERING_CIRC_CALLS * blockSize *                       \
+                     sizeof(output_type))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+#define FIR_DECIMATE_CIRC_DEFINE_TEST(suffix, output_type)                    \
+   JTEST_DEFINE_TEST(arm_fir_decimate_circ_##suffix##_test,                   \
+         arm_fir_decimate_circ_##suffix)                                      \
+   {                                                                          \
+      arm_fir_decimate_circ_instance_##suffix fir_inst_fut = { 0 };           \
+      arm_fir_decimate_instance_##suffix fir_inst_ref = { 0 };                \
+      uint32_t call;                                                          \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps              \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  M_idx, uint8_t, M, filtering_Ms                             \
+                  ,                                                           \
+                  if (blockSize % M == 0)                                     \
+                  {                                                           \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Decimation Factor: %d\n",               \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)M);                                 \
+                                                                              \
+                     /* Initialize the FIR Instances */                       \
+                     arm_fir_decimate_circ_init_##suffix(                     \
+                           &fir_inst_fut, numTaps, M,                         \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, blockSize);             \
+                                                                              \
+                     arm_fir_decimate_init_##suffix(                          \
+                           &fir_inst_ref, numTaps, M,                         \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_scratch, blockSize);            \
+                                                                              \
+                     for (call = 0; call < FILTERING_CIRC_CALLS; call++)      \
+                     {                                                        \
+                        JTEST_COUNT_CYCLES(                                   \
+                              arm_fir_decimate_circ_##suffix(                 \
+                                    &fir_inst_fut,                            \
+                                    (output_type *)                           \
+                                    filtering_##suffix##_inputs +             \
+                                    call * blockSize,                         \
+                                    (output_type *) filtering_output_fut +    \
+                                    call * (blockSize / M),                   \
+                                    blockSize));                              \
+                                                                              \
+                        JTEST_COUNT_CYCLES(                                   \
+                              arm_fir_decimate_##suffix(                      \
+                                    &fir_inst_ref,                            \
+                                    (output_type *)                           \
+                                    filtering_##suffix##_inputs +             \
+                                    call * blockSize,                         \
+                                    (output_type *) filtering_output_ref +    \
+                                    call * (blockSize / M),                   \
+                                    blockSize));                              \
+                     }                                                        \
+                                                                              \
+                     TEST_ASSERT_BUFFERS_EQUAL(                               \
+                           filtering_output_ref,                              \
+                           filtering_output_fut,                              \
+                           FILTERING_CIRC_CALLS * (blockSize / M) *           \
+                           sizeof(output_type));                              \
+                  })));                                                       \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+#define FIR_INTERPOLATE_CIRC_DEFINE_TEST(suffix, output_type)                 \
+   JTEST_DEFINE_TEST(arm_fir_interpolate_circ_##suffix##_test,                \
+         arm_fir_interpolate_circ_##suffix)                                   \
+   {                                                                          \
+      arm_fir_interpolate_circ_instance_##suffix fir_inst_fut = { 0 };        \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };             \
+      uint32_t call;                                                          \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+                  /* Display test parameter values */                         \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                                 "Number of Taps: %d\n"                       \
+                                 "Upsample factor: %d\n",                     \
+                                (int)blockSize,                               \
+                                (int)numTaps,                                 \
+                                (int)L);                                      \
+                                                                              \
+                  /* Initialize the FIR Instances */                          \
+                  arm_fir_interpolate_circ_init_##suffix(                     \
+                        &fir_inst_fut, L, numTaps,                            \
+                        (output_type*)filtering_coeffs_##suffix,              \
+                        (void *) filtering_pState, blockSize);                \
+                                                                              \
+                  arm_fir_interpolate_init_##suffix(                          \
+                        &fir_inst_ref, L, numTaps,                            \
+                        (output_type*)filtering_coeffs_##suffix,              \
+                        (void *) filtering_scratch, blockSize);               \
+                                                                              \
+                  for (call = 0; call < FILTERING_CIRC_CALLS; call++)         \
+                  {                                                           \
+                     JTEST_COUNT_CYCLES(                                      \
+                           arm_fir_interpolate_circ_##suffix(                 \
+                                 &fir_inst_fut,                               \
+                                 (output_type *) filtering_##suffix##_inputs +\
+                                 call * blockSize,                            \
+                                 (output_type *) filtering_output_fut +       \
+                                 call * blockSize * L,                        \
+                                 blockSize));                                 \
+                                                                              \
+                     JTEST_COUNT_CYCLES(                                      \
+                           arm_fir_interpolate_##suffix(                      \
+                                 &fir_inst_ref,                               \
+                                 (output_type *) filtering_##suffix##_inputs +\
+                                 call * blockSize,                            \
+                                 (output_type *) filtering_output_ref +       \
+                                 call * blockSize * L,                        \
+                                 blockSize));                                 \
+                  }                                                           \
+                                                                              \
+                  TEST_ASSERT_BUFFERS_EQUAL(                                  \
+                        filtering_output_ref,                                 \
+                        filtering_output_fut,                                 \
+                        FILTERING_CIRC_CALLS * blockSize * L *                \
+                        sizeof(output_type)))));                              \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+/*
+  Rational resampler test template. The input is streamed in
+  FILTERING_CIRC_CALLS blocks of different sizes and the concatenated outputs
+  are compared with the direct reference on the whole input. The cost in
+  multiply-accumulates per output is displayed next to the cost of chaining
+  the interpolator and the decimator.
+*/
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_resample_instance_##suffix fir_inst_ref = { 0 };                \
+      uint32_t call;                                                          \
+      uint32_t chunk;                                                         \
+      uint32_t inCnt;                                                         \
+      uint32_t outCnt;                                                        \
+      uint32_t refCnt;                                                        \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     /* Display test parameter values */                      \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                       \
+                                     "Number of Taps: %d\n"                   \
+                                     "Upsample factor: %d\n"                  \
+                                     "Decimation Factor: %d\n"                \
+                                     "MACs per output: %d\n"                  \
+                                     "MACs per output, chained: %d\n",        \
+                                     (int)blockSize,                          \
+                                     (int)numTaps,                            \
+                                     (int)L,                                  \
+                                     (int)M,                                  \
+                                     (int)(numTaps / L),                      \
+                                     (int)(M * numTaps / L));                 \
+                                                                              \
+                     /* Initialize the FIR Instances */                       \
+                     if (arm_fir_resample_init_##suffix(                      \
+                            &fir_inst_fut, L, M, numTaps,                     \
+                            (output_type*)filtering_coeffs_##suffix,          \
+                            (void *) filtering_pState, blockSize)             \
+                         != ARM_MATH_SUCCESS)                                 \
+                     {                                                        \
+                        return JTEST_TEST_FAILED;                             \
+                     }                                                        \
+                                                                              \
+                     arm_fir_resample_init_##suffix(                          \
+                           &fir_inst_ref, L, M, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_scratch, blockSize);            \
+                                                                              \
+                     /* Stream blocks of blockSize samples and less */        \
+                     inCnt = 0;                                               \
+                     outCnt = 0;                                              \
+                                                                              \
+                     for (call = 0; call < FILTERING_CIRC_CALLS; call++)      \
+                     {                                                        \
+                        chunk = blockSize - (call * 5) % blockSize;           \
+                                                                              \
+                        JTEST_COUNT_CYCLES(                                   \
+                              outCnt += arm_fir_resample_##suffix(            \
+                                 &fir_inst_fut,                               \
+                                 (output_type *) filtering_##suffix##_inputs +\
+                                 inCnt,                                       \
+                                 (output_type *) filtering_output_fut +       \
+                                 outCnt,                                      \
+                                 chunk));                                     \
+                                                                              \
+                        inCnt += chunk;                                       \
+                     }                                                        \
+                                                                              \
+                     refCnt = ref_fir_resample_##suffix(                      \
+                           &fir_inst_ref,                                     \
+                           (output_type *) filtering_##suffix##_inputs,       \
+                           (void *) filtering_output_ref,                     \
+                           inCnt);                                            \
+                                                                              \
+                     TEST_ASSERT_EQUAL(outCnt, refCnt);                       \
+                                                                              \
+                     FILTERING_SNR_COMPARE_INTERFACE(                         \
+                           outCnt,                                            \
+                           output_type)))));                                  \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+/*
+  Rational resampler initialization test template. The initialization must
+  reject null factors, and filter lengths that are zero or not a multiple of
+  the upsample factor.
+*/
+#define FIR_RESAMPLE_INIT_DEFINE_TEST(suffix, output_type)                    \
+   JTEST_DEFINE_TEST(arm_fir_resample_init_##suffix##_test,                   \
+         arm_fir_resample_init_##suffix)                                      \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+                                                                              \
+      TEST_ASSERT_EQUAL(arm_fir_resample_init_##suffix(                       \
+                           &fir_inst_fut, 0, 2, 8,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, 16),                    \
+                        ARM_MATH_ARGUMENT_ERROR);                             \
+      TEST_ASSERT_EQUAL(arm_fir_resample_init_##suffix(                       \
+                           &fir_inst_fut, 2, 0, 8,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, 16),                    \
+                        ARM_MATH_ARGUMENT_ERROR);                             \
+      TEST_ASSERT_EQUAL(arm_fir_resample_init_##suffix(                       \
+                           &fir_inst_fut, 2, 3, 0,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, 16),                    \
+                        ARM_MATH_LENGTH_ERROR);                               \
+      TEST_ASSERT_EQUAL(arm_fir_resample_init_##suffix(                       \
+                           &fir_inst_fut, 3, 2, 8,                            \
+                           (output_type*)filtering_coeffs_##suffix,           \
+                           (void *) filtering_pState, 16),                    \
+                        ARM_MATH_LENGTH_ERROR);                               \
+                                                                              \
+      return JTEST_TEST_PASSED;                                               \
+   }
+
 #define FIR_LATTICE_DEFINE_TEST(suffix, output_type)                       \
    JTEST_DEFINE_TEST(arm_fir_lattice_##suffix##_test,                      \
          arm_fir_lattice_##suffix)                                         \
@@ -360,11 +689,93 @@ FIR_DECIMATE_DEFINE_TEST( q15,, q15_t );
 FIR_DECIMATE_DEFINE_TEST( q31, _fast, q31_t );
 FIR_DECIMATE_DEFINE_TEST( q15, _fast, q15_t );
 
+FIR_CIRC_DEFINE_TEST( q31, q31_t );
+FIR_CIRC_DEFINE_TEST( q15, q15_t );
+
+FIR_DECIMATE_CIRC_DEFINE_TEST( q31, q31_t );
+FIR_DECIMATE_CIRC_DEFINE_TEST( q15, q15_t );
+
+FIR_INTERPOLATE_CIRC_DEFINE_TEST( q31, q31_t );
+FIR_INTERPOLATE_CIRC_DEFINE_TEST( q15, q15_t );
+
+FIR_RESAMPLE_DEFINE_TEST( f32, float32_t );
+FIR_RESAMPLE_DEFINE_TEST( q31, q31_t );
+FIR_RESAMPLE_DEFINE_TEST( q15, q15_t );
+FIR_RESAMPLE_INIT_DEFINE_TEST( f32, float32_t );
+FIR_RESAMPLE_INIT_DEFINE_TEST( q31, q31_t );
+FIR_RESAMPLE_INIT_DEFINE_TEST( q15, q15_t );
+
 FIR_SPARSE_DEFINE_TEST( f32, float32_t );
 FIR_SPARSE_DEFINE_TEST( q31, q31_t );
 FIR_SPARSE2_DEFINE_TEST( q15, q15_t );
 FIR_SPARSE2_DEFINE_TEST( q7, q7_t );
 
+/*
+ * Bit exactness of arm_fir_q15() against the reference for each filter length.
+ * The coefficients are scaled down by each value of filtering_coeff_shifts, so
+ * that both the 32-bit and the 64-bit accumulator paths of the Cortex-M0 kernel
+ * are run. The cycle counts give the cost of each filter length.
+ */
+JTEST_DEFINE_TEST( arm_fir_q15_bitexact_test,
+                   arm_fir_q15 )
+{
+    arm_fir_instance_q15 fir_inst_fut = { 0 };
+    arm_fir_instance_q15 fir_inst_ref = { 0 };
+    q15_t *coeffs = ( q15_t * ) filtering_scratch;
+    uint32_t i;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps
+            ,
+            TEMPLATE_DO_ARR_DESC(
+                shift_idx, uint8_t, coeffShift, filtering_coeff_shifts
+                ,
+                for( i = 0; i < numTaps; i++ )
+                {
+                    coeffs[i] = filtering_coeffs_q15[i] >> coeffShift;
+                }
+
+                /* Display test parameter values */
+                JTEST_DUMP_STRF( "Block Size: %d\n"
+                                 "Number of Taps: %d\n"
+                                 "Coefficient Shift: %d\n",
+                                 ( int )blockSize,
+                                 ( int )numTaps,
+                                 ( int )coeffShift );
+
+                /* Initialize the FIR Instances */
+                arm_fir_init_q15(
+                    &fir_inst_fut, numTaps, coeffs,
+                    ( void * ) filtering_pState, blockSize );
+
+                JTEST_COUNT_CYCLES(
+                    arm_fir_q15(
+                        &fir_inst_fut,
+                        ( void * ) filtering_q15_inputs,
+                        ( void * ) filtering_output_fut,
+                        blockSize ) );
+
+                arm_fir_init_q15(
+                    &fir_inst_ref, numTaps, coeffs,
+                    ( void * ) filtering_pState, blockSize );
+
+                ref_fir_q15(
+                    &fir_inst_ref,
+                    ( void * ) filtering_q15_inputs,
+                    ( void * ) filtering_output_ref,
+                    blockSize );
+
+                TEST_ASSERT_BUFFERS_EQUAL(
+                    filtering_output_ref,
+                    filtering_output_fut,
+                    blockSize * sizeof( q15_t ) ) ) ) );
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -380,6 +791,7 @@ JTEST_DEFINE_GROUP( fir_tests )
     JTEST_TEST_CALL( arm_fir_q7_test );
     JTEST_TEST_CALL( arm_fir_fast_q31_test );
     JTEST_TEST_CALL( arm_fir_fast_q15_test );
+    JTEST_TEST_CALL( arm_fir_q15_bitexact_test );
 
     JTEST_TEST_CALL( arm_fir_lattice_f32_test );
     JTEST_TEST_CALL( arm_fir_lattice_q31_test );
@@ -395,6 +807,20 @@ JTEST_DEFINE_GROUP( fir_tests )
     JTEST_TEST_CALL( arm_fir_decimate_fast_q31_test );
     JTEST_TEST_CALL( arm_fir_decimate_fast_q15_test );
 
+    JTEST_TEST_CALL( arm_fir_circ_q31_test );
+    JTEST_TEST_CALL( arm_fir_circ_q15_test );
+    JTEST_TEST_CALL( arm_fir_decimate_circ_q31_test );
+    JTEST_TEST_CALL( arm_fir_decimate_circ_q15_test );
+    JTEST_TEST_CALL( arm_fir_interpolate_circ_q31_test );
+    JTEST_TEST_CALL( arm_fir_interpolate_circ_q15_test );
+
+    JTEST_TEST_CALL( arm_fir_resample_f32_test );
+    JTEST_TEST_CALL( arm_fir_resample_q31_test );
+    JTEST_TEST_CALL( arm_fir_resample_q15_test );
+    JTEST_TEST_CALL( arm_fir_resample_init_f32_test );
+    JTEST_TEST_CALL( arm_fir_resample_init_q31_test );
+    JTEST_TEST_CALL( arm_fir_resample_init_q15_test );
+
     JTEST_TEST_CALL( arm_fir_sparse_f32_test );
     JTEST_TEST_CALL( arm_fir_sparse_q31_test );
     JTEST_TEST_CALL( arm_fir_sparse_q15_test );
@@ -0,0 +1,354 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define MEDIAN_LEN        1000
+#define MEDIAN_MAX_WINDOW 127
+
+/* Period of the spikes of the input */
+#define MEDIAN_SPIKE_PERIOD 37
+
+static const uint16_t median_windows[] = { 1, 3, 5, 15, 31, 127 };
+
+#define MEDIAN_WINDOWS (sizeof(median_windows) / sizeof(median_windows[0]))
+
+/* Sizes of the successive calls, cycled */
+static const uint16_t median_chunks[] = { 1, 7, 64, 333 };
+
+#define MEDIAN_CHUNKS (sizeof(median_chunks) / sizeof(median_chunks[0]))
+
+/* Three sigma rule: 3 * 1.4826 = 0.55598 * 2^3 */
+#define MEDIAN_HAMPEL_FRACT_Q31 ((q31_t) 0x472A3055)
+#define MEDIAN_HAMPEL_FRACT_Q15 ((q15_t) 0x472A)
+#define MEDIAN_HAMPEL_SHIFT     3
+
+static q31_t median_inputs_q31[MEDIAN_LEN];
+static q15_t median_inputs_q15[MEDIAN_LEN];
+static q31_t median_state_q31[MEDIAN_MAX_WINDOW];
+static q15_t median_state_q15[MEDIAN_MAX_WINDOW];
+static int16_t median_heap[2 * MEDIAN_MAX_WINDOW];
+static q31_t median_sorted_q31[MEDIAN_MAX_WINDOW];
+static q15_t median_sorted_q15[MEDIAN_MAX_WINDOW];
+static q31_t median_output_fut_q31[MEDIAN_LEN];
+static q15_t median_output_fut_q15[MEDIAN_LEN];
+static q31_t median_output_ref_q31[MEDIAN_LEN];
+static q15_t median_output_ref_q15[MEDIAN_LEN];
+
+/*
+  Builds the input, a slow sine of amplitude 0.5 plus a scrambled noise, with
+  spikes every MEDIAN_SPIKE_PERIOD samples, at full scale for some of them.
+  The second half is quantized to 6 bits, so that the windows hold many equal
+  samples.
+*/
+static void median_build_input(void)
+{
+    uint32_t noise;
+    float64_t x;
+    uint32_t i;
+
+    for (i = 0; i < MEDIAN_LEN; i++)
+    {
+        noise = (i + 3) * 2654435761U;
+        x = 0.5 * sin(0.02 * i) +
+            0.1 * ((float64_t) (noise >> 8) / 16777216.0 - 0.5);
+
+        if ((i % MEDIAN_SPIKE_PERIOD) == 0)
+        {
+            x = ((i / MEDIAN_SPIKE_PERIOD) % 3 == 0) ? -1.0 :
+                ((x > 0) ? x - 0.9 : x + 0.9);
+        }
+
+        if (i >= MEDIAN_LEN / 2)
+        {
+            x = floor(x * 64.0) / 64.0;
+        }
+
+        median_inputs_q31[i] = (q31_t) (x * 2147483648.0);
+        median_inputs_q15[i] = (q15_t) (x * 32768.0);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Streams the input in calls of the sizes in median_chunks into the instance
+  median_inst_fut of the filter fn, in place when in_place is set.
+*/
+#define MEDIAN_STREAM(fn, suffix, in_place)                                 \
+    do                                                                      \
+    {                                                                       \
+        uint32_t __pos = 0;                                                 \
+        uint32_t __call = 0;                                                \
+        uint32_t __chunk;                                                   \
+                                                                            \
+        if (in_place)                                                       \
+        {                                                                   \
+            memcpy(median_output_fut_##suffix, median_inputs_##suffix,      \
+                   sizeof(median_output_fut_##suffix));                     \
+        }                                                                   \
+                                                                            \
+        while (__pos < MEDIAN_LEN)                                          \
+        {                                                                   \
+            __chunk = median_chunks[__call++ % MEDIAN_CHUNKS];              \
+            __chunk = (__chunk > MEDIAN_LEN - __pos) ?                      \
+                MEDIAN_LEN - __pos : __chunk;                               \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_##fn##_##suffix(                                        \
+                    &median_inst_fut,                                       \
+                    (in_place) ? median_output_fut_##suffix + __pos :       \
+                    median_inputs_##suffix + __pos,                         \
+                    median_output_fut_##suffix + __pos,                     \
+                    __chunk));                                              \
+                                                                            \
+            __pos += __chunk;                                               \
+        }                                                                   \
+    } while (0)
+
+/*
+  Running median test template. For each window size, the streamed output
+  must match the reference exactly. Arguments are: type suffix.
+*/
+#define MEDIAN_DEFINE_TEST(suffix)                                          \
+    JTEST_DEFINE_TEST(arm_median_##suffix##_test,                           \
+                      arm_median_##suffix)                                  \
+    {                                                                       \
+        arm_median_instance_##suffix median_inst_fut;                       \
+        uint32_t w;                                                         \
+                                                                            \
+        median_build_input();                                               \
+                                                                            \
+        for (w = 0; w < MEDIAN_WINDOWS; w++)                                \
+        {                                                                   \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Window Size: %d\n",                            \
+                            (int) median_windows[w]);                       \
+                                                                            \
+            TEST_ASSERT_EQUAL(arm_median_init_##suffix(&median_inst_fut,    \
+                                                       median_windows[w],   \
+                                                       median_state_##suffix, \
+                                                       median_heap),        \
+                              ARM_MATH_SUCCESS);                            \
+                                                                            \
+            ref_median_##suffix(&median_inst_fut,                           \
+                                median_inputs_##suffix,                     \
+                                median_output_ref_##suffix,                 \
+                                MEDIAN_LEN);                                \
+                                                                            \
+            MEDIAN_STREAM(median, suffix, 0);                               \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(median_output_ref_##suffix,           \
+                                      median_output_fut_##suffix,           \
+                                      sizeof(median_output_fut_##suffix));  \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+MEDIAN_DEFINE_TEST(q31);
+MEDIAN_DEFINE_TEST(q15);
+
+/*
+  Hampel filter test template. For each window size, the output streamed in
+  place must match the reference exactly, with the three sigma threshold and
+  with a threshold of 0, which gives the running median. Arguments are: type
+  suffix and type suffix in upper case.
+*/
+#define HAMPEL_DEFINE_TEST(suffix, SUFFIX)                                  \
+    JTEST_DEFINE_TEST(arm_hampel_##suffix##_test,                           \
+                      arm_hampel_##suffix)                                  \
+    {                                                                       \
+        arm_hampel_instance_##suffix median_inst_fut;                       \
+        arm_median_instance_##suffix median_inst_ref;                       \
+        uint32_t w;                                                         \
+        uint32_t t;                                                         \
+                                                                            \
+        median_build_input();                                               \
+                                                                            \
+        for (w = 0; w < MEDIAN_WINDOWS; w++)                                \
+        {                                                                   \
+            for (t = 0; t < 2; t++)                                         \
+            {                                                               \
+                /* Display parameter values */                              \
+                JTEST_DUMP_STRF("Window Size: %d\n"                         \
+                                "Threshold: %s\n",                          \
+                                (int) median_windows[w],                    \
+                                (t == 0) ? "3 sigma" : "0");                \
+                                                                            \
+                TEST_ASSERT_EQUAL(arm_hampel_init_##suffix(                 \
+                                      &median_inst_fut,                     \
+                                      median_windows[w],                    \
+                                      (t == 0) ?                            \
+                                      MEDIAN_HAMPEL_FRACT_##SUFFIX : 0,     \
+                                      MEDIAN_HAMPEL_SHIFT,                  \
+                                      median_state_##suffix,                \
+                                      median_sorted_##suffix),              \
+                                  ARM_MATH_SUCCESS);                        \
+                                                                            \
+                ref_hampel_##suffix(&median_inst_fut,                       \
+                                    median_inputs_##suffix,                 \
+                                    median_output_ref_##suffix,             \
+                                    MEDIAN_LEN);                            \
+                                                                            \
+                MEDIAN_STREAM(hampel, suffix, 1);                           \
+                                                                            \
+                TEST_ASSERT_BUFFERS_EQUAL(median_output_ref_##suffix,       \
+                                          median_output_fut_##suffix,       \
+                                          sizeof(median_output_fut_##suffix)); \
+            }                                                               \
+                                                                            \
+            /* With a threshold of 0, the output is the running median */   \
+            arm_median_init_##suffix(&median_inst_ref, median_windows[w],   \
+                                     median_state_##suffix, median_heap);   \
+            ref_median_##suffix(&median_inst_ref,                           \
+                                median_inputs_##suffix,                     \
+                                median_output_ref_##suffix,                 \
+                                MEDIAN_LEN);                                \
+                                                                            \
+            TEST_ASSERT_BUFFERS_EQUAL(median_output_ref_##suffix,           \
+                                      median_output_fut_##suffix,           \
+                                      sizeof(median_output_fut_##suffix));  \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+HAMPEL_DEFINE_TEST(q31, Q31);
+HAMPEL_DEFINE_TEST(q15, Q15);
+
+/*
+  Spike removal test template. On a ramp with spikes every
+  MEDIAN_SPIKE_PERIOD samples, the output of the Hampel filter over 7 samples
+  must follow the ramp delayed by 3 samples within one step of the ramp, and
+  must be the ramp itself away from the spikes. Arguments are: type suffix,
+  type suffix in upper case, and full scale of the type.
+*/
+#define HAMPEL_SPIKE_DEFINE_TEST(suffix, SUFFIX, full_scale)                \
+    JTEST_DEFINE_TEST(arm_hampel_spike_##suffix##_test,                     \
+                      arm_hampel_##suffix)                                  \
+    {                                                                       \
+        arm_hampel_instance_##suffix median_inst_fut;                       \
+        const float64_t step = 1.0 / MEDIAN_LEN;                            \
+        float64_t ramp;                                                     \
+        float64_t error;                                                    \
+        uint32_t i;                                                         \
+                                                                            \
+        for (i = 0; i < MEDIAN_LEN; i++)                                    \
+        {                                                                   \
+            ramp = i * step - 0.5;                                          \
+            if ((i % MEDIAN_SPIKE_PERIOD) == 5)                             \
+            {                                                               \
+                ramp += (ramp > 0) ? -0.25 : 0.25;                          \
+            }                                                               \
+                                                                            \
+            median_inputs_##suffix[i] = (suffix##_t) (full_scale * ramp);   \
+        }                                                                   \
+                                                                            \
+        arm_hampel_init_##suffix(&median_inst_fut, 7,                       \
+                                 MEDIAN_HAMPEL_FRACT_##SUFFIX,              \
+                                 MEDIAN_HAMPEL_SHIFT,                       \
+                                 median_state_##suffix,                     \
+                                 median_sorted_##suffix);                   \
+        MEDIAN_STREAM(hampel, suffix, 0);                                   \
+                                                                            \
+        for (i = 7; i < MEDIAN_LEN; i++)                                    \
+        {                                                                   \
+            ramp = (i - 3) * step - 0.5;                                    \
+            error = fabs(median_output_fut_##suffix[i] / full_scale - ramp); \
+                                                                            \
+            if ((error > 1.5 * step) ||                                     \
+                (((i - 3) % MEDIAN_SPIKE_PERIOD != 5) &&                    \
+                 (median_output_fut_##suffix[i] !=                          \
+                  median_inputs_##suffix[i - 3])))                          \
+            {                                                               \
+                JTEST_DUMP_STRF("Sample: %d\n", (int) i);                   \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+HAMPEL_SPIKE_DEFINE_TEST(q31, Q31, 2147483648.0);
+HAMPEL_SPIKE_DEFINE_TEST(q15, Q15, 32768.0);
+
+/*
+  Initialization test template. The initialization must reject even and too
+  large windows, and negative or out of range thresholds. Arguments are: type
+  suffix, type suffix in upper case, and largest shift.
+*/
+#define MEDIAN_INIT_DEFINE_TEST(suffix, SUFFIX, max_shift)                  \
+    JTEST_DEFINE_TEST(arm_median_init_##suffix##_test,                      \
+                      arm_median_init_##suffix)                             \
+    {                                                                       \
+        arm_median_instance_##suffix median_inst_fut;                       \
+        arm_hampel_instance_##suffix hampel_inst_fut;                       \
+                                                                            \
+        TEST_ASSERT_EQUAL(arm_median_init_##suffix(&median_inst_fut, 0,     \
+                                                   median_state_##suffix,   \
+                                                   median_heap),            \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_median_init_##suffix(&median_inst_fut, 16,    \
+                                                   median_state_##suffix,   \
+                                                   median_heap),            \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_median_init_##suffix(&median_inst_fut, 32769, \
+                                                   median_state_##suffix,   \
+                                                   median_heap),            \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+                                                                            \
+        TEST_ASSERT_EQUAL(arm_hampel_init_##suffix(                         \
+                              &hampel_inst_fut, 5, -1, 0,                   \
+                              median_state_##suffix,                        \
+                              median_sorted_##suffix),                      \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_hampel_init_##suffix(                         \
+                              &hampel_inst_fut, 5,                          \
+                              MEDIAN_HAMPEL_FRACT_##SUFFIX, max_shift + 1,  \
+                              median_state_##suffix,                        \
+                              median_sorted_##suffix),                      \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_hampel_init_##suffix(                         \
+                              &hampel_inst_fut, 6,                          \
+                              MEDIAN_HAMPEL_FRACT_##SUFFIX, 0,              \
+                              median_state_##suffix,                        \
+                              median_sorted_##suffix),                      \
+                          ARM_MATH_ARGUMENT_ERROR);                         \
+        TEST_ASSERT_EQUAL(arm_hampel_init_##suffix(                         \
+                              &hampel_inst_fut, 5,                          \
+                              MEDIAN_HAMPEL_FRACT_##SUFFIX, max_shift,      \
+                              median_state_##suffix,                        \
+                              median_sorted_##suffix),                      \
+                          ARM_MATH_SUCCESS);                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+MEDIAN_INIT_DEFINE_TEST(q31, Q31, 31);
+MEDIAN_INIT_DEFINE_TEST(q15, Q15, 15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    JTEST_TEST_CALL(arm_median_q31_test);
+    JTEST_TEST_CALL(arm_median_q15_test);
+    JTEST_TEST_CALL(arm_hampel_q31_test);
+    JTEST_TEST_CALL(arm_hampel_q15_test);
+    JTEST_TEST_CALL(arm_hampel_spike_q31_test);
+    JTEST_TEST_CALL(arm_hampel_spike_q15_test);
+    JTEST_TEST_CALL(arm_median_init_q31_test);
+    JTEST_TEST_CALL(arm_median_init_q15_test);
+}
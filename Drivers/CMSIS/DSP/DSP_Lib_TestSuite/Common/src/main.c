@@ -10,8 +10,10 @@
 
 void debug_init( void )
 {
+#if !defined JTEST_HOST
     uint32_t *SHCSR_ptr = ( uint32_t * ) 0xE000ED24; /* System Handler Control and State Register */
     *SHCSR_ptr |= 0x70000;             /* Enable  UsageFault, BusFault, and MemManage fault*/
+#endif
 }
 
 int main( void )
@@ -24,5 +26,9 @@ int main( void )
 
     JTEST_ACT_EXIT_FW();        /* Exit test framework.  */
 
+#if defined JTEST_HOST
+    return ( JTEST_FW.failed == 0 ) ? 0 : 1; /* Exit status for ctest. */
+#else
     while( 1 );                  /* Never return. */
+#endif
 }
@@ -0,0 +1,272 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define SMALL_MAT_PASSES    32
+#define SMALL_MAT_FRAC_BITS 24
+#define SMALL_MAT_ONE       (1 << SMALL_MAT_FRAC_BITS)
+
+/* Maximum errors in LSB */
+#define SMALL_MAT_MULT_MAX_ERROR       1
+#define SMALL_MAT_SYM_UPDATE_MAX_ERROR 4
+#define SMALL_MAT_LDLT_SOLVE_MAX_ERROR 8
+
+static q31_t small_mat_a[6 * 6];
+static q31_t small_mat_b[6 * 6];
+static q31_t small_mat_q[6 * 6];
+static q31_t small_mat_output_fut[6 * 6];
+static q31_t small_mat_output_ref[6 * 6];
+
+/*
+  Fills a matrix with scrambled values in [-range range). With sym set, the
+  matrix is made symmetric.
+*/
+static void small_mat_fill(
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t seed,
+    q31_t range,
+    uint32_t sym)
+{
+    uint32_t i, j;
+    uint32_t state = seed * 2654435761U + 1U;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            state = state * 1664525U + 1013904223U;
+            pDst[i * n + j] = (q31_t) (((q63_t) (state >> 8) * 2 * range) >> 24) - range;
+        }
+    }
+
+    if (sym)
+    {
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < i; j++)
+            {
+                pDst[i * n + j] = pDst[j * n + i];
+            }
+        }
+    }
+}
+
+/*
+  Builds a symmetric positive definite matrix M * M' + n * I / 4 from the
+  matrix M in small_mat_q.
+*/
+static void small_mat_fill_spd(
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t seed)
+{
+    uint32_t i;
+
+    small_mat_fill(small_mat_q, n, seed, SMALL_MAT_ONE, 0);
+    ref_mat_mult_trans_small_q31(small_mat_q, small_mat_q, pDst, n,
+                                 SMALL_MAT_FRAC_BITS);
+
+    for (i = 0; i < n; i++)
+    {
+        pDst[i * n + i] += (q31_t) (n * SMALL_MAT_ONE / 4);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Matrix product test template, on scrambled matrices with values up to 2.
+  Arguments are: operation (mult/mult_trans) and size (3/4/6)
+*/
+#define SMALL_MAT_MULT_DEFINE_TEST(op, n)                               \
+    JTEST_DEFINE_TEST(arm_mat_##op##_##n##x##n##_q31_test,              \
+                      arm_mat_##op##_##n##x##n##_q31)                   \
+    {                                                                   \
+        int64_t max_error = 0;                                          \
+        uint32_t pass;                                                  \
+                                                                        \
+        for (pass = 0; pass < SMALL_MAT_PASSES; pass++)                 \
+        {                                                               \
+            small_mat_fill(small_mat_a, n, 2 * pass, 2 * SMALL_MAT_ONE, 0); \
+            small_mat_fill(small_mat_b, n, 2 * pass + 1, 2 * SMALL_MAT_ONE, 0); \
+                                                                        \
+            arm_mat_##op##_##n##x##n##_q31(small_mat_a, small_mat_b,    \
+                                           small_mat_output_fut,        \
+                                           SMALL_MAT_FRAC_BITS);        \
+            ref_mat_##op##_small_q31(small_mat_a, small_mat_b,          \
+                                     small_mat_output_ref, n,           \
+                                     SMALL_MAT_FRAC_BITS);              \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(small_mat_output_ref,                 \
+                                  small_mat_output_fut, n * n,          \
+                                  int64_t, SMALL_MAT_MULT_MAX_ERROR,    \
+                                  max_error);                           \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error);        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_mat_##op##_##n##x##n##_q31(small_mat_a, small_mat_b,    \
+                                           small_mat_output_fut,        \
+                                           SMALL_MAT_FRAC_BITS));       \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+SMALL_MAT_MULT_DEFINE_TEST( mult, 3 );
+SMALL_MAT_MULT_DEFINE_TEST( mult, 4 );
+SMALL_MAT_MULT_DEFINE_TEST( mult, 6 );
+SMALL_MAT_MULT_DEFINE_TEST( mult_trans, 3 );
+SMALL_MAT_MULT_DEFINE_TEST( mult_trans, 4 );
+SMALL_MAT_MULT_DEFINE_TEST( mult_trans, 6 );
+
+/*
+  Symmetric update test template. The output must be exactly symmetric, and
+  the same when computed in place of P. Argument is the size (3/4/6)
+*/
+#define SMALL_MAT_SYM_UPDATE_DEFINE_TEST(n)                             \
+    JTEST_DEFINE_TEST(arm_mat_sym_update_##n##x##n##_q31_test,          \
+                      arm_mat_sym_update_##n##x##n##_q31)               \
+    {                                                                   \
+        int64_t max_error = 0;                                          \
+        uint32_t pass;                                                  \
+        uint32_t i, j;                                                  \
+                                                                        \
+        for (pass = 0; pass < SMALL_MAT_PASSES; pass++)                 \
+        {                                                               \
+            small_mat_fill(small_mat_a, n, 3 * pass, SMALL_MAT_ONE, 0); \
+            small_mat_fill(small_mat_b, n, 3 * pass + 1, 2 * SMALL_MAT_ONE, 1); \
+            small_mat_fill(small_mat_q, n, 3 * pass + 2, SMALL_MAT_ONE, 1); \
+                                                                        \
+            arm_mat_sym_update_##n##x##n##_q31(small_mat_a, small_mat_b, \
+                                               (pass & 1) ? NULL : small_mat_q, \
+                                               small_mat_output_fut,    \
+                                               SMALL_MAT_FRAC_BITS);    \
+            ref_mat_sym_update_small_q31(small_mat_a, small_mat_b,      \
+                                         (pass & 1) ? NULL : small_mat_q, \
+                                         small_mat_output_ref, n,       \
+                                         SMALL_MAT_FRAC_BITS);          \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(small_mat_output_ref,                 \
+                                  small_mat_output_fut, n * n,          \
+                                  int64_t,                              \
+                                  SMALL_MAT_SYM_UPDATE_MAX_ERROR,       \
+                                  max_error);                           \
+                                                                        \
+            for (i = 0; i < n; i++)                                     \
+            {                                                           \
+                for (j = 0; j < i; j++)                                 \
+                {                                                       \
+                    TEST_ASSERT_EQUAL(small_mat_output_fut[i * n + j],  \
+                                      small_mat_output_fut[j * n + i]); \
+                }                                                       \
+            }                                                           \
+                                                                        \
+            /* In place */                                              \
+            arm_mat_sym_update_##n##x##n##_q31(small_mat_a, small_mat_b, \
+                                               (pass & 1) ? NULL : small_mat_q, \
+                                               small_mat_b,             \
+                                               SMALL_MAT_FRAC_BITS);    \
+            TEST_ASSERT_BUFFERS_EQUAL(small_mat_b, small_mat_output_fut, \
+                                      n * n * sizeof(q31_t));           \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error);        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_mat_sym_update_##n##x##n##_q31(small_mat_a, small_mat_b, \
+                                               small_mat_q,             \
+                                               small_mat_output_fut,    \
+                                               SMALL_MAT_FRAC_BITS));   \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+SMALL_MAT_SYM_UPDATE_DEFINE_TEST( 3 );
+SMALL_MAT_SYM_UPDATE_DEFINE_TEST( 4 );
+SMALL_MAT_SYM_UPDATE_DEFINE_TEST( 6 );
+
+/*
+  Symmetric positive definite solver test template, with n right-hand sides
+  solved in place. A matrix with a negative pivot must be rejected. Argument
+  is the size (3/4/6)
+*/
+#define SMALL_MAT_LDLT_SOLVE_DEFINE_TEST(n)                             \
+    JTEST_DEFINE_TEST(arm_mat_ldlt_solve_##n##x##n##_q31_test,          \
+                      arm_mat_ldlt_solve_##n##x##n##_q31)               \
+    {                                                                   \
+        int64_t max_error = 0;                                          \
+        uint32_t pass;                                                  \
+                                                                        \
+        for (pass = 0; pass < SMALL_MAT_PASSES; pass++)                 \
+        {                                                               \
+            small_mat_fill_spd(small_mat_a, n, 2 * pass);               \
+            small_mat_fill(small_mat_b, n, 2 * pass + 1, 2 * SMALL_MAT_ONE, 0); \
+                                                                        \
+            ref_mat_ldlt_solve_small_q31(small_mat_a, small_mat_b,      \
+                                         small_mat_output_ref, n, n,    \
+                                         SMALL_MAT_FRAC_BITS);          \
+            TEST_ASSERT_EQUAL(                                          \
+                arm_mat_ldlt_solve_##n##x##n##_q31(small_mat_a,         \
+                                                   small_mat_b,         \
+                                                   small_mat_b, n,      \
+                                                   SMALL_MAT_FRAC_BITS), \
+                ARM_MATH_SUCCESS);                                      \
+                                                                        \
+            TEST_ASSERT_MAX_ERROR(small_mat_output_ref, small_mat_b,    \
+                                  n * n, int64_t,                       \
+                                  SMALL_MAT_LDLT_SOLVE_MAX_ERROR,       \
+                                  max_error);                           \
+        }                                                               \
+                                                                        \
+        JTEST_DUMP_STRF("Max Error: %d LSB\n", (int) max_error);        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_mat_ldlt_solve_##n##x##n##_q31(small_mat_a, small_mat_b, \
+                                               small_mat_output_fut, 1, \
+                                               SMALL_MAT_FRAC_BITS));   \
+                                                                        \
+        /* Not positive definite */                                     \
+        small_mat_a[(n - 1) * n + n - 1] = -SMALL_MAT_ONE;              \
+        TEST_ASSERT_EQUAL(                                              \
+            arm_mat_ldlt_solve_##n##x##n##_q31(small_mat_a, small_mat_b, \
+                                               small_mat_output_fut, 1, \
+                                               SMALL_MAT_FRAC_BITS),    \
+            ARM_MATH_SINGULAR);                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+SMALL_MAT_LDLT_SOLVE_DEFINE_TEST( 3 );
+SMALL_MAT_LDLT_SOLVE_DEFINE_TEST( 4 );
+SMALL_MAT_LDLT_SOLVE_DEFINE_TEST( 6 );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( small_mat_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_mat_mult_3x3_q31_test );
+    JTEST_TEST_CALL( arm_mat_mult_4x4_q31_test );
+    JTEST_TEST_CALL( arm_mat_mult_6x6_q31_test );
+    JTEST_TEST_CALL( arm_mat_mult_trans_3x3_q31_test );
+    JTEST_TEST_CALL( arm_mat_mult_trans_4x4_q31_test );
+    JTEST_TEST_CALL( arm_mat_mult_trans_6x6_q31_test );
+    JTEST_TEST_CALL( arm_mat_sym_update_3x3_q31_test );
+    JTEST_TEST_CALL( arm_mat_sym_update_4x4_q31_test );
+    JTEST_TEST_CALL( arm_mat_sym_update_6x6_q31_test );
+    JTEST_TEST_CALL( arm_mat_ldlt_solve_3x3_q31_test );
+    JTEST_TEST_CALL( arm_mat_ldlt_solve_4x4_q31_test );
+    JTEST_TEST_CALL( arm_mat_ldlt_solve_6x6_q31_test );
+}
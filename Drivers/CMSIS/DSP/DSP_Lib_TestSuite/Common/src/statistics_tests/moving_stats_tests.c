@@ -0,0 +1,250 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define MOVING_STATS_MAX_STREAM_LEN 64
+
+static q15_t moving_stats_stream_q15[MOVING_STATS_MAX_STREAM_LEN];
+static q31_t moving_stats_stream_q31[MOVING_STATS_MAX_STREAM_LEN];
+
+/* Smoothing factors of the exponential moving statistics */
+static const q15_t exp_stats_alphas_q15[] = { 0x0800, 0x4000, 0x7FFF };
+static const q31_t exp_stats_alphas_q31[] = { 0x08000000, 0x40000000, 0x7FFFFFFF };
+
+/*
+  Builds the input stream from the bits of statistics_f_32. Every third sample
+  repeats the previous one, so that the windows hold equal values. The samples
+  are shifted right by shift bits. Returns the stream length.
+*/
+#define MOVING_STATS_DEFINE_STREAM(suffix, type)                        \
+    static uint32_t moving_stats_build_stream_##suffix(uint32_t shift)  \
+    {                                                                   \
+        type *pData = (type *) statistics_f_32.data_ptr;                \
+        uint32_t len = statistics_f_32.element_count *                  \
+            sizeof(float32_t) / sizeof(type);                           \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0; i < len; i++)                                       \
+        {                                                               \
+            moving_stats_stream_##suffix[i] = ((i % 3) == 2) ?          \
+                moving_stats_stream_##suffix[i - 1] :                   \
+                (type) (pData[i] >> shift);                             \
+        }                                                               \
+                                                                        \
+        return len;                                                     \
+    }
+
+MOVING_STATS_DEFINE_STREAM( q15, q15_t );
+MOVING_STATS_DEFINE_STREAM( q31, q31_t );
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Compare the result of a moving window function with the result of the block
+  function on the window. Arguments are: statistic (mean/var/std/rms), function
+  suffix (q15/q31) and output type
+*/
+#define MOVING_STATS_COMPARE(stat, suffix, type)                        \
+    do                                                                  \
+    {                                                                   \
+        type result_fut;                                                \
+        type result_ref;                                                \
+                                                                        \
+        arm_moving_##stat##_##suffix(&stats_inst, &result_fut);         \
+        arm_##stat##_##suffix(window, window_len, &result_ref);         \
+        TEST_ASSERT_EQUAL(result_fut, result_ref);                      \
+    } while (0)
+
+/*
+  Compare the result of a moving window minimum or maximum with the result of
+  the block function on the window. Arguments are: min/max, function suffix
+  (q15/q31) and output type
+*/
+#define MOVING_MINMAX_COMPARE(stat, suffix, type)                       \
+    do                                                                  \
+    {                                                                   \
+        type result_fut;                                                \
+        type result_ref;                                                \
+        uint32_t index_fut;                                             \
+        uint32_t index_ref;                                             \
+                                                                        \
+        arm_moving_##stat##_##suffix(&stat##_inst, pSrc, chunk,         \
+                                     &result_fut, &index_fut);          \
+        arm_##stat##_##suffix(window, window_len,                       \
+                              &result_ref, &index_ref);                 \
+        TEST_ASSERT_EQUAL(result_fut, result_ref);                      \
+        TEST_ASSERT_EQUAL(index_fut, index_ref);                        \
+    } while (0)
+
+/*
+  Moving window statistics test template. The stream is pushed in chunks of 1,
+  4 and 7 samples, and after each chunk the results are compared with the block
+  functions on the last window, zero padded at the start. Arguments are:
+  function suffix (q15/q31), input/output type (q15_t/q31_t) and the shift of
+  the input stream
+*/
+#define MOVING_STATS_DEFINE_TEST(suffix, type, shift)                   \
+    JTEST_DEFINE_TEST(arm_moving_stats_##suffix##_test,                 \
+                      arm_moving_stats_##suffix)                        \
+    {                                                                   \
+        arm_moving_stats_instance_##suffix stats_inst;                  \
+        arm_moving_minmax_instance_##suffix max_inst;                   \
+        arm_moving_minmax_instance_##suffix min_inst;                   \
+        type state[STATISTICS_MAX_WINDOW_LEN];                          \
+        type max_values[STATISTICS_MAX_WINDOW_LEN];                     \
+        type min_values[STATISTICS_MAX_WINDOW_LEN];                     \
+        uint32_t max_positions[STATISTICS_MAX_WINDOW_LEN];              \
+        uint32_t min_positions[STATISTICS_MAX_WINDOW_LEN];              \
+        type window[STATISTICS_MAX_WINDOW_LEN];                         \
+        type *pSrc;                                                     \
+        uint32_t len = moving_stats_build_stream_##suffix(shift);       \
+        uint32_t pos;                                                   \
+        uint32_t chunk;                                                 \
+        uint32_t i;                                                     \
+        int32_t k;                                                      \
+                                                                        \
+        /* Go through all window lengths */                             \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            win_idx, uint16_t, window_len, statistics_window_lens       \
+            ,                                                           \
+                                                                        \
+            if ((arm_moving_stats_init_##suffix(                        \
+                     &stats_inst, window_len, state)                    \
+                 != ARM_MATH_SUCCESS) ||                                \
+                (arm_moving_minmax_init_##suffix(                       \
+                     &max_inst, window_len, max_values, max_positions)  \
+                 != ARM_MATH_SUCCESS) ||                                \
+                (arm_moving_minmax_init_##suffix(                       \
+                     &min_inst, window_len, min_values, min_positions)  \
+                 != ARM_MATH_SUCCESS))                                  \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Window Length: %d\n"                       \
+                            "Stream Length: %d\n",                      \
+                            (int)window_len,                            \
+                            (int)len);                                  \
+                                                                        \
+            for (pos = 0, i = 0; pos < len; pos += chunk, i++)          \
+            {                                                           \
+                chunk = 3 * (i % 3) + 1;                                \
+                chunk = (chunk > len - pos) ? len - pos : chunk;        \
+                pSrc = moving_stats_stream_##suffix + pos;              \
+                                                                        \
+                arm_moving_stats_##suffix(&stats_inst, pSrc, chunk);    \
+                                                                        \
+                /* Copy the window, zero padded at the start */         \
+                for (k = 0; k < window_len; k++)                        \
+                {                                                       \
+                    int32_t src = (int32_t)(pos + chunk) -              \
+                        window_len + k;                                 \
+                    window[k] = (src < 0) ? 0 :                         \
+                        moving_stats_stream_##suffix[src];              \
+                }                                                       \
+                                                                        \
+                MOVING_STATS_COMPARE(mean, suffix, type);               \
+                MOVING_STATS_COMPARE(var, suffix, type);                \
+                MOVING_STATS_COMPARE(std, suffix, type);                \
+                MOVING_STATS_COMPARE(rms, suffix, type);                \
+                MOVING_MINMAX_COMPARE(max, suffix, type);               \
+                MOVING_MINMAX_COMPARE(min, suffix, type);               \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/* The Q31 stream is scaled down so that arm_rms_q31() does not overflow */
+MOVING_STATS_DEFINE_TEST( q31, q31_t, 2 );
+MOVING_STATS_DEFINE_TEST( q15, q15_t, 0 );
+
+/*
+  Exponential moving statistics test template. The stream is pushed in two
+  blocks and the estimates are compared with the reference. Arguments are:
+  function suffix (q15/q31) and input/output type (q15_t/q31_t)
+*/
+#define EXP_STATS_DEFINE_TEST(suffix, type)                             \
+    JTEST_DEFINE_TEST(arm_exp_stats_##suffix##_test,                    \
+                      arm_exp_stats_##suffix)                           \
+    {                                                                   \
+        arm_exp_stats_instance_##suffix exp_inst;                       \
+        type result_fut[2];                                             \
+        type result_ref[2];                                             \
+        uint32_t len = moving_stats_build_stream_##suffix(0);           \
+        uint32_t i;                                                     \
+                                                                        \
+        for (i = 0;                                                     \
+             i < sizeof(exp_stats_alphas_##suffix) / sizeof(type);      \
+             i++)                                                       \
+        {                                                               \
+            if (arm_exp_stats_init_##suffix(                            \
+                    &exp_inst, exp_stats_alphas_##suffix[i])            \
+                != ARM_MATH_SUCCESS)                                    \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Smoothing Factor: 0x%08X\n"                \
+                            "Stream Length: %d\n",                      \
+                            (int)exp_stats_alphas_##suffix[i],          \
+                            (int)len);                                  \
+                                                                        \
+            arm_exp_stats_##suffix(&exp_inst,                           \
+                                   moving_stats_stream_##suffix,        \
+                                   len / 2,                             \
+                                   &result_fut[0], &result_fut[1]);     \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_exp_stats_##suffix(                                 \
+                    &exp_inst,                                          \
+                    moving_stats_stream_##suffix + len / 2,             \
+                    len - len / 2,                                      \
+                    &result_fut[0], &result_fut[1]));                   \
+                                                                        \
+            ref_exp_stats_##suffix(moving_stats_stream_##suffix, len,   \
+                                   exp_stats_alphas_##suffix[i],        \
+                                   &result_ref[0], &result_ref[1]);     \
+                                                                        \
+            /* Test correctness */                                      \
+            TEST_CONVERT_AND_ASSERT_SNR(                                \
+                statistics_output_f32_ref,                              \
+                result_ref,                                             \
+                statistics_output_f32_fut,                              \
+                result_fut,                                             \
+                2,                                                      \
+                type,                                                   \
+                STATISTICS_SNR_THRESHOLD_##type);                       \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+EXP_STATS_DEFINE_TEST( q31, q31_t );
+EXP_STATS_DEFINE_TEST( q15, q15_t );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( moving_stats_tests )
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL( arm_moving_stats_q31_test );
+    JTEST_TEST_CALL( arm_moving_stats_q15_test );
+    JTEST_TEST_CALL( arm_exp_stats_q31_test );
+    JTEST_TEST_CALL( arm_exp_stats_q15_test );
+}
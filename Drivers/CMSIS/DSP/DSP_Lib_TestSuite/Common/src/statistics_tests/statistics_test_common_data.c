@@ -38,6 +38,11 @@ ARR_DESC_DEFINE( uint32_t,
                  4,
                  CURLY( 1, 2, 15, 32 ) );
 
+ARR_DESC_DEFINE( uint16_t,
+                 statistics_window_lens,
+                 4,
+                 CURLY( 1, 2, 7, 16 ) );
+
 /*--------------------------------------------------------------------------------*/
 /* Test Data */
 /*--------------------------------------------------------------------------------*/
@@ -0,0 +1,311 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "arm_const_structs.h"
+#include "test_templates.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define CFFT_BFP_MAX_LEN 1024
+
+/* Input levels, in dB below full scale */
+static const int32_t cfft_bfp_levels[] = { 0, 12, 24, 36, 48, 60, 72 };
+
+#define CFFT_BFP_NUM_LEVELS (sizeof(cfft_bfp_levels) / sizeof(cfft_bfp_levels[0]))
+
+static const arm_cfft_instance_q15 *cfft_bfp_structs[] =
+{
+    &arm_cfft_sR_q15_len16,
+    &arm_cfft_sR_q15_len32,
+    &arm_cfft_sR_q15_len64,
+    &arm_cfft_sR_q15_len256,
+    &arm_cfft_sR_q15_len1024
+};
+
+#define CFFT_BFP_NUM_STRUCTS (sizeof(cfft_bfp_structs) / sizeof(cfft_bfp_structs[0]))
+
+/* Minimum SNR of the block floating point transform at any input level, for
+   each of cfft_bfp_structs. It loses about 3 dB for each doubling of fftLen. */
+static const float32_t cfft_bfp_snr_thresholds[] = { 75, 70, 70, 65, 58 };
+
+static q15_t cfft_bfp_input[2 * CFFT_BFP_MAX_LEN];
+static q15_t cfft_bfp_output_fut[2 * CFFT_BFP_MAX_LEN];
+static q15_t cfft_bfp_output_q15[2 * CFFT_BFP_MAX_LEN];
+static float32_t cfft_bfp_output_f32_fut[2 * CFFT_BFP_MAX_LEN];
+static float32_t cfft_bfp_output_f32_ref[2 * CFFT_BFP_MAX_LEN];
+
+/*
+  Builds a complex input of fftLen samples: a scrambled noise with peaks at
+  half of full scale divided by 10^(level/20), plus a tone at the same level.
+*/
+static void cfft_bfp_build_input(uint32_t fftLen, int32_t level)
+{
+    float64_t scale = 0.25 * pow(10.0, -level / 20.0);
+    uint32_t noise;
+    uint32_t i;
+
+    for (i = 0; i < 2 * fftLen; i++)
+    {
+        noise = (i + 1) * 2654435761U;
+        cfft_bfp_input[i] = (q15_t) floor(32768.0 * scale *
+            (((float64_t) (noise >> 8) / 8388608.0 - 1.0) +
+             cos(0.3 * i)) + 0.5);
+    }
+}
+
+/*
+  Full scale inputs, which drive the butterflies to their overflow margin, for
+  lengths that are powers of 4 and lengths that start with a radix-2 stage.
+*/
+static const arm_cfft_instance_q15 *cfft_bfp_full_scale_structs[] =
+{
+    &arm_cfft_sR_q15_len16,
+    &arm_cfft_sR_q15_len32,
+    &arm_cfft_sR_q15_len64,
+    &arm_cfft_sR_q15_len128,
+    &arm_cfft_sR_q15_len256,
+    &arm_cfft_sR_q15_len512,
+    &arm_cfft_sR_q15_len1024
+};
+
+#define CFFT_BFP_NUM_FULL_SCALE_STRUCTS \
+    (sizeof(cfft_bfp_full_scale_structs) / sizeof(cfft_bfp_full_scale_structs[0]))
+
+/* Minimum SNR of the full scale inputs, for each of cfft_bfp_full_scale_structs */
+static const float32_t cfft_bfp_full_scale_thresholds[] = { 75, 75, 72, 70, 68, 65, 62 };
+
+typedef enum
+{
+    CFFT_BFP_NEGATIVE,          /* -32768 on both parts */
+    CFFT_BFP_ALTERNATING,       /* +-full scale, the imaginary part lagging */
+    CFFT_BFP_TONE_LOW,          /* Full scale tone at 45 degrees, bin 1 */
+    CFFT_BFP_TONE_HIGH,         /* Full scale tone at 45 degrees, bin fftLen/4+1 */
+    CFFT_BFP_NUM_FULL_SCALE
+} cfft_bfp_full_scale_t;
+
+/*
+  Builds a complex full scale input of fftLen samples. The tones have an
+  amplitude of sqrt(2) times full scale and are clipped, so that both the real
+  and the imaginary parts reach full scale.
+*/
+static void cfft_bfp_build_full_scale(uint32_t fftLen, cfft_bfp_full_scale_t pattern)
+{
+    float64_t phase;
+    float64_t re, im;
+    uint32_t bin = (pattern == CFFT_BFP_TONE_LOW) ? 1 : fftLen / 4 + 1;
+    uint32_t i;
+
+    for (i = 0; i < fftLen; i++)
+    {
+        switch (pattern)
+        {
+        case CFFT_BFP_NEGATIVE:
+            re = -32768.0;
+            im = -32768.0;
+            break;
+
+        case CFFT_BFP_ALTERNATING:
+            re = (i & 1) ? -32768.0 : 32767.0;
+            im = (i & 2) ? -32768.0 : 32767.0;
+            break;
+
+        default:
+            phase = 2.0 * PI * (float64_t) ((bin * i) % fftLen) / fftLen + PI / 4.0;
+            re = floor(1.41421356 * 32767.0 * cos(phase) + 0.5);
+            im = floor(1.41421356 * 32767.0 * sin(phase) + 0.5);
+            break;
+        }
+
+        cfft_bfp_input[2 * i] = (q15_t) ((re > 32767.0) ? 32767.0 : (re < -32768.0) ? -32768.0 : re);
+        cfft_bfp_input[2 * i + 1] = (q15_t) ((im > 32767.0) ? 32767.0 : (im < -32768.0) ? -32768.0 : im);
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Block floating point CFFT test template. For each length and input level,
+  the output scaled by its exponent is compared with the floating point
+  transform, and so is the output of arm_cfft_q15() scaled back. The SNR of
+  both is displayed, giving the SNR against the input level, and the SNR of
+  the block floating point transform must be above the threshold of the
+  length and above the SNR of arm_cfft_q15(). Arguments are: inverse-transform flag,
+  and test name suffix.
+*/
+#define CFFT_BFP_DEFINE_TEST(ifft_flag, config_suffix)                      \
+    JTEST_DEFINE_TEST(arm_cfft_bfp_q15_##config_suffix##_test,              \
+                      arm_cfft_bfp_q15)                                     \
+    {                                                                       \
+        const arm_cfft_instance_q15 *cfft_inst;                             \
+        uint32_t fftLen;                                                    \
+        int32_t exponent;                                                   \
+        float32_t snr_fut;                                                  \
+        float32_t snr_q15;                                                  \
+        uint32_t s, l, i;                                                   \
+                                                                            \
+        for (s = 0; s < CFFT_BFP_NUM_STRUCTS; s++)                          \
+        {                                                                   \
+            cfft_inst = cfft_bfp_structs[s];                                \
+            fftLen = cfft_inst->fftLen;                                     \
+                                                                            \
+            for (l = 0; l < CFFT_BFP_NUM_LEVELS; l++)                       \
+            {                                                               \
+                cfft_bfp_build_input(fftLen, cfft_bfp_levels[l]);           \
+                memcpy(cfft_bfp_output_fut, cfft_bfp_input,                 \
+                       2 * fftLen * sizeof(q15_t));                         \
+                memcpy(cfft_bfp_output_q15, cfft_bfp_input,                 \
+                       2 * fftLen * sizeof(q15_t));                         \
+                                                                            \
+                JTEST_COUNT_CYCLES(                                         \
+                    exponent = arm_cfft_bfp_q15(cfft_inst,                  \
+                                                cfft_bfp_output_fut,        \
+                                                ifft_flag));                \
+                arm_cfft_q15(cfft_inst, cfft_bfp_output_q15, ifft_flag, 1); \
+                ref_cfft_bfp_q15(cfft_inst, cfft_bfp_input,                 \
+                                 cfft_bfp_output_f32_ref, ifft_flag);       \
+                                                                            \
+                for (i = 0; i < 2 * fftLen; i++)                            \
+                {                                                           \
+                    cfft_bfp_output_f32_fut[i] = (float32_t)                \
+                        ldexp(cfft_bfp_output_fut[i], exponent - 15);       \
+                }                                                           \
+                                                                            \
+                snr_fut = arm_snr_f32(cfft_bfp_output_f32_ref,              \
+                                      cfft_bfp_output_f32_fut,              \
+                                      2 * fftLen);                          \
+                                                                            \
+                /* The forward arm_cfft_q15() divides by fftLen */          \
+                for (i = 0; i < 2 * fftLen; i++)                            \
+                {                                                           \
+                    cfft_bfp_output_f32_fut[i] = (float32_t)                \
+                        ldexp(cfft_bfp_output_q15[i], -15) *                \
+                        ((ifft_flag) ? 1 : fftLen);                         \
+                }                                                           \
+                                                                            \
+                snr_q15 = arm_snr_f32(cfft_bfp_output_f32_ref,              \
+                                      cfft_bfp_output_f32_fut,              \
+                                      2 * fftLen);                          \
+                                                                            \
+                /* Display parameter values and SNRs */                     \
+                JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                                "Input Level: -%d dB\n"                     \
+                                "Exponent: %d\n"                            \
+                                "SNR arm_cfft_bfp_q15: %d dB\n"             \
+                                "SNR arm_cfft_q15: %d dB\n",                \
+                                (int) fftLen,                               \
+                                (int) cfft_bfp_levels[l],                   \
+                                (int) exponent,                             \
+                                (int) snr_fut,                              \
+                                (int) snr_q15);                             \
+                                                                            \
+                if ((snr_fut < cfft_bfp_snr_thresholds[s]) ||               \
+                    (snr_fut < snr_q15))                                    \
+                {                                                           \
+                    return JTEST_TEST_FAILED;                               \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CFFT_BFP_DEFINE_TEST(0, forward);
+CFFT_BFP_DEFINE_TEST(1, inverse);
+
+/*
+  Full scale test template. An overflow in a butterfly wraps around and ruins
+  the SNR, which must stay above the threshold of the length for each full
+  scale input. Arguments are: inverse-transform flag, and test name suffix.
+*/
+#define CFFT_BFP_FULL_SCALE_DEFINE_TEST(ifft_flag, config_suffix)           \
+    JTEST_DEFINE_TEST(arm_cfft_bfp_q15_full_scale_##config_suffix##_test,   \
+                      arm_cfft_bfp_q15)                                     \
+    {                                                                       \
+        const arm_cfft_instance_q15 *cfft_inst;                             \
+        uint32_t fftLen;                                                    \
+        int32_t exponent;                                                   \
+        float32_t snr_fut;                                                  \
+        uint32_t s, p, i;                                                   \
+                                                                            \
+        for (s = 0; s < CFFT_BFP_NUM_FULL_SCALE_STRUCTS; s++)               \
+        {                                                                   \
+            cfft_inst = cfft_bfp_full_scale_structs[s];                     \
+            fftLen = cfft_inst->fftLen;                                     \
+                                                                            \
+            for (p = 0; p < CFFT_BFP_NUM_FULL_SCALE; p++)                   \
+            {                                                               \
+                cfft_bfp_build_full_scale(fftLen, (cfft_bfp_full_scale_t) p); \
+                memcpy(cfft_bfp_output_fut, cfft_bfp_input,                 \
+                       2 * fftLen * sizeof(q15_t));                         \
+                                                                            \
+                exponent = arm_cfft_bfp_q15(cfft_inst, cfft_bfp_output_fut, \
+                                            ifft_flag);                     \
+                ref_cfft_bfp_q15(cfft_inst, cfft_bfp_input,                 \
+                                 cfft_bfp_output_f32_ref, ifft_flag);       \
+                                                                            \
+                for (i = 0; i < 2 * fftLen; i++)                            \
+                {                                                           \
+                    cfft_bfp_output_f32_fut[i] = (float32_t)                \
+                        ldexp(cfft_bfp_output_fut[i], exponent - 15);       \
+                }                                                           \
+                                                                            \
+                snr_fut = arm_snr_f32(cfft_bfp_output_f32_ref,              \
+                                      cfft_bfp_output_f32_fut,              \
+                                      2 * fftLen);                          \
+                                                                            \
+                /* Display parameter values and SNR */                      \
+                JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                                "Input Pattern: %d\n"                       \
+                                "Exponent: %d\n"                            \
+                                "SNR arm_cfft_bfp_q15: %d dB\n",            \
+                                (int) fftLen,                               \
+                                (int) p,                                    \
+                                (int) exponent,                             \
+                                (int) snr_fut);                             \
+                                                                            \
+                if (snr_fut < cfft_bfp_full_scale_thresholds[s])            \
+                {                                                           \
+                    return JTEST_TEST_FAILED;                               \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CFFT_BFP_FULL_SCALE_DEFINE_TEST(0, forward);
+CFFT_BFP_FULL_SCALE_DEFINE_TEST(1, inverse);
+
+/*
+  An input of zeros gives an output of zeros with an exponent of 0.
+*/
+JTEST_DEFINE_TEST(arm_cfft_bfp_q15_zero_test, arm_cfft_bfp_q15)
+{
+    memset(cfft_bfp_output_fut, 0, sizeof(cfft_bfp_output_fut));
+    memset(cfft_bfp_output_q15, 0, sizeof(cfft_bfp_output_q15));
+
+    TEST_ASSERT_EQUAL(arm_cfft_bfp_q15(&arm_cfft_sR_q15_len256,
+                                       cfft_bfp_output_fut, 0), 0);
+    TEST_ASSERT_BUFFERS_EQUAL(cfft_bfp_output_fut, cfft_bfp_output_q15,
+                              sizeof(cfft_bfp_output_fut));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_bfp_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_forward_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_full_scale_forward_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_full_scale_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_bfp_q15_zero_test);
+}
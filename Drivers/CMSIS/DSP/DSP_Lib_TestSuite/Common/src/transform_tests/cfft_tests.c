@@ -1,6 +1,7 @@
 #include "jtest.h"
 #include "ref.h"
 #include "arr_desc.h"
+#include "arm_common_tables.h"
 #include "transform_templates.h"
 #include "transform_test_data.h"
 
@@ -96,6 +97,68 @@
     } while (0)
 
 
+/* Twiddle and bit reversal buffers of the CFFT instances initialized in RAM */
+static float32_t cfft_ram_twiddle[2 * 4096];
+static uint16_t cfft_ram_bitrev[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
+
+/*
+  CFFT with tables in RAM test template. The instance of each length is
+  initialized with arm_cfft_ram_init_xxx() and compared with the reference
+  run with the constant instance. Arguments are: inverse-transform flag,
+  function suffix (q15/q31/f32) and the output type (q15_t, q31_t, float32_t)
+*/
+#define CFFT_RAM_TEST_BODY(ifft_flag, suffix, output_type)                              \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_instance_##suffix cfft_inst_ram;                                       \
+                                                                                        \
+        /* Go through all arm_cfft_instances */                                         \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,           \
+            transform_cfft_##suffix##_structs                                           \
+            ,                                                                           \
+                                                                                        \
+            if ((arm_cfft_ram_init_##suffix(&cfft_inst_ram,                             \
+                                            cfft_inst_ptr->fftLen,                      \
+                                            (output_type *) cfft_ram_twiddle,           \
+                                            cfft_ram_bitrev) != ARM_MATH_SUCCESS) ||    \
+                (cfft_inst_ram.bitRevLength != cfft_inst_ptr->bitRevLength))            \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_##suffix##_inputs,                                        \
+                cfft_inst_ptr->fftLen *                                                 \
+                sizeof(output_type) *                                                   \
+                2 /*complex_inputs*/);                                                  \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)cfft_inst_ptr->fftLen,                                 \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_##suffix(&cfft_inst_ram,                                       \
+                             (void *) transform_fft_inplace_input_fut,                  \
+                             ifft_flag,              /* IFFT Flag */                    \
+                             1));            /* Bitreverse flag */                      \
+            ref_cfft_##suffix(cfft_inst_ptr,                                            \
+                         (void *) transform_fft_inplace_input_ref,                      \
+                         ifft_flag,         /* IFFT Flag */                             \
+                         1);        /* Bitreverse flag */                               \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                cfft_inst_ptr->fftLen,                                                  \
+                output_type));                                                          \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
 /* Test declarations */
 JTEST_DEFINE_TEST( cfft_f32_test, cfft_f32 )
 {
@@ -127,6 +190,36 @@ JTEST_DEFINE_TEST( cfft_q15_ifft_test, cfft_q15 )
     CFFT_TEST_BODY( ( uint8_t ) 1, q15, q15_t );
 }
 
+JTEST_DEFINE_TEST( cfft_ram_f32_test, cfft_ram_f32 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 0, f32, float32_t );
+}
+
+JTEST_DEFINE_TEST( cfft_ram_f32_ifft_test, cfft_ram_f32 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 1, f32, float32_t );
+}
+
+JTEST_DEFINE_TEST( cfft_ram_q31_test, cfft_ram_q31 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 0, q31, q31_t );
+}
+
+JTEST_DEFINE_TEST( cfft_ram_q31_ifft_test, cfft_ram_q31 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 1, q31, q31_t );
+}
+
+JTEST_DEFINE_TEST( cfft_ram_q15_test, cfft_ram_q15 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 0, q15, q15_t );
+}
+
+JTEST_DEFINE_TEST( cfft_ram_q15_ifft_test, cfft_ram_q15 )
+{
+    CFFT_RAM_TEST_BODY( ( uint8_t ) 1, q15, q15_t );
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -141,4 +234,13 @@ JTEST_DEFINE_GROUP( cfft_tests )
 
     JTEST_TEST_CALL( cfft_q15_test );
     JTEST_TEST_CALL( cfft_q15_ifft_test );
+
+    JTEST_TEST_CALL( cfft_ram_f32_test );
+    JTEST_TEST_CALL( cfft_ram_f32_ifft_test );
+
+    JTEST_TEST_CALL( cfft_ram_q31_test );
+    JTEST_TEST_CALL( cfft_ram_q31_ifft_test );
+
+    JTEST_TEST_CALL( cfft_ram_q15_test );
+    JTEST_TEST_CALL( cfft_ram_q15_ifft_test );
 }
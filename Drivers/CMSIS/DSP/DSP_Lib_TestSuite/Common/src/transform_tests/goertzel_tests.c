@@ -0,0 +1,189 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arm_math.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+#define GOERTZEL_NUM_BINS 8
+
+/* DC, integer and fractional bins of the block lengths, and Nyquist */
+static const q15_t goertzel_freqs_q15[GOERTZEL_NUM_BINS] =
+{
+    0x0000, 0x0080, 0x0200, 0x0A3D, 0x1234, 0x2A00, 0x3F80, 0x4000
+};
+
+static const q31_t goertzel_freqs_q31[GOERTZEL_NUM_BINS] =
+{
+    0x00000000, 0x00800000, 0x02000000, 0x0A3D70A4,
+    0x12345678, 0x2A000000, 0x3F800000, 0x40000000
+};
+
+#define SLIDING_DFT_LENGTH   64
+#define SLIDING_DFT_NUM_BINS 6
+#define SLIDING_DFT_SRC_LEN  ( 3 * SLIDING_DFT_LENGTH + 13 )
+
+static const uint16_t sliding_dft_bins[SLIDING_DFT_NUM_BINS] =
+{
+    0, 1, 5, 17, 31, 32
+};
+
+/* The input is pushed in chunks of these sizes, the last one takes the rest */
+static const uint32_t sliding_dft_chunks[] =
+{
+    1, 7, 64, 3, 100
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Goertzel function test template. Arguments are: function suffix (q15/q31)
+  and input/output type (q15_t/q31_t)
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, output_type)                       \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                     \
+                      arm_goertzel_##suffix)                            \
+    {                                                                   \
+        CONCAT(arm_goertzel_instance_, suffix) goertzel_inst = {0};     \
+        q31_t coeffs[2 * GOERTZEL_NUM_BINS];                            \
+                                                                        \
+        /* Go through all block lengths */                              \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            blocklen_idx, uint16_t, blocklen,                           \
+            transform_goertzel_blocklens                                \
+            ,                                                           \
+                                                                        \
+            if (arm_goertzel_init_##suffix(                             \
+                    &goertzel_inst, GOERTZEL_NUM_BINS, blocklen,        \
+                    goertzel_freqs_##suffix,                            \
+                    coeffs) != ARM_MATH_SUCCESS)                        \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_##suffix##_inputs,                        \
+                blocklen * sizeof(output_type));                        \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Number of Bins: %d\n",                     \
+                            (int)blocklen,                              \
+                            (int)GOERTZEL_NUM_BINS);                    \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_goertzel_##suffix(                                  \
+                    &goertzel_inst,                                     \
+                    (void *) transform_fft_input_fut,                   \
+                    (void *) transform_fft_output_fut));                \
+                                                                        \
+            ref_goertzel_##suffix(                                      \
+                (void *) transform_fft_input_ref,                       \
+                blocklen,                                               \
+                goertzel_freqs_##suffix,                                \
+                GOERTZEL_NUM_BINS,                                      \
+                (void *) transform_fft_output_ref);                     \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                      \
+                GOERTZEL_NUM_BINS,                                      \
+                output_type));                                          \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+GOERTZEL_DEFINE_TEST( q31, TYPE_FROM_ABBREV( q31 ) );
+GOERTZEL_DEFINE_TEST( q15, TYPE_FROM_ABBREV( q15 ) );
+
+/*
+  Sliding DFT function test template. Arguments are: function suffix
+  (q15/q31) and input/output type (q15_t/q31_t)
+*/
+#define SLIDING_DFT_DEFINE_TEST(suffix, output_type)                    \
+    JTEST_DEFINE_TEST(arm_sliding_dft_##suffix##_test,                  \
+                      arm_sliding_dft_##suffix)                         \
+    {                                                                   \
+        CONCAT(arm_sliding_dft_instance_, suffix) sdft_inst = {0};      \
+        q31_t twiddle[2 * SLIDING_DFT_NUM_BINS];                        \
+        q31_t state[2 * SLIDING_DFT_NUM_BINS];                          \
+        output_type delay[SLIDING_DFT_LENGTH];                          \
+        output_type *pSrc = (output_type *) transform_fft_input_fut;    \
+        uint32_t remaining = SLIDING_DFT_SRC_LEN;                       \
+        uint32_t chunk;                                                 \
+        uint32_t i;                                                     \
+                                                                        \
+        if (arm_sliding_dft_init_##suffix(                              \
+                &sdft_inst, SLIDING_DFT_NUM_BINS, SLIDING_DFT_LENGTH,   \
+                sliding_dft_bins, twiddle, delay, state)                \
+            != ARM_MATH_SUCCESS)                                        \
+        {                                                               \
+            return JTEST_TEST_FAILED;                                   \
+        }                                                               \
+                                                                        \
+        TRANSFORM_COPY_INPUTS(                                          \
+            transform_fft_##suffix##_inputs,                            \
+            SLIDING_DFT_SRC_LEN * sizeof(output_type));                 \
+                                                                        \
+        /* Display parameter values */                                  \
+        JTEST_DUMP_STRF("DFT Length: %d\n"                              \
+                        "Number of Bins: %d\n"                          \
+                        "Input Length: %d\n",                           \
+                        (int)SLIDING_DFT_LENGTH,                        \
+                        (int)SLIDING_DFT_NUM_BINS,                      \
+                        (int)SLIDING_DFT_SRC_LEN);                      \
+                                                                        \
+        /* Push the input in chunks, the window slides across them */   \
+        for (i = 0; remaining > 0U; i++)                                \
+        {                                                               \
+            chunk = (i < sizeof(sliding_dft_chunks) / sizeof(uint32_t)) ? \
+                sliding_dft_chunks[i] : remaining;                      \
+            chunk = (chunk > remaining) ? remaining : chunk;            \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_sliding_dft_##suffix(                               \
+                    &sdft_inst, pSrc,                                   \
+                    (void *) transform_fft_output_fut,                  \
+                    chunk));                                            \
+                                                                        \
+            pSrc += chunk;                                              \
+            remaining -= chunk;                                         \
+        }                                                               \
+                                                                        \
+        ref_sliding_dft_##suffix(                                       \
+            (void *) transform_fft_input_ref,                           \
+            SLIDING_DFT_SRC_LEN,                                        \
+            SLIDING_DFT_LENGTH,                                         \
+            sliding_dft_bins,                                           \
+            SLIDING_DFT_NUM_BINS,                                       \
+            (void *) transform_fft_output_ref);                         \
+                                                                        \
+        /* Test correctness */                                          \
+        SLIDING_DFT_SNR_COMPARE_INTERFACE(                              \
+            2 * SLIDING_DFT_NUM_BINS,                                   \
+            output_type);                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+SLIDING_DFT_DEFINE_TEST( q31, TYPE_FROM_ABBREV( q31 ) );
+SLIDING_DFT_DEFINE_TEST( q15, TYPE_FROM_ABBREV( q15 ) );
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP( goertzel_tests )
+{
+    JTEST_TEST_CALL( arm_goertzel_q31_test );
+    JTEST_TEST_CALL( arm_goertzel_q15_test );
+    JTEST_TEST_CALL( arm_sliding_dft_q31_test );
+    JTEST_TEST_CALL( arm_sliding_dft_q15_test );
+}
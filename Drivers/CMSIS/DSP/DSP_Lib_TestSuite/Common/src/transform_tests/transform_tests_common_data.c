@@ -3250,6 +3250,12 @@ ARR_DESC_DEFINE( uint16_t,
                      32, 64, 128, 256,
                      512, 1024, 2048 ) );
 
+ARR_DESC_DEFINE( uint16_t,
+                 transform_goertzel_blocklens,
+                 3,
+                 CURLY(
+                     64, 205, 256 ) );
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bitreversal_host.c
+ * Description:  C version of arm_bitreversal_32 and arm_bitreversal_16
+ *               for the host build of the test suite.
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: host (x86, AArch64)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdint.h>
+
+/*
+ * The library implements these two functions in arm_bitreversal2.S, which
+ * only assembles for Thumb. The versions below follow the Cortex-M0 code of
+ * that file: the table holds pairs of byte offsets into a buffer of 32-bit
+ * complex values, and each pair of complex samples is swapped.
+ */
+
+void arm_bitreversal_32(
+    uint32_t *pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t *pBitRevTab )
+{
+    uint32_t i, a, b, tmp;
+
+    for( i = ( bitRevLen + 1U ) >> 1U; i > 0U; i-- )
+    {
+        a = pBitRevTab[0] >> 2U;
+        b = pBitRevTab[1] >> 2U;
+
+        tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        tmp = pSrc[a + 1U];
+        pSrc[a + 1U] = pSrc[b + 1U];
+        pSrc[b + 1U] = tmp;
+
+        pBitRevTab += 2;
+    }
+}
+
+void arm_bitreversal_16(
+    uint16_t *pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t *pBitRevTab )
+{
+    uint32_t i, a, b;
+    uint16_t tmp;
+
+    /* The table is shared with the 32-bit version, offsets are halved */
+    for( i = ( bitRevLen + 1U ) >> 1U; i > 0U; i-- )
+    {
+        a = pBitRevTab[0] >> 2U;
+        b = pBitRevTab[1] >> 2U;
+
+        tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        tmp = pSrc[a + 1U];
+        pSrc[a + 1U] = pSrc[b + 1U];
+        pSrc[b + 1U] = tmp;
+
+        pBitRevTab += 2;
+    }
+}
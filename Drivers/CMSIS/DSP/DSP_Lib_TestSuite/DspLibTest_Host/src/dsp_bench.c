@@ -0,0 +1,588 @@
+/*
+ * Host timing harness for the CMSIS-DSP library.
+ *
+ * Runs a set of kernels of the library and the matching functions of the
+ * reference libraries on the same data and prints the time per sample of
+ * both, for several block sizes.
+ *
+ * Usage: DspLibBench_Host [--quick] [--csv]
+ *   --quick  smallest size only and short measurements (used by ctest)
+ *   --csv    print comma separated values instead of a table
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "ref.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define BENCH_MAX_SIZE      1024
+#define BENCH_FIR_TAPS      32
+#define BENCH_BIQUAD_STAGES 2
+#define BENCH_RESAMPLE_L    3
+#define BENCH_RESAMPLE_M    10
+#define BENCH_RESAMPLE_TAPS 30
+#define BENCH_CONV_MAX_TAPS 512
+#define BENCH_CONV_MAX_FFT  (4 * BENCH_CONV_MAX_TAPS)
+#define BENCH_CONV_LEN      4096
+#define BENCH_MEDIAN_MAX_WINDOW 127
+
+static const uint32_t bench_sizes[] = { 64, 256, 1024 };
+static const uint16_t bench_median_windows[] = { 5, 15, 31, 63, 127 };
+
+static uint64_t bench_min_ns = 50000000U;   /* Time spent per measurement */
+static uint32_t bench_size_count = sizeof( bench_sizes ) / sizeof( bench_sizes[0] );
+static int      bench_csv = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Buffers */
+/*--------------------------------------------------------------------------------*/
+
+static float32_t bench_in_f32[2 * BENCH_MAX_SIZE];
+static q31_t     bench_in_q31[2 * BENCH_MAX_SIZE];
+static q15_t     bench_in_q15[2 * BENCH_MAX_SIZE];
+
+static float32_t bench_out_f32[2 * BENCH_MAX_SIZE];
+static q31_t     bench_out_q31[2 * BENCH_MAX_SIZE];
+static q15_t     bench_out_q15[2 * BENCH_MAX_SIZE];
+static int8_t    bench_shift[BENCH_MAX_SIZE];
+
+static float32_t bench_state_f32[BENCH_MAX_SIZE + BENCH_FIR_TAPS];
+static q31_t     bench_state_q31[BENCH_MAX_SIZE + BENCH_FIR_TAPS];
+static q15_t     bench_state_q15[BENCH_MAX_SIZE + BENCH_FIR_TAPS];
+
+static float32_t bench_fir_coeffs_f32[BENCH_FIR_TAPS];
+static q31_t     bench_fir_coeffs_q31[BENCH_FIR_TAPS];
+static q15_t     bench_fir_coeffs_q15[BENCH_FIR_TAPS];
+
+/* Interpolator state, upsampled signal and decimator state of the chained resampler */
+static q15_t     bench_interp_state_q15[BENCH_MAX_SIZE + BENCH_FIR_TAPS];
+static q15_t     bench_upsampled_q15[BENCH_RESAMPLE_L * BENCH_MAX_SIZE];
+static q15_t     bench_decim_state_q15[BENCH_RESAMPLE_L * BENCH_MAX_SIZE];
+static q15_t     bench_decim_coeff_q15[1] = { 0x7FFF };
+
+/* Taps, spectrum, state and scratch of the FFT convolutions */
+static q31_t     bench_conv_in_q31[BENCH_CONV_LEN];
+static q15_t     bench_conv_in_q15[BENCH_CONV_LEN];
+static q31_t     bench_conv_out_q31[BENCH_CONV_LEN];
+static q15_t     bench_conv_out_q15[BENCH_CONV_LEN];
+static q31_t     bench_conv_coeffs_q31[BENCH_CONV_MAX_TAPS];
+static q15_t     bench_conv_coeffs_q15[BENCH_CONV_MAX_TAPS];
+static q31_t     bench_conv_freq_q31[BENCH_CONV_MAX_FFT + 2];
+static q15_t     bench_conv_freq_q15[BENCH_CONV_MAX_FFT + 2];
+static q31_t     bench_conv_state_q31[BENCH_CONV_MAX_FFT];
+static q15_t     bench_conv_state_q15[BENCH_CONV_MAX_FFT];
+static q31_t     bench_conv_scratch_q31[3 * BENCH_CONV_MAX_FFT];
+static q15_t     bench_conv_scratch_q15[3 * BENCH_CONV_MAX_FFT];
+
+/* Running median and Hampel filters */
+static q31_t     bench_median_state_q31[BENCH_MEDIAN_MAX_WINDOW];
+static q15_t     bench_median_state_q15[BENCH_MEDIAN_MAX_WINDOW];
+static int16_t   bench_median_heap[2 * BENCH_MEDIAN_MAX_WINDOW];
+static q31_t     bench_median_sorted_q31[BENCH_MEDIAN_MAX_WINDOW];
+static q15_t     bench_median_sorted_q15[BENCH_MEDIAN_MAX_WINDOW];
+
+/* b0, b1, b2, a1, a2 per stage, q15 has an extra zero after b0 */
+static float32_t bench_biquad_coeffs_f32[5 * BENCH_BIQUAD_STAGES];
+static q31_t     bench_biquad_coeffs_q31[5 * BENCH_BIQUAD_STAGES];
+static q15_t     bench_biquad_coeffs_q15[6 * BENCH_BIQUAD_STAGES];
+
+/*--------------------------------------------------------------------------------*/
+/* Timing */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t bench_now_ns( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( ( uint64_t ) ts.tv_sec * 1000000000U ) + ( uint64_t ) ts.tv_nsec;
+}
+
+/**
+ *  Repeat call for at least bench_min_ns and store the average time of one
+ *  call, in nanoseconds, in result.
+ */
+#define BENCH_NS(result, call)                                          \
+    do                                                                  \
+    {                                                                   \
+        uint64_t __bench_start;                                         \
+        uint64_t __bench_elapsed;                                       \
+        uint32_t __bench_iter = 0;                                      \
+                                                                        \
+        call;                   /* Warm up */                           \
+        __bench_start = bench_now_ns();                                 \
+        do                                                              \
+        {                                                               \
+            call;                                                       \
+            __bench_iter++;                                             \
+            __bench_elapsed = bench_now_ns() - __bench_start;           \
+        } while (__bench_elapsed < bench_min_ns);                       \
+                                                                        \
+        result = (double) __bench_elapsed / __bench_iter;               \
+    } while (0)
+
+/**
+ *  Time fut_call and ref_call, processing size samples each, and print one
+ *  result line.
+ */
+#define BENCH_RUN(name, size, fut_call, ref_call)                       \
+    do                                                                  \
+    {                                                                   \
+        double __bench_fut_ns;                                          \
+        double __bench_ref_ns;                                          \
+                                                                        \
+        BENCH_NS(__bench_fut_ns, fut_call);                             \
+        BENCH_NS(__bench_ref_ns, ref_call);                             \
+        bench_print(name, size, __bench_fut_ns / (size),                \
+                    __bench_ref_ns / (size));                           \
+    } while (0)
+
+static void bench_print_header( void )
+{
+    if( bench_csv )
+    {
+        printf( "kernel,size,fut_ns_per_sample,ref_ns_per_sample,speedup\n" );
+    }
+    else
+    {
+        printf( "%-34s %6s %14s %14s %8s\n",
+                "kernel", "size", "fut ns/sample", "ref ns/sample", "speedup" );
+    }
+}
+
+static void bench_print( const char *name, uint32_t size, double fut, double ref )
+{
+    if( bench_csv )
+    {
+        printf( "%s,%u,%.3f,%.3f,%.2f\n", name, ( unsigned ) size, fut, ref, ref / fut );
+    }
+    else
+    {
+        printf( "%-34s %6u %14.3f %14.3f %7.2fx\n", name, ( unsigned ) size, fut, ref, ref / fut );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Data */
+/*--------------------------------------------------------------------------------*/
+
+static void bench_init_data( void )
+{
+    uint32_t i;
+
+    srand( 1 );
+
+    for( i = 0; i < 2 * BENCH_MAX_SIZE; i++ )
+    {
+        bench_in_f32[i] = ( ( float32_t ) rand() / RAND_MAX ) - 0.5f;
+    }
+
+    for( i = 0; i < BENCH_FIR_TAPS; i++ )
+    {
+        bench_fir_coeffs_f32[i] = 1.0f / BENCH_FIR_TAPS;
+    }
+
+    for( i = 0; i < BENCH_BIQUAD_STAGES; i++ )
+    {
+        /* Second order low pass, b = 0.0675 0.1349 0.0675, a = -1.1430 0.4128 */
+        bench_biquad_coeffs_f32[5 * i + 0] = 0.0675f;
+        bench_biquad_coeffs_f32[5 * i + 1] = 0.1349f;
+        bench_biquad_coeffs_f32[5 * i + 2] = 0.0675f;
+        bench_biquad_coeffs_f32[5 * i + 3] = 1.1430f;
+        bench_biquad_coeffs_f32[5 * i + 4] = -0.4128f;
+    }
+
+    arm_float_to_q31( bench_in_f32, bench_in_q31, 2 * BENCH_MAX_SIZE );
+    arm_float_to_q15( bench_in_f32, bench_in_q15, 2 * BENCH_MAX_SIZE );
+    arm_float_to_q31( bench_fir_coeffs_f32, bench_fir_coeffs_q31, BENCH_FIR_TAPS );
+    arm_float_to_q31( bench_in_f32, bench_conv_coeffs_q31, BENCH_CONV_MAX_TAPS );
+    arm_float_to_q15( bench_in_f32, bench_conv_coeffs_q15, BENCH_CONV_MAX_TAPS );
+
+    for( i = 0; i < BENCH_CONV_LEN; i++ )
+    {
+        bench_conv_in_q31[i] = bench_in_q31[i % ( 2 * BENCH_MAX_SIZE )];
+        bench_conv_in_q15[i] = bench_in_q15[i % ( 2 * BENCH_MAX_SIZE )];
+    }
+
+    arm_float_to_q15( bench_fir_coeffs_f32, bench_fir_coeffs_q15, BENCH_FIR_TAPS );
+
+    /* Fixed-point biquad coefficients are stored with postShift 1 */
+    for( i = 0; i < 5 * BENCH_BIQUAD_STAGES; i++ )
+    {
+        bench_biquad_coeffs_q31[i] = ( q31_t ) ( bench_biquad_coeffs_f32[i] * 1073741824.0f );
+    }
+
+    for( i = 0; i < BENCH_BIQUAD_STAGES; i++ )
+    {
+        bench_biquad_coeffs_q15[6 * i + 0] = ( q15_t ) ( bench_biquad_coeffs_f32[5 * i + 0] * 16384.0f );
+        bench_biquad_coeffs_q15[6 * i + 1] = 0;
+        bench_biquad_coeffs_q15[6 * i + 2] = ( q15_t ) ( bench_biquad_coeffs_f32[5 * i + 1] * 16384.0f );
+        bench_biquad_coeffs_q15[6 * i + 3] = ( q15_t ) ( bench_biquad_coeffs_f32[5 * i + 2] * 16384.0f );
+        bench_biquad_coeffs_q15[6 * i + 4] = ( q15_t ) ( bench_biquad_coeffs_f32[5 * i + 3] * 16384.0f );
+        bench_biquad_coeffs_q15[6 * i + 5] = ( q15_t ) ( bench_biquad_coeffs_f32[5 * i + 4] * 16384.0f );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Kernels */
+/*--------------------------------------------------------------------------------*/
+
+static void bench_basic( uint32_t n )
+{
+    q63_t result_q63;
+
+    BENCH_RUN( "arm_add_q15", n,
+               arm_add_q15( bench_in_q15, bench_in_q15 + n, bench_out_q15, n ),
+               ref_add_q15( bench_in_q15, bench_in_q15 + n, bench_out_q15, n ) );
+    BENCH_RUN( "arm_dot_prod_q31", n,
+               arm_dot_prod_q31( bench_in_q31, bench_in_q31 + n, n, &result_q63 ),
+               ref_dot_prod_q31( bench_in_q31, bench_in_q31 + n, n, &result_q63 ) );
+}
+
+static void bench_statistics( uint32_t n )
+{
+    float32_t result_f32;
+    q31_t result_q31;
+
+    BENCH_RUN( "arm_mean_q31", n,
+               arm_mean_q31( bench_in_q31, n, &result_q31 ),
+               ref_mean_q31( bench_in_q31, n, &result_q31 ) );
+    BENCH_RUN( "arm_var_f32", n,
+               arm_var_f32( bench_in_f32, n, &result_f32 ),
+               ref_var_f32( bench_in_f32, n, &result_f32 ) );
+}
+
+static void bench_fir( uint32_t n )
+{
+    arm_fir_instance_f32 fir_f32;
+    arm_fir_instance_q31 fir_q31;
+    arm_fir_instance_q15 fir_q15;
+
+    arm_fir_init_f32( &fir_f32, BENCH_FIR_TAPS, bench_fir_coeffs_f32, bench_state_f32, n );
+    arm_fir_init_q31( &fir_q31, BENCH_FIR_TAPS, bench_fir_coeffs_q31, bench_state_q31, n );
+    arm_fir_init_q15( &fir_q15, BENCH_FIR_TAPS, bench_fir_coeffs_q15, bench_state_q15, n );
+
+    BENCH_RUN( "arm_fir_f32 (32 taps)", n,
+               arm_fir_f32( &fir_f32, bench_in_f32, bench_out_f32, n ),
+               ref_fir_f32( &fir_f32, bench_in_f32, bench_out_f32, n ) );
+    BENCH_RUN( "arm_fir_q31 (32 taps)", n,
+               arm_fir_q31( &fir_q31, bench_in_q31, bench_out_q31, n ),
+               ref_fir_q31( &fir_q31, bench_in_q31, bench_out_q31, n ) );
+    BENCH_RUN( "arm_fir_q15 (32 taps)", n,
+               arm_fir_q15( &fir_q15, bench_in_q15, bench_out_q15, n ),
+               ref_fir_q15( &fir_q15, bench_in_q15, bench_out_q15, n ) );
+}
+
+static void bench_resample( uint32_t n )
+{
+    arm_fir_resample_instance_q15 resample_q15;
+    arm_fir_interpolate_instance_q15 interp_q15;
+    arm_fir_decimate_instance_q15 decim_q15;
+
+    /* The chained decimator needs a multiple of M upsampled samples */
+    n -= n % BENCH_RESAMPLE_M;
+
+    arm_fir_resample_init_q15( &resample_q15, BENCH_RESAMPLE_L, BENCH_RESAMPLE_M, BENCH_RESAMPLE_TAPS,
+                               bench_fir_coeffs_q15, bench_state_q15, n );
+    arm_fir_interpolate_init_q15( &interp_q15, BENCH_RESAMPLE_L, BENCH_RESAMPLE_TAPS,
+                                  bench_fir_coeffs_q15, bench_interp_state_q15, n );
+    arm_fir_decimate_init_q15( &decim_q15, 1, BENCH_RESAMPLE_M, bench_decim_coeff_q15,
+                               bench_decim_state_q15, BENCH_RESAMPLE_L * n );
+
+    /* The reference column is the interpolator followed by a 1-tap decimator */
+    BENCH_RUN( "arm_fir_resample_q15 (3/10)", n,
+               arm_fir_resample_q15( &resample_q15, bench_in_q15, bench_out_q15, n ),
+               ( arm_fir_interpolate_q15( &interp_q15, bench_in_q15, bench_upsampled_q15, n ),
+                 arm_fir_decimate_q15( &decim_q15, bench_upsampled_q15, bench_out_q15,
+                                       BENCH_RESAMPLE_L * n ) ) );
+}
+
+static void bench_biquad( uint32_t n )
+{
+    arm_biquad_casd_df1_inst_f32 biquad_f32;
+    arm_biquad_casd_df1_inst_q31 biquad_q31;
+    arm_biquad_casd_df1_inst_q15 biquad_q15;
+
+    arm_biquad_cascade_df1_init_f32( &biquad_f32, BENCH_BIQUAD_STAGES,
+                                     bench_biquad_coeffs_f32, bench_state_f32 );
+    arm_biquad_cascade_df1_init_q31( &biquad_q31, BENCH_BIQUAD_STAGES,
+                                     bench_biquad_coeffs_q31, bench_state_q31, 1 );
+    arm_biquad_cascade_df1_init_q15( &biquad_q15, BENCH_BIQUAD_STAGES,
+                                     bench_biquad_coeffs_q15, bench_state_q15, 1 );
+
+    BENCH_RUN( "arm_biquad_cascade_df1_f32 (2 st)", n,
+               arm_biquad_cascade_df1_f32( &biquad_f32, bench_in_f32, bench_out_f32, n ),
+               ref_biquad_cascade_df1_f32( &biquad_f32, bench_in_f32, bench_out_f32, n ) );
+    BENCH_RUN( "arm_biquad_cascade_df1_q31 (2 st)", n,
+               arm_biquad_cascade_df1_q31( &biquad_q31, bench_in_q31, bench_out_q31, n ),
+               ref_biquad_cascade_df1_q31( &biquad_q31, bench_in_q31, bench_out_q31, n ) );
+    BENCH_RUN( "arm_biquad_cascade_df1_q15 (2 st)", n,
+               arm_biquad_cascade_df1_q15( &biquad_q15, bench_in_q15, bench_out_q15, n ),
+               ref_biquad_cascade_df1_q15( &biquad_q15, bench_in_q15, bench_out_q15, n ) );
+}
+
+static void bench_cfft( uint32_t n )
+{
+    const arm_cfft_instance_f32 *cfft_f32;
+    const arm_cfft_instance_q31 *cfft_q31;
+    const arm_cfft_instance_q15 *cfft_q15;
+
+    switch( n )
+    {
+        case 64:
+            cfft_f32 = &arm_cfft_sR_f32_len64;
+            cfft_q31 = &arm_cfft_sR_q31_len64;
+            cfft_q15 = &arm_cfft_sR_q15_len64;
+            break;
+
+        case 256:
+            cfft_f32 = &arm_cfft_sR_f32_len256;
+            cfft_q31 = &arm_cfft_sR_q31_len256;
+            cfft_q15 = &arm_cfft_sR_q15_len256;
+            break;
+
+        case 1024:
+            cfft_f32 = &arm_cfft_sR_f32_len1024;
+            cfft_q31 = &arm_cfft_sR_q31_len1024;
+            cfft_q15 = &arm_cfft_sR_q15_len1024;
+            break;
+
+        default:
+            return;
+    }
+
+    /* The transforms are in place, the input is copied before each run */
+    BENCH_RUN( "arm_cfft_f32", n,
+               ( memcpy( bench_out_f32, bench_in_f32, 2 * n * sizeof( float32_t ) ),
+                 arm_cfft_f32( cfft_f32, bench_out_f32, 0, 1 ) ),
+               ( memcpy( bench_out_f32, bench_in_f32, 2 * n * sizeof( float32_t ) ),
+                 ref_cfft_f32( cfft_f32, bench_out_f32, 0, 1 ) ) );
+    BENCH_RUN( "arm_cfft_q31", n,
+               ( memcpy( bench_out_q31, bench_in_q31, 2 * n * sizeof( q31_t ) ),
+                 arm_cfft_q31( cfft_q31, bench_out_q31, 0, 1 ) ),
+               ( memcpy( bench_out_q31, bench_in_q31, 2 * n * sizeof( q31_t ) ),
+                 ref_cfft_q31( cfft_q31, bench_out_q31, 0, 1 ) ) );
+    BENCH_RUN( "arm_cfft_q15", n,
+               ( memcpy( bench_out_q15, bench_in_q15, 2 * n * sizeof( q15_t ) ),
+                 arm_cfft_q15( cfft_q15, bench_out_q15, 0, 1 ) ),
+               ( memcpy( bench_out_q15, bench_in_q15, 2 * n * sizeof( q15_t ) ),
+                 ref_cfft_q15( cfft_q15, bench_out_q15, 0, 1 ) ) );
+
+    /* Block floating point Q15 against the Q15 and Q31 transforms */
+    BENCH_RUN( "arm_cfft_bfp_q15 / arm_cfft_q15", n,
+               ( memcpy( bench_out_q15, bench_in_q15, 2 * n * sizeof( q15_t ) ),
+                 arm_cfft_bfp_q15( cfft_q15, bench_out_q15, 0 ) ),
+               ( memcpy( bench_out_q15, bench_in_q15, 2 * n * sizeof( q15_t ) ),
+                 arm_cfft_q15( cfft_q15, bench_out_q15, 0, 1 ) ) );
+    BENCH_RUN( "arm_cfft_bfp_q15 / arm_cfft_q31", n,
+               ( memcpy( bench_out_q15, bench_in_q15, 2 * n * sizeof( q15_t ) ),
+                 arm_cfft_bfp_q15( cfft_q15, bench_out_q15, 0 ) ),
+               ( memcpy( bench_out_q31, bench_in_q31, 2 * n * sizeof( q31_t ) ),
+                 arm_cfft_q31( cfft_q31, bench_out_q31, 0, 1 ) ) );
+}
+
+static void bench_fast_math( uint32_t n )
+{
+    /* The references evaluate the functions with the double precision libm */
+    BENCH_RUN( "arm_atan2_q31", n,
+               arm_atan2_q31( bench_in_q31, bench_in_q31 + n, bench_out_q31, n ),
+               ref_atan2_q31( bench_in_q31, bench_in_q31 + n, bench_out_q31, n ) );
+    BENCH_RUN( "arm_atan2_q15", n,
+               arm_atan2_q15( bench_in_q15, bench_in_q15 + n, bench_out_q15, n ),
+               ref_atan2_q15( bench_in_q15, bench_in_q15 + n, bench_out_q15, n ) );
+    BENCH_RUN( "arm_log2_q31", n,
+               arm_log2_q31( bench_in_q31, bench_out_q31, n ),
+               ref_log2_q31( bench_in_q31, bench_out_q31, n ) );
+    BENCH_RUN( "arm_exp2_q15", n,
+               arm_exp2_q15( bench_in_q15, bench_out_q15, n ),
+               ref_exp2_q15( bench_in_q15, bench_out_q15, n ) );
+    BENCH_RUN( "arm_rsqrt_q31", n,
+               arm_rsqrt_q31( bench_in_q31, bench_out_q31, bench_shift, n ),
+               ref_rsqrt_q31( bench_in_q31, bench_out_q31, bench_shift, n ) );
+    BENCH_RUN( "arm_cmplx_mag_db_q15", n,
+               arm_cmplx_mag_db_q15( bench_in_q15, bench_out_q15, n ),
+               ref_cmplx_mag_db_q15( bench_in_q15, bench_out_q15, n ) );
+}
+
+/**
+ *  Time the direct and the FFT convolution of a stream, for numbers of taps
+ *  from 8 to max_taps, with an FFT of 4 times the number of taps. The size
+ *  column is the number of taps, the ref column the direct convolution. The
+ *  smallest number of taps from which the FFT is faster is printed at the
+ *  end, to set ARM_CONV_FFT_CROSSOVER_Q15 and ARM_CONV_FFT_CROSSOVER_Q31.
+ */
+#define BENCH_CONV_FFT(suffix, SUFFIX, max_taps)                        \
+    do                                                                  \
+    {                                                                   \
+        arm_conv_fft_instance_##suffix direct;                          \
+        arm_conv_fft_instance_##suffix fft;                             \
+        uint32_t crossover = 0;                                         \
+        uint32_t taps;                                                  \
+        double direct_ns;                                               \
+        double fft_ns;                                                  \
+                                                                        \
+        for( taps = 8; taps <= ( max_taps ); taps *= 2 )                \
+        {                                                               \
+            arm_conv_fft_init_##suffix( &direct, ( uint16_t ) ( 4 * taps ), \
+                                        ( uint16_t ) taps,              \
+                                        bench_conv_coeffs_##suffix,     \
+                                        bench_conv_freq_##suffix,       \
+                                        bench_conv_state_##suffix,      \
+                                        bench_conv_scratch_##suffix );  \
+            fft = direct;                                               \
+            direct.useFft = 0;                                          \
+            fft.useFft = 1;                                             \
+                                                                        \
+            BENCH_NS( fft_ns, arm_conv_fft_##suffix( &fft,              \
+                                                     bench_conv_in_##suffix, \
+                                                     bench_conv_out_##suffix, \
+                                                     BENCH_CONV_LEN ) ); \
+            BENCH_NS( direct_ns, arm_conv_fft_##suffix( &direct,        \
+                                                        bench_conv_in_##suffix, \
+                                                        bench_conv_out_##suffix, \
+                                                        BENCH_CONV_LEN ) ); \
+            bench_print( "arm_conv_fft_" #suffix " (taps)", taps,       \
+                         fft_ns / BENCH_CONV_LEN,                       \
+                         direct_ns / BENCH_CONV_LEN );                  \
+                                                                        \
+            if( ( crossover == 0 ) && ( fft_ns < direct_ns ) )          \
+            {                                                           \
+                crossover = taps;                                       \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        if( !bench_csv )                                                \
+        {                                                               \
+            printf( "arm_conv_fft_" #suffix " crossover: %u taps "      \
+                    "(ARM_CONV_FFT_CROSSOVER_" #SUFFIX " = %u)\n",      \
+                    ( unsigned ) crossover,                             \
+                    ( unsigned ) ARM_CONV_FFT_CROSSOVER_##SUFFIX );     \
+        }                                                               \
+    } while( 0 )
+
+static void bench_conv_fft( uint32_t max_taps )
+{
+    BENCH_CONV_FFT( q15, Q15, max_taps );
+    BENCH_CONV_FFT( q31, Q31, max_taps );
+}
+
+/**
+ *  Time the running median and Hampel filters against sorting the window for
+ *  each sample, for the windows of bench_median_windows up to max_window. The
+ *  size column is the window size, the ref column the sort. The Hampel
+ *  threshold is three sigma.
+ */
+#define BENCH_MEDIAN(suffix, fract, max_window)                         \
+    do                                                                  \
+    {                                                                   \
+        arm_median_instance_##suffix median;                            \
+        arm_hampel_instance_##suffix hampel;                            \
+        uint16_t window;                                                \
+        uint32_t w;                                                     \
+        double fut_ns;                                                  \
+        double ref_ns;                                                  \
+                                                                        \
+        for( w = 0; w < sizeof( bench_median_windows ) /                \
+                        sizeof( bench_median_windows[0] ); w++ )        \
+        {                                                               \
+            window = bench_median_windows[w];                           \
+                                                                        \
+            if( window > ( max_window ) )                               \
+            {                                                           \
+                break;                                                  \
+            }                                                           \
+                                                                        \
+            arm_median_init_##suffix( &median, window,                  \
+                                      bench_median_state_##suffix,      \
+                                      bench_median_heap );              \
+            BENCH_NS( fut_ns, arm_median_##suffix( &median,             \
+                                                   bench_in_##suffix,   \
+                                                   bench_out_##suffix,  \
+                                                   BENCH_MAX_SIZE ) );  \
+            BENCH_NS( ref_ns, ref_median_##suffix( &median,             \
+                                                   bench_in_##suffix,   \
+                                                   bench_out_##suffix,  \
+                                                   BENCH_MAX_SIZE ) );  \
+            bench_print( "arm_median_" #suffix " (window)", window,     \
+                         fut_ns / BENCH_MAX_SIZE,                       \
+                         ref_ns / BENCH_MAX_SIZE );                     \
+                                                                        \
+            arm_hampel_init_##suffix( &hampel, window, fract, 3,        \
+                                      bench_median_state_##suffix,      \
+                                      bench_median_sorted_##suffix );   \
+            BENCH_NS( fut_ns, arm_hampel_##suffix( &hampel,             \
+                                                   bench_in_##suffix,   \
+                                                   bench_out_##suffix,  \
+                                                   BENCH_MAX_SIZE ) );  \
+            BENCH_NS( ref_ns, ref_hampel_##suffix( &hampel,             \
+                                                   bench_in_##suffix,   \
+                                                   bench_out_##suffix,  \
+                                                   BENCH_MAX_SIZE ) );  \
+            bench_print( "arm_hampel_" #suffix " (window)", window,     \
+                         fut_ns / BENCH_MAX_SIZE,                       \
+                         ref_ns / BENCH_MAX_SIZE );                     \
+        }                                                               \
+    } while( 0 )
+
+static void bench_median( uint16_t max_window )
+{
+    BENCH_MEDIAN( q15, 0x472A, max_window );
+    BENCH_MEDIAN( q31, 0x472A3055, max_window );
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Main */
+/*--------------------------------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+    uint32_t i;
+    int arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            bench_min_ns = 1000000U;
+            bench_size_count = 1;
+        }
+        else if( strcmp( argv[arg], "--csv" ) == 0 )
+        {
+            bench_csv = 1;
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--csv]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    bench_init_data();
+    bench_print_header();
+
+    for( i = 0; i < bench_size_count; i++ )
+    {
+        bench_basic( bench_sizes[i] );
+        bench_statistics( bench_sizes[i] );
+        bench_fir( bench_sizes[i] );
+        bench_resample( bench_sizes[i] );
+        bench_biquad( bench_sizes[i] );
+        bench_cfft( bench_sizes[i] );
+        bench_fast_math( bench_sizes[i] );
+    }
+
+    /* The crossover does not depend on the block size */
+    bench_conv_fft( ( bench_size_count == 1 ) ? 32 : BENCH_CONV_MAX_TAPS );
+
+    /* Per sample, the size column is the window */
+    bench_median( ( bench_size_count == 1 ) ? 15 : BENCH_MEDIAN_MAX_WINDOW );
+
+    return 0;
+}
@@ -400,6 +400,16 @@ void ref_cmplx_mag_squared_q15(
     q15_t *pDst,
     uint32_t numSamples );
 
+void ref_cmplx_mag_db_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t numSamples );
+
+void ref_cmplx_mag_db_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t numSamples );
+
 void ref_cmplx_mult_cmplx_f32(
     float32_t *pSrcA,
     float32_t *pSrcB,
@@ -461,6 +471,18 @@ q15_t ref_pid_q15(
     arm_pid_instance_q15 *S,
     q15_t in );
 
+void ref_kalman_predict_q31(
+    const arm_kalman_instance_q31 *S,
+    const q31_t *pControl,
+    float64_t *pX,
+    float64_t *pP );
+
+arm_status ref_kalman_update_q31(
+    const arm_kalman_instance_q31 *S,
+    const q31_t *pMeas,
+    float64_t *pX,
+    float64_t *pP );
+
 /*
  * Fast Math Functions
  */
@@ -480,6 +502,60 @@ arm_status ref_sqrt_q31( q31_t in, q31_t *pOut );
 
 arm_status ref_sqrt_q15( q15_t in, q15_t *pOut );
 
+void ref_atan2_q31(
+    q31_t *pSrcY,
+    q31_t *pSrcX,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+void ref_atan2_q15(
+    q15_t *pSrcY,
+    q15_t *pSrcX,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+arm_status ref_log2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+arm_status ref_log2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+arm_status ref_ln_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+arm_status ref_ln_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+void ref_exp2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+void ref_exp2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+arm_status ref_rsqrt_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize );
+
+arm_status ref_rsqrt_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize );
+
 /*
  * Filtering Functions
  */
@@ -929,6 +1005,60 @@ void ref_fir_interpolate_q15(
     q15_t *pDst,
     uint32_t blockSize );
 
+uint32_t ref_fir_resample_f32(
+    const arm_fir_resample_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+uint32_t ref_fir_resample_q31(
+    const arm_fir_resample_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+uint32_t ref_fir_resample_q15(
+    const arm_fir_resample_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+void ref_conv_fft_q31(
+    const arm_conv_fft_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+void ref_conv_fft_q15(
+    const arm_conv_fft_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+void ref_median_q31(
+    const arm_median_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+void ref_median_q15(
+    const arm_median_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+void ref_hampel_q31(
+    const arm_hampel_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+void ref_hampel_q15(
+    const arm_hampel_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
 /*
  * Matrix Functions
  */
@@ -976,6 +1106,36 @@ arm_status ref_mat_mult_q15(
 /* Alias for testing purposes*/
 #define ref_mat_mult_fast_q15 ref_mat_mult_q15
 
+void ref_mat_mult_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits );
+
+void ref_mat_mult_trans_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits );
+
+void ref_mat_sym_update_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits );
+
+arm_status ref_mat_ldlt_solve_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t n,
+    uint32_t fracBits );
+
 arm_status ref_mat_scale_f32(
     const arm_matrix_instance_f32 *pSrc,
     float32_t scale,
@@ -1175,6 +1335,20 @@ void ref_var_q15(
     uint32_t blockSize,
     q15_t *pResult );
 
+void ref_exp_stats_q31(
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t alpha,
+    q31_t *pMean,
+    q31_t *pVar );
+
+void ref_exp_stats_q15(
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t alpha,
+    q15_t *pMean,
+    q15_t *pVar );
+
 /*
  * Support Functions
  */
@@ -1304,6 +1478,12 @@ void ref_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag );
 
+void ref_cfft_bfp_q15(
+    const arm_cfft_instance_q15 *S,
+    const q15_t *pSrc,
+    float32_t *pDst,
+    uint8_t ifftFlag );
+
 void ref_cfft_radix2_f32(
     const arm_cfft_radix2_instance_f32 *S,
     float32_t *pSrc );
@@ -1363,6 +1543,36 @@ void ref_dct4_q15(
     q15_t *pState,
     q15_t *pInlineBuffer );
 
+void ref_goertzel_q15(
+    const q15_t *pSrc,
+    uint16_t blockSize,
+    const q15_t *pFreqs,
+    uint16_t numBins,
+    q15_t *pDst );
+
+void ref_goertzel_q31(
+    const q31_t *pSrc,
+    uint16_t blockSize,
+    const q31_t *pFreqs,
+    uint16_t numBins,
+    q31_t *pDst );
+
+void ref_sliding_dft_q15(
+    const q15_t *pSrc,
+    uint32_t srcLen,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    uint16_t numBins,
+    q15_t *pDst );
+
+void ref_sliding_dft_q31(
+    const q31_t *pSrc,
+    uint32_t srcLen,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    uint16_t numBins,
+    q31_t *pDst );
+
 /*
  * Intrinsics
  */
@@ -0,0 +1,35 @@
+#include "ref.h"
+
+void ref_cmplx_mag_db_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t numSamples )
+{
+    uint32_t i;
+    float64_t power;
+
+    for( i = 0; i < numSamples * 2; i += 2 )
+    {
+        power = ( ( float64_t )pSrc[i] * pSrc[i] + ( float64_t )pSrc[i + 1] * pSrc[i + 1] ) / 4611686018427387904.0;
+
+        /* 9.23 format, zero gives -256 dB */
+        *pDst++ = ( power > 0.0 ) ? ( q31_t )floor( 10.0 * log10( power ) * 8388608.0 + 0.5 ) : INT_MIN;
+    }
+}
+
+void ref_cmplx_mag_db_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t numSamples )
+{
+    uint32_t i;
+    float64_t power;
+
+    for( i = 0; i < numSamples * 2; i += 2 )
+    {
+        power = ( ( float64_t )pSrc[i] * pSrc[i] + ( float64_t )pSrc[i + 1] * pSrc[i + 1] ) / 1073741824.0;
+
+        /* 8.8 format, zero gives -128 dB */
+        *pDst++ = ( power > 0.0 ) ? ( q15_t )floor( 10.0 * log10( power ) * 256.0 + 0.5 ) : SHRT_MIN;
+    }
+}
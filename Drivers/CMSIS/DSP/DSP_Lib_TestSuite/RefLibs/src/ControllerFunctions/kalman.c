@@ -0,0 +1,232 @@
+#include "ref.h"
+
+/* The model is read from the Q31 instance, the estimate is kept in double */
+static float64_t ref_kalman_to_f64(
+    q31_t x,
+    uint32_t fracBits )
+{
+    return ldexp( ( float64_t )x, -( int )fracBits );
+}
+
+void ref_kalman_predict_q31(
+    const arm_kalman_instance_q31 *S,
+    const q31_t *pControl,
+    float64_t *pX,
+    float64_t *pP )
+{
+    uint32_t n = S->numStates;
+    uint32_t fb = S->fracBits;
+    float64_t x[6], FP[6 * 6], sum;
+    uint32_t i, j, k;
+
+    for( i = 0; i < n; i++ )
+    {
+        sum = ( pControl != NULL ) ? ref_kalman_to_f64( pControl[i], fb ) : 0;
+
+        for( k = 0; k < n; k++ )
+        {
+            sum += ref_kalman_to_f64( S->pF[i * n + k], fb ) * pX[k];
+        }
+
+        x[i] = sum;
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        pX[i] = x[i];
+
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += ref_kalman_to_f64( S->pF[i * n + k], fb ) * pP[k * n + j];
+            }
+
+            FP[i * n + j] = sum;
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = ref_kalman_to_f64( S->pQ[i * n + j], fb );
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += FP[i * n + k] * ref_kalman_to_f64( S->pF[j * n + k], fb );
+            }
+
+            pP[i * n + j] = sum;
+        }
+    }
+}
+
+arm_status ref_kalman_update_q31(
+    const arm_kalman_instance_q31 *S,
+    const q31_t *pMeas,
+    float64_t *pX,
+    float64_t *pP )
+{
+    uint32_t n = S->numStates;
+    uint32_t m = S->numMeas;
+    uint32_t fb = S->fracBits;
+    float64_t HP[6 * 6], Sm[6 * 6], K[6 * 6], IKH[6 * 6], T[6 * 6], y[6];
+    float64_t sum, piv, f;
+    uint32_t i, j, k, l;
+
+    /* y = z - H * x, HP = H * P */
+    for( i = 0; i < m; i++ )
+    {
+        sum = ref_kalman_to_f64( pMeas[i], fb );
+
+        for( k = 0; k < n; k++ )
+        {
+            sum -= ref_kalman_to_f64( S->pH[i * n + k], fb ) * pX[k];
+        }
+
+        y[i] = sum;
+
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += ref_kalman_to_f64( S->pH[i * n + k], fb ) * pP[k * n + j];
+            }
+
+            HP[i * n + j] = sum;
+        }
+    }
+
+    /* S = H * P * H' + R */
+    for( i = 0; i < m; i++ )
+    {
+        for( j = 0; j < m; j++ )
+        {
+            sum = ref_kalman_to_f64( S->pR[i * n + j], fb );
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += HP[i * n + k] * ref_kalman_to_f64( S->pH[j * n + k], fb );
+            }
+
+            Sm[i * n + j] = sum;
+        }
+    }
+
+    /* S * K' = H * P by Gauss-Jordan elimination, HP becomes K' */
+    for( i = 0; i < m; i++ )
+    {
+        piv = Sm[i * n + i];
+
+        if( piv <= 0 )
+        {
+            return ARM_MATH_SINGULAR;
+        }
+
+        for( j = 0; j < m; j++ )
+        {
+            if( j != i )
+            {
+                f = Sm[j * n + i] / piv;
+
+                for( k = 0; k < m; k++ )
+                {
+                    Sm[j * n + k] -= f * Sm[i * n + k];
+                }
+
+                for( k = 0; k < n; k++ )
+                {
+                    HP[j * n + k] -= f * HP[i * n + k];
+                }
+            }
+        }
+    }
+
+    for( i = 0; i < m; i++ )
+    {
+        for( k = 0; k < n; k++ )
+        {
+            K[k * n + i] = HP[i * n + k] / Sm[i * n + i];
+        }
+    }
+
+    /* x = x + K * y */
+    for( i = 0; i < n; i++ )
+    {
+        for( k = 0; k < m; k++ )
+        {
+            pX[i] += K[i * n + k] * y[k];
+        }
+    }
+
+    /* I - K * H */
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = ( i == j ) ? 1.0 : 0.0;
+
+            for( k = 0; k < m; k++ )
+            {
+                sum -= K[i * n + k] * ref_kalman_to_f64( S->pH[k * n + j], fb );
+            }
+
+            IKH[i * n + j] = sum;
+        }
+    }
+
+    /* P = (I - K * H) * P * (I - K * H)' + K * R * K' */
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += IKH[i * n + k] * pP[k * n + j];
+            }
+
+            T[i * n + j] = sum;
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += T[i * n + k] * IKH[j * n + k];
+            }
+
+            for( k = 0; k < m; k++ )
+            {
+                f = 0;
+
+                for( l = 0; l < m; l++ )
+                {
+                    f += ref_kalman_to_f64( S->pR[k * n + l], fb ) * K[j * n + l];
+                }
+
+                sum += K[i * n + k] * f;
+            }
+
+            HP[i * n + j] = sum;
+        }
+    }
+
+    for( i = 0; i < n * n; i++ )
+    {
+        pP[i] = HP[i];
+    }
+
+    return ARM_MATH_SUCCESS;
+}
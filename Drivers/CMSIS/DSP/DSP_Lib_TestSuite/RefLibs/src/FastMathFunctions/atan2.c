@@ -0,0 +1,37 @@
+#include "ref.h"
+
+void ref_atan2_q31(
+    q31_t *pSrcY,
+    q31_t *pSrcX,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    float64_t angle;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        /* Angle divided by pi, pi wraps to -pi */
+        angle = atan2( ( float64_t )pSrcY[i], ( float64_t )pSrcX[i] ) / 3.14159265358979323846;
+        angle = floor( angle * 2147483648.0 + 0.5 );
+        *pDst++ = ( angle >= 2147483648.0 ) ? INT_MIN : ( q31_t )angle;
+    }
+}
+
+void ref_atan2_q15(
+    q15_t *pSrcY,
+    q15_t *pSrcX,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    float64_t angle;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        /* Angle divided by pi, pi wraps to -pi */
+        angle = atan2( ( float64_t )pSrcY[i], ( float64_t )pSrcX[i] ) / 3.14159265358979323846;
+        angle = floor( angle * 32768.0 + 0.5 );
+        *pDst++ = ( angle >= 32768.0 ) ? SHRT_MIN : ( q15_t )angle;
+    }
+}
@@ -0,0 +1,33 @@
+#include "ref.h"
+
+void ref_exp2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    float64_t out;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        /* 6.26 input, 1.31 output */
+        out = floor( exp2( ( float64_t )pSrc[i] / 67108864.0 ) * 2147483648.0 + 0.5 );
+        *pDst++ = ( out > 2147483647.0 ) ? INT_MAX : ( q31_t )out;
+    }
+}
+
+void ref_exp2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    float64_t out;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        /* 5.11 input, 1.15 output */
+        out = floor( exp2( ( float64_t )pSrc[i] / 2048.0 ) * 32768.0 + 0.5 );
+        *pDst++ = ( out > 32767.0 ) ? SHRT_MAX : ( q15_t )out;
+    }
+}
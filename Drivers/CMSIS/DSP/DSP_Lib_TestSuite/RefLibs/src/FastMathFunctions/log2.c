@@ -0,0 +1,103 @@
+#include "ref.h"
+
+arm_status ref_log2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* 6.26 format */
+            *pDst++ = ( q31_t )floor( log2( ( float64_t )pSrc[i] / 2147483648.0 ) * 67108864.0 + 0.5 );
+        }
+        else
+        {
+            *pDst++ = INT_MIN;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
+
+arm_status ref_log2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* 5.11 format */
+            *pDst++ = ( q15_t )floor( log2( ( float64_t )pSrc[i] / 32768.0 ) * 2048.0 + 0.5 );
+        }
+        else
+        {
+            *pDst++ = SHRT_MIN;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
+
+arm_status ref_ln_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* 6.26 format */
+            *pDst++ = ( q31_t )floor( log( ( float64_t )pSrc[i] / 2147483648.0 ) * 67108864.0 + 0.5 );
+        }
+        else
+        {
+            /* -32 * ln(2) */
+            *pDst++ = ( q31_t )floor( -32.0 * log( 2.0 ) * 67108864.0 + 0.5 );
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
+
+arm_status ref_ln_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* 5.11 format */
+            *pDst++ = ( q15_t )floor( log( ( float64_t )pSrc[i] / 32768.0 ) * 2048.0 + 0.5 );
+        }
+        else
+        {
+            /* -16 * ln(2) */
+            *pDst++ = ( q15_t )floor( -16.0 * log( 2.0 ) * 2048.0 + 0.5 );
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
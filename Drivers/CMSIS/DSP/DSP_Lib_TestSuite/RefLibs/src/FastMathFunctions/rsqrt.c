@@ -0,0 +1,73 @@
+#include "ref.h"
+
+arm_status ref_rsqrt_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    int8_t shift;
+    float64_t out;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* Mantissa in [0.5 1) and shift */
+            out = 1.0 / sqrt( ( float64_t )pSrc[i] / 2147483648.0 );
+            for( shift = 0; out >= 1.0; shift++ )
+            {
+                out /= 2.0;
+            }
+            out = floor( out * 2147483648.0 + 0.5 );
+            *pDst++ = ( out > 2147483647.0 ) ? INT_MAX : ( q31_t )out;
+            *pShift++ = shift;
+        }
+        else
+        {
+            *pDst++ = 0;
+            *pShift++ = 0;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
+
+arm_status ref_rsqrt_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize )
+{
+    uint32_t i;
+    int8_t shift;
+    float64_t out;
+    arm_status status = ARM_MATH_SUCCESS;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        if( pSrc[i] > 0 )
+        {
+            /* Mantissa in [0.5 1) and shift */
+            out = 1.0 / sqrt( ( float64_t )pSrc[i] / 32768.0 );
+            for( shift = 0; out >= 1.0; shift++ )
+            {
+                out /= 2.0;
+            }
+            out = floor( out * 32768.0 + 0.5 );
+            *pDst++ = ( out > 32767.0 ) ? SHRT_MAX : ( q15_t )out;
+            *pShift++ = shift;
+        }
+        else
+        {
+            *pDst++ = 0;
+            *pShift++ = 0;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,55 @@
+#include "ref.h"
+
+/*
+ * Direct implementation of the streaming convolution, in the format of the
+ * FIR filters. The whole input is processed from a zero history, the state
+ * of the instance is not used. For a correlation, the taps are reversed.
+ */
+
+void ref_conv_fft_q31(
+    const arm_conv_fft_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    const q31_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t n, k;
+    q63_t acc;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( k = 0U; ( k < numTaps ) && ( k <= n ); k++ )
+        {
+            acc += ( q63_t ) pCoeffs[S->reverse ? numTaps - 1U - k : k] * pSrc[n - k];
+        }
+
+        pDst[n] = ( q31_t ) ( acc >> 31 );
+    }
+}
+
+void ref_conv_fft_q15(
+    const arm_conv_fft_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    const q15_t *pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+    uint32_t n, k;
+    q63_t acc;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        acc = 0;
+
+        for( k = 0U; ( k < numTaps ) && ( k <= n ); k++ )
+        {
+            acc += ( q31_t ) pCoeffs[S->reverse ? numTaps - 1U - k : k] * pSrc[n - k];
+        }
+
+        pDst[n] = ref_sat_q15( ( q31_t ) ( acc >> 15 ) );
+    }
+}
@@ -73,7 +73,7 @@ void ref_correlate_f32(
             if( ( i - j < srcBLen ) && ( j < srcALen ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += pIn1[j] * pIn2[-( ( int32_t )i - j )];
+                sum += pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )];
             }
         }
 
@@ -149,7 +149,7 @@ void ref_correlate_q31(
             if( ( ( ( i - j ) < srcBLen ) && ( j < srcALen ) ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += ( ( q63_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] );
+                sum += ( ( q63_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] );
             }
         }
 
@@ -226,7 +226,7 @@ void ref_correlate_fast_q31(
             {
                 /* z[i] += x[i-j] * y[j] */
                 sum = ( q31_t )( ( ( ( q63_t ) sum << 32 ) +
-                                   ( ( q63_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] ) ) >> 32 );
+                                   ( ( q63_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] ) ) >> 32 );
             }
         }
 
@@ -302,7 +302,7 @@ void ref_correlate_q15(
             if( ( ( ( i - j ) < srcBLen ) && ( j < srcALen ) ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] );
+                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] );
             }
         }
 
@@ -378,7 +378,7 @@ void ref_correlate_fast_q15(
             if( ( ( ( i - j ) < srcBLen ) && ( j < srcALen ) ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] );
+                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] );
             }
         }
 
@@ -455,7 +455,7 @@ void ref_correlate_fast_opt_q15(
             if( ( ( ( i - j ) < srcBLen ) && ( j < srcALen ) ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] );
+                sum += ( ( q31_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] );
             }
         }
 
@@ -531,7 +531,7 @@ void ref_correlate_q7(
             if( ( ( ( i - j ) < srcBLen ) && ( j < srcALen ) ) )
             {
                 /* z[i] += x[i-j] * y[j] */
-                sum += ( ( q15_t ) pIn1[j] * pIn2[-( ( int32_t ) i - j )] );
+                sum += ( ( q15_t ) pIn1[j] * pIn2[-( ( int32_t ) i - ( int32_t ) j )] );
             }
         }
 
@@ -0,0 +1,109 @@
+#include "ref.h"
+
+/*
+ * Direct implementation: the input is upsampled by inserting L-1 zeros, filtered
+ * with all the taps and one output in M is kept. The whole input is processed
+ * from a zero history, the state of the instance is not used.
+ */
+
+uint32_t ref_fir_resample_f32(
+    const arm_fir_resample_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize )
+{
+    float32_t *pCoeffs = S->pCoeffs;
+    uint32_t L = S->L;
+    uint32_t M = S->M;
+    uint32_t numTaps = L * S->phaseLength;
+    uint32_t m, i, t, k;
+    float32_t sum;
+
+    for( m = 0U, t = 0U; ( t / L ) < blockSize; m++, t += M )
+    {
+        sum = 0.0f;
+
+        for( i = 0U; ( i < numTaps ) && ( i <= t ); i++ )
+        {
+            k = t - i;
+
+            /* Only the non-zero samples of the upsampled input */
+            if( ( k % L ) == 0U )
+            {
+                sum += pSrc[k / L] * pCoeffs[numTaps - 1U - i];
+            }
+        }
+
+        pDst[m] = sum;
+    }
+
+    return ( m );
+}
+
+uint32_t ref_fir_resample_q31(
+    const arm_fir_resample_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pCoeffs = S->pCoeffs;
+    uint32_t L = S->L;
+    uint32_t M = S->M;
+    uint32_t numTaps = L * S->phaseLength;
+    uint32_t m, i, t, k;
+    q63_t sum;
+
+    for( m = 0U, t = 0U; ( t / L ) < blockSize; m++, t += M )
+    {
+        sum = 0;
+
+        for( i = 0U; ( i < numTaps ) && ( i <= t ); i++ )
+        {
+            k = t - i;
+
+            /* Only the non-zero samples of the upsampled input */
+            if( ( k % L ) == 0U )
+            {
+                sum += ( q63_t ) pSrc[k / L] * pCoeffs[numTaps - 1U - i];
+            }
+        }
+
+        pDst[m] = ( q31_t )( sum >> 31 );
+    }
+
+    return ( m );
+}
+
+uint32_t ref_fir_resample_q15(
+    const arm_fir_resample_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pCoeffs = S->pCoeffs;
+    uint32_t L = S->L;
+    uint32_t M = S->M;
+    uint32_t numTaps = L * S->phaseLength;
+    uint32_t m, i, t, k;
+    q63_t sum;
+
+    for( m = 0U, t = 0U; ( t / L ) < blockSize; m++, t += M )
+    {
+        sum = 0;
+
+        for( i = 0U; ( i < numTaps ) && ( i <= t ); i++ )
+        {
+            k = t - i;
+
+            /* Only the non-zero samples of the upsampled input */
+            if( ( k % L ) == 0U )
+            {
+                sum += ( q63_t ) pSrc[k / L] * pCoeffs[numTaps - 1U - i];
+            }
+        }
+
+        pDst[m] = ref_sat_q15( ( q31_t )( sum >> 15 ) );
+    }
+
+    return ( m );
+}
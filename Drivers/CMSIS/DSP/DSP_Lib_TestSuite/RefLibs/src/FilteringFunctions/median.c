@@ -0,0 +1,155 @@
+#include "ref.h"
+
+/*
+ * Direct implementations of the running median and Hampel filters, sorting
+ * the window for each sample. The whole input is processed from a zero
+ * history, the state of the instance is not used.
+ */
+
+#define REF_MEDIAN_MAX_WINDOW 255
+
+/*
+ * Median of the n values of pData, sorted in place.
+ */
+static q63_t ref_median_sort(
+    q63_t *pData,
+    uint32_t n )
+{
+    uint32_t i, j;
+    q63_t x;
+
+    for( i = 1U; i < n; i++ )
+    {
+        x = pData[i];
+
+        for( j = i; ( j > 0U ) && ( pData[j - 1U] > x ); j-- )
+        {
+            pData[j] = pData[j - 1U];
+        }
+
+        pData[j] = x;
+    }
+
+    return pData[n / 2U];
+}
+
+/*
+ * Hampel filter of the windowSize samples of pWindow, sorted in place. The
+ * deviations are saturated to maxVal, and the threshold is
+ * thresholdFract * 2^(shift - fracBits).
+ */
+static q63_t ref_hampel_window(
+    q63_t *pWindow,
+    uint32_t windowSize,
+    q63_t thresholdFract,
+    int32_t shift,
+    int32_t fracBits,
+    q63_t maxVal )
+{
+    q63_t med, mad, center, dev;
+    uint32_t k;
+
+    center = pWindow[windowSize / 2U];
+    med = ref_median_sort( pWindow, windowSize );
+
+    for( k = 0U; k < windowSize; k++ )
+    {
+        dev = pWindow[k] - med;
+        dev = ( dev < 0 ) ? -dev : dev;
+        pWindow[k] = ( dev > maxVal ) ? maxVal : dev;
+    }
+
+    mad = ref_median_sort( pWindow, windowSize );
+    dev = center - med;
+    dev = ( dev < 0 ) ? -dev : dev;
+
+    return ( dev > ( ( mad * thresholdFract ) >> ( fracBits - shift ) ) ) ? med : center;
+}
+
+void ref_median_q31(
+    const arm_median_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q63_t window[REF_MEDIAN_MAX_WINDOW];
+    uint32_t windowSize = S->windowSize;
+    uint32_t n, k;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        for( k = 0U; k < windowSize; k++ )
+        {
+            window[k] = ( n + k >= windowSize - 1U ) ? pSrc[n + k - ( windowSize - 1U )] : 0;
+        }
+
+        pDst[n] = ( q31_t ) ref_median_sort( window, windowSize );
+    }
+}
+
+void ref_median_q15(
+    const arm_median_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q63_t window[REF_MEDIAN_MAX_WINDOW];
+    uint32_t windowSize = S->windowSize;
+    uint32_t n, k;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        for( k = 0U; k < windowSize; k++ )
+        {
+            window[k] = ( n + k >= windowSize - 1U ) ? pSrc[n + k - ( windowSize - 1U )] : 0;
+        }
+
+        pDst[n] = ( q15_t ) ref_median_sort( window, windowSize );
+    }
+}
+
+void ref_hampel_q31(
+    const arm_hampel_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q63_t window[REF_MEDIAN_MAX_WINDOW];
+    uint32_t windowSize = S->windowSize;
+    uint32_t n, k;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        for( k = 0U; k < windowSize; k++ )
+        {
+            window[k] = ( n + k >= windowSize - 1U ) ? pSrc[n + k - ( windowSize - 1U )] : 0;
+        }
+
+        pDst[n] = ( q31_t ) ref_hampel_window( window, windowSize,
+                                               S->thresholdFract, S->shift, 31,
+                                               0x7FFFFFFF );
+    }
+}
+
+void ref_hampel_q15(
+    const arm_hampel_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q63_t window[REF_MEDIAN_MAX_WINDOW];
+    uint32_t windowSize = S->windowSize;
+    uint32_t n, k;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        for( k = 0U; k < windowSize; k++ )
+        {
+            window[k] = ( n + k >= windowSize - 1U ) ? pSrc[n + k - ( windowSize - 1U )] : 0;
+        }
+
+        pDst[n] = ( q15_t ) ref_hampel_window( window, windowSize,
+                                               S->thresholdFract, S->shift, 15,
+                                               0x7FFF );
+    }
+}
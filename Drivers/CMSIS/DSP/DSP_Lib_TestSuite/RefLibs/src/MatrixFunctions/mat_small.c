@@ -0,0 +1,191 @@
+#include "ref.h"
+
+/* Conversion of a value with fracBits fractional bits to and from double */
+static float64_t ref_mat_small_to_f64(
+    q31_t x,
+    uint32_t fracBits )
+{
+    return ldexp( ( float64_t )x, -( int )fracBits );
+}
+
+static q31_t ref_mat_small_to_q31(
+    float64_t x,
+    uint32_t fracBits )
+{
+    return ref_sat_q31( ( q63_t )floor( ldexp( x, ( int )fracBits ) + 0.5 ) );
+}
+
+void ref_mat_mult_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += ref_mat_small_to_f64( pSrcA[i * n + k], fracBits ) *
+                       ref_mat_small_to_f64( pSrcB[k * n + j], fracBits );
+            }
+
+            pDst[i * n + j] = ref_mat_small_to_q31( sum, fracBits );
+        }
+    }
+}
+
+void ref_mat_mult_trans_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += ref_mat_small_to_f64( pSrcA[i * n + k], fracBits ) *
+                       ref_mat_small_to_f64( pSrcB[j * n + k], fracBits );
+            }
+
+            pDst[i * n + j] = ref_mat_small_to_q31( sum, fracBits );
+        }
+    }
+}
+
+void ref_mat_sym_update_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    float64_t AP[6 * 6];
+    uint32_t i, j, k;
+    float64_t sum;
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += ref_mat_small_to_f64( pSrcA[i * n + k], fracBits ) *
+                       ref_mat_small_to_f64( pSrcP[k * n + j], fracBits );
+            }
+
+            AP[i * n + j] = sum;
+        }
+    }
+
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j < n; j++ )
+        {
+            sum = ( pSrcQ != NULL ) ? ref_mat_small_to_f64( pSrcQ[i * n + j], fracBits ) : 0;
+
+            for( k = 0; k < n; k++ )
+            {
+                sum += AP[i * n + k] * ref_mat_small_to_f64( pSrcA[j * n + k], fracBits );
+            }
+
+            pDst[i * n + j] = ref_mat_small_to_q31( sum, fracBits );
+        }
+    }
+}
+
+arm_status ref_mat_ldlt_solve_small_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    float64_t L[6 * 6];
+    float64_t x[6];
+    float64_t sum;
+    uint32_t i, j, k;
+    uint16_t c;
+
+    /* Cholesky factorization A = L * L' of the lower triangle */
+    for( i = 0; i < n; i++ )
+    {
+        for( j = 0; j <= i; j++ )
+        {
+            sum = ref_mat_small_to_f64( pSrcA[i * n + j], fracBits );
+
+            for( k = 0; k < j; k++ )
+            {
+                sum -= L[i * n + k] * L[j * n + k];
+            }
+
+            if( i == j )
+            {
+                if( sum <= 0 )
+                {
+                    return ARM_MATH_SINGULAR;
+                }
+
+                L[i * n + i] = sqrt( sum );
+            }
+            else
+            {
+                L[i * n + j] = sum / L[j * n + j];
+            }
+        }
+    }
+
+    for( c = 0; c < numCols; c++ )
+    {
+        for( i = 0; i < n; i++ )
+        {
+            sum = ref_mat_small_to_f64( pSrcB[i * numCols + c], fracBits );
+
+            for( k = 0; k < i; k++ )
+            {
+                sum -= L[i * n + k] * x[k];
+            }
+
+            x[i] = sum / L[i * n + i];
+        }
+
+        for( i = n; i > 0; i-- )
+        {
+            sum = x[i - 1];
+
+            for( k = i; k < n; k++ )
+            {
+                sum -= L[k * n + i - 1] * x[k];
+            }
+
+            x[i - 1] = sum / L[( i - 1 ) * n + i - 1];
+        }
+
+        for( i = 0; i < n; i++ )
+        {
+            pDst[i * numCols + c] = ref_mat_small_to_q31( x[i], fracBits );
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
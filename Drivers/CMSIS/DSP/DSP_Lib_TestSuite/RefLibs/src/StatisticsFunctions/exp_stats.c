@@ -0,0 +1,47 @@
+#include "ref.h"
+
+void ref_exp_stats_q31(
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t alpha,
+    q31_t *pMean,
+    q31_t *pVar )
+{
+    uint32_t i;
+    double a = ( double )alpha / 2147483648.0;
+    double mean = 0, var = 0, diff, incr;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        diff = ( double )pSrc[i] / 2147483648.0 - mean;
+        incr = a * diff;
+        mean += incr;
+        var = ( 1 - a ) * ( var + diff * incr );
+    }
+
+    *pMean = ref_sat_q31( ( q63_t )( mean * 2147483648.0 ) );
+    *pVar = ref_sat_q31( ( q63_t )( var * 2147483648.0 ) );
+}
+
+void ref_exp_stats_q15(
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t alpha,
+    q15_t *pMean,
+    q15_t *pVar )
+{
+    uint32_t i;
+    double a = ( double )alpha / 32768.0;
+    double mean = 0, var = 0, diff, incr;
+
+    for( i = 0; i < blockSize; i++ )
+    {
+        diff = ( double )pSrc[i] / 32768.0 - mean;
+        incr = a * diff;
+        mean += incr;
+        var = ( 1 - a ) * ( var + diff * incr );
+    }
+
+    *pMean = ref_sat_q15( ( q31_t )( mean * 32768.0 ) );
+    *pVar = ref_sat_q15( ( q31_t )( var * 32768.0 ) );
+}
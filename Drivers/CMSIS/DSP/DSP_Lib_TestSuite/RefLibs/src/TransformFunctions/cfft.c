@@ -237,6 +237,29 @@ void ref_cfft_q15(
     }
 }
 
+/*
+ * The output is the DFT of the input without scaling, or the inverse DFT for
+ * the inverse transform, in floating point.
+ */
+void ref_cfft_bfp_q15(
+    const arm_cfft_instance_q15 *S,
+    const q15_t *pSrc,
+    float32_t *pDst,
+    uint8_t ifftFlag )
+{
+    arm_cfft_instance_f32 cfft = { 0 };
+    uint32_t i;
+
+    cfft.fftLen = S->fftLen;
+
+    for( i = 0; i < S->fftLen * 2; i++ )
+    {
+        pDst[i] = ( float32_t )pSrc[i] / 32768.0f;
+    }
+
+    ref_cfft_f32( &cfft, pDst, ifftFlag, 1 );
+}
+
 void ref_cfft_radix2_f32(
     const arm_cfft_radix2_instance_f32 *S,
     float32_t *pSrc )
@@ -0,0 +1,61 @@
+#include "ref.h"
+
+/*
+ * The Goertzel functions output X/N with X = sum(x[n] * exp(-j*w*(n-N))).
+ * The bins are computed directly in double precision.
+ */
+#define REF_TWO_PI 6.28318530717958647692
+
+void ref_goertzel_q15(
+    const q15_t *pSrc,
+    uint16_t blockSize,
+    const q15_t *pFreqs,
+    uint16_t numBins,
+    q15_t *pDst )
+{
+    double w, re, im;
+    uint32_t i, n;
+
+    for( i = 0; i < numBins; i++ )
+    {
+        w = REF_TWO_PI * ( double )pFreqs[i] / 32768.0;
+        re = 0.0;
+        im = 0.0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            re += ( double )pSrc[n] * cos( w * ( ( double )n - ( double )blockSize ) );
+            im -= ( double )pSrc[n] * sin( w * ( ( double )n - ( double )blockSize ) );
+        }
+
+        pDst[2 * i] = ref_sat_q15( ( q31_t )floor( re / blockSize + 0.5 ) );
+        pDst[2 * i + 1] = ref_sat_q15( ( q31_t )floor( im / blockSize + 0.5 ) );
+    }
+}
+
+void ref_goertzel_q31(
+    const q31_t *pSrc,
+    uint16_t blockSize,
+    const q31_t *pFreqs,
+    uint16_t numBins,
+    q31_t *pDst )
+{
+    double w, re, im;
+    uint32_t i, n;
+
+    for( i = 0; i < numBins; i++ )
+    {
+        w = REF_TWO_PI * ( double )pFreqs[i] / 2147483648.0;
+        re = 0.0;
+        im = 0.0;
+
+        for( n = 0; n < blockSize; n++ )
+        {
+            re += ( double )pSrc[n] * cos( w * ( ( double )n - ( double )blockSize ) );
+            im -= ( double )pSrc[n] * sin( w * ( ( double )n - ( double )blockSize ) );
+        }
+
+        pDst[2 * i] = ref_sat_q31( ( q63_t )floor( re / blockSize + 0.5 ) );
+        pDst[2 * i + 1] = ref_sat_q31( ( q63_t )floor( im / blockSize + 0.5 ) );
+    }
+}
@@ -0,0 +1,68 @@
+#include "ref.h"
+
+/*
+ * The sliding DFT functions output X/N for the window made of the last N
+ * samples, the oldest sample at index 0. Samples before the start of the
+ * input are zero. The bins are computed directly in double precision.
+ */
+#define REF_TWO_PI 6.28318530717958647692
+
+void ref_sliding_dft_q15(
+    const q15_t *pSrc,
+    uint32_t srcLen,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    uint16_t numBins,
+    q15_t *pDst )
+{
+    double w, re, im, x;
+    int32_t start = ( int32_t )srcLen - ( int32_t )dftLength;
+    uint32_t i, n;
+
+    for( i = 0; i < numBins; i++ )
+    {
+        w = REF_TWO_PI * ( double )pBins[i] / ( double )dftLength;
+        re = 0.0;
+        im = 0.0;
+
+        for( n = 0; n < dftLength; n++ )
+        {
+            x = ( start + ( int32_t )n < 0 ) ? 0.0 : ( double )pSrc[start + ( int32_t )n];
+            re += x * cos( w * n );
+            im -= x * sin( w * n );
+        }
+
+        pDst[2 * i] = ref_sat_q15( ( q31_t )floor( re / dftLength + 0.5 ) );
+        pDst[2 * i + 1] = ref_sat_q15( ( q31_t )floor( im / dftLength + 0.5 ) );
+    }
+}
+
+void ref_sliding_dft_q31(
+    const q31_t *pSrc,
+    uint32_t srcLen,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    uint16_t numBins,
+    q31_t *pDst )
+{
+    double w, re, im, x;
+    int32_t start = ( int32_t )srcLen - ( int32_t )dftLength;
+    uint32_t i, n;
+
+    for( i = 0; i < numBins; i++ )
+    {
+        w = REF_TWO_PI * ( double )pBins[i] / ( double )dftLength;
+        re = 0.0;
+        im = 0.0;
+
+        for( n = 0; n < dftLength; n++ )
+        {
+            x = ( start + ( int32_t )n < 0 ) ? 0.0 : ( double )pSrc[start + ( int32_t )n];
+            re += x * cos( w * n );
+            im -= x * sin( w * n );
+        }
+
+        pDst[2 * i] = ref_sat_q31( ( q63_t )floor( re / dftLength + 0.5 ) );
+        pDst[2 * i + 1] = ref_sat_q31( ( q63_t )floor( im / dftLength + 0.5 ) );
+    }
+}
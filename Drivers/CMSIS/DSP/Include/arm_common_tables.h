@@ -31,6 +31,293 @@
 
 #include "arm_math.h"
 
+/*
+ * FFT table selection.
+ *
+ * By default every FFT table is built. When ARM_DSP_CONFIG_TABLES is defined
+ * for the library build, only the tables of the transforms selected with the
+ * macros below are built, unless ARM_ALL_FFT_TABLES is also defined:
+ *   ARM_TABLE_CFFT_F32_<N>, ARM_TABLE_CFFT_Q31_<N>, ARM_TABLE_CFFT_Q15_<N>
+ *   ARM_TABLE_RFFT_FAST_F32_<N>, ARM_TABLE_RFFT_Q31_<N>, ARM_TABLE_RFFT_Q15_<N>
+ * They also enable the matching structure of arm_const_structs.h and the
+ * matching length in the init functions. The radix-2 and radix-4 functions
+ * need ARM_TABLE_BITREV_1024 and ARM_TABLE_CFFT_xxx_4096 of their type.
+ *
+ * Single tables can be selected with ARM_TABLE_TWIDDLECOEF_xxx_<N>,
+ * ARM_TABLE_BITREVIDX_FLT_<N> or ARM_TABLE_BITREVIDX_FXT_<N>, for instance
+ * to keep a bit reversal table in flash while the twiddle factors are
+ * generated in RAM with arm_cfft_ram_init_f32() and its variants.
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES)
+  #define ARM_TABLE_BITREV_1024
+  #define ARM_TABLE_CFFT_F32_16
+  #define ARM_TABLE_CFFT_F32_32
+  #define ARM_TABLE_CFFT_F32_64
+  #define ARM_TABLE_CFFT_F32_128
+  #define ARM_TABLE_CFFT_F32_256
+  #define ARM_TABLE_CFFT_F32_512
+  #define ARM_TABLE_CFFT_F32_1024
+  #define ARM_TABLE_CFFT_F32_2048
+  #define ARM_TABLE_CFFT_F32_4096
+  #define ARM_TABLE_CFFT_Q31_16
+  #define ARM_TABLE_CFFT_Q31_32
+  #define ARM_TABLE_CFFT_Q31_64
+  #define ARM_TABLE_CFFT_Q31_128
+  #define ARM_TABLE_CFFT_Q31_256
+  #define ARM_TABLE_CFFT_Q31_512
+  #define ARM_TABLE_CFFT_Q31_1024
+  #define ARM_TABLE_CFFT_Q31_2048
+  #define ARM_TABLE_CFFT_Q31_4096
+  #define ARM_TABLE_CFFT_Q15_16
+  #define ARM_TABLE_CFFT_Q15_32
+  #define ARM_TABLE_CFFT_Q15_64
+  #define ARM_TABLE_CFFT_Q15_128
+  #define ARM_TABLE_CFFT_Q15_256
+  #define ARM_TABLE_CFFT_Q15_512
+  #define ARM_TABLE_CFFT_Q15_1024
+  #define ARM_TABLE_CFFT_Q15_2048
+  #define ARM_TABLE_CFFT_Q15_4096
+  #define ARM_TABLE_RFFT_FAST_F32_32
+  #define ARM_TABLE_RFFT_FAST_F32_64
+  #define ARM_TABLE_RFFT_FAST_F32_128
+  #define ARM_TABLE_RFFT_FAST_F32_256
+  #define ARM_TABLE_RFFT_FAST_F32_512
+  #define ARM_TABLE_RFFT_FAST_F32_1024
+  #define ARM_TABLE_RFFT_FAST_F32_2048
+  #define ARM_TABLE_RFFT_FAST_F32_4096
+  #define ARM_TABLE_RFFT_Q31_32
+  #define ARM_TABLE_RFFT_Q31_64
+  #define ARM_TABLE_RFFT_Q31_128
+  #define ARM_TABLE_RFFT_Q31_256
+  #define ARM_TABLE_RFFT_Q31_512
+  #define ARM_TABLE_RFFT_Q31_1024
+  #define ARM_TABLE_RFFT_Q31_2048
+  #define ARM_TABLE_RFFT_Q31_4096
+  #define ARM_TABLE_RFFT_Q31_8192
+  #define ARM_TABLE_RFFT_Q15_32
+  #define ARM_TABLE_RFFT_Q15_64
+  #define ARM_TABLE_RFFT_Q15_128
+  #define ARM_TABLE_RFFT_Q15_256
+  #define ARM_TABLE_RFFT_Q15_512
+  #define ARM_TABLE_RFFT_Q15_1024
+  #define ARM_TABLE_RFFT_Q15_2048
+  #define ARM_TABLE_RFFT_Q15_4096
+  #define ARM_TABLE_RFFT_Q15_8192
+#endif
+
+#if defined(ARM_TABLE_RFFT_FAST_F32_32)
+  #define ARM_TABLE_CFFT_F32_16
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_64)
+  #define ARM_TABLE_CFFT_F32_32
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_128)
+  #define ARM_TABLE_CFFT_F32_64
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_256)
+  #define ARM_TABLE_CFFT_F32_128
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_512)
+  #define ARM_TABLE_CFFT_F32_256
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_1024)
+  #define ARM_TABLE_CFFT_F32_512
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_2048)
+  #define ARM_TABLE_CFFT_F32_1024
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+#endif
+#if defined(ARM_TABLE_RFFT_FAST_F32_4096)
+  #define ARM_TABLE_CFFT_F32_2048
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_32)
+  #define ARM_TABLE_CFFT_Q31_16
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_64)
+  #define ARM_TABLE_CFFT_Q31_32
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_128)
+  #define ARM_TABLE_CFFT_Q31_64
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_256)
+  #define ARM_TABLE_CFFT_Q31_128
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_512)
+  #define ARM_TABLE_CFFT_Q31_256
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_1024)
+  #define ARM_TABLE_CFFT_Q31_512
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_2048)
+  #define ARM_TABLE_CFFT_Q31_1024
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_4096)
+  #define ARM_TABLE_CFFT_Q31_2048
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q31_8192)
+  #define ARM_TABLE_CFFT_Q31_4096
+  #define ARM_TABLE_REALCOEF_Q31
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_32)
+  #define ARM_TABLE_CFFT_Q15_16
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_64)
+  #define ARM_TABLE_CFFT_Q15_32
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_128)
+  #define ARM_TABLE_CFFT_Q15_64
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_256)
+  #define ARM_TABLE_CFFT_Q15_128
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_512)
+  #define ARM_TABLE_CFFT_Q15_256
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_1024)
+  #define ARM_TABLE_CFFT_Q15_512
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_2048)
+  #define ARM_TABLE_CFFT_Q15_1024
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_4096)
+  #define ARM_TABLE_CFFT_Q15_2048
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_RFFT_Q15_8192)
+  #define ARM_TABLE_CFFT_Q15_4096
+  #define ARM_TABLE_REALCOEF_Q15
+#endif
+#if defined(ARM_TABLE_CFFT_F32_16)
+  #define ARM_TABLE_TWIDDLECOEF_F32_16
+  #define ARM_TABLE_BITREVIDX_FLT_16
+#endif
+#if defined(ARM_TABLE_CFFT_F32_32)
+  #define ARM_TABLE_TWIDDLECOEF_F32_32
+  #define ARM_TABLE_BITREVIDX_FLT_32
+#endif
+#if defined(ARM_TABLE_CFFT_F32_64)
+  #define ARM_TABLE_TWIDDLECOEF_F32_64
+  #define ARM_TABLE_BITREVIDX_FLT_64
+#endif
+#if defined(ARM_TABLE_CFFT_F32_128)
+  #define ARM_TABLE_TWIDDLECOEF_F32_128
+  #define ARM_TABLE_BITREVIDX_FLT_128
+#endif
+#if defined(ARM_TABLE_CFFT_F32_256)
+  #define ARM_TABLE_TWIDDLECOEF_F32_256
+  #define ARM_TABLE_BITREVIDX_FLT_256
+#endif
+#if defined(ARM_TABLE_CFFT_F32_512)
+  #define ARM_TABLE_TWIDDLECOEF_F32_512
+  #define ARM_TABLE_BITREVIDX_FLT_512
+#endif
+#if defined(ARM_TABLE_CFFT_F32_1024)
+  #define ARM_TABLE_TWIDDLECOEF_F32_1024
+  #define ARM_TABLE_BITREVIDX_FLT_1024
+#endif
+#if defined(ARM_TABLE_CFFT_F32_2048)
+  #define ARM_TABLE_TWIDDLECOEF_F32_2048
+  #define ARM_TABLE_BITREVIDX_FLT_2048
+#endif
+#if defined(ARM_TABLE_CFFT_F32_4096)
+  #define ARM_TABLE_TWIDDLECOEF_F32_4096
+  #define ARM_TABLE_BITREVIDX_FLT_4096
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_16)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_16
+  #define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_32)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_32
+  #define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_64)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_64
+  #define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_128)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_128
+  #define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_256)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_256
+  #define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_512)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_512
+  #define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_1024)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_1024
+  #define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_2048)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_2048
+  #define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#if defined(ARM_TABLE_CFFT_Q31_4096)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_4096
+  #define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_16)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_16
+  #define ARM_TABLE_BITREVIDX_FXT_16
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_32)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_32
+  #define ARM_TABLE_BITREVIDX_FXT_32
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_64)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_64
+  #define ARM_TABLE_BITREVIDX_FXT_64
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_128)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_128
+  #define ARM_TABLE_BITREVIDX_FXT_128
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_256)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_256
+  #define ARM_TABLE_BITREVIDX_FXT_256
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_512)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_512
+  #define ARM_TABLE_BITREVIDX_FXT_512
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_1024)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_1024
+  #define ARM_TABLE_BITREVIDX_FXT_1024
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_2048)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_2048
+  #define ARM_TABLE_BITREVIDX_FXT_2048
+#endif
+#if defined(ARM_TABLE_CFFT_Q15_4096)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_4096
+  #define ARM_TABLE_BITREVIDX_FXT_4096
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -118,4 +405,13 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for Fast Math atan2, logarithm, exp2 and reciprocal square root */
+extern const q15_t atanTable_q15[FAST_MATH_POLY_SEGMENTS + 1];
+extern const q31_t atanTable_q31[4 * FAST_MATH_POLY_SEGMENTS];
+extern const q15_t log2Table_q15[FAST_MATH_POLY_SEGMENTS + 1];
+extern const q31_t log2Table_q31[4 * FAST_MATH_POLY_SEGMENTS];
+extern const q15_t exp2Table_q15[FAST_MATH_POLY_SEGMENTS + 1];
+extern const q31_t exp2Table_q31[4 * FAST_MATH_POLY_SEGMENTS];
+extern const q15_t rsqrtTable_q15[49];
+
 #endif /*  ARM_COMMON_TABLES_H */
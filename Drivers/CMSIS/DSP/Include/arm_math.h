@@ -78,6 +78,9 @@
    * For Armv8-M cores define preprocessor macro ARM_MATH_ARMV8MBL or ARM_MATH_ARMV8MML.
    * Set preprocessor macro __DSP_PRESENT if Armv8-M Mainline core supports DSP instructions.
    *
+   * C++ applications can also include <code>arm_math.hpp</code>, which provides FIR and Biquad filter templates
+   * specialized at compile time for a fixed length and fixed coefficients.
+   *
    *
    * Examples
    * --------
@@ -139,6 +142,13 @@
    *
    * Initialize macro __DSP_PRESENT = 1 when Armv8-M Mainline core supports DSP instructions.
    *
+   * - ARM_DSP_CONFIG_TABLES:
+   *
+   * Define macro ARM_DSP_CONFIG_TABLES to build only the FFT tables and instances selected with the ARM_TABLE_xxx macros
+   * described in arm_common_tables.h, for example ARM_TABLE_CFFT_Q15_256 or ARM_TABLE_RFFT_FAST_F32_1024. By default all
+   * the tables are built. The tables of other lengths can be computed in RAM with arm_cfft_ram_init_f32(), arm_cfft_ram_init_q31(),
+   * arm_cfft_ram_init_q15() and arm_rfft_fast_ram_init_f32().
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -372,6 +382,11 @@ extern "C"
 #define TABLE_SPACING_Q31     0x400000
 #define TABLE_SPACING_Q15     0x80
 
+/**
+ * @brief Number of table segments of the atan2, logarithm and exp2 Fast math approximations
+ */
+#define FAST_MATH_POLY_SEGMENTS  32
+
 /**
  * @brief Macros required for SINE and COSINE Controller functions
  */
@@ -2099,6 +2114,32 @@ void arm_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag );
 
+/**
+ * @brief  Processing function for the block floating point Q15 CFFT.
+ * @param[in]     S         points to an instance of the Q15 CFFT structure.
+ * @param[in,out] p1        points to the complex data buffer of size 2*fftLen, processed in place.
+ * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return The exponent of the output, in natural order: the transform is p1 * 2^exponent.
+ */
+int32_t arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 *S,
+    q15_t *p1,
+    uint8_t ifftFlag );
+
+/**
+ * @brief  Initialization function for the Q15 CFFT with tables computed in RAM.
+ * @param[out] S             points to an instance of the Q15 CFFT structure.
+ * @param[in]  fftLen        length of the FFT, a power of 2 between 16 and 4096.
+ * @param[out] pTwiddle      points to the twiddle buffer of size 3*fftLen/2.
+ * @param[out] pBitRevTable  points to the bit reversal buffer of size ARMBITREVINDEXTABLE_FIXED_<N>_TABLE_LENGTH.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the length is not supported.
+ */
+arm_status arm_cfft_ram_init_q15(
+    arm_cfft_instance_q15 *S,
+    uint16_t fftLen,
+    q15_t *pTwiddle,
+    uint16_t *pBitRevTable );
+
 /**
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  */
@@ -2116,6 +2157,20 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag );
 
+/**
+ * @brief  Initialization function for the Q31 CFFT with tables computed in RAM.
+ * @param[out] S             points to an instance of the Q31 CFFT structure.
+ * @param[in]  fftLen        length of the FFT, a power of 2 between 16 and 4096.
+ * @param[out] pTwiddle      points to the twiddle buffer of size 3*fftLen/2.
+ * @param[out] pBitRevTable  points to the bit reversal buffer of size ARMBITREVINDEXTABLE_FIXED_<N>_TABLE_LENGTH.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the length is not supported.
+ */
+arm_status arm_cfft_ram_init_q31(
+    arm_cfft_instance_q31 *S,
+    uint16_t fftLen,
+    q31_t *pTwiddle,
+    uint16_t *pBitRevTable );
+
 /**
  * @brief Instance structure for the floating-point CFFT/CIFFT function.
  */
@@ -2133,6 +2188,20 @@ void arm_cfft_f32(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag );
 
+/**
+ * @brief  Initialization function for the floating-point CFFT with tables computed in RAM.
+ * @param[out] S             points to an instance of the floating-point CFFT structure.
+ * @param[in]  fftLen        length of the FFT, a power of 2 between 16 and 4096.
+ * @param[out] pTwiddle      points to the twiddle buffer of size 2*fftLen.
+ * @param[out] pBitRevTable  points to the bit reversal buffer of size ARMBITREVINDEXTABLE_<N>_TABLE_LENGTH.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the length is not supported.
+ */
+arm_status arm_cfft_ram_init_f32(
+    arm_cfft_instance_f32 *S,
+    uint16_t fftLen,
+    float32_t *pTwiddle,
+    uint16_t *pBitRevTable );
+
 /**
  * @brief Instance structure for the Q15 RFFT/RIFFT function.
  */
@@ -2224,6 +2293,22 @@ arm_status arm_rfft_fast_init_f32(
     arm_rfft_fast_instance_f32 *S,
     uint16_t fftLen );
 
+/**
+ * @brief  Initialization function for the floating-point real FFT with tables computed in RAM.
+ * @param[out] S             points to an arm_rfft_fast_instance_f32 structure.
+ * @param[in]  fftLen        length of the real sequence, a power of 2 between 32 and 8192.
+ * @param[out] pTwiddle      points to the CFFT twiddle buffer of size fftLen.
+ * @param[out] pTwiddleRFFT  points to the RFFT twiddle buffer of size fftLen.
+ * @param[out] pBitRevTable  points to the bit reversal buffer of size ARMBITREVINDEXTABLE_<fftLen/2>_TABLE_LENGTH.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the length is not supported.
+ */
+arm_status arm_rfft_fast_ram_init_f32(
+    arm_rfft_fast_instance_f32 *S,
+    uint16_t fftLen,
+    float32_t *pTwiddle,
+    float32_t *pTwiddleRFFT,
+    uint16_t *pBitRevTable );
+
 void arm_rfft_fast_f32(
     arm_rfft_fast_instance_f32 *S,
     float32_t *p, float32_t *pOut,
@@ -2367,6 +2452,186 @@ void arm_dct4_q15(
     q15_t *pInlineBuffer );
 
 
+/**
+ * @brief Damping factor of the sliding DFT twiddle factors, 1 - 2^-20 in 1.31 format.
+ */
+#define ARM_SLIDING_DFT_DAMPING  0x7FFFF800
+
+
+/**
+ * @brief Instance structure for the Q15 Goertzel bin detector.
+ */
+typedef struct
+{
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockSize;                  /**< number of samples processed per call. */
+    q31_t *pCoeffs;                      /**< points to the cosine and sine of each bin, interleaved. */
+} arm_goertzel_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 Goertzel bin detector.
+ */
+typedef struct
+{
+    uint16_t numBins;                    /**< number of frequency bins. */
+    uint16_t blockSize;                  /**< number of samples processed per call. */
+    q31_t *pCoeffs;                      /**< points to the cosine and sine of each bin, interleaved. */
+} arm_goertzel_instance_q31;
+
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel bin detector.
+ * @param[in,out] S          points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins    number of frequency bins.
+ * @param[in]     blockSize  number of samples processed per call, at most 256.
+ * @param[in]     pFreqs     points to the normalized bin frequencies, 0x4000 is the Nyquist frequency.
+ * @param[out]    pCoeffs    points to the coefficient buffer of size 2*numBins.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the arguments are out of range.
+ */
+arm_status arm_goertzel_init_q15(
+    arm_goertzel_instance_q15 *S,
+    uint16_t numBins,
+    uint16_t blockSize,
+    const q15_t *pFreqs,
+    q31_t *pCoeffs );
+
+/**
+ * @brief Processing function for the Q15 Goertzel bin detector.
+ * @param[in]  S      points to an instance of the Q15 Goertzel structure.
+ * @param[in]  pSrc   points to the block of input samples.
+ * @param[out] pDst   points to the numBins complex outputs.
+ */
+void arm_goertzel_q15(
+    const arm_goertzel_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst );
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel bin detector.
+ * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins    number of frequency bins.
+ * @param[in]     blockSize  number of samples processed per call, at most 32768.
+ * @param[in]     pFreqs     points to the normalized bin frequencies, 0x40000000 is the Nyquist frequency.
+ * @param[out]    pCoeffs    points to the coefficient buffer of size 2*numBins.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the arguments are out of range.
+ */
+arm_status arm_goertzel_init_q31(
+    arm_goertzel_instance_q31 *S,
+    uint16_t numBins,
+    uint16_t blockSize,
+    const q31_t *pFreqs,
+    q31_t *pCoeffs );
+
+/**
+ * @brief Processing function for the Q31 Goertzel bin detector.
+ * @param[in]  S      points to an instance of the Q31 Goertzel structure.
+ * @param[in]  pSrc   points to the block of input samples.
+ * @param[out] pDst   points to the numBins complex outputs.
+ */
+void arm_goertzel_q31(
+    const arm_goertzel_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst );
+
+
+/**
+ * @brief Instance structure for the Q15 sliding DFT.
+ */
+typedef struct
+{
+    uint16_t numBins;                    /**< number of DFT bins. */
+    uint16_t dftLength;                  /**< length of the sliding window. */
+    uint16_t stateIndex;                 /**< position of the oldest sample in the delay line. */
+    q31_t invLength;                     /**< 1/dftLength in 1.31 format. */
+    q31_t combCoeff;                     /**< damping of the sample leaving the window. */
+    q31_t *pTwiddle;                     /**< points to the damped twiddle factor of each bin. */
+    q15_t *pDelay;                       /**< points to the delay line of dftLength samples. */
+    q31_t *pState;                       /**< points to the bin states of size 2*numBins. */
+} arm_sliding_dft_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 sliding DFT.
+ */
+typedef struct
+{
+    uint16_t numBins;                    /**< number of DFT bins. */
+    uint16_t dftLength;                  /**< length of the sliding window. */
+    uint16_t stateIndex;                 /**< position of the oldest sample in the delay line. */
+    q31_t invLength;                     /**< 1/dftLength in 1.31 format. */
+    q31_t combCoeff;                     /**< damping of the sample leaving the window. */
+    q31_t *pTwiddle;                     /**< points to the damped twiddle factor of each bin. */
+    q31_t *pDelay;                       /**< points to the delay line of dftLength samples. */
+    q31_t *pState;                       /**< points to the bin states of size 2*numBins. */
+} arm_sliding_dft_instance_q31;
+
+
+/**
+ * @brief  Initialization function for the Q15 sliding DFT.
+ * @param[in,out] S           points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     numBins     number of DFT bins.
+ * @param[in]     dftLength   length of the sliding window, at least 2.
+ * @param[in]     pBins       points to the bin indexes.
+ * @param[out]    pTwiddle    points to the twiddle buffer of size 2*numBins.
+ * @param[out]    pDelay      points to the delay line of size dftLength.
+ * @param[out]    pState      points to the bin state buffer of size 2*numBins.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the arguments are out of range.
+ */
+arm_status arm_sliding_dft_init_q15(
+    arm_sliding_dft_instance_q15 *S,
+    uint16_t numBins,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    q31_t *pTwiddle,
+    q15_t *pDelay,
+    q31_t *pState );
+
+/**
+ * @brief Processing function for the Q15 sliding DFT.
+ * @param[in,out] S           points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     pSrc        points to the block of input samples.
+ * @param[out]    pDst        points to the numBins complex outputs of the last window.
+ * @param[in]     blockSize   number of input samples to process.
+ */
+void arm_sliding_dft_q15(
+    arm_sliding_dft_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[in,out] S           points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     numBins     number of DFT bins.
+ * @param[in]     dftLength   length of the sliding window, at least 2.
+ * @param[in]     pBins       points to the bin indexes.
+ * @param[out]    pTwiddle    points to the twiddle buffer of size 2*numBins.
+ * @param[out]    pDelay      points to the delay line of size dftLength.
+ * @param[out]    pState      points to the bin state buffer of size 2*numBins.
+ * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if the arguments are out of range.
+ */
+arm_status arm_sliding_dft_init_q31(
+    arm_sliding_dft_instance_q31 *S,
+    uint16_t numBins,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    q31_t *pTwiddle,
+    q31_t *pDelay,
+    q31_t *pState );
+
+/**
+ * @brief Processing function for the Q31 sliding DFT.
+ * @param[in,out] S           points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     pSrc        points to the block of input samples.
+ * @param[out]    pDst        points to the numBins complex outputs of the last window.
+ * @param[in]     blockSize   number of input samples to process.
+ */
+void arm_sliding_dft_q31(
+    arm_sliding_dft_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
 /**
  * @brief Floating-point vector addition.
  * @param[in]  pSrcA      points to the first input vector
@@ -3544,185 +3809,626 @@ arm_status arm_fir_interpolate_init_f32(
 
 
 /**
- * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+ * @brief Instance structure for the Q15 FIR filter with circular state buffer.
  */
 typedef struct
 {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-} arm_biquad_cas_df1_32x64_ins_q31;
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+} arm_fir_circ_instance_q15;
 
 /**
- * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
- * @param[in]  pSrc       points to the block of input data.
- * @param[out] pDst       points to the block of output data
- * @param[in]  blockSize  number of samples to process.
+ * @brief Instance structure for the Q15 FIR decimator with circular state buffer.
  */
-void arm_biquad_cas_df1_32x64_q31(
-    const arm_biquad_cas_df1_32x64_ins_q31 *S,
-    q31_t *pSrc,
-    q31_t *pDst,
-    uint32_t blockSize );
-
+typedef struct
+{
+    uint8_t M;                /**< decimation factor. */
+    uint16_t numTaps;         /**< number of coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+} arm_fir_decimate_circ_instance_q15;
 
 /**
- * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
- * @param[in]     numStages  number of 2nd order stages in the filter.
- * @param[in]     pCoeffs    points to the filter coefficients.
- * @param[in]     pState     points to the state buffer.
- * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+ * @brief Instance structure for the Q15 FIR interpolator with circular state buffer.
  */
-void arm_biquad_cas_df1_32x64_init_q31(
-    arm_biquad_cas_df1_32x64_ins_q31 *S,
-    uint8_t numStages,
-    q31_t *pCoeffs,
-    q63_t *pState,
-    uint8_t postShift );
+typedef struct
+{
+    uint8_t L;                /**< upsample factor. */
+    uint16_t phaseLength;     /**< length of each polyphase filter component. */
+    uint32_t stateLength;     /**< length of the circular delay line, phaseLength+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length 2*(phaseLength+blockSize-1). */
+} arm_fir_interpolate_circ_instance_q15;
 
 
 /**
- * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ * @brief Instance structure for the Q31 FIR filter with circular state buffer.
  */
 typedef struct
 {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-} arm_biquad_cascade_df2T_instance_f32;
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+} arm_fir_circ_instance_q31;
 
 /**
- * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ * @brief Instance structure for the Q31 FIR decimator with circular state buffer.
  */
 typedef struct
 {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-} arm_biquad_cascade_stereo_df2T_instance_f32;
+    uint8_t M;                /**< decimation factor. */
+    uint16_t numTaps;         /**< number of coefficients in the filter. */
+    uint32_t stateLength;     /**< length of the circular delay line, numTaps+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*(numTaps+blockSize-1). */
+} arm_fir_decimate_circ_instance_q31;
 
 /**
- * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ * @brief Instance structure for the Q31 FIR interpolator with circular state buffer.
  */
 typedef struct
 {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-} arm_biquad_cascade_df2T_instance_f64;
+    uint8_t L;                /**< upsample factor. */
+    uint16_t phaseLength;     /**< length of each polyphase filter component. */
+    uint32_t stateLength;     /**< length of the circular delay line, phaseLength+blockSize-1. */
+    uint32_t stateIndex;      /**< position in the delay line of the oldest sample used by the next call. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length 2*(phaseLength+blockSize-1). */
+} arm_fir_interpolate_circ_instance_q31;
 
 
 /**
- * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
- * @param[in]  S          points to an instance of the filter data structure.
- * @param[in]  pSrc       points to the block of input data.
- * @param[out] pDst       points to the block of output data
- * @param[in]  blockSize  number of samples to process.
+ * @brief Processing function for the Q15 FIR filter with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, at most the block size given at initialization.
  */
-void arm_biquad_cascade_df2T_f32(
-    const arm_biquad_cascade_df2T_instance_f32 *S,
-    float32_t *pSrc,
-    float32_t *pDst,
+void arm_fir_circ_q15(
+    arm_fir_circ_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
     uint32_t blockSize );
 
 
 /**
- * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
- * @param[in]  S          points to an instance of the filter data structure.
- * @param[in]  pSrc       points to the block of input data.
- * @param[out] pDst       points to the block of output data
- * @param[in]  blockSize  number of samples to process.
+ * @brief  Initialization function for the Q15 FIR filter with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR filter structure.
+ * @param[in]     numTaps    Number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of samples that are processed per call.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> or <code>blockSize</code> is 0.
  */
-void arm_biquad_cascade_stereo_df2T_f32(
-    const arm_biquad_cascade_stereo_df2T_instance_f32 *S,
-    float32_t *pSrc,
-    float32_t *pDst,
+arm_status arm_fir_circ_init_q15(
+    arm_fir_circ_instance_q15 *S,
+    uint16_t numTaps,
+    q15_t *pCoeffs,
+    q15_t *pState,
     uint32_t blockSize );
 
 
 /**
- * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
- * @param[in]  S          points to an instance of the filter data structure.
- * @param[in]  pSrc       points to the block of input data.
- * @param[out] pDst       points to the block of output data
- * @param[in]  blockSize  number of samples to process.
+ * @brief Processing function for the Q15 FIR decimator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR decimator structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
  */
-void arm_biquad_cascade_df2T_f64(
-    const arm_biquad_cascade_df2T_instance_f64 *S,
-    float64_t *pSrc,
-    float64_t *pDst,
+void arm_fir_decimate_circ_q15(
+    arm_fir_decimate_circ_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
     uint32_t blockSize );
 
 
 /**
- * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
- * @param[in,out] S          points to an instance of the filter data structure.
- * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @brief  Initialization function for the Q15 FIR decimator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR decimator structure.
+ * @param[in]     numTaps    number of coefficients in the filter.
+ * @param[in]     M          decimation factor.
  * @param[in]     pCoeffs    points to the filter coefficients.
- * @param[in]     pState     points to the state buffer.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * <code>blockSize</code> is not a multiple of <code>M</code>.
  */
-void arm_biquad_cascade_df2T_init_f32(
-    arm_biquad_cascade_df2T_instance_f32 *S,
-    uint8_t numStages,
-    float32_t *pCoeffs,
-    float32_t *pState );
+arm_status arm_fir_decimate_circ_init_q15(
+    arm_fir_decimate_circ_instance_q15 *S,
+    uint16_t numTaps,
+    uint8_t M,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    uint32_t blockSize );
 
 
 /**
- * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
- * @param[in,out] S          points to an instance of the filter data structure.
- * @param[in]     numStages  number of 2nd order stages in the filter.
- * @param[in]     pCoeffs    points to the filter coefficients.
- * @param[in]     pState     points to the state buffer.
+ * @brief Processing function for the Q15 FIR interpolator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR interpolator structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
  */
-void arm_biquad_cascade_stereo_df2T_init_f32(
-    arm_biquad_cascade_stereo_df2T_instance_f32 *S,
-    uint8_t numStages,
-    float32_t *pCoeffs,
-    float32_t *pState );
+void arm_fir_interpolate_circ_q15(
+    arm_fir_interpolate_circ_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
 
 
 /**
- * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
- * @param[in,out] S          points to an instance of the filter data structure.
- * @param[in]     numStages  number of 2nd order stages in the filter.
- * @param[in]     pCoeffs    points to the filter coefficients.
- * @param[in]     pState     points to the state buffer.
+ * @brief  Initialization function for the Q15 FIR interpolator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q15 circular-state FIR interpolator structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficient buffer.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps/L+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
  */
-void arm_biquad_cascade_df2T_init_f64(
-    arm_biquad_cascade_df2T_instance_f64 *S,
-    uint8_t numStages,
-    float64_t *pCoeffs,
-    float64_t *pState );
+arm_status arm_fir_interpolate_circ_init_q15(
+    arm_fir_interpolate_circ_instance_q15 *S,
+    uint8_t L,
+    uint16_t numTaps,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    uint32_t blockSize );
 
 
 /**
- * @brief Instance structure for the Q15 FIR lattice filter.
+ * @brief Processing function for the Q31 FIR filter with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR filter structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, at most the block size given at initialization.
  */
-typedef struct
-{
-    uint16_t numStages;                  /**< number of filter stages. */
-    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
-    q15_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
-} arm_fir_lattice_instance_q15;
+void arm_fir_circ_q31(
+    arm_fir_circ_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
 
 /**
- * @brief Instance structure for the Q31 FIR lattice filter.
+ * @brief  Initialization function for the Q31 FIR filter with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR filter structure.
+ * @param[in]     numTaps    Number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of samples that are processed per call.
+ * @return The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> or <code>blockSize</code> is 0.
  */
-typedef struct
-{
-    uint16_t numStages;                  /**< number of filter stages. */
-    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
-    q31_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
-} arm_fir_lattice_instance_q31;
+arm_status arm_fir_circ_init_q31(
+    arm_fir_circ_instance_q31 *S,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t blockSize );
+
 
 /**
- * @brief Instance structure for the floating-point FIR lattice filter.
+ * @brief Processing function for the Q31 FIR decimator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR decimator structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
  */
-typedef struct
-{
+void arm_fir_decimate_circ_q31(
+    arm_fir_decimate_circ_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q31 FIR decimator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR decimator structure.
+ * @param[in]     numTaps    number of coefficients in the filter.
+ * @param[in]     M          decimation factor.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * <code>blockSize</code> is not a multiple of <code>M</code>.
+ */
+arm_status arm_fir_decimate_circ_init_q31(
+    arm_fir_decimate_circ_instance_q31 *S,
+    uint16_t numTaps,
+    uint8_t M,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the Q31 FIR interpolator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR interpolator structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
+ */
+void arm_fir_interpolate_circ_q31(
+    arm_fir_interpolate_circ_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q31 FIR interpolator with circular state buffer.
+ * @param[in,out] S          points to an instance of the Q31 circular-state FIR interpolator structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficient buffer.
+ * @param[in]     pState     points to the state buffer of 2*(numTaps/L+blockSize-1) samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+ */
+arm_status arm_fir_interpolate_circ_init_q31(
+    arm_fir_interpolate_circ_instance_q31 *S,
+    uint8_t L,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Instance structure for the Q15 FIR rational resampler.
+ */
+typedef struct
+{
+    uint16_t L;                       /**< upsample factor. */
+    uint16_t M;                       /**< decimation factor. */
+    uint16_t stepInt;                 /**< integer part of M/L, in input samples. */
+    uint16_t stepFrac;                /**< remainder of M/L, in polyphase components. */
+    uint16_t phaseLength;             /**< length of each polyphase filter component. */
+    uint16_t phase;                   /**< polyphase component of the next output. */
+    uint32_t inputOffset;             /**< input sample of the next output, relative to the next block. */
+    q15_t *pCoeffs;                   /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                    /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+} arm_fir_resample_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 FIR rational resampler.
+ */
+typedef struct
+{
+    uint16_t L;                       /**< upsample factor. */
+    uint16_t M;                       /**< decimation factor. */
+    uint16_t stepInt;                 /**< integer part of M/L, in input samples. */
+    uint16_t stepFrac;                /**< remainder of M/L, in polyphase components. */
+    uint16_t phaseLength;             /**< length of each polyphase filter component. */
+    uint16_t phase;                   /**< polyphase component of the next output. */
+    uint32_t inputOffset;             /**< input sample of the next output, relative to the next block. */
+    q31_t *pCoeffs;                   /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                    /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+} arm_fir_resample_instance_q31;
+
+/**
+ * @brief Instance structure for the floating-point FIR rational resampler.
+ */
+typedef struct
+{
+    uint16_t L;                       /**< upsample factor. */
+    uint16_t M;                       /**< decimation factor. */
+    uint16_t stepInt;                 /**< integer part of M/L, in input samples. */
+    uint16_t stepFrac;                /**< remainder of M/L, in polyphase components. */
+    uint16_t phaseLength;             /**< length of each polyphase filter component. */
+    uint16_t phase;                   /**< polyphase component of the next output. */
+    uint32_t inputOffset;             /**< input sample of the next output, relative to the next block. */
+    float32_t *pCoeffs;               /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;                /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+} arm_fir_resample_instance_f32;
+
+
+/**
+ * @brief Processing function for the Q15 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data, of at least ceil(blockSize*L/M) samples.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+uint32_t arm_fir_resample_q15(
+    arm_fir_resample_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q15 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     M          decimation factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficient buffer.
+ * @param[in]     pState     points to the state buffer of numTaps/L+blockSize-1 samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is zero
+ * or not a multiple of the interpolation factor <code>L</code>.
+ */
+arm_status arm_fir_resample_init_q15(
+    arm_fir_resample_instance_q15 *S,
+    uint16_t L,
+    uint16_t M,
+    uint16_t numTaps,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the Q31 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data, of at least ceil(blockSize*L/M) samples.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+uint32_t arm_fir_resample_q31(
+    arm_fir_resample_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the Q31 FIR rational resampler.
+ * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     M          decimation factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficient buffer.
+ * @param[in]     pState     points to the state buffer of numTaps/L+blockSize-1 samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is zero
+ * or not a multiple of the interpolation factor <code>L</code>.
+ */
+arm_status arm_fir_resample_init_q31(
+    arm_fir_resample_instance_q31 *S,
+    uint16_t L,
+    uint16_t M,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the floating-point FIR rational resampler.
+ * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data, of at least ceil(blockSize*L/M) samples.
+ * @param[in]     blockSize  number of input samples to process, at most the block size given at initialization.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+uint32_t arm_fir_resample_f32(
+    arm_fir_resample_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the floating-point FIR rational resampler.
+ * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+ * @param[in]     L          upsample factor.
+ * @param[in]     M          decimation factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficient buffer.
+ * @param[in]     pState     points to the state buffer of numTaps/L+blockSize-1 samples.
+ * @param[in]     blockSize  maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is zero
+ * or not a multiple of the interpolation factor <code>L</code>.
+ */
+arm_status arm_fir_resample_init_f32(
+    arm_fir_resample_instance_f32 *S,
+    uint16_t L,
+    uint16_t M,
+    uint16_t numTaps,
+    float32_t *pCoeffs,
+    float32_t *pState,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+} arm_biquad_cas_df1_32x64_ins_q31;
+
+
+/**
+ * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_biquad_cas_df1_32x64_q31(
+    const arm_biquad_cas_df1_32x64_ins_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+ * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+ */
+void arm_biquad_cas_df1_32x64_init_q31(
+    arm_biquad_cas_df1_32x64_ins_q31 *S,
+    uint8_t numStages,
+    q31_t *pCoeffs,
+    q63_t *pState,
+    uint8_t postShift );
+
+
+/**
+ * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+} arm_biquad_cascade_df2T_instance_f32;
+
+/**
+ * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+} arm_biquad_cascade_stereo_df2T_instance_f32;
+
+/**
+ * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+ */
+typedef struct
+{
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+} arm_biquad_cascade_df2T_instance_f64;
+
+
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+ * @param[in]  S          points to an instance of the filter data structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_biquad_cascade_df2T_f32(
+    const arm_biquad_cascade_df2T_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
+ * @param[in]  S          points to an instance of the filter data structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_biquad_cascade_stereo_df2T_f32(
+    const arm_biquad_cascade_stereo_df2T_instance_f32 *S,
+    float32_t *pSrc,
+    float32_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+ * @param[in]  S          points to an instance of the filter data structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data
+ * @param[in]  blockSize  number of samples to process.
+ */
+void arm_biquad_cascade_df2T_f64(
+    const arm_biquad_cascade_df2T_instance_f64 *S,
+    float64_t *pSrc,
+    float64_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+ * @param[in,out] S          points to an instance of the filter data structure.
+ * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ */
+void arm_biquad_cascade_df2T_init_f32(
+    arm_biquad_cascade_df2T_instance_f32 *S,
+    uint8_t numStages,
+    float32_t *pCoeffs,
+    float32_t *pState );
+
+
+/**
+ * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+ * @param[in,out] S          points to an instance of the filter data structure.
+ * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ */
+void arm_biquad_cascade_stereo_df2T_init_f32(
+    arm_biquad_cascade_stereo_df2T_instance_f32 *S,
+    uint8_t numStages,
+    float32_t *pCoeffs,
+    float32_t *pState );
+
+
+/**
+ * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+ * @param[in,out] S          points to an instance of the filter data structure.
+ * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @param[in]     pCoeffs    points to the filter coefficients.
+ * @param[in]     pState     points to the state buffer.
+ */
+void arm_biquad_cascade_df2T_init_f64(
+    arm_biquad_cascade_df2T_instance_f64 *S,
+    uint8_t numStages,
+    float64_t *pCoeffs,
+    float64_t *pState );
+
+
+/**
+ * @brief Instance structure for the Q15 FIR lattice filter.
+ */
+typedef struct
+{
+    uint16_t numStages;                  /**< number of filter stages. */
+    q15_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
+    q15_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
+} arm_fir_lattice_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 FIR lattice filter.
+ */
+typedef struct
+{
+    uint16_t numStages;                  /**< number of filter stages. */
+    q31_t *pState;                       /**< points to the state variable array. The array is of length numStages. */
+    q31_t *pCoeffs;                      /**< points to the coefficient array. The array is of length numStages. */
+} arm_fir_lattice_instance_q31;
+
+/**
+ * @brief Instance structure for the floating-point FIR lattice filter.
+ */
+typedef struct
+{
     uint16_t numStages;                  /**< number of filter stages. */
     float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
     float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
@@ -4320,89 +5026,424 @@ void arm_correlate_fast_q15(
 
 
 /**
- * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
- * @param[in]  pSrcA     points to the first input sequence.
- * @param[in]  srcALen   length of the first input sequence.
- * @param[in]  pSrcB     points to the second input sequence.
- * @param[in]  srcBLen   length of the second input sequence.
- * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
- * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+ * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+ */
+void arm_correlate_fast_opt_q15(
+    q15_t *pSrcA,
+    uint32_t srcALen,
+    q15_t *pSrcB,
+    uint32_t srcBLen,
+    q15_t *pDst,
+    q15_t *pScratch );
+
+
+/**
+ * @brief Correlation of Q31 sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ */
+void arm_correlate_q31(
+    q31_t *pSrcA,
+    uint32_t srcALen,
+    q31_t *pSrcB,
+    uint32_t srcBLen,
+    q31_t *pDst );
+
+
+/**
+ * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ */
+void arm_correlate_fast_q31(
+    q31_t *pSrcA,
+    uint32_t srcALen,
+    q31_t *pSrcB,
+    uint32_t srcBLen,
+    q31_t *pDst );
+
+
+/**
+  * @brief Correlation of Q7 sequences.
+  * @param[in]  pSrcA      points to the first input sequence.
+  * @param[in]  srcALen    length of the first input sequence.
+  * @param[in]  pSrcB      points to the second input sequence.
+  * @param[in]  srcBLen    length of the second input sequence.
+  * @param[out] pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+  * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+  * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+  */
+void arm_correlate_opt_q7(
+    q7_t *pSrcA,
+    uint32_t srcALen,
+    q7_t *pSrcB,
+    uint32_t srcBLen,
+    q7_t *pDst,
+    q15_t *pScratch1,
+    q15_t *pScratch2 );
+
+
+/**
+ * @brief Correlation of Q7 sequences.
+ * @param[in]  pSrcA    points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ */
+void arm_correlate_q7(
+    q7_t *pSrcA,
+    uint32_t srcALen,
+    q7_t *pSrcB,
+    uint32_t srcBLen,
+    q7_t *pDst );
+
+
+/**
+ * @brief Smallest number of taps for which the Q15 FFT convolution uses the FFT,
+ * 0 to always select the direct convolution.
+ * The Q15 FFT path goes through arm_rfft_q15(), which halves the data at each
+ * stage: its SNR is 40 dB at best and about 30 dB with 512 points, where the
+ * direct convolution is exact. The FFT is therefore never selected by default;
+ * define this to 32 to select it from the speed crossover, or set
+ * <code>useFft</code> after the initialization. The crossover was measured by
+ * DspLibBench_Host on the host, not on Cortex-M0 (FFT of 4 times the number of
+ * taps): the FFT is 0.66x the direct convolution at 16 taps and 1.09x at 32.
+ */
+#ifndef ARM_CONV_FFT_CROSSOVER_Q15
+#define ARM_CONV_FFT_CROSSOVER_Q15 (0U)
+#endif
+
+/**
+ * @brief Smallest number of taps for which the Q31 FFT convolution uses the FFT.
+ * Crossover printed by DspLibBench_Host on the host, not measured on
+ * Cortex-M0, as for Q15: the FFT is 0.93x the direct convolution at 32 taps
+ * and 1.54x at 64 taps. The SNR of the Q31 FFT path is above 110 dB.
+ */
+#ifndef ARM_CONV_FFT_CROSSOVER_Q31
+#define ARM_CONV_FFT_CROSSOVER_Q31 (64U)
+#endif
+
+/**
+ * @brief Instance structure for the Q15 FFT convolution and correlation.
+ */
+typedef struct
+{
+    uint16_t fftLen;                  /**< length of the FFT. */
+    uint16_t numTaps;                 /**< number of taps. */
+    uint16_t blockSize;               /**< number of new samples per FFT, fftLen-numTaps+1. */
+    uint8_t reverse;                  /**< flag that selects a correlation (reverse=1): the taps are used in reversed order. */
+    uint8_t useFft;                   /**< flag that selects the FFT (useFft=1) or the direct convolution (useFft=0). */
+    int32_t coeffsExp;                /**< exponent of the normalized spectrum of the taps. */
+    const q15_t *pCoeffs;             /**< points to the taps, numTaps values. */
+    q15_t *pCoeffsFreq;               /**< points to the normalized spectrum of the taps, fftLen+2 values. */
+    q15_t *pState;                    /**< points to the state, the last fftLen input samples. */
+    q15_t *pScratch;                  /**< points to the scratch buffer, 3*fftLen values. */
+    arm_rfft_instance_q15 rfft;       /**< forward real FFT instance. */
+    arm_rfft_instance_q15 rifft;      /**< inverse real FFT instance. */
+} arm_conv_fft_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 FFT convolution and correlation.
+ */
+typedef struct
+{
+    uint16_t fftLen;                  /**< length of the FFT. */
+    uint16_t numTaps;                 /**< number of taps. */
+    uint16_t blockSize;               /**< number of new samples per FFT, fftLen-numTaps+1. */
+    uint8_t reverse;                  /**< flag that selects a correlation (reverse=1): the taps are used in reversed order. */
+    uint8_t useFft;                   /**< flag that selects the FFT (useFft=1) or the direct convolution (useFft=0). */
+    int32_t coeffsExp;                /**< exponent of the normalized spectrum of the taps. */
+    const q31_t *pCoeffs;             /**< points to the taps, numTaps values. */
+    q31_t *pCoeffsFreq;               /**< points to the normalized spectrum of the taps, fftLen+2 values. */
+    q31_t *pState;                    /**< points to the state, the last fftLen input samples. */
+    q31_t *pScratch;                  /**< points to the scratch buffer, 3*fftLen values. */
+    arm_rfft_instance_q31 rfft;       /**< forward real FFT instance. */
+    arm_rfft_instance_q31 rifft;      /**< inverse real FFT instance. */
+} arm_conv_fft_instance_q31;
+
+/**
+ * @brief  Initialization function for the Q15 FFT convolution.
+ * @param[out] S            points to an instance of the Q15 FFT convolution structure.
+ * @param[in]  fftLen       length of the FFT, 32 to 8192.
+ * @param[in]  numTaps      number of taps, 1 to fftLen.
+ * @param[in]  pCoeffs      points to the taps.
+ * @param[out] pCoeffsFreq  points to the spectrum of the taps, fftLen+2 values.
+ * @param[out] pState       points to the state buffer, fftLen samples.
+ * @param[in]  pScratch     points to a scratch buffer of 3*fftLen samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_conv_fft_init_q15(
+    arm_conv_fft_instance_q15 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q15_t *pCoeffs,
+    q15_t *pCoeffsFreq,
+    q15_t *pState,
+    q15_t *pScratch );
+
+/**
+ * @brief  Initialization function for the Q15 FFT correlation.
+ * @param[out] S            points to an instance of the Q15 FFT convolution structure.
+ * @param[in]  fftLen       length of the FFT, 32 to 8192.
+ * @param[in]  numTaps      length of the template, 1 to fftLen.
+ * @param[in]  pTemplate    points to the template.
+ * @param[out] pCoeffsFreq  points to the spectrum of the template, fftLen+2 values.
+ * @param[out] pState       points to the state buffer, fftLen samples.
+ * @param[in]  pScratch     points to a scratch buffer of 3*fftLen samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_correlate_fft_init_q15(
+    arm_conv_fft_instance_q15 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q15_t *pTemplate,
+    q15_t *pCoeffsFreq,
+    q15_t *pState,
+    q15_t *pScratch );
+
+/**
+ * @brief Processing function for the Q15 FFT convolution and correlation.
+ * @param[in,out] S          points to an instance of the Q15 FFT convolution structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_conv_fft_q15(
+    arm_conv_fft_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+/**
+ * @brief  Initialization function for the Q31 FFT convolution.
+ * @param[out] S            points to an instance of the Q31 FFT convolution structure.
+ * @param[in]  fftLen       length of the FFT, 32 to 8192.
+ * @param[in]  numTaps      number of taps, 1 to fftLen.
+ * @param[in]  pCoeffs      points to the taps.
+ * @param[out] pCoeffsFreq  points to the spectrum of the taps, fftLen+2 values.
+ * @param[out] pState       points to the state buffer, fftLen samples.
+ * @param[in]  pScratch     points to a scratch buffer of 3*fftLen samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_conv_fft_init_q31(
+    arm_conv_fft_instance_q31 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q31_t *pCoeffs,
+    q31_t *pCoeffsFreq,
+    q31_t *pState,
+    q31_t *pScratch );
+
+/**
+ * @brief  Initialization function for the Q31 FFT correlation.
+ * @param[out] S            points to an instance of the Q31 FFT convolution structure.
+ * @param[in]  fftLen       length of the FFT, 32 to 8192.
+ * @param[in]  numTaps      length of the template, 1 to fftLen.
+ * @param[in]  pTemplate    points to the template.
+ * @param[out] pCoeffsFreq  points to the spectrum of the template, fftLen+2 values.
+ * @param[out] pState       points to the state buffer, fftLen samples.
+ * @param[in]  pScratch     points to a scratch buffer of 3*fftLen samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_correlate_fft_init_q31(
+    arm_conv_fft_instance_q31 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q31_t *pTemplate,
+    q31_t *pCoeffsFreq,
+    q31_t *pState,
+    q31_t *pScratch );
+
+/**
+ * @brief Processing function for the Q31 FFT convolution and correlation.
+ * @param[in,out] S          points to an instance of the Q31 FFT convolution structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_conv_fft_q31(
+    arm_conv_fft_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Instance structure for the Q15 running median filter.
+ */
+typedef struct
+{
+    uint16_t windowSize;              /**< number of samples in the window, odd. */
+    uint16_t index;                   /**< state index. Points to the oldest sample in the state buffer. */
+    q15_t *pState;                    /**< points to the state, the last windowSize input samples. */
+    int16_t *pHeap;                   /**< points to the heap buffer, 2*windowSize values: the position of each sample, then the heaps. */
+} arm_median_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 running median filter.
+ */
+typedef struct
+{
+    uint16_t windowSize;              /**< number of samples in the window, odd. */
+    uint16_t index;                   /**< state index. Points to the oldest sample in the state buffer. */
+    q31_t *pState;                    /**< points to the state, the last windowSize input samples. */
+    int16_t *pHeap;                   /**< points to the heap buffer, 2*windowSize values: the position of each sample, then the heaps. */
+} arm_median_instance_q31;
+
+/**
+ * @brief Instance structure for the Q15 Hampel filter.
+ */
+typedef struct
+{
+    uint16_t windowSize;              /**< number of samples in the window, odd. */
+    uint16_t index;                   /**< state index. Points to the oldest sample in the state buffer. */
+    q15_t thresholdFract;             /**< fractional part of the threshold, in units of median absolute deviation. */
+    int8_t shift;                     /**< number of bits to shift the threshold. */
+    q15_t *pState;                    /**< points to the state, the last windowSize input samples. */
+    q15_t *pSorted;                   /**< points to the same samples, sorted in increasing order. */
+} arm_hampel_instance_q15;
+
+/**
+ * @brief Instance structure for the Q31 Hampel filter.
+ */
+typedef struct
+{
+    uint16_t windowSize;              /**< number of samples in the window, odd. */
+    uint16_t index;                   /**< state index. Points to the oldest sample in the state buffer. */
+    q31_t thresholdFract;             /**< fractional part of the threshold, in units of median absolute deviation. */
+    int8_t shift;                     /**< number of bits to shift the threshold. */
+    q31_t *pState;                    /**< points to the state, the last windowSize input samples. */
+    q31_t *pSorted;                   /**< points to the same samples, sorted in increasing order. */
+} arm_hampel_instance_q31;
+
+/**
+ * @brief  Initialization function for the Q15 running median filter.
+ * @param[out] S           points to an instance of the Q15 running median structure.
+ * @param[in]  windowSize  number of samples in the window, odd, 1 to 32767.
+ * @param[out] pState      points to the state buffer, windowSize samples.
+ * @param[out] pHeap       points to the heap buffer, 2*windowSize values.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_median_init_q15(
+    arm_median_instance_q15 *S,
+    uint16_t windowSize,
+    q15_t *pState,
+    int16_t *pHeap );
+
+/**
+ * @brief Processing function for the Q15 running median filter.
+ * @param[in,out] S          points to an instance of the Q15 running median structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
  */
-void arm_correlate_fast_opt_q15(
-    q15_t *pSrcA,
-    uint32_t srcALen,
-    q15_t *pSrcB,
-    uint32_t srcBLen,
+void arm_median_q15(
+    arm_median_instance_q15 *S,
+    const q15_t *pSrc,
     q15_t *pDst,
-    q15_t *pScratch );
-
+    uint32_t blockSize );
 
 /**
- * @brief Correlation of Q31 sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @brief  Initialization function for the Q31 running median filter.
+ * @param[out] S           points to an instance of the Q31 running median structure.
+ * @param[in]  windowSize  number of samples in the window, odd, 1 to 32767.
+ * @param[out] pState      points to the state buffer, windowSize samples.
+ * @param[out] pHeap       points to the heap buffer, 2*windowSize values.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
  */
-void arm_correlate_q31(
-    q31_t *pSrcA,
-    uint32_t srcALen,
-    q31_t *pSrcB,
-    uint32_t srcBLen,
-    q31_t *pDst );
-
+arm_status arm_median_init_q31(
+    arm_median_instance_q31 *S,
+    uint16_t windowSize,
+    q31_t *pState,
+    int16_t *pHeap );
 
 /**
- * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @brief Processing function for the Q31 running median filter.
+ * @param[in,out] S          points to an instance of the Q31 running median structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
  */
-void arm_correlate_fast_q31(
-    q31_t *pSrcA,
-    uint32_t srcALen,
-    q31_t *pSrcB,
-    uint32_t srcBLen,
-    q31_t *pDst );
+void arm_median_q31(
+    arm_median_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
 
+/**
+ * @brief  Initialization function for the Q15 Hampel filter.
+ * @param[out] S               points to an instance of the Q15 Hampel structure.
+ * @param[in]  windowSize      number of samples in the window, odd.
+ * @param[in]  thresholdFract  fractional part of the threshold.
+ * @param[in]  shift           number of bits to shift the threshold, 0 to 15.
+ * @param[out] pState          points to the state buffer, windowSize samples.
+ * @param[out] pSorted         points to the sorted window buffer, windowSize samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_hampel_init_q15(
+    arm_hampel_instance_q15 *S,
+    uint16_t windowSize,
+    q15_t thresholdFract,
+    int8_t shift,
+    q15_t *pState,
+    q15_t *pSorted );
 
 /**
-  * @brief Correlation of Q7 sequences.
-  * @param[in]  pSrcA      points to the first input sequence.
-  * @param[in]  srcALen    length of the first input sequence.
-  * @param[in]  pSrcB      points to the second input sequence.
-  * @param[in]  srcBLen    length of the second input sequence.
-  * @param[out] pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-  * @param[in]  pScratch1  points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-  * @param[in]  pScratch2  points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
-  */
-void arm_correlate_opt_q7(
-    q7_t *pSrcA,
-    uint32_t srcALen,
-    q7_t *pSrcB,
-    uint32_t srcBLen,
-    q7_t *pDst,
-    q15_t *pScratch1,
-    q15_t *pScratch2 );
+ * @brief Processing function for the Q15 Hampel filter.
+ * @param[in,out] S          points to an instance of the Q15 Hampel structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ */
+void arm_hampel_q15(
+    arm_hampel_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
 
+/**
+ * @brief  Initialization function for the Q31 Hampel filter.
+ * @param[out] S               points to an instance of the Q31 Hampel structure.
+ * @param[in]  windowSize      number of samples in the window, odd.
+ * @param[in]  thresholdFract  fractional part of the threshold.
+ * @param[in]  shift           number of bits to shift the threshold, 0 to 31.
+ * @param[out] pState          points to the state buffer, windowSize samples.
+ * @param[out] pSorted         points to the sorted window buffer, windowSize samples.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_hampel_init_q31(
+    arm_hampel_instance_q31 *S,
+    uint16_t windowSize,
+    q31_t thresholdFract,
+    int8_t shift,
+    q31_t *pState,
+    q31_t *pSorted );
 
 /**
- * @brief Correlation of Q7 sequences.
- * @param[in]  pSrcA    points to the first input sequence.
- * @param[in]  srcALen  length of the first input sequence.
- * @param[in]  pSrcB    points to the second input sequence.
- * @param[in]  srcBLen  length of the second input sequence.
- * @param[out] pDst     points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ * @brief Processing function for the Q31 Hampel filter.
+ * @param[in,out] S          points to an instance of the Q31 Hampel structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[out]    pDst       points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
  */
-void arm_correlate_q7(
-    q7_t *pSrcA,
-    uint32_t srcALen,
-    q7_t *pSrcB,
-    uint32_t srcBLen,
-    q7_t *pDst );
+void arm_hampel_q31(
+    arm_hampel_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
 
 
 /**
@@ -4701,6 +5742,39 @@ void arm_cmplx_mag_squared_q15(
     uint32_t numSamples );
 
 
+/**
+ * @brief Number of samples of the blocks of the complex magnitude in decibels functions.
+ * The functions keep the mantissas of a block on the stack.
+ */
+#ifndef ARM_CMPLX_MAG_DB_BLOCK_SIZE
+#define ARM_CMPLX_MAG_DB_BLOCK_SIZE  16U
+#endif
+
+
+/**
+ * @brief  Q31 complex magnitude in decibels
+ * @param[in]  pSrc        points to the complex input vector
+ * @param[out] pDst        points to the real output vector in 9.23 format
+ * @param[in]  numSamples  number of complex samples in the input vector
+ */
+void arm_cmplx_mag_db_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t numSamples );
+
+
+/**
+ * @brief  Q15 complex magnitude in decibels
+ * @param[in]  pSrc        points to the complex input vector
+ * @param[out] pDst        points to the real output vector in 8.8 format
+ * @param[in]  numSamples  number of complex samples in the input vector
+ */
+void arm_cmplx_mag_db_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t numSamples );
+
+
 /**
   * @ingroup groupController
   */
@@ -4924,6 +5998,252 @@ arm_status arm_mat_inverse_f64(
     const arm_matrix_instance_f64 *src,
     arm_matrix_instance_f64 *dst );
 
+/**
+ * @brief Q31 3x3 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 4x4 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 6x6 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 3x3 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_trans_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 4x4 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_trans_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 6x6 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_mult_trans_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 3x3 symmetric update A * P * A' + Q.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL.
+ * @param[out] *pDst     points to the output matrix, which may be P or Q.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_sym_update_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 4x4 symmetric update A * P * A' + Q.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL.
+ * @param[out] *pDst     points to the output matrix, which may be P or Q.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_sym_update_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 6x6 symmetric update A * P * A' + Q.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL.
+ * @param[out] *pDst     points to the output matrix, which may be P or Q.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return none.
+ */
+void arm_mat_sym_update_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 3x3 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the symmetric positive definite matrix A.
+ * @param[in]  *pSrcB    points to the 3 x numCols matrix B.
+ * @param[out] *pDst     points to the 3 x numCols solution X of A * X = B, which may be B.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or ARM_MATH_SUCCESS.
+ */
+arm_status arm_mat_ldlt_solve_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 4x4 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the symmetric positive definite matrix A.
+ * @param[in]  *pSrcB    points to the 4 x numCols matrix B.
+ * @param[out] *pDst     points to the 4 x numCols solution X of A * X = B, which may be B.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or ARM_MATH_SUCCESS.
+ */
+arm_status arm_mat_ldlt_solve_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits );
+
+/**
+ * @brief Q31 6x6 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the symmetric positive definite matrix A.
+ * @param[in]  *pSrcB    points to the 6 x numCols matrix B.
+ * @param[out] *pDst     points to the 6 x numCols solution X of A * X = B, which may be B.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or ARM_MATH_SUCCESS.
+ */
+arm_status arm_mat_ldlt_solve_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits );
+
+/**
+ * @brief Instance structure for the Q31 Kalman filter.
+ */
+typedef struct
+{
+    uint16_t numStates;      /**< number of states N: 3, 4 or 6. */
+    uint16_t numMeas;        /**< number of measurements M, 1 to N. */
+    uint32_t fracBits;       /**< number of fractional bits of all the values. */
+    const q31_t *pF;         /**< points to the state transition matrix, N x N. */
+    const q31_t *pQ;         /**< points to the process noise covariance, N x N. */
+    const q31_t *pH;         /**< points to the measurement matrix, N x N of which M rows are used. */
+    const q31_t *pR;         /**< points to the measurement noise covariance, N x N of which M x M are used. */
+    q31_t *pState;           /**< points to the state estimate, N values. */
+    q31_t *pCov;             /**< points to the estimate covariance, N x N. */
+    q31_t *pScratch;         /**< points to the scratch buffer, 3*N*N + N values. */
+} arm_kalman_instance_q31;
+
+/**
+ * @brief  Initialization function for the Q31 Kalman filter.
+ * @param[out] *S          points to an instance of the Q31 Kalman filter structure.
+ * @param[in]  numStates   number of states N: 3, 4 or 6.
+ * @param[in]  numMeas     number of measurements M, 1 to N.
+ * @param[in]  fracBits    number of fractional bits of all the values, 1 to 30.
+ * @param[in]  *pF         points to the state transition matrix.
+ * @param[in]  *pQ         points to the process noise covariance.
+ * @param[in]  *pH         points to the measurement matrix.
+ * @param[in]  *pR         points to the measurement noise covariance.
+ * @param[in,out] *pState  points to the initial state estimate.
+ * @param[in,out] *pCov    points to the initial covariance.
+ * @param[in]  *pScratch   points to a scratch buffer of 3*N*N + N values.
+ * @return The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+ */
+arm_status arm_kalman_init_q31(
+    arm_kalman_instance_q31 *S,
+    uint16_t numStates,
+    uint16_t numMeas,
+    uint32_t fracBits,
+    const q31_t *pF,
+    const q31_t *pQ,
+    const q31_t *pH,
+    const q31_t *pR,
+    q31_t *pState,
+    q31_t *pCov,
+    q31_t *pScratch );
+
+/**
+ * @brief Prediction step of the Q31 Kalman filter.
+ * @param[in,out] *S         points to an instance of the Q31 Kalman filter structure.
+ * @param[in]     *pControl  points to the effect of the control input on the state, or NULL.
+ * @return none.
+ */
+void arm_kalman_predict_q31(
+    arm_kalman_instance_q31 *S,
+    const q31_t *pControl );
+
+/**
+ * @brief Measurement update of the Q31 Kalman filter.
+ * @param[in,out] *S      points to an instance of the Q31 Kalman filter structure.
+ * @param[in]     *pMeas  points to the measurement, M values.
+ * @return The function returns ARM_MATH_SINGULAR if the innovation covariance is not
+ * positive definite, or ARM_MATH_SUCCESS.
+ */
+arm_status arm_kalman_update_q31(
+    arm_kalman_instance_q31 *S,
+    const q31_t *pMeas );
+
 
 
 /**
@@ -5743,42 +7063,176 @@ CMSIS_INLINE __STATIC_INLINE arm_status arm_sqrt_f32(
         *pOut = sqrtf( in );
 #endif
 
-        return ( ARM_MATH_SUCCESS );
-    }
-    else
-    {
-        *pOut = 0.0f;
-        return ( ARM_MATH_ARGUMENT_ERROR );
-    }
-}
+        return ( ARM_MATH_SUCCESS );
+    }
+    else
+    {
+        *pOut = 0.0f;
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+}
+
+
+/**
+ * @brief Q31 square root function.
+ * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
+ * @param[out] pOut  square root of input value.
+ * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+ * <code>in</code> is negative value and returns zero output for negative values.
+ */
+arm_status arm_sqrt_q31(
+    q31_t in,
+    q31_t *pOut );
+
+
+/**
+ * @brief  Q15 square root function.
+ * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+ * @param[out] pOut  square root of input value.
+ * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
+ * <code>in</code> is negative value and returns zero output for negative values.
+ */
+arm_status arm_sqrt_q15(
+    q15_t in,
+    q15_t *pOut );
+
+/**
+ * @} end of SQRT group
+ */
+
+
+/**
+ * @brief Four quadrant arctangent of Q31 vectors.
+ * @param[in]  pSrcY      points to the vector of y coordinates
+ * @param[in]  pSrcX      points to the vector of x coordinates
+ * @param[out] pDst       points to the output angles divided by pi, in [-1 +1)
+ * @param[in]  blockSize  number of samples in the vectors
+ */
+void arm_atan2_q31(
+    q31_t *pSrcY,
+    q31_t *pSrcX,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Four quadrant arctangent of Q15 vectors.
+ * @param[in]  pSrcY      points to the vector of y coordinates
+ * @param[in]  pSrcX      points to the vector of x coordinates
+ * @param[out] pDst       points to the output angles divided by pi, in [-1 +1)
+ * @param[in]  blockSize  number of samples in the vectors
+ */
+void arm_atan2_q15(
+    q15_t *pSrcY,
+    q15_t *pSrcX,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Base 2 logarithm of Q31 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector in 6.26 format
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ */
+arm_status arm_log2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Base 2 logarithm of Q15 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector in 5.11 format
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ */
+arm_status arm_log2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Natural logarithm of Q31 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector in 6.26 format
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ */
+arm_status arm_ln_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Natural logarithm of Q15 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector in 5.11 format
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ */
+arm_status arm_ln_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Base 2 exponential of Q31 vector.
+ * @param[in]  pSrc       points to the input vector in 6.26 format
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vector
+ */
+void arm_exp2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize );
 
 
 /**
- * @brief Q31 square root function.
- * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
- * @param[out] pOut  square root of input value.
- * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
- * <code>in</code> is negative value and returns zero output for negative values.
+ * @brief Base 2 exponential of Q15 vector.
+ * @param[in]  pSrc       points to the input vector in 5.11 format
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in the vector
  */
-arm_status arm_sqrt_q31(
-    q31_t in,
-    q31_t *pOut );
+void arm_exp2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize );
 
 
 /**
- * @brief  Q15 square root function.
- * @param[in]  in    input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
- * @param[out] pOut  square root of input value.
- * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
- * <code>in</code> is negative value and returns zero output for negative values.
+ * @brief Reciprocal square root of Q31 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output mantissas
+ * @param[out] pShift     points to the output shifts, 1/sqrt(pSrc[n]) = pDst[n] * 2^pShift[n]
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
  */
-arm_status arm_sqrt_q15(
-    q15_t in,
-    q15_t *pOut );
+arm_status arm_rsqrt_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize );
+
 
 /**
- * @} end of SQRT group
+ * @brief Reciprocal square root of Q15 vector.
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output mantissas
+ * @param[out] pShift     points to the output shifts, 1/sqrt(pSrc[n]) = pDst[n] * 2^pShift[n]
+ * @param[in]  blockSize  number of samples in the vector
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
  */
+arm_status arm_rsqrt_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize );
 
 
 /**
@@ -5844,12 +7298,13 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_f32(
     uint32_t blockSize )
 {
     uint32_t i = 0U;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = ( int32_t )( dst_base + dst_length );
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5862,7 +7317,7 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_f32(
         /* Update the input pointer */
         dst += dstInc;
 
-        if( dst == ( int32_t * ) dst_end )
+        if( dst == dst_end )
         {
             dst = dst_base;
         }
@@ -5946,13 +7401,14 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q15(
     uint32_t blockSize )
 {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = ( int32_t )( dst_base + dst_length );
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5965,7 +7421,7 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q15(
         /* Update the input pointer */
         dst += dstInc;
 
-        if( dst == ( q15_t * ) dst_end )
+        if( dst == dst_end )
         {
             dst = dst_base;
         }
@@ -5987,6 +7443,118 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q15(
 }
 
 
+/**
+ * @brief Q15 mirrored circular write function.
+ * @param[in,out] circBuffer   points to the delay line of length L, held twice in a buffer of 2*L samples.
+ * @param[in]     L            length of the delay line.
+ * @param[in]     writeOffset  position of the first sample to write, lower than L.
+ * @param[in]     src          points to the samples to write.
+ * @param[in]     blockSize    number of samples to write, at most L.
+ *
+ * Each sample is written at its position in both copies, so that any L consecutive
+ * samples of the delay line can be read linearly from the first copy onwards.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_mirror_q15(
+    q15_t *circBuffer,
+    uint32_t L,
+    uint32_t writeOffset,
+    const q15_t *src,
+    uint32_t blockSize )
+{
+    q15_t *pLow = circBuffer + writeOffset;
+    q15_t *pHigh = pLow + L;
+    uint32_t i;
+
+    /* Number of samples written before the end of the delay line */
+    i = L - writeOffset;
+
+    if( i > blockSize )
+    {
+        i = blockSize;
+    }
+
+    blockSize -= i;
+
+    while( i > 0U )
+    {
+        *pLow++ = *src;
+        *pHigh++ = *src++;
+
+        /* Decrement the loop counter */
+        i--;
+    }
+
+    /* The remaining samples wrap around to the start of the delay line */
+    pLow = circBuffer;
+    pHigh = circBuffer + L;
+
+    while( blockSize > 0U )
+    {
+        *pLow++ = *src;
+        *pHigh++ = *src++;
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+}
+
+
+/**
+ * @brief Q31 mirrored circular write function.
+ * @param[in,out] circBuffer   points to the delay line of length L, held twice in a buffer of 2*L samples.
+ * @param[in]     L            length of the delay line.
+ * @param[in]     writeOffset  position of the first sample to write, lower than L.
+ * @param[in]     src          points to the samples to write.
+ * @param[in]     blockSize    number of samples to write, at most L.
+ *
+ * Each sample is written at its position in both copies, so that any L consecutive
+ * samples of the delay line can be read linearly from the first copy onwards.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_circularWrite_mirror_q31(
+    q31_t *circBuffer,
+    uint32_t L,
+    uint32_t writeOffset,
+    const q31_t *src,
+    uint32_t blockSize )
+{
+    q31_t *pLow = circBuffer + writeOffset;
+    q31_t *pHigh = pLow + L;
+    uint32_t i;
+
+    /* Number of samples written before the end of the delay line */
+    i = L - writeOffset;
+
+    if( i > blockSize )
+    {
+        i = blockSize;
+    }
+
+    blockSize -= i;
+
+    while( i > 0U )
+    {
+        *pLow++ = *src;
+        *pHigh++ = *src++;
+
+        /* Decrement the loop counter */
+        i--;
+    }
+
+    /* The remaining samples wrap around to the start of the delay line */
+    pLow = circBuffer;
+    pHigh = circBuffer + L;
+
+    while( blockSize > 0U )
+    {
+        *pLow++ = *src;
+        *pHigh++ = *src++;
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+}
+
+
 /**
  * @brief Q7 Circular write function.
  */
@@ -6049,13 +7617,14 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q7(
     uint32_t blockSize )
 {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = ( int32_t )( dst_base + dst_length );
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6068,7 +7637,7 @@ CMSIS_INLINE __STATIC_INLINE void arm_circularRead_q7(
         /* Update the input pointer */
         dst += dstInc;
 
-        if( dst == ( q7_t * ) dst_end )
+        if( dst == dst_end )
         {
             dst = dst_base;
         }
@@ -6532,6 +8101,359 @@ void arm_max_f32(
     uint32_t *pIndex );
 
 
+/**
+ * @brief Instance structure for the Q15 moving window statistics.
+ */
+typedef struct
+{
+    uint16_t windowLen;                /**< number of samples in the window. */
+    uint16_t stateIndex;               /**< position of the oldest sample in the delay line. */
+    q15_t *pState;                     /**< points to the delay line of windowLen samples. */
+    q31_t sum;                         /**< sum of the samples of the window. */
+    q63_t sumOfSquares;                /**< sum of the squares of the samples of the window. */
+} arm_moving_stats_instance_q15;
+
+/**
+ * @brief Instance structure for the Q15 moving window minimum and maximum.
+ */
+typedef struct
+{
+    uint16_t windowLen;                /**< number of samples in the window. */
+    uint16_t head;                     /**< position of the oldest queued sample in the buffers. */
+    uint16_t count;                    /**< number of queued samples. */
+    uint32_t sampleCount;              /**< position of the next sample in the stream, modulo 2^32. */
+    q15_t *pValues;                    /**< points to the values of the queued samples. */
+    uint32_t *pPositions;              /**< points to the stream positions of the queued samples. */
+} arm_moving_minmax_instance_q15;
+
+/**
+ * @brief Instance structure for the Q15 exponential moving statistics.
+ */
+typedef struct
+{
+    q15_t alpha;                       /**< smoothing factor in 1.15 format. */
+    q31_t mean;                        /**< mean estimate in 1.31 format. */
+    q31_t variance;                    /**< variance estimate in 1.31 format. */
+} arm_exp_stats_instance_q15;
+
+
+/**
+ * @brief  Initialization function for the Q15 moving window statistics.
+ * @param[out] S          points to an instance of the Q15 moving window statistics structure.
+ * @param[in]  windowLen  number of samples in the window.
+ * @param[out] pState     points to the delay line of size windowLen.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+ */
+arm_status arm_moving_stats_init_q15(
+    arm_moving_stats_instance_q15 *S,
+    uint16_t windowLen,
+    q15_t *pState );
+
+
+/**
+ * @brief Update function for the Q15 moving window statistics.
+ * @param[in,out] S          points to an instance of the Q15 moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ */
+void arm_moving_stats_q15(
+    arm_moving_stats_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Mean of the window of the Q15 moving window statistics.
+ * @param[in]  S        points to an instance of the Q15 moving window statistics structure.
+ * @param[out] pResult  mean value returned here
+ */
+void arm_moving_mean_q15(
+    const arm_moving_stats_instance_q15 *S,
+    q15_t *pResult );
+
+
+/**
+ * @brief Variance of the window of the Q15 moving window statistics.
+ * @param[in]  S        points to an instance of the Q15 moving window statistics structure.
+ * @param[out] pResult  variance value returned here
+ */
+void arm_moving_var_q15(
+    const arm_moving_stats_instance_q15 *S,
+    q15_t *pResult );
+
+
+/**
+ * @brief Standard deviation of the window of the Q15 moving window statistics.
+ * @param[in]  S        points to an instance of the Q15 moving window statistics structure.
+ * @param[out] pResult  standard deviation value returned here
+ */
+void arm_moving_std_q15(
+    const arm_moving_stats_instance_q15 *S,
+    q15_t *pResult );
+
+
+/**
+ * @brief Root Mean Square of the window of the Q15 moving window statistics.
+ * @param[in]  S        points to an instance of the Q15 moving window statistics structure.
+ * @param[out] pResult  RMS value returned here
+ */
+void arm_moving_rms_q15(
+    const arm_moving_stats_instance_q15 *S,
+    q15_t *pResult );
+
+
+/**
+ * @brief  Initialization function for the Q15 moving window minimum or maximum.
+ * @param[out] S           points to an instance of the Q15 moving window minimum and maximum structure.
+ * @param[in]  windowLen   number of samples in the window.
+ * @param[out] pValues     points to the queue value buffer of size windowLen.
+ * @param[out] pPositions  points to the queue position buffer of size windowLen.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+ */
+arm_status arm_moving_minmax_init_q15(
+    arm_moving_minmax_instance_q15 *S,
+    uint16_t windowLen,
+    q15_t *pValues,
+    uint32_t *pPositions );
+
+
+/**
+ * @brief Maximum of the Q15 moving window.
+ * @param[in,out] S          points to an instance of the Q15 moving window minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pResult    maximum value of the last window returned here
+ * @param[out]    pIndex     index of the maximum value in the last window returned here
+ */
+void arm_moving_max_q15(
+    arm_moving_minmax_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t *pResult,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief Minimum of the Q15 moving window.
+ * @param[in,out] S          points to an instance of the Q15 moving window minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pResult    minimum value of the last window returned here
+ * @param[out]    pIndex     index of the minimum value in the last window returned here
+ */
+void arm_moving_min_q15(
+    arm_moving_minmax_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t *pResult,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief  Initialization function for the Q15 exponential moving statistics.
+ * @param[out] S      points to an instance of the Q15 exponential moving statistics structure.
+ * @param[in]  alpha  smoothing factor in 1.15 format.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if alpha is not positive.
+ */
+arm_status arm_exp_stats_init_q15(
+    arm_exp_stats_instance_q15 *S,
+    q15_t alpha );
+
+
+/**
+ * @brief Update function for the Q15 exponential moving statistics.
+ * @param[in,out] S          points to an instance of the Q15 exponential moving statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pMean      mean estimate returned here
+ * @param[out]    pVar       variance estimate returned here
+ */
+void arm_exp_stats_q15(
+    arm_exp_stats_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t *pMean,
+    q15_t *pVar );
+
+
+/**
+ * @brief Instance structure for the Q31 moving window statistics.
+ */
+typedef struct
+{
+    uint16_t windowLen;                /**< number of samples in the window. */
+    uint16_t stateIndex;               /**< position of the oldest sample in the delay line. */
+    q31_t *pState;                     /**< points to the delay line of windowLen samples. */
+    q63_t sum;                         /**< sum of the samples of the window. */
+    q63_t sumScaled;                   /**< sum of the samples of the window shifted right by 8 bits. */
+    q63_t sumOfSquaresScaled;          /**< sum of the squares of the samples shifted right by 8 bits. */
+    uint64_t sumOfSquaresLow;          /**< low 64 bits of the sum of the squares of the samples. */
+    uint32_t sumOfSquaresHigh;         /**< high bits of the sum of the squares of the samples. */
+} arm_moving_stats_instance_q31;
+
+/**
+ * @brief Instance structure for the Q31 moving window minimum and maximum.
+ */
+typedef struct
+{
+    uint16_t windowLen;                /**< number of samples in the window. */
+    uint16_t head;                     /**< position of the oldest queued sample in the buffers. */
+    uint16_t count;                    /**< number of queued samples. */
+    uint32_t sampleCount;              /**< position of the next sample in the stream, modulo 2^32. */
+    q31_t *pValues;                    /**< points to the values of the queued samples. */
+    uint32_t *pPositions;              /**< points to the stream positions of the queued samples. */
+} arm_moving_minmax_instance_q31;
+
+/**
+ * @brief Instance structure for the Q31 exponential moving statistics.
+ */
+typedef struct
+{
+    q31_t alpha;                       /**< smoothing factor in 1.31 format. */
+    q31_t mean;                        /**< mean estimate in 1.31 format. */
+    q31_t variance;                    /**< variance estimate in 1.31 format. */
+} arm_exp_stats_instance_q31;
+
+
+/**
+ * @brief  Initialization function for the Q31 moving window statistics.
+ * @param[out] S          points to an instance of the Q31 moving window statistics structure.
+ * @param[in]  windowLen  number of samples in the window.
+ * @param[out] pState     points to the delay line of size windowLen.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+ */
+arm_status arm_moving_stats_init_q31(
+    arm_moving_stats_instance_q31 *S,
+    uint16_t windowLen,
+    q31_t *pState );
+
+
+/**
+ * @brief Update function for the Q31 moving window statistics.
+ * @param[in,out] S          points to an instance of the Q31 moving window statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ */
+void arm_moving_stats_q31(
+    arm_moving_stats_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize );
+
+
+/**
+ * @brief Mean of the window of the Q31 moving window statistics.
+ * @param[in]  S        points to an instance of the Q31 moving window statistics structure.
+ * @param[out] pResult  mean value returned here
+ */
+void arm_moving_mean_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult );
+
+
+/**
+ * @brief Variance of the window of the Q31 moving window statistics.
+ * @param[in]  S        points to an instance of the Q31 moving window statistics structure.
+ * @param[out] pResult  variance value returned here
+ */
+void arm_moving_var_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult );
+
+
+/**
+ * @brief Standard deviation of the window of the Q31 moving window statistics.
+ * @param[in]  S        points to an instance of the Q31 moving window statistics structure.
+ * @param[out] pResult  standard deviation value returned here
+ */
+void arm_moving_std_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult );
+
+
+/**
+ * @brief Root Mean Square of the window of the Q31 moving window statistics.
+ * @param[in]  S        points to an instance of the Q31 moving window statistics structure.
+ * @param[out] pResult  RMS value returned here
+ */
+void arm_moving_rms_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult );
+
+
+/**
+ * @brief  Initialization function for the Q31 moving window minimum or maximum.
+ * @param[out] S           points to an instance of the Q31 moving window minimum and maximum structure.
+ * @param[in]  windowLen   number of samples in the window.
+ * @param[out] pValues     points to the queue value buffer of size windowLen.
+ * @param[out] pPositions  points to the queue position buffer of size windowLen.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if windowLen is 0.
+ */
+arm_status arm_moving_minmax_init_q31(
+    arm_moving_minmax_instance_q31 *S,
+    uint16_t windowLen,
+    q31_t *pValues,
+    uint32_t *pPositions );
+
+
+/**
+ * @brief Maximum of the Q31 moving window.
+ * @param[in,out] S          points to an instance of the Q31 moving window minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pResult    maximum value of the last window returned here
+ * @param[out]    pIndex     index of the maximum value in the last window returned here
+ */
+void arm_moving_max_q31(
+    arm_moving_minmax_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t *pResult,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief Minimum of the Q31 moving window.
+ * @param[in,out] S          points to an instance of the Q31 moving window minimum and maximum structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pResult    minimum value of the last window returned here
+ * @param[out]    pIndex     index of the minimum value in the last window returned here
+ */
+void arm_moving_min_q31(
+    arm_moving_minmax_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t *pResult,
+    uint32_t *pIndex );
+
+
+/**
+ * @brief  Initialization function for the Q31 exponential moving statistics.
+ * @param[out] S      points to an instance of the Q31 exponential moving statistics structure.
+ * @param[in]  alpha  smoothing factor in 1.31 format.
+ * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if alpha is not positive.
+ */
+arm_status arm_exp_stats_init_q31(
+    arm_exp_stats_instance_q31 *S,
+    q31_t alpha );
+
+
+/**
+ * @brief Update function for the Q31 exponential moving statistics.
+ * @param[in,out] S          points to an instance of the Q31 exponential moving statistics structure.
+ * @param[in]     pSrc       points to the block of input samples.
+ * @param[in]     blockSize  number of input samples.
+ * @param[out]    pMean      mean estimate returned here
+ * @param[out]    pVar       variance estimate returned here
+ */
+void arm_exp_stats_q31(
+    arm_exp_stats_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t *pMean,
+    q31_t *pVar );
+
+
 /**
  * @brief  Q15 complex-by-complex multiplication
  * @param[in]  pSrcA       points to the first input vector
@@ -0,0 +1,467 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_math.hpp
+ * Description:  C++ filter templates specialized at compile time
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \par C++ Filter Templates
+ * The C filter functions take the filter length and the number of stages at run time, so the compiler cannot unroll
+ * their loops or fold the coefficients into the code. This header provides C++ templates for the filters whose
+ * length, coefficients and number of stages are known at compile time:
+ * <pre>
+ *    static constexpr q15_t taps[8] = { ... };
+ *    arm_math::Fir<q15_t, 8, taps> fir;
+ *    fir.process( pSrc, pDst, blockSize );
+ * </pre>
+ * The coefficients are template arguments, so they must be arrays with static storage duration, in the same order as
+ * for the C functions. Small filters are computed by fully unrolled kernels. Filters longer than
+ * ARM_MATH_HPP_MAX_UNROLLED_TAPS taps or with more than ARM_MATH_HPP_MAX_UNROLLED_STAGES stages use the C functions.
+ * Both give the same results as the Cortex-M0 code of the C functions, bit for bit for the fixed-point types.
+ *
+ * The templates need C++11 and no other part of the C++ library.
+ */
+
+#ifndef _ARM_MATH_HPP
+#define _ARM_MATH_HPP
+
+#include "arm_math.h"
+
+/* Longest FIR filter computed by an unrolled kernel */
+#ifndef ARM_MATH_HPP_MAX_UNROLLED_TAPS
+#define ARM_MATH_HPP_MAX_UNROLLED_TAPS    32
+#endif
+
+/* Largest number of Biquad stages computed by an unrolled kernel */
+#ifndef ARM_MATH_HPP_MAX_UNROLLED_STAGES
+#define ARM_MATH_HPP_MAX_UNROLLED_STAGES  4
+#endif
+
+/* Default maximum number of samples per call */
+#ifndef ARM_MATH_HPP_BLOCK_SIZE
+#define ARM_MATH_HPP_BLOCK_SIZE           32
+#endif
+
+namespace arm_math
+{
+
+namespace detail
+{
+
+/*--------------------------------------------------------------------------------*/
+/* Type traits: accumulator, products, output conversion and C functions */
+/*--------------------------------------------------------------------------------*/
+
+template <typename T> struct FilterTraits;
+
+template <> struct FilterTraits<q15_t>
+{
+    typedef q63_t acc_t;
+    typedef arm_fir_instance_q15 fir_t;
+    typedef arm_biquad_casd_df1_inst_q15 biquad_t;
+
+    /* Coefficients per Biquad stage, {b0, 0, b1, b2, a1, a2} */
+    static const uint32_t biquadCoeffs = 6U;
+
+    static inline acc_t mul( q15_t x, q15_t c )
+    {
+        return ( q63_t ) ( ( q31_t ) x * c );
+    }
+
+    /* 34.30 to 1.15 with saturation */
+    static inline q15_t firOut( acc_t acc )
+    {
+        return ( q15_t ) __SSAT( ( q31_t ) ( acc >> 15 ), 16 );
+    }
+
+    static inline q15_t biquadOut( acc_t acc, uint32_t postShift )
+    {
+        return ( q15_t ) __SSAT( ( q31_t ) ( acc >> ( 15U - postShift ) ), 16 );
+    }
+
+    static inline void firInit( fir_t *S, uint16_t numTaps, const q15_t *pCoeffs, q15_t *pState, uint32_t blockSize )
+    {
+        arm_fir_init_q15( S, numTaps, const_cast<q15_t *>( pCoeffs ), pState, blockSize );
+    }
+
+    static inline void fir( const fir_t *S, q15_t *pSrc, q15_t *pDst, uint32_t blockSize )
+    {
+        arm_fir_q15( S, pSrc, pDst, blockSize );
+    }
+
+    static inline void biquadInit( biquad_t *S, uint8_t numStages, const q15_t *pCoeffs, q15_t *pState, int8_t postShift )
+    {
+        arm_biquad_cascade_df1_init_q15( S, numStages, const_cast<q15_t *>( pCoeffs ), pState, postShift );
+    }
+
+    static inline void biquad( const biquad_t *S, q15_t *pSrc, q15_t *pDst, uint32_t blockSize )
+    {
+        arm_biquad_cascade_df1_q15( S, pSrc, pDst, blockSize );
+    }
+};
+
+template <> struct FilterTraits<q31_t>
+{
+    typedef q63_t acc_t;
+    typedef arm_fir_instance_q31 fir_t;
+    typedef arm_biquad_casd_df1_inst_q31 biquad_t;
+
+    /* Coefficients per Biquad stage, {b0, b1, b2, a1, a2} */
+    static const uint32_t biquadCoeffs = 5U;
+
+    static inline acc_t mul( q31_t x, q31_t c )
+    {
+        return ( q63_t ) x * c;
+    }
+
+    /* 2.62 to 1.31, truncated */
+    static inline q31_t firOut( acc_t acc )
+    {
+        return ( q31_t ) ( acc >> 31 );
+    }
+
+    static inline q31_t biquadOut( acc_t acc, uint32_t postShift )
+    {
+        return ( q31_t ) ( acc >> ( 31U - postShift ) );
+    }
+
+    static inline void firInit( fir_t *S, uint16_t numTaps, const q31_t *pCoeffs, q31_t *pState, uint32_t blockSize )
+    {
+        arm_fir_init_q31( S, numTaps, const_cast<q31_t *>( pCoeffs ), pState, blockSize );
+    }
+
+    static inline void fir( const fir_t *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize )
+    {
+        arm_fir_q31( S, pSrc, pDst, blockSize );
+    }
+
+    static inline void biquadInit( biquad_t *S, uint8_t numStages, const q31_t *pCoeffs, q31_t *pState, int8_t postShift )
+    {
+        arm_biquad_cascade_df1_init_q31( S, numStages, const_cast<q31_t *>( pCoeffs ), pState, postShift );
+    }
+
+    static inline void biquad( const biquad_t *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize )
+    {
+        arm_biquad_cascade_df1_q31( S, pSrc, pDst, blockSize );
+    }
+};
+
+template <> struct FilterTraits<float32_t>
+{
+    typedef float32_t acc_t;
+    typedef arm_fir_instance_f32 fir_t;
+    typedef arm_biquad_casd_df1_inst_f32 biquad_t;
+
+    /* Coefficients per Biquad stage, {b0, b1, b2, a1, a2} */
+    static const uint32_t biquadCoeffs = 5U;
+
+    static inline acc_t mul( float32_t x, float32_t c )
+    {
+        return x * c;
+    }
+
+    static inline float32_t firOut( acc_t acc )
+    {
+        return acc;
+    }
+
+    static inline float32_t biquadOut( acc_t acc, uint32_t postShift )
+    {
+        ( void ) postShift;
+        return acc;
+    }
+
+    static inline void firInit( fir_t *S, uint16_t numTaps, const float32_t *pCoeffs, float32_t *pState, uint32_t blockSize )
+    {
+        arm_fir_init_f32( S, numTaps, const_cast<float32_t *>( pCoeffs ), pState, blockSize );
+    }
+
+    static inline void fir( const fir_t *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize )
+    {
+        arm_fir_f32( S, pSrc, pDst, blockSize );
+    }
+
+    static inline void biquadInit( biquad_t *S, uint8_t numStages, const float32_t *pCoeffs, float32_t *pState, int8_t postShift )
+    {
+        ( void ) postShift;
+        arm_biquad_cascade_df1_init_f32( S, numStages, const_cast<float32_t *>( pCoeffs ), pState );
+    }
+
+    static inline void biquad( const biquad_t *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize )
+    {
+        arm_biquad_cascade_df1_f32( S, pSrc, pDst, blockSize );
+    }
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Unrolled kernels */
+/*--------------------------------------------------------------------------------*/
+
+/* Dot product of K state samples and K coefficients, summed from the oldest sample like the C functions */
+template <typename T, uint32_t K> struct Dot
+{
+    static inline typename FilterTraits<T>::acc_t run( const T *px, const T *pb )
+    {
+        return Dot<T, K - 1U>::run( px, pb ) + FilterTraits<T>::mul( px[K - 1U], pb[K - 1U] );
+    }
+};
+
+template <typename T> struct Dot<T, 0U>
+{
+    static inline typename FilterTraits<T>::acc_t run( const T *px, const T *pb )
+    {
+        ( void ) px;
+        ( void ) pb;
+        return 0;
+    }
+};
+
+/* One output of Biquad stages Stage..Stages-1, state {x[n-1], x[n-2], y[n-1], y[n-2]} per stage */
+template <typename T, const T *Coeffs, uint32_t Stages, uint32_t PostShift, uint32_t Stage> struct BiquadStage
+{
+    static inline T run( T x, T *pState )
+    {
+        typedef FilterTraits<T> Tr;
+        const T *pb = Coeffs + Stage * Tr::biquadCoeffs + ( Tr::biquadCoeffs - 5U );
+        T *ps = pState + 4U * Stage;
+        typename Tr::acc_t acc;
+        T y;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = Tr::mul( x, Coeffs[Stage * Tr::biquadCoeffs] ) + Tr::mul( ps[0], pb[1] ) + Tr::mul( ps[1], pb[2] )
+              + Tr::mul( ps[2], pb[3] ) + Tr::mul( ps[3], pb[4] );
+        y = Tr::biquadOut( acc, PostShift );
+
+        ps[1] = ps[0];
+        ps[0] = x;
+        ps[3] = ps[2];
+        ps[2] = y;
+
+        return BiquadStage<T, Coeffs, Stages, PostShift, Stage + 1U>::run( y, pState );
+    }
+};
+
+template <typename T, const T *Coeffs, uint32_t Stages, uint32_t PostShift> struct BiquadStage<T, Coeffs, Stages, PostShift, Stages>
+{
+    static inline T run( T x, T *pState )
+    {
+        ( void ) pState;
+        return x;
+    }
+};
+
+} /* namespace detail */
+
+/*--------------------------------------------------------------------------------*/
+/* FIR filter */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ * @brief FIR filter of fixed length and coefficients.
+ * @tparam T            sample type, q15_t, q31_t or float32_t.
+ * @tparam NumTaps      number of filter coefficients.
+ * @tparam Coeffs       coefficients {b[numTaps-1], ..., b[1], b[0]}, as for arm_fir_init_q15() and friends.
+ * @tparam MaxBlockSize maximum number of samples per call to process().
+ * @tparam Unrolled     true to use the unrolled kernel, false to call the C function.
+ *
+ * The results are the ones of arm_fir_q15(), arm_fir_q31() and arm_fir_f32(). With the C function the length of a
+ * Q15 filter must be even on cores with DSP instructions, see arm_fir_init_q15().
+ */
+template <typename T, uint16_t NumTaps, const T *Coeffs, uint32_t MaxBlockSize = ARM_MATH_HPP_BLOCK_SIZE,
+          bool Unrolled = ( NumTaps <= ARM_MATH_HPP_MAX_UNROLLED_TAPS )>
+class Fir
+{
+public:
+    Fir()
+    {
+        reset();
+    }
+
+    /** Clears the state. */
+    void reset()
+    {
+        memset( state, 0, sizeof( state ) );
+    }
+
+    /**
+     * @brief Filters a block of samples.
+     * @param[in]  pSrc      points to the block of input data.
+     * @param[out] pDst      points to the block of output data.
+     * @param[in]  blockSize number of samples to process, at most MaxBlockSize.
+     */
+    void process( const T *pSrc, T *pDst, uint32_t blockSize )
+    {
+        T *pStateCurnt = state + ( NumTaps - 1U );
+        uint32_t i;
+
+        /* Append the new samples to the previous NumTaps - 1 samples */
+        for( i = 0U; i < blockSize; i++ )
+        {
+            pStateCurnt[i] = pSrc[i];
+        }
+
+        for( i = 0U; i < blockSize; i++ )
+        {
+            pDst[i] = detail::FilterTraits<T>::firOut( detail::Dot<T, NumTaps>::run( state + i, Coeffs ) );
+        }
+
+        /* Keep the last NumTaps - 1 samples for the next call */
+        for( i = 0U; i < NumTaps - 1U; i++ )
+        {
+            state[i] = state[blockSize + i];
+        }
+    }
+
+private:
+    T state[NumTaps - 1U + MaxBlockSize];
+};
+
+template <typename T, uint16_t NumTaps, const T *Coeffs, uint32_t MaxBlockSize>
+class Fir<T, NumTaps, Coeffs, MaxBlockSize, false>
+{
+public:
+    Fir()
+    {
+        detail::FilterTraits<T>::firInit( &instance, NumTaps, Coeffs, state, MaxBlockSize );
+    }
+
+    /* The instance points to the state of this object */
+    Fir( const Fir & ) = delete;
+    Fir &operator=( const Fir & ) = delete;
+
+    /** Clears the state. */
+    void reset()
+    {
+        detail::FilterTraits<T>::firInit( &instance, NumTaps, Coeffs, state, MaxBlockSize );
+    }
+
+    /**
+     * @brief Filters a block of samples.
+     * @param[in]  pSrc      points to the block of input data.
+     * @param[out] pDst      points to the block of output data.
+     * @param[in]  blockSize number of samples to process, at most MaxBlockSize.
+     */
+    void process( const T *pSrc, T *pDst, uint32_t blockSize )
+    {
+        detail::FilterTraits<T>::fir( &instance, const_cast<T *>( pSrc ), pDst, blockSize );
+    }
+
+private:
+    typename detail::FilterTraits<T>::fir_t instance;
+
+    /* arm_fir_init_q15() clears one more sample on cores with DSP instructions */
+    T state[NumTaps + MaxBlockSize];
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Biquad cascade filter, Direct Form I */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ * @brief Biquad cascade Direct Form I filter of fixed coefficients.
+ * @tparam T          sample type, q15_t, q31_t or float32_t.
+ * @tparam Stages     number of 2nd order stages.
+ * @tparam Coeffs     coefficients of the stages, as for arm_biquad_cascade_df1_init_q15() and friends.
+ * @tparam PostShift  shift applied to the accumulator of each stage, ignored for float32_t.
+ * @tparam Unrolled   true to use the unrolled kernel, false to call the C function.
+ *
+ * The results are the ones of arm_biquad_cascade_df1_q15(), arm_biquad_cascade_df1_q31() and
+ * arm_biquad_cascade_df1_f32(). The unrolled kernel runs all the stages on each sample, which needs no
+ * intermediate buffer.
+ */
+template <typename T, uint8_t Stages, const T *Coeffs, uint8_t PostShift = 0U,
+          bool Unrolled = ( Stages <= ARM_MATH_HPP_MAX_UNROLLED_STAGES )>
+class Biquad
+{
+public:
+    Biquad()
+    {
+        reset();
+    }
+
+    /** Clears the state. */
+    void reset()
+    {
+        memset( state, 0, sizeof( state ) );
+    }
+
+    /**
+     * @brief Filters a block of samples.
+     * @param[in]  pSrc      points to the block of input data.
+     * @param[out] pDst      points to the block of output data.
+     * @param[in]  blockSize number of samples to process.
+     */
+    void process( const T *pSrc, T *pDst, uint32_t blockSize )
+    {
+        uint32_t i;
+
+        for( i = 0U; i < blockSize; i++ )
+        {
+            pDst[i] = detail::BiquadStage<T, Coeffs, Stages, PostShift, 0U>::run( pSrc[i], state );
+        }
+    }
+
+private:
+    T state[4U * Stages];
+};
+
+template <typename T, uint8_t Stages, const T *Coeffs, uint8_t PostShift>
+class Biquad<T, Stages, Coeffs, PostShift, false>
+{
+public:
+    Biquad()
+    {
+        detail::FilterTraits<T>::biquadInit( &instance, Stages, Coeffs, state, PostShift );
+    }
+
+    /* The instance points to the state of this object */
+    Biquad( const Biquad & ) = delete;
+    Biquad &operator=( const Biquad & ) = delete;
+
+    /** Clears the state. */
+    void reset()
+    {
+        detail::FilterTraits<T>::biquadInit( &instance, Stages, Coeffs, state, PostShift );
+    }
+
+    /**
+     * @brief Filters a block of samples.
+     * @param[in]  pSrc      points to the block of input data.
+     * @param[out] pDst      points to the block of output data.
+     * @param[in]  blockSize number of samples to process.
+     */
+    void process( const T *pSrc, T *pDst, uint32_t blockSize )
+    {
+        detail::FilterTraits<T>::biquad( &instance, const_cast<T *>( pSrc ), pDst, blockSize );
+    }
+
+private:
+    typename detail::FilterTraits<T>::biquad_t instance;
+    T state[4U * Stages];
+};
+
+} /* namespace arm_math */
+
+#endif /* _ARM_MATH_HPP */
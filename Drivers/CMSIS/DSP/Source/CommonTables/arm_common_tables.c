@@ -64,6 +64,7 @@
 /*
 * @brief  Table for bit reversal process
 */
+#if defined(ARM_TABLE_BITREV_1024)
 const uint16_t armBitRevTable[1024] =
 {
     0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280,
@@ -170,6 +171,7 @@ const uint16_t armBitRevTable[1024] =
     0x67e, 0x17e, 0x57e, 0x37e, 0x77e, 0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe,
     0x5fe, 0x3fe, 0x7fe, 0x1
 };
+#endif
 
 
 /*
@@ -191,6 +193,7 @@ const uint16_t armBitRevTable[1024] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_16)
 const float32_t twiddleCoef_16[32] =
 {
     1.000000000f,  0.000000000f,
@@ -210,6 +213,7 @@ const float32_t twiddleCoef_16[32] =
     0.707106781f, -0.707106781f,
     0.923879533f, -0.382683432f
 };
+#endif
 
 /**
 * \par
@@ -226,6 +230,7 @@ const float32_t twiddleCoef_16[32] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_32)
 const float32_t twiddleCoef_32[64] =
 {
     1.000000000f,  0.000000000f,
@@ -261,6 +266,7 @@ const float32_t twiddleCoef_32[64] =
     0.923879533f, -0.382683432f,
     0.980785280f, -0.195090322f
 };
+#endif
 
 /**
 * \par
@@ -277,6 +283,7 @@ const float32_t twiddleCoef_32[64] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_64)
 const float32_t twiddleCoef_64[128] =
 {
     1.000000000f,  0.000000000f,
@@ -344,6 +351,7 @@ const float32_t twiddleCoef_64[128] =
     0.980785280f, -0.195090322f,
     0.995184727f, -0.098017140f
 };
+#endif
 
 /**
 * \par
@@ -361,6 +369,7 @@ const float32_t twiddleCoef_64[128] =
 *
 */
 
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_128)
 const float32_t twiddleCoef_128[256] =
 {
     1.000000000f,  0.000000000f,
@@ -492,6 +501,7 @@ const float32_t twiddleCoef_128[256] =
     0.995184727f, -0.098017140f,
     0.998795456f, -0.049067674f
 };
+#endif
 
 /**
 * \par
@@ -508,6 +518,7 @@ const float32_t twiddleCoef_128[256] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_256)
 const float32_t twiddleCoef_256[512] =
 {
     1.000000000f,  0.000000000f,
@@ -767,6 +778,7 @@ const float32_t twiddleCoef_256[512] =
     0.998795456f, -0.049067674f,
     0.999698819f, -0.024541229f
 };
+#endif
 
 /**
 * \par
@@ -783,6 +795,7 @@ const float32_t twiddleCoef_256[512] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_512)
 const float32_t twiddleCoef_512[1024] =
 {
     1.000000000f,  0.000000000f,
@@ -1298,6 +1311,7 @@ const float32_t twiddleCoef_512[1024] =
     0.999698819f, -0.024541229f,
     0.999924702f, -0.012271538f
 };
+#endif
 /**
 * \par
 * Example code for Floating-point Twiddle factors Generation:
@@ -1313,6 +1327,7 @@ const float32_t twiddleCoef_512[1024] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_1024)
 const float32_t twiddleCoef_1024[2048] =
 {
     1.000000000f,  0.000000000f,
@@ -2340,6 +2355,7 @@ const float32_t twiddleCoef_1024[2048] =
     0.999924702f, -0.012271538f,
     0.999981175f, -0.006135885f
 };
+#endif
 
 /**
 * \par
@@ -2356,6 +2372,7 @@ const float32_t twiddleCoef_1024[2048] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_2048)
 const float32_t twiddleCoef_2048[4096] =
 {
     1.000000000f,  0.000000000f,
@@ -4407,6 +4424,7 @@ const float32_t twiddleCoef_2048[4096] =
     0.999981175f, -0.006135885f,
     0.999995294f, -0.003067957f
 };
+#endif
 
 /**
 * \par
@@ -4423,6 +4441,7 @@ const float32_t twiddleCoef_2048[4096] =
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
 const float32_t twiddleCoef_4096[8192] =
 {
     1.000000000f,  0.000000000f,
@@ -8522,6 +8541,7 @@ const float32_t twiddleCoef_4096[8192] =
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif
 
 /*
 * @brief  Q31 Twiddle factors Table
@@ -8546,6 +8566,7 @@ const float32_t twiddleCoef_4096[8192] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_16)
 const q31_t twiddleCoef_16_q31[24] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000,
@@ -8561,6 +8582,7 @@ const q31_t twiddleCoef_16_q31[24] =
     ( q31_t )0xA57D8666, ( q31_t )0xA57D8666,
     ( q31_t )0xCF043AB2, ( q31_t )0x89BE50C3
 };
+#endif
 
 /**
 * \par
@@ -8580,6 +8602,7 @@ const q31_t twiddleCoef_16_q31[24] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_32)
 const q31_t twiddleCoef_32_q31[48] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000,
@@ -8607,6 +8630,7 @@ const q31_t twiddleCoef_32_q31[48] =
     ( q31_t )0xCF043AB2, ( q31_t )0x89BE50C3,
     ( q31_t )0xE70747C3, ( q31_t )0x8275A0C0
 };
+#endif
 
 /**
 * \par
@@ -8626,6 +8650,7 @@ const q31_t twiddleCoef_32_q31[48] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_64)
 const q31_t twiddleCoef_64_q31[96] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7F62368F,
@@ -8661,6 +8686,7 @@ const q31_t twiddleCoef_64_q31[96] =
     ( q31_t )0xDAD7F3A2, ( q31_t )0x8582FAA4, ( q31_t )0xE70747C3,
     ( q31_t )0x8275A0C0, ( q31_t )0xF3742CA1, ( q31_t )0x809DC970
 };
+#endif
 
 /**
 * \par
@@ -8680,6 +8706,7 @@ const q31_t twiddleCoef_64_q31[96] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_128)
 const q31_t twiddleCoef_128_q31[192] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FD8878D,
@@ -8747,6 +8774,7 @@ const q31_t twiddleCoef_128_q31[192] =
     ( q31_t )0xED37EF91, ( q31_t )0x8162AA03, ( q31_t )0xF3742CA1,
     ( q31_t )0x809DC970, ( q31_t )0xF9B82683, ( q31_t )0x80277872
 };
+#endif
 
 /**
 * \par
@@ -8766,6 +8794,7 @@ const q31_t twiddleCoef_128_q31[192] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_256)
 const q31_t twiddleCoef_256_q31[384] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FF62182,
@@ -8897,6 +8926,7 @@ const q31_t twiddleCoef_256_q31[384] =
     ( q31_t )0xF6956FB6, ( q31_t )0x8058C94C, ( q31_t )0xF9B82683,
     ( q31_t )0x80277872, ( q31_t )0xFCDBD541, ( q31_t )0x8009DE7D
 };
+#endif
 
 /**
 * \par
@@ -8916,6 +8946,7 @@ const q31_t twiddleCoef_256_q31[384] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_512)
 const q31_t twiddleCoef_512_q31[768] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFD885A,
@@ -9175,6 +9206,7 @@ const q31_t twiddleCoef_512_q31[768] =
     ( q31_t )0xFB49E6A2, ( q31_t )0x80163440, ( q31_t )0xFCDBD541,
     ( q31_t )0x8009DE7D, ( q31_t )0xFE6DE2E0, ( q31_t )0x800277A5
 };
+#endif
 
 /**
 * \par
@@ -9194,6 +9226,7 @@ const q31_t twiddleCoef_512_q31[768] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_1024)
 const q31_t twiddleCoef_1024_q31[1536] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFF6216,
@@ -9709,6 +9742,7 @@ const q31_t twiddleCoef_1024_q31[1536] =
     ( q31_t )0xFDA4D928, ( q31_t )0x80058D2E, ( q31_t )0xFE6DE2E0,
     ( q31_t )0x800277A5, ( q31_t )0xFF36F078, ( q31_t )0x80009DE9
 };
+#endif
 
 /**
 * \par
@@ -9728,6 +9762,7 @@ const q31_t twiddleCoef_1024_q31[1536] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_2048)
 const q31_t twiddleCoef_2048_q31[3072] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFFD885,
@@ -10755,6 +10790,7 @@ const q31_t twiddleCoef_2048_q31[3072] =
     ( q31_t )0xFED2694F, ( q31_t )0x8001634D, ( q31_t )0xFF36F078,
     ( q31_t )0x80009DE9, ( q31_t )0xFF9B781D, ( q31_t )0x8000277A
 };
+#endif
 
 /**
 * \par
@@ -10774,6 +10810,7 @@ const q31_t twiddleCoef_2048_q31[3072] =
 *   round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
 const q31_t twiddleCoef_4096_q31[6144] =
 {
     ( q31_t )0x7FFFFFFF, ( q31_t )0x00000000, ( q31_t )0x7FFFF621,
@@ -12825,6 +12862,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
     ( q31_t )0xFF69343E, ( q31_t )0x800058D3, ( q31_t )0xFF9B781D,
     ( q31_t )0x8000277A, ( q31_t )0xFFCDBC0A, ( q31_t )0x800009DE
 };
+#endif
 
 
 
@@ -12851,6 +12889,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
 const q15_t twiddleCoef_16_q15[24] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000,
@@ -12866,6 +12905,7 @@ const q15_t twiddleCoef_16_q15[24] =
     ( q15_t )0xA57D, ( q15_t )0xA57D,
     ( q15_t )0xCF04, ( q15_t )0x89BE
 };
+#endif
 
 /**
 * \par
@@ -12885,6 +12925,7 @@ const q15_t twiddleCoef_16_q15[24] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
 const q15_t twiddleCoef_32_q15[48] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000,
@@ -12912,6 +12953,7 @@ const q15_t twiddleCoef_32_q15[48] =
     ( q15_t )0xCF04, ( q15_t )0x89BE,
     ( q15_t )0xE707, ( q15_t )0x8275
 };
+#endif
 
 /**
 * \par
@@ -12931,6 +12973,7 @@ const q15_t twiddleCoef_32_q15[48] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
 const q15_t twiddleCoef_64_q15[96] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7F62, ( q15_t )0x0C8B,
@@ -12958,6 +13001,7 @@ const q15_t twiddleCoef_64_q15[96] =
     ( q15_t )0xCF04, ( q15_t )0x89BE, ( q15_t )0xDAD7, ( q15_t )0x8582,
     ( q15_t )0xE707, ( q15_t )0x8275, ( q15_t )0xF374, ( q15_t )0x809D
 };
+#endif
 
 /**
 * \par
@@ -12977,6 +13021,7 @@ const q15_t twiddleCoef_64_q15[96] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
 const q15_t twiddleCoef_128_q15[192] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FD8, ( q15_t )0x0647,
@@ -13028,6 +13073,7 @@ const q15_t twiddleCoef_128_q15[192] =
     ( q15_t )0xE707, ( q15_t )0x8275, ( q15_t )0xED37, ( q15_t )0x8162,
     ( q15_t )0xF374, ( q15_t )0x809D, ( q15_t )0xF9B8, ( q15_t )0x8027
 };
+#endif
 
 /**
 * \par
@@ -13047,6 +13093,7 @@ const q15_t twiddleCoef_128_q15[192] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
 const q15_t twiddleCoef_256_q15[384] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FF6, ( q15_t )0x0324,
@@ -13146,6 +13193,7 @@ const q15_t twiddleCoef_256_q15[384] =
     ( q15_t )0xF374, ( q15_t )0x809D, ( q15_t )0xF695, ( q15_t )0x8058,
     ( q15_t )0xF9B8, ( q15_t )0x8027, ( q15_t )0xFCDB, ( q15_t )0x8009
 };
+#endif
 
 /**
 * \par
@@ -13165,6 +13213,7 @@ const q15_t twiddleCoef_256_q15[384] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
 const q15_t twiddleCoef_512_q15[768] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFD, ( q15_t )0x0192,
@@ -13360,6 +13409,7 @@ const q15_t twiddleCoef_512_q15[768] =
     ( q15_t )0xF9B8, ( q15_t )0x8027, ( q15_t )0xFB49, ( q15_t )0x8016,
     ( q15_t )0xFCDB, ( q15_t )0x8009, ( q15_t )0xFE6D, ( q15_t )0x8002
 };
+#endif
 
 /**
 * \par
@@ -13379,6 +13429,7 @@ const q15_t twiddleCoef_512_q15[768] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
 const q15_t twiddleCoef_1024_q15[1536] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x00C9,
@@ -13766,6 +13817,7 @@ const q15_t twiddleCoef_1024_q15[1536] =
     ( q15_t )0xFCDB, ( q15_t )0x8009, ( q15_t )0xFDA4, ( q15_t )0x8005,
     ( q15_t )0xFE6D, ( q15_t )0x8002, ( q15_t )0xFF36, ( q15_t )0x8000
 };
+#endif
 
 /**
 * \par
@@ -13785,6 +13837,7 @@ const q15_t twiddleCoef_1024_q15[1536] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
 const q15_t twiddleCoef_2048_q15[3072] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x0064,
@@ -14556,6 +14609,7 @@ const q15_t twiddleCoef_2048_q15[3072] =
     ( q15_t )0xFE6D, ( q15_t )0x8002, ( q15_t )0xFED2, ( q15_t )0x8001,
     ( q15_t )0xFF36, ( q15_t )0x8000, ( q15_t )0xFF9B, ( q15_t )0x8000
 };
+#endif
 
 /**
 * \par
@@ -14575,6 +14629,7 @@ const q15_t twiddleCoef_2048_q15[3072] =
 *   round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
 const q15_t twiddleCoef_4096_q15[6144] =
 {
     ( q15_t )0x7FFF, ( q15_t )0x0000, ( q15_t )0x7FFF, ( q15_t )0x0032,
@@ -16114,6 +16169,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
     ( q15_t )0xFF36, ( q15_t )0x8000, ( q15_t )0xFF69, ( q15_t )0x8000,
     ( q15_t )0xFF9B, ( q15_t )0x8000, ( q15_t )0xFFCD, ( q15_t )0x8000
 };
+#endif
 
 
 /**
@@ -16156,12 +16212,15 @@ const q31_t armRecipTableQ31[64] =
     0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_16)
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH] =
 {
     /* 8x2, size 20 */
     8, 64, 24, 72, 16, 64, 40, 80, 32, 64, 56, 88, 48, 72, 88, 104, 72, 96, 104, 112
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_32)
 const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
 {
     /* 8x4, size 48 */
@@ -16169,7 +16228,9 @@ const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
     80, 144, 96, 192, 104, 208, 112, 152, 120, 216, 136, 192, 144, 160, 168, 208,
     152, 224, 176, 208, 184, 232, 216, 240, 200, 224, 232, 240
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_64)
 const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
 {
     /* radix 8, size 56 */
@@ -16178,7 +16239,9 @@ const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
     184, 464, 224, 280, 232, 344, 240, 408, 248, 472, 296, 352, 304, 416, 312, 480,
     368, 424, 376, 488, 440, 496
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_128)
 const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
 {
     /* 8x2, size 208 */
@@ -16196,7 +16259,9 @@ const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
     792, 864, 808, 904, 816, 864, 824, 920, 840, 864, 856, 880, 872, 944, 888, 1008,
     904, 928, 912, 960, 920, 992, 944, 968, 952, 1000, 968, 992, 984, 1008
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_256)
 const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
 {
     /* 8x4, size 440 */
@@ -16234,7 +16299,9 @@ const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
     1880, 1904, 1888, 1984, 1896, 2000, 1912, 2032, 1904, 2016, 1976, 2032,
     1960, 1968, 2008, 2032, 1992, 2016, 2024, 2032
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_512)
 const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
 {
     /* radix 8, size 448 */
@@ -16274,7 +16341,9 @@ const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
     3064, 4072, 3128, 3632, 3192, 3696, 3256, 3760, 3320, 3824, 3384, 3888,
     3448, 3952, 3512, 4016, 3576, 4080
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024)
 const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
 {
     /* 8x2, size 1800 */
@@ -16426,7 +16495,9 @@ const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
     8008, 8032, 8024, 8048, 8056, 8120, 8072, 8096, 8080, 8128, 8088, 8160,
     8112, 8136, 8120, 8168, 8136, 8160, 8152, 8176
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048)
 const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
 {
     /* 8x2, size 3808 */
@@ -16768,7 +16839,9 @@ const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
     16248, 16368, 16264, 16288, 16280, 16296, 16296, 16304, 16344, 16368,
     16328, 16352, 16360, 16368
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_4096)
 const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
 {
     /* radix 8, size 4032 */
@@ -17139,21 +17212,27 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
     31096, 31544, 31160, 32056, 31224, 32568, 31672, 32120, 31736, 32632,
     32248, 32696
 };
+#endif
 
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_16)
 const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] =
 {
     /* radix 4, size 12 */
     8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_32)
 const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH] =
 {
     /* 4x2, size 24 */
     8, 128, 16, 64, 24, 192, 40, 160, 48, 96, 56, 224, 72, 144,
     88, 208, 104, 176, 120, 240, 152, 200, 184, 232
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_64)
 const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH] =
 {
     /* radix 4, size 56 */
@@ -17161,7 +17240,9 @@ const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_L
     112, 224, 120, 480, 136, 272, 152, 400, 168, 336, 176, 208, 184, 464, 200, 304, 216, 432,
     232, 368, 248, 496, 280, 392, 296, 328, 312, 456, 344, 424, 376, 488, 440, 472
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_128)
 const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH] =
 {
     /* 4x2, size 112 */
@@ -17172,7 +17253,9 @@ const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE
     472, 880, 488, 752, 504, 1008, 536, 776, 552, 648, 568, 904, 600, 840, 616, 712, 632, 968,
     664, 808, 696, 936, 728, 872, 760, 1000, 824, 920, 888, 984
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_256)
 const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH] =
 {
     /* radix 4, size 240 */
@@ -17191,7 +17274,9 @@ const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE
     1368, 1704, 1384, 1448, 1400, 1960, 1432, 1640, 1464, 1896, 1496, 1768, 1528, 2024, 1592, 1816,
     1624, 1688, 1656, 1944, 1720, 1880, 1784, 2008, 1912, 1976
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_512)
 const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH] =
 {
     /* 4x2, size 480 */
@@ -17225,7 +17310,9 @@ const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE
     3128, 3608, 3160, 3352, 3192, 3864, 3256, 3736, 3288, 3480, 3320, 3992, 3384, 3672, 3448, 3928,
     3512, 3800, 3576, 4056, 3704, 3896, 3832, 4024
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_1024)
 const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] =
 {
     /* radix 4, size 992 */
@@ -17299,7 +17386,9 @@ const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TAB
     6872, 7000, 6904, 8024, 6968, 7384, 7032, 7896, 7096, 7640, 7160, 8152, 7288, 7736,
     7352, 7480, 7416, 7992, 7544, 7864, 7672, 8120, 7928, 8056
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_2048)
 const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] =
 {
     /* 4x2, size 1984 */
@@ -17455,7 +17544,9 @@ const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TAB
     14456, 15416, 14520, 14904, 14584, 15928, 14712, 15672, 14776, 15160, 14840, 16184,
     14968, 15544, 15096, 16056, 15224, 15800, 15352, 16312, 15608, 15992, 15864, 16248
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_4096)
 const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] =
 {
     /* radix 4, size 4032 */
@@ -17793,6 +17884,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
     30456, 32184, 30584, 31672, 30712, 32696, 30968, 31864, 31096, 31352, 31224, 32376,
     31480, 32120, 31736, 32632, 32248, 32504
 };
+#endif
 
 /**
 * \par
@@ -17802,6 +17894,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
 * \par
 * Real and Imag values are in interleaved fashion
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
 const float32_t twiddleCoef_rfft_32[32] =
 {
     0.000000000f,  1.000000000f,
@@ -17821,7 +17914,9 @@ const float32_t twiddleCoef_rfft_32[32] =
     0.382683432f, -0.923879533f,
     0.195090322f, -0.980785280f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
 const float32_t twiddleCoef_rfft_64[64] =
 {
     0.000000000000000f,  1.000000000000000f,
@@ -17857,7 +17952,9 @@ const float32_t twiddleCoef_rfft_64[64] =
     0.195090322016129f, -0.980785280403230f,
     0.098017140329561f, -0.995184726672197f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
 const float32_t twiddleCoef_rfft_128[128] =
 {
     0.000000000f,  1.000000000f,
@@ -17925,7 +18022,9 @@ const float32_t twiddleCoef_rfft_128[128] =
     0.098017140f, -0.995184727f,
     0.049067674f, -0.998795456f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
 const float32_t twiddleCoef_rfft_256[256] =
 {
     0.000000000f,  1.000000000f,
@@ -18057,7 +18156,9 @@ const float32_t twiddleCoef_rfft_256[256] =
     0.049067674f, -0.998795456f,
     0.024541229f, -0.999698819f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
 const float32_t twiddleCoef_rfft_512[512] =
 {
     0.000000000f,  1.000000000f,
@@ -18317,7 +18418,9 @@ const float32_t twiddleCoef_rfft_512[512] =
     0.024541229f, -0.999698819f,
     0.012271538f, -0.999924702f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
 const float32_t twiddleCoef_rfft_1024[1024] =
 {
     0.000000000f,  1.000000000f,
@@ -18833,7 +18936,9 @@ const float32_t twiddleCoef_rfft_1024[1024] =
     0.012271538f, -0.999924702f,
     0.006135885f, -0.999981175f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
 const float32_t twiddleCoef_rfft_2048[2048] =
 {
     0.000000000f,  1.000000000f,
@@ -19861,7 +19966,9 @@ const float32_t twiddleCoef_rfft_2048[2048] =
     0.006135885f, -0.999981175f,
     0.003067957f, -0.999995294f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
 const float32_t twiddleCoef_rfft_4096[4096] =
 {
     0.000000000f,  1.000000000f,
@@ -21913,6 +22020,7 @@ const float32_t twiddleCoef_rfft_4096[4096] =
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+#endif
 
 
 /**
@@ -22213,3 +22321,226 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] =
     -5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
     -2009, -1608, -1206, -804, -402, 0
 };
+
+/**
+ * \par
+ * Arctangent table for the Fast Math atan2 functions. Table values are in Q15
+ * (1.15 fixed-point format) and are generated with:
+ * <pre>
+ * for(n = 0; n < (FAST_MATH_POLY_SEGMENTS + 1); n++)
+ * {
+ *  atanTable_q15[n] = atan(x) / pi;
+ * } </pre>
+ * where x = n / FAST_MATH_POLY_SEGMENTS. The values are rounded to the nearest
+ * integer.
+ */
+const q15_t atanTable_q15[FAST_MATH_POLY_SEGMENTS + 1] =
+{
+    0, 326, 651, 975, 1297, 1617, 1933, 2246, 2555, 2860, 3159,
+    3453, 3742, 4025, 4302, 4572, 4836, 5094, 5344, 5589, 5826, 6058,
+    6282, 6500, 6712, 6917, 7117, 7310, 7498, 7679, 7856, 8026, 8192
+};
+
+/**
+ * \par
+ * Arctangent coefficients for the Fast Math atan2 functions. The interval
+ * [0 1) is split into FAST_MATH_POLY_SEGMENTS segments. For segment n the table
+ * holds the coefficients c0, c1, c2 and c3 of the cubic
+ * <pre>
+ *     p(f) = c0 + c1 * f + c2 * f^2 + c3 * f^3,  0 <= f < 1
+ * </pre>
+ * that interpolates atan(x) / pi at the four Chebyshev nodes of the segment,
+ * where x = (n + f) / FAST_MATH_POLY_SEGMENTS. The coefficients are in Q31
+ * (1.31 fixed-point format), rounded to the nearest integer.
+ */
+const q31_t atanTable_q31[4 * FAST_MATH_POLY_SEGMENTS] =
+{
+    0x00000000, 0x0145F309, (q31_t)0xFFFFFFF7, (q31_t)0xFFFFE4E2,
+    0x0145D7E1, 0x0145A1A5, (q31_t)0xFFFFAE8A, (q31_t)0xFFFFE533,
+    0x028B0D43, 0x0144AE64, (q31_t)0xFFFF5E10, (q31_t)0xFFFFE5D2,
+    0x03CEFF89, 0x01431C18, (q31_t)0xFFFF0F77, (q31_t)0xFFFFE6BC,
+    0x051111D3, 0x0140EF5E, (q31_t)0xFFFEC39C, (q31_t)0xFFFFE7E9,
+    0x0650ACB6, 0x013E2E7D, (q31_t)0xFFFE7B4A, (q31_t)0xFFFFE951,
+    0x078D3FCE, 0x013AE138, (q31_t)0xFFFE3734, (q31_t)0xFFFFEAEC,
+    0x08C64324, 0x0137109A, (q31_t)0xFFFDF7EF, (q31_t)0xFFFFECAE,
+    0x09FB385A, 0x0132C6BC, (q31_t)0xFFFDBDF2, (q31_t)0xFFFFEE8C,
+    0x0B2BAB94, 0x012E0E83, (q31_t)0xFFFD8994, (q31_t)0xFFFFF07E,
+    0x0C57342A, 0x0128F365, (q31_t)0xFFFD5B0E, (q31_t)0xFFFFF278,
+    0x0D7D7514, 0x01238127, (q31_t)0xFFFD3277, (q31_t)0xFFFFF471,
+    0x0E9E1D23, 0x011DC3A6, (q31_t)0xFFFD0FCD, (q31_t)0xFFFFF661,
+    0x0FB8E6F8, 0x0117C6A1, (q31_t)0xFFFCF2F6, (q31_t)0xFFFFF841,
+    0x10CD98D0, 0x01119589, (q31_t)0xFFFCDBBF, (q31_t)0xFFFFFA0B,
+    0x11DC0423, 0x010B3B5C, (q31_t)0xFFFCC9E5, (q31_t)0xFFFFFBB9,
+    0x12E4051D, 0x0104C284, (q31_t)0xFFFCBD18, (q31_t)0xFFFFFD4A,
+    0x13E58203, 0x00FE34C0, (q31_t)0xFFFCB4FD, (q31_t)0xFFFFFEBA,
+    0x14E06A7A, 0x00F79B11, (q31_t)0xFFFCB132, 0x00000007,
+    0x15D4B6C4, 0x00F0FDB0, (q31_t)0xFFFCB150, 0x00000133,
+    0x16C266F6, 0x00EA6409, (q31_t)0xFFFCB4F0, 0x0000023D,
+    0x17A9822C, 0x00E3D4BC, (q31_t)0xFFFCBBAD, 0x00000325,
+    0x188A15BB, 0x00DD55A0, (q31_t)0xFFFCC524, 0x000003EE,
+    0x1964346D, 0x00D6EBC8, (q31_t)0xFFFCD0F5, 0x0000049A,
+    0x1A37F5C5, 0x00D09B92, (q31_t)0xFFFCDEC8, 0x00000529,
+    0x1B057548, 0x00CA68AE, (q31_t)0xFFFCEE4A, 0x000005A0,
+    0x1BCCD1E0, 0x00C4562C, (q31_t)0xFFFCFF2E, 0x000005FE,
+    0x1C8E2D38, 0x00BE668C, (q31_t)0xFFFD112E, 0x00000648,
+    0x1D49AB3B, 0x00B89BC7, (q31_t)0xFFFD240B, 0x00000680,
+    0x1DFF718C, 0x00B2F760, (q31_t)0xFFFD378D, 0x000006A6,
+    0x1EAFA71F, 0x00AD7A6E, (q31_t)0xFFFD4B82, 0x000006BE,
+    0x1F5A73CD, 0x00A825AD, (q31_t)0xFFFD5FBE, 0x000006C9
+};
+
+/**
+ * \par
+ * Base 2 logarithm table for the Fast Math logarithm functions. Table values
+ * are in Q15 (1.15 fixed-point format) and are generated with:
+ * <pre>
+ * for(n = 0; n < (FAST_MATH_POLY_SEGMENTS + 1); n++)
+ * {
+ *  log2Table_q15[n] = log2(1 + x);
+ * } </pre>
+ * where x = n / FAST_MATH_POLY_SEGMENTS. The values are rounded to the nearest
+ * integer and the last value, 1.0, is saturated to 0x7FFF.
+ */
+const q15_t log2Table_q15[FAST_MATH_POLY_SEGMENTS + 1] =
+{
+    0, 1455, 2866, 4236, 5568, 6863, 8124, 9352, 10549, 11716, 12855,
+    13968, 15055, 16117, 17156, 18173, 19168, 20143, 21098, 22034, 22952, 23852,
+    24736, 25604, 26455, 27292, 28114, 28922, 29717, 30498, 31267, 32024, 32767
+};
+
+/**
+ * \par
+ * Base 2 logarithm coefficients for the Fast Math logarithm functions. The
+ * interval [0 1) is split into FAST_MATH_POLY_SEGMENTS segments. For segment n
+ * the table holds the coefficients c0, c1, c2 and c3 of the cubic
+ * <pre>
+ *     p(f) = c0 + c1 * f + c2 * f^2 + c3 * f^3,  0 <= f < 1
+ * </pre>
+ * that interpolates log2(1 + x) at the four Chebyshev nodes of the segment,
+ * where x = (n + f) / FAST_MATH_POLY_SEGMENTS. The coefficients are in Q31
+ * (1.31 fixed-point format), rounded to the nearest integer.
+ */
+const q31_t log2Table_q31[4 * FAST_MATH_POLY_SEGMENTS] =
+{
+    0x00000005, 0x05C55129, (q31_t)0xFFE8EE2C, 0x00007588,
+    0x05AEB4E2, 0x05988CD2, (q31_t)0xFFEA4E7D, 0x00006B51,
+    0x0B31FB82, 0x056E6A9C, (q31_t)0xFFEB9032, 0x00006240,
+    0x108C5891, 0x0546B0C0, (q31_t)0xFFECB6BF, 0x00005A2E,
+    0x15C01A3D, 0x05212BE1, (q31_t)0xFFEDC51B, 0x000052F8,
+    0x1ACF5E31, 0x04FDAE2F, (q31_t)0xFFEEBDDA, 0x00004C82,
+    0x1FBC16BC, 0x04DC0EAF, (q31_t)0xFFEFA33C, 0x000046B3,
+    0x24880F59, 0x04BC2896, (q31_t)0xFFF07735, 0x00004176,
+    0x2934F09A, 0x049DDACB, (q31_t)0xFFF13B7D, 0x00003CBB,
+    0x2DC4439D, 0x0481076E, (q31_t)0xFFF1F197, 0x00003872,
+    0x32377514, 0x04659376, (q31_t)0xFFF29AD8, 0x0000348E,
+    0x368FD7F0, 0x044B665F, (q31_t)0xFFF3386F, 0x00003103,
+    0x3ACEA7C2, 0x043269E1, (q31_t)0xFFF3CB68, 0x00002DC8,
+    0x3EF50AD3, 0x041A89AB, (q31_t)0xFFF454B2, 0x00002AD4,
+    0x43041405, 0x0403B336, (q31_t)0xFFF4D521, 0x00002820,
+    0x46FCC47C, 0x03EDD589, (q31_t)0xFFF54D75, 0x000025A5,
+    0x4AE00D1E, 0x03D8E118, (q31_t)0xFFF5BE58, 0x0000235D,
+    0x4EAECFEC, 0x03C4C79C, (q31_t)0xFFF62865, 0x00002143,
+    0x5269E130, 0x03B17BF2, (q31_t)0xFFF68C26, 0x00001F53,
+    0x5612089B, 0x039EF1FE, (q31_t)0xFFF6EA17, 0x00001D89,
+    0x59A8023A, 0x038D1E93, (q31_t)0xFFF742AB, 0x00001BE1,
+    0x5D2C7F5A, 0x037BF75D, (q31_t)0xFFF79648, 0x00001A58,
+    0x60A02758, 0x036B72C9, (q31_t)0xFFF7E54C, 0x000018EC,
+    0x64039859, 0x035B87FA, (q31_t)0xFFF8300A, 0x00001799,
+    0x675767F6, 0x034C2EB2, (q31_t)0xFFF876D0, 0x0000165E,
+    0x6A9C23D7, 0x033D5F49, (q31_t)0xFFF8B9E6, 0x00001538,
+    0x6DD2523E, 0x032F129C, (q31_t)0xFFF8F98B, 0x00001427,
+    0x70FA728C, 0x03214207, (q31_t)0xFFF935FB, 0x00001327,
+    0x7414FDB5, 0x0313E754, (q31_t)0xFFF96F6C, 0x00001238,
+    0x772266AD, 0x0306FCB8, (q31_t)0xFFF9A610, 0x00001158,
+    0x7A231ACE, 0x02FA7CC6, (q31_t)0xFFF9DA15, 0x00001086,
+    0x7D178230, 0x02EE626B, (q31_t)0xFFFA0BA5, 0x00000FC1
+};
+
+/**
+ * \par
+ * Base 2 exponential table for the Fast Math exp2 functions. Table values are
+ * in Q15 (1.15 fixed-point format) and are generated with:
+ * <pre>
+ * for(n = 0; n < (FAST_MATH_POLY_SEGMENTS + 1); n++)
+ * {
+ *  exp2Table_q15[n] = pow(2, x) - 1;
+ * } </pre>
+ * where x = n / FAST_MATH_POLY_SEGMENTS. The values are rounded to the nearest
+ * integer and the last value, 1.0, is saturated to 0x7FFF.
+ */
+const q15_t exp2Table_q15[FAST_MATH_POLY_SEGMENTS + 1] =
+{
+    0, 718, 1451, 2200, 2966, 3748, 4548, 5365, 6200, 7053, 7925,
+    8816, 9727, 10657, 11608, 12580, 13573, 14588, 15625, 16684, 17767, 18874,
+    20005, 21160, 22341, 23548, 24781, 26041, 27329, 28645, 29989, 31364, 32767
+};
+
+/**
+ * \par
+ * Base 2 exponential coefficients for the Fast Math exp2 functions. The
+ * interval [0 1) is split into FAST_MATH_POLY_SEGMENTS segments. For segment n
+ * the table holds the coefficients c0, c1, c2 and c3 of the cubic
+ * <pre>
+ *     p(f) = c0 + c1 * f + c2 * f^2 + c3 * f^3,  0 <= f < 1
+ * </pre>
+ * that interpolates pow(2, x) - 1 at the four Chebyshev nodes of the segment,
+ * where x = (n + f) / FAST_MATH_POLY_SEGMENTS. The coefficients are in Q31
+ * (1.31 fixed-point format), rounded to the nearest integer.
+ */
+const q31_t exp2Table_q31[4 * FAST_MATH_POLY_SEGMENTS] =
+{
+    0x00000000, 0x02C5C865, 0x0007AFD7, 0x00000E5D,
+    0x02CD8699, 0x02D55334, 0x0007DAEE, 0x00000EAE,
+    0x05AAC368, 0x02E53522, 0x000806F6, 0x00000F00,
+    0x08980E80, 0x02F5701A, 0x000833F6, 0x00000F54,
+    0x0B95C1E4, 0x0306060C, 0x000861F1, 0x00000FAA,
+    0x0EA4398B, 0x0316F8F8, 0x000890EF, 0x00001002,
+    0x11C3D373, 0x03284AE6, 0x0008C0F4, 0x0000105B,
+    0x14F4EFA9, 0x0339FDEC, 0x0008F206, 0x000010B7,
+    0x1837F051, 0x034C1428, 0x0009242B, 0x00001115,
+    0x1B8D39BA, 0x035E8FC9, 0x00095769, 0x00001175,
+    0x1EF53260, 0x03717305, 0x00098BC7, 0x000011D6,
+    0x22704303, 0x0384C023, 0x0009C14A, 0x0000123A,
+    0x25FED6A9, 0x03987972, 0x0009F7F9, 0x000012A1,
+    0x29A15AB5, 0x03ACA152, 0x000A2FDA, 0x00001309,
+    0x2D583EEA, 0x03C13A2F, 0x000A68F5, 0x00001374,
+    0x3123F582, 0x03D64682, 0x000AA350, 0x000013E1,
+    0x3504F334, 0x03EBC8D1, 0x000ADEF2, 0x00001450,
+    0x38FBAF47, 0x0401C3B4, 0x000B1BE2, 0x000014C2,
+    0x3D08A39F, 0x041839CD, 0x000B5A28, 0x00001537,
+    0x412C4CCA, 0x042F2DCF, 0x000B99CB, 0x000015AD,
+    0x45672A11, 0x0446A27C, 0x000BDAD2, 0x00001627,
+    0x49B9BD86, 0x045E9AA5, 0x000C1D47, 0x000016A3,
+    0x4E248C15, 0x0477192B, 0x000C612F, 0x00001722,
+    0x52A81D92, 0x04902100, 0x000CA695, 0x000017A4,
+    0x5744FCCB, 0x04A9B526, 0x000CED7F, 0x00001828,
+    0x5BFBB798, 0x04C3D8AE, 0x000D35F7, 0x000018B0,
+    0x60CCDEEC, 0x04DE8EBC, 0x000D8005, 0x0000193A,
+    0x65B906E7, 0x04F9DA86, 0x000DCBB3, 0x000019C7,
+    0x6AC0C6E8, 0x0515BF54, 0x000E1908, 0x00001A58,
+    0x6FE4B99C, 0x0532407E, 0x000E680F, 0x00001AEC,
+    0x75257D15, 0x054F6173, 0x000EB8D1, 0x00001B82,
+    0x7A83B2DB, 0x056D25B0, 0x000F0B58, 0x00001C1D
+};
+
+/**
+ * \par
+ * Initial estimates of the Fast Math reciprocal square root functions. The
+ * table covers the normalized inputs [0.25 1] in steps of 1/64 and the values
+ * are in Q15 (1.15 fixed-point format):
+ * <pre>
+ * for(n = 0; n < 49; n++)
+ * {
+ *  rsqrtTable_q15[n] = 1 / (2 * sqrt((16 + n) / 64));
+ * } </pre>
+ * The values are rounded to the nearest integer and the first value, 1.0, is
+ * saturated to 0x7FFF.
+ */
+const q15_t rsqrtTable_q15[49] =
+{
+    32767, 31790, 30894, 30070, 29309, 28602, 27945, 27330, 26755, 26214, 25705,
+    25225, 24770, 24339, 23930, 23541, 23170, 22817, 22479, 22155, 21845, 21548,
+    21263, 20988, 20724, 20470, 20225, 19988, 19760, 19539, 19326, 19119, 18919,
+    18725, 18536, 18354, 18176, 18004, 17837, 17674, 17515, 17361, 17211, 17064,
+    16921, 16782, 16646, 16514, 16384
+};
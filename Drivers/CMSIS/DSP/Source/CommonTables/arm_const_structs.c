@@ -30,205 +30,276 @@
 #include "arm_const_structs.h"
 
 /* Floating-point structs */
+#if defined(ARM_TABLE_CFFT_F32_16)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 =
 {
     16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_32)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 =
 {
     32, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_64)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 =
 {
     64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_128)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 =
 {
     128, twiddleCoef_128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_256)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 =
 {
     256, twiddleCoef_256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_512)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 =
 {
     512, twiddleCoef_512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_1024)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 =
 {
     1024, twiddleCoef_1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_2048)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 =
 {
     2048, twiddleCoef_2048, armBitRevIndexTable2048, ARMBITREVINDEXTABLE_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_F32_4096)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 =
 {
     4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE_4096_TABLE_LENGTH
 };
+#endif
 
 /* Fixed-point structs */
+#if defined(ARM_TABLE_CFFT_Q31_16)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 =
 {
     16, twiddleCoef_16_q31, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_32)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 =
 {
     32, twiddleCoef_32_q31, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_64)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 =
 {
     64, twiddleCoef_64_q31, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_128)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 =
 {
     128, twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_256)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 =
 {
     256, twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_512)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 =
 {
     512, twiddleCoef_512_q31, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_1024)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 =
 {
     1024, twiddleCoef_1024_q31, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_2048)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 =
 {
     2048, twiddleCoef_2048_q31, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q31_4096)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 =
 {
     4096, twiddleCoef_4096_q31, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_16)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 =
 {
     16, twiddleCoef_16_q15, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_32)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 =
 {
     32, twiddleCoef_32_q15, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_64)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 =
 {
     64, twiddleCoef_64_q15, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_128)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 =
 {
     128, twiddleCoef_128_q15, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_256)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 =
 {
     256, twiddleCoef_256_q15, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_512)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 =
 {
     512, twiddleCoef_512_q15, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_1024)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 =
 {
     1024, twiddleCoef_1024_q15, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_2048)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 =
 {
     2048, twiddleCoef_2048_q15, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_CFFT_Q15_4096)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 =
 {
     4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
 /* Structure for real-value inputs */
 /* Floating-point structs */
+#if defined(ARM_TABLE_RFFT_FAST_F32_32)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len32 =
 {
     { 16, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE_16_TABLE_LENGTH },
     32U,
     ( float32_t * )twiddleCoef_rfft_32
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_64)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len64 =
 {
     { 32, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE_32_TABLE_LENGTH },
     64U,
     ( float32_t * )twiddleCoef_rfft_64
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_128)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len128 =
 {
     { 64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE_64_TABLE_LENGTH },
     128U,
     ( float32_t * )twiddleCoef_rfft_128
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_256)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len256 =
 {
     { 128, twiddleCoef_128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH },
     256U,
     ( float32_t * )twiddleCoef_rfft_256
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_512)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len512 =
 {
     { 256, twiddleCoef_256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH },
     512U,
     ( float32_t * )twiddleCoef_rfft_512
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_1024)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len1024 =
 {
     { 512, twiddleCoef_512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH },
     1024U,
     ( float32_t * )twiddleCoef_rfft_1024
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_2048)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len2048 =
 {
     { 1024, twiddleCoef_1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE_1024_TABLE_LENGTH },
     2048U,
     ( float32_t * )twiddleCoef_rfft_2048
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_FAST_F32_4096)
 const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len4096 =
 {
     { 2048, twiddleCoef_2048, armBitRevIndexTable2048, ARMBITREVINDEXTABLE_2048_TABLE_LENGTH },
     4096U,
     ( float32_t * )twiddleCoef_rfft_4096
 };
+#endif
 
 /* Fixed-point structs */
 /* q31_t */
 extern const q31_t realCoefAQ31[8192];
 extern const q31_t realCoefBQ31[8192];
 
+#if defined(ARM_TABLE_RFFT_Q31_32)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len32 =
 {
     32U,
@@ -239,7 +310,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len32 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len16
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_64)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len64 =
 {
     64U,
@@ -250,7 +323,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len64 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len32
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_128)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len128 =
 {
     128U,
@@ -261,7 +336,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len128 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len64
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_256)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len256 =
 {
     256U,
@@ -272,7 +349,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len256 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len128
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_512)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len512 =
 {
     512U,
@@ -283,7 +362,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len512 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len256
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_1024)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len1024 =
 {
     1024U,
@@ -294,7 +375,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len1024 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len512
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_2048)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len2048 =
 {
     2048U,
@@ -305,7 +388,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len2048 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len1024
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_4096)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len4096 =
 {
     4096U,
@@ -316,7 +401,9 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len4096 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len2048
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_8192)
 const arm_rfft_instance_q31 arm_rfft_sR_q31_len8192 =
 {
     8192U,
@@ -327,11 +414,13 @@ const arm_rfft_instance_q31 arm_rfft_sR_q31_len8192 =
     ( q31_t * )realCoefBQ31,
     &arm_cfft_sR_q31_len4096
 };
+#endif
 
 /* q15_t */
 extern const q15_t realCoefAQ15[8192];
 extern const q15_t realCoefBQ15[8192];
 
+#if defined(ARM_TABLE_RFFT_Q15_32)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len32 =
 {
     32U,
@@ -342,7 +431,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len32 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len16
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_64)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len64 =
 {
     64U,
@@ -353,7 +444,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len64 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len32
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_128)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len128 =
 {
     128U,
@@ -364,7 +457,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len128 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len64
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_256)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len256 =
 {
     256U,
@@ -375,7 +470,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len256 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len128
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_512)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len512 =
 {
     512U,
@@ -386,7 +483,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len512 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len256
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_1024)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len1024 =
 {
     1024U,
@@ -397,7 +496,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len1024 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len512
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_2048)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len2048 =
 {
     2048U,
@@ -408,7 +509,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len2048 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len1024
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_4096)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len4096 =
 {
     4096U,
@@ -419,7 +522,9 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len4096 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len2048
 };
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_8192)
 const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192 =
 {
     8192U,
@@ -430,3 +535,4 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192 =
     ( q15_t * )realCoefBQ15,
     &arm_cfft_sR_q15_len4096
 };
+#endif
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_db_q15.c
+ * Description:  Q15 complex magnitude in decibels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_db Complex Magnitude in Decibels
+ *
+ * Computes the magnitude of the elements of a complex data vector in decibels, for instance to display
+ * a spectrum or to compare a level with a threshold.
+ *
+ * The <code>pSrc</code> points to the source data and
+ * <code>pDst</code> points to the where the result should be written.
+ * <code>numSamples</code> specifies the number of complex samples
+ * in the input array and the data is stored in an interleaved fashion
+ * (real, imag, real, imag, ...).
+ * The input array has a total of <code>2*numSamples</code> values;
+ * the output array has a total of <code>numSamples</code> values.
+ * The underlying algorithm would be:
+ *
+ * <pre>
+ * for(n=0; n<numSamples; n++) {
+ *     pDst[n] = 10 * log10(pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2);
+ * }
+ * </pre>
+ *
+ * The squared magnitude is computed without loss of precision, normalized to a mantissa and an
+ * exponent, and the base 2 logarithm of the mantissas is computed by blocks with the
+ * \ref log2 "logarithm functions", so no square root and no floating-point is needed.
+ *
+ * \par Output Format
+ * The magnitudes are in [0 sqrt(2)] and the outputs are in dB relative to a magnitude of one.
+ * The outputs of the Q15 function are in 8.8 format, in [-91 +4) dB, and the outputs of the Q31 function
+ * are in 9.23 format, in [-187 +4) dB. An input of zero gives the most negative value of the
+ * output format, -128 dB or -256 dB.
+ *
+ * \par Accuracy
+ * Measured on samples spread over the full input range, the maximum errors are:
+ * <pre>
+ *    arm_cmplx_mag_db_q15  1 LSB (2^-8 dB)
+ *    arm_cmplx_mag_db_q31  1 LSB (2^-23 dB)
+ * </pre>
+ */
+
+/**
+ * @addtogroup cmplx_mag_db
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex magnitude in decibels
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and finally output is converted into 8.8 format.
+ * The output vector holds the exponents of a block while the logarithm is computed.
+ */
+
+void arm_cmplx_mag_db_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t numSamples )
+{
+    q15_t mant[ARM_CMPLX_MAG_DB_BLOCK_SIZE];       /* Mantissas of the block, then their logarithm */
+    q15_t real, imag;                              /* Input sample */
+    q31_t l;                                       /* Base 2 logarithm of the squared magnitude */
+    uint32_t power;                                /* Squared magnitude in 2.30 format */
+    uint32_t e;                                    /* Exponent of the squared magnitude */
+    uint32_t blkCnt;                               /* Samples in the block */
+    uint32_t i;                                    /* Loop counter */
+
+    while( numSamples > 0U )
+    {
+        blkCnt = ( numSamples < ARM_CMPLX_MAG_DB_BLOCK_SIZE ) ? numSamples : ARM_CMPLX_MAG_DB_BLOCK_SIZE;
+
+        /* Split the squared magnitudes into a mantissa in [0.5 1) and an exponent */
+        for( i = 0U; i < blkCnt; i++ )
+        {
+            real = *pSrc++;
+            imag = *pSrc++;
+            power = ( uint32_t ) ( ( q31_t ) real * real ) + ( uint32_t ) ( ( q31_t ) imag * imag );
+
+            if( power > 0U )
+            {
+                e = __CLZ( power );
+                mant[i] = ( q15_t ) ( ( power << e ) >> 17U );
+                pDst[i] = ( q15_t ) e;
+            }
+            else
+            {
+                mant[i] = 0x4000;
+                pDst[i] = -1;
+            }
+        }
+
+        /* log2 of the mantissas in 5.11 format */
+        arm_log2_q15( mant, mant, blkCnt );
+
+        /* 10 * log10(power) = 10 * log10(2) * (log2(mant) + 2 - e), with 10 * log10(2) / 4 in 1.15 format */
+        for( i = 0U; i < blkCnt; i++ )
+        {
+            if( pDst[i] >= 0 )
+            {
+                l = mant[i] + ( 2 - ( q31_t ) pDst[i] ) * 0x800;
+                pDst[i] = ( q15_t ) ( ( l * 0x6054 + 0x8000 ) >> 16 );
+            }
+            else
+            {
+                pDst[i] = ( q15_t ) 0x8000;
+            }
+        }
+
+        pDst += blkCnt;
+        numSamples -= blkCnt;
+    }
+}
+
+/**
+ * @} end of cmplx_mag_db group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_mag_db_q31.c
+ * Description:  Q31 complex magnitude in decibels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_db
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex magnitude in decibels
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications with 64-bit results and finally output is
+ * converted into 9.23 format. The output vector holds the exponents of a block while the logarithm
+ * is computed.
+ */
+
+void arm_cmplx_mag_db_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t numSamples )
+{
+    q31_t mant[ARM_CMPLX_MAG_DB_BLOCK_SIZE];       /* Mantissas of the block, then their logarithm */
+    q31_t real, imag;                              /* Input sample */
+    q63_t l;                                       /* Base 2 logarithm of the squared magnitude */
+    uint64_t power;                                /* Squared magnitude in 2.62 format */
+    uint32_t e;                                    /* Exponent of the squared magnitude */
+    uint32_t blkCnt;                               /* Samples in the block */
+    uint32_t i;                                    /* Loop counter */
+
+    while( numSamples > 0U )
+    {
+        blkCnt = ( numSamples < ARM_CMPLX_MAG_DB_BLOCK_SIZE ) ? numSamples : ARM_CMPLX_MAG_DB_BLOCK_SIZE;
+
+        /* Split the squared magnitudes into a mantissa in [0.5 1) and an exponent */
+        for( i = 0U; i < blkCnt; i++ )
+        {
+            real = *pSrc++;
+            imag = *pSrc++;
+            power = ( uint64_t ) ( ( q63_t ) real * real ) + ( uint64_t ) ( ( q63_t ) imag * imag );
+
+            if( power > 0U )
+            {
+                e = ( ( power >> 32U ) != 0U ) ? __CLZ( ( uint32_t ) ( power >> 32U ) ) :
+                    32U + __CLZ( ( uint32_t ) power );
+                mant[i] = ( q31_t ) ( ( power << e ) >> 33U );
+                pDst[i] = ( q31_t ) e;
+            }
+            else
+            {
+                mant[i] = 0x40000000;
+                pDst[i] = -1;
+            }
+        }
+
+        /* log2 of the mantissas in 6.26 format */
+        arm_log2_q31( mant, mant, blkCnt );
+
+        /* 10 * log10(power) = 10 * log10(2) * (log2(mant) + 2 - e), with 10 * log10(2) / 4 in 1.31 format */
+        for( i = 0U; i < blkCnt; i++ )
+        {
+            if( pDst[i] >= 0 )
+            {
+                l = mant[i] + ( q63_t ) ( 2 - pDst[i] ) * 0x4000000;
+                pDst[i] = ( q31_t ) ( ( l * 0x60546093 + 0x80000000LL ) >> 32 );
+            }
+            else
+            {
+                pDst[i] = ( q31_t ) 0x80000000;
+            }
+        }
+
+        pDst += blkCnt;
+        numSamples -= blkCnt;
+    }
+}
+
+/**
+ * @} end of cmplx_mag_db group
+ */
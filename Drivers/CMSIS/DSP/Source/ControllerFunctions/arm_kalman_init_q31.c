@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_init_q31.c
+ * Description:  Initialization function for the Q31 Kalman filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * Linear Kalman filter with 3, 4 or 6 states, in Q31, built on the
+ * fixed-size matrix functions.
+ *
+ * \par Algorithm:
+ * <pre>
+ *    Predict:  x = F * x + u
+ *              P = F * P * F' + Q
+ *    Update:   y = z - H * x
+ *              S = H * P * H' + R
+ *              K = P * H' * inv(S)
+ *              x = x + K * y
+ *              P = (I - K * H) * P * (I - K * H)' + K * R * K'   </pre>
+ *
+ * \par
+ * The covariance is updated in the Joseph form, which keeps P symmetric
+ * positive definite under rounding, where the short form
+ * <code>P - K * H * P</code> can lose it after many updates. The gain is
+ * obtained by solving <code>S * K' = H * P</code> with
+ * arm_mat_ldlt_solve_3x3_q31() and the like, without inverting S.
+ *
+ * \par
+ * There are N states and M measurements, 1 <= M <= N. All the matrices are
+ * stored as N x N arrays in row order: H uses its first M rows and R its top
+ * left M x M block. The other values are ignored, but they must be
+ * readable. Inside the update, S is completed to N x N by an identity block,
+ * so the same fixed-size functions serve every M.
+ *
+ * \par Fixed-Point Behavior
+ * All the values, including the state, the matrices and the measurements,
+ * are fixed-point numbers with the same number of fractional bits, given at
+ * initialization. The integer bits must cover the largest covariance and
+ * the largest element of the products: the units of the states should be
+ * chosen so that their variances are of the same order of magnitude.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Kalman filter.
+ * @param[out] *S          points to an instance of the Q31 Kalman filter structure.
+ * @param[in]  numStates   number of states N: 3, 4 or 6.
+ * @param[in]  numMeas     number of measurements M, 1 to N.
+ * @param[in]  fracBits    number of fractional bits of all the values, 1 to 30.
+ * @param[in]  *pF         points to the state transition matrix F, N x N.
+ * @param[in]  *pQ         points to the process noise covariance Q, N x N.
+ * @param[in]  *pH         points to the measurement matrix H, N x N of which the first M rows are used.
+ * @param[in]  *pR         points to the measurement noise covariance R, N x N of which the top left M x M block is used.
+ * @param[in,out] *pState  points to the initial state estimate x, N values.
+ * @param[in,out] *pCov    points to the initial covariance P, N x N.
+ * @param[in]  *pScratch   points to a scratch buffer of 3*N*N + N values.
+ * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR if a size or
+ * <code>fracBits</code> is not supported.
+ *
+ * \par
+ * The estimate and the covariance are updated in place in <code>pState</code>
+ * and <code>pCov</code>. The matrices are not copied and can be changed
+ * between two calls, for a time varying model.
+ */
+
+arm_status arm_kalman_init_q31(
+    arm_kalman_instance_q31 *S,
+    uint16_t numStates,
+    uint16_t numMeas,
+    uint32_t fracBits,
+    const q31_t *pF,
+    const q31_t *pQ,
+    const q31_t *pH,
+    const q31_t *pR,
+    q31_t *pState,
+    q31_t *pCov,
+    q31_t *pScratch )
+{
+    arm_status status;
+
+    if( ( numStates != 3U && numStates != 4U && numStates != 6U ) ||
+            ( numMeas == 0U ) || ( numMeas > numStates ) ||
+            ( fracBits == 0U ) || ( fracBits > 30U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the sizes, the format and the buffers */
+        S->numStates = numStates;
+        S->numMeas = numMeas;
+        S->fracBits = fracBits;
+        S->pF = pF;
+        S->pQ = pQ;
+        S->pH = pH;
+        S->pR = pR;
+        S->pState = pState;
+        S->pCov = pCov;
+        S->pScratch = pScratch;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of Kalman group
+ */
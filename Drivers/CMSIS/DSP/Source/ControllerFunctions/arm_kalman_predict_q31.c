@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_predict_q31.c
+ * Description:  Prediction step of the Q31 Kalman filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief Prediction step of the Q31 Kalman filter.
+ * @param[in,out] *S         points to an instance of the Q31 Kalman filter structure.
+ * @param[in]     *pControl  points to the effect u of the control input on the state, N values, or NULL.
+ * @return none.
+ *
+ * \par
+ * Computes <code>x = F * x + u</code> and <code>P = F * P * F' + Q</code>.
+ * <code>u</code> is <code>B * u</code> in the usual notation, computed by
+ * the caller.
+ */
+
+void arm_kalman_predict_q31(
+    arm_kalman_instance_q31 *S,
+    const q31_t *pControl )
+{
+    uint32_t n = S->numStates;
+    uint32_t fracBits = S->fracBits;
+    q31_t *pX = S->pState;
+    q31_t *pTmp = S->pScratch;                     /* F * x */
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    uint32_t i, k;
+
+    /* x = F * x + u */
+    for( i = 0U; i < n; i++ )
+    {
+        sum = round;
+
+        for( k = 0U; k < n; k++ )
+        {
+            sum += ( q63_t ) S->pF[i * n + k] * pX[k];
+        }
+
+        pTmp[i] = clip_q63_to_q31( sum >> fracBits );
+
+        if( pControl != NULL )
+        {
+            pTmp[i] = clip_q63_to_q31( ( q63_t ) pTmp[i] + pControl[i] );
+        }
+    }
+
+    for( i = 0U; i < n; i++ )
+    {
+        pX[i] = pTmp[i];
+    }
+
+    /* P = F * P * F' + Q, in place */
+    switch( n )
+    {
+    case 3U:
+        arm_mat_sym_update_3x3_q31( S->pF, S->pCov, S->pQ, S->pCov, fracBits );
+        break;
+
+    case 4U:
+        arm_mat_sym_update_4x4_q31( S->pF, S->pCov, S->pQ, S->pCov, fracBits );
+        break;
+
+    default:
+        arm_mat_sym_update_6x6_q31( S->pF, S->pCov, S->pQ, S->pCov, fracBits );
+        break;
+    }
+}
+
+/**
+ * @} end of Kalman group
+ */
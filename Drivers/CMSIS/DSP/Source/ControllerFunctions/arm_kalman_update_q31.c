@@ -0,0 +1,281 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_q31.c
+ * Description:  Measurement update of the Q31 Kalman filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief Fixed-size matrix multiplication selected by the number of states.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_kalman_mult_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    switch( n )
+    {
+    case 3U:
+        arm_mat_mult_3x3_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+
+    case 4U:
+        arm_mat_mult_4x4_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+
+    default:
+        arm_mat_mult_6x6_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+    }
+}
+
+/**
+ * @brief Fixed-size multiplication by a transposed matrix selected by the number of states.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_kalman_mult_trans_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    switch( n )
+    {
+    case 3U:
+        arm_mat_mult_trans_3x3_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+
+    case 4U:
+        arm_mat_mult_trans_4x4_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+
+    default:
+        arm_mat_mult_trans_6x6_q31( pSrcA, pSrcB, pDst, fracBits );
+        break;
+    }
+}
+
+/**
+ * @brief Fixed-size symmetric update selected by the number of states.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_kalman_sym_update_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    switch( n )
+    {
+    case 3U:
+        arm_mat_sym_update_3x3_q31( pSrcA, pSrcP, pSrcQ, pDst, fracBits );
+        break;
+
+    case 4U:
+        arm_mat_sym_update_4x4_q31( pSrcA, pSrcP, pSrcQ, pDst, fracBits );
+        break;
+
+    default:
+        arm_mat_sym_update_6x6_q31( pSrcA, pSrcP, pSrcQ, pDst, fracBits );
+        break;
+    }
+}
+
+/**
+ * @brief Fixed-size symmetric positive definite solver selected by the number of states.
+ */
+CMSIS_INLINE __STATIC_INLINE arm_status arm_kalman_solve_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    arm_status status;
+
+    switch( n )
+    {
+    case 3U:
+        status = arm_mat_ldlt_solve_3x3_q31( pSrcA, pSrcB, pDst, 3U, fracBits );
+        break;
+
+    case 4U:
+        status = arm_mat_ldlt_solve_4x4_q31( pSrcA, pSrcB, pDst, 4U, fracBits );
+        break;
+
+    default:
+        status = arm_mat_ldlt_solve_6x6_q31( pSrcA, pSrcB, pDst, 6U, fracBits );
+        break;
+    }
+
+    return ( status );
+}
+
+/**
+ * @brief Measurement update of the Q31 Kalman filter.
+ * @param[in,out] *S      points to an instance of the Q31 Kalman filter structure.
+ * @param[in]     *pMeas  points to the measurement z, M values.
+ * @return The function returns ARM_MATH_SINGULAR if the innovation covariance
+ * <code>H * P * H' + R</code> is not positive definite in the format, or ARM_MATH_SUCCESS.
+ *
+ * \par
+ * On ARM_MATH_SINGULAR, the estimate and the covariance are left unchanged,
+ * as if the measurement had been rejected. This happens when R is 0 or too
+ * small for the number of fractional bits.
+ */
+
+arm_status arm_kalman_update_q31(
+    arm_kalman_instance_q31 *S,
+    const q31_t *pMeas )
+{
+    uint32_t n = S->numStates;
+    uint32_t m = S->numMeas;
+    uint32_t fracBits = S->fracBits;
+    q31_t *pX = S->pState;
+    q31_t *pP = S->pCov;
+    const q31_t *pH = S->pH;
+    const q31_t *pR = S->pR;
+    q31_t *pBuf0 = S->pScratch;                    /* H * P, then K */
+    q31_t *pBuf1 = pBuf0 + n * n;                  /* S, then K * R * K' */
+    q31_t *pBuf2 = pBuf1 + n * n;                  /* K', then I - K * H */
+    q31_t *pY = pBuf2 + n * n;                     /* Innovation */
+    q31_t one = ( q31_t ) 1 << fracBits;
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    uint32_t i, j, k;
+    arm_status status;
+
+    /* y = z - H * x, extended with zeros */
+    for( i = 0U; i < n; i++ )
+    {
+        if( i < m )
+        {
+            sum = round;
+
+            for( k = 0U; k < n; k++ )
+            {
+                sum += ( q63_t ) pH[i * n + k] * pX[k];
+            }
+
+            pY[i] = clip_q63_to_q31( ( q63_t ) pMeas[i] - ( sum >> fracBits ) );
+        }
+        else
+        {
+            pY[i] = 0;
+        }
+    }
+
+    /* H * P, with zero rows below the measurements */
+    arm_kalman_mult_q31( pH, pP, pBuf0, n, fracBits );
+
+    for( i = m * n; i < n * n; i++ )
+    {
+        pBuf0[i] = 0;
+    }
+
+    /* S = H * P * H' + R, completed by an identity block */
+    arm_kalman_mult_trans_q31( pBuf0, pH, pBuf1, n, fracBits );
+
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            if( ( i < m ) && ( j < m ) )
+            {
+                pBuf1[i * n + j] = clip_q63_to_q31( ( q63_t ) pBuf1[i * n + j] + pR[i * n + j] );
+            }
+            else
+            {
+                pBuf1[i * n + j] = ( i == j ) ? one : 0;
+            }
+        }
+    }
+
+    /* S * K' = H * P; the rows of K' below the measurements are 0 */
+    status = arm_kalman_solve_q31( pBuf1, pBuf0, pBuf2, n, fracBits );
+
+    if( status != ARM_MATH_SUCCESS )
+    {
+        return ( status );
+    }
+
+    /* x = x + K * y */
+    for( i = 0U; i < n; i++ )
+    {
+        sum = round;
+
+        for( k = 0U; k < m; k++ )
+        {
+            sum += ( q63_t ) pBuf2[k * n + i] * pY[k];
+        }
+
+        pX[i] = clip_q63_to_q31( ( q63_t ) pX[i] + ( sum >> fracBits ) );
+    }
+
+    /* K */
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            pBuf0[i * n + j] = pBuf2[j * n + i];
+        }
+    }
+
+    /* K * R * K'; the zero columns of K mask the unused part of R */
+    arm_kalman_sym_update_q31( pBuf0, pR, NULL, pBuf1, n, fracBits );
+
+    /* I - K * H */
+    arm_kalman_mult_q31( pBuf0, pH, pBuf2, n, fracBits );
+
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            pBuf2[i * n + j] = clip_q63_to_q31( ( ( i == j ) ? ( q63_t ) one : 0 ) - pBuf2[i * n + j] );
+        }
+    }
+
+    /* P = (I - K * H) * P * (I - K * H)' + K * R * K', in place */
+    arm_kalman_sym_update_q31( pBuf2, pP, pBuf1, pP, n, fracBits );
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Kalman group
+ */
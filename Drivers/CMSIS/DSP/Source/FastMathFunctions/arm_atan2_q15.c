@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Q15 four quadrant arctangent function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Four Quadrant Arctangent
+ *
+ * Computes the angle of each point <code>(x, y)</code> of two vectors, <code>atan2(y, x)</code>,
+ * for instance the phase of the complex samples of a demodulator.
+ * There are separate functions for Q15 and Q31 data types.
+ *
+ * The point is folded into the first octant, where <code>t = min(|x|, |y|) / max(|x|, |y|)</code> is
+ * in [0 1]. The ratio is computed with the reciprocal functions <code>arm_recip_q15()</code> and
+ * <code>arm_recip_q31()</code>, so no division is needed, and <code>atan(t)</code> is read from a table
+ * of <code>FAST_MATH_POLY_SEGMENTS</code> segments. The Q15 function interpolates linearly between the
+ * segment ends (<code>atanTable_q15</code>) and the Q31 function evaluates a cubic per segment
+ * (<code>atanTable_q31</code>). The angle is then unfolded with the signs and the order of
+ * <code>|x|</code> and <code>|y|</code>.
+ *
+ * \par Output Format
+ * The outputs are the angles divided by <code>pi</code>: 1.15 or 1.31 values in [-1 +1) for angles in
+ * [-pi pi). The angle <code>pi</code> wraps to <code>-pi</code>, and the difference of two outputs
+ * computed with wrap-around arithmetic is the phase difference modulo <code>2*pi</code>. An output
+ * shifted right by one bit is in the input format of the sine and cosine functions, modulo one.
+ * The angle of the point (0, 0) is zero.
+ *
+ * \par Accuracy
+ * Measured on points spread over the full input range, the maximum errors are:
+ * <pre>
+ *    arm_atan2_q15  2 LSB (pi * 2^-15)
+ *    arm_atan2_q31  4 LSB (pi * 2^-31)
+ * </pre>
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief Four quadrant arctangent of Q15 vectors.
+ * @param[in]  *pSrcY points to the vector of y coordinates in 1.15 format.
+ * @param[in]  *pSrcX points to the vector of x coordinates in 1.15 format.
+ * @param[out] *pDst points to the output angles divided by pi, in 1.15 format.
+ * @param[in]  blockSize number of samples in the vectors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The absolute value of 0x8000 is saturated to 0x7FFF. The ratio and the interpolation use
+ * 16 bit by 16 bit multiplications with 32-bit intermediates.
+ */
+
+void arm_atan2_q15(
+    q15_t *pSrcY,
+    q15_t *pSrcX,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t x, y;                                    /* Input coordinates */
+    q31_t ax, ay;                                  /* Absolute values of the coordinates */
+    q31_t num, den;                                /* Smaller and larger absolute value */
+    q31_t t;                                       /* Ratio, then fraction of the segment */
+    q31_t a, b;                                    /* Ends of the segment */
+    q31_t angle;                                   /* Output angle */
+    q15_t recip;                                   /* Reciprocal of den */
+    uint32_t shift;                                /* Shift of the reciprocal */
+    uint32_t index;                                /* Segment index */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+    while( blkCnt > 0U )
+    {
+        y = *pSrcY++;
+        x = *pSrcX++;
+
+        /* Fold the point into the first octant */
+        ay = ( y > 0 ) ? y : ( ( y == ( q15_t ) 0x8000 ) ? 0x7FFF : -y );
+        ax = ( x > 0 ) ? x : ( ( x == ( q15_t ) 0x8000 ) ? 0x7FFF : -x );
+        num = ( ay < ax ) ? ay : ax;
+        den = ( ay < ax ) ? ax : ay;
+
+        angle = 0;
+
+        if( den > 0 )
+        {
+            /* t = num / den in 1.15 format, with 1/den = recip * 2^shift */
+            shift = arm_recip_q15( ( q15_t ) den, &recip, ( q15_t * ) armRecipTableQ15 );
+            t = ( num * recip ) >> ( 15U - shift );
+            t = ( t > 0x7FFF ) ? 0x7FFF : t;
+
+            /* Linear interpolation of atan(t) / pi in 1.15 format */
+            index = ( uint32_t ) t >> 10U;
+            t = t & 0x3FF;
+            a = atanTable_q15[index];
+            b = atanTable_q15[index + 1U];
+            angle = a + ( ( ( b - a ) * t ) >> 10 );
+        }
+
+        /* Unfold the angle: octant, then quadrant, then sign */
+        if( ay > ax )
+        {
+            angle = 0x4000 - angle;
+        }
+
+        if( x < 0 )
+        {
+            angle = 0x8000 - angle;
+        }
+
+        if( y < 0 )
+        {
+            angle = -angle;
+        }
+
+        *pDst++ = ( q15_t ) angle;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of atan2 group
+ */
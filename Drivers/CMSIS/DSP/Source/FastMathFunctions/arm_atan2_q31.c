@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Q31 four quadrant arctangent function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief Four quadrant arctangent of Q31 vectors.
+ * @param[in]  *pSrcY points to the vector of y coordinates in 1.31 format.
+ * @param[in]  *pSrcX points to the vector of x coordinates in 1.31 format.
+ * @param[out] *pDst points to the output angles divided by pi, in 1.31 format.
+ * @param[in]  blockSize number of samples in the vectors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The absolute value of 0x80000000 is saturated to 0x7FFFFFFF. The ratio and the cubic use
+ * 32 bit by 32 bit multiplications with 64-bit intermediates.
+ */
+
+void arm_atan2_q31(
+    q31_t *pSrcY,
+    q31_t *pSrcX,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    const q31_t *pCoef;                            /* Coefficients of the segment */
+    q31_t x, y;                                    /* Input coordinates */
+    q31_t ax, ay;                                  /* Absolute values of the coordinates */
+    q31_t num, den;                                /* Smaller and larger absolute value */
+    q31_t recip;                                   /* Reciprocal of den */
+    q31_t f;                                       /* Fraction of the segment */
+    q31_t acc;                                     /* Polynomial value */
+    q63_t t;                                       /* Ratio */
+    uint32_t angle;                                /* Output angle */
+    uint32_t shift;                                /* Shift of the reciprocal */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+    while( blkCnt > 0U )
+    {
+        y = *pSrcY++;
+        x = *pSrcX++;
+
+        /* Fold the point into the first octant */
+        ay = ( y > 0 ) ? y : ( ( y == INT32_MIN ) ? INT32_MAX : -y );
+        ax = ( x > 0 ) ? x : ( ( x == INT32_MIN ) ? INT32_MAX : -x );
+        num = ( ay < ax ) ? ay : ax;
+        den = ( ay < ax ) ? ax : ay;
+
+        angle = 0U;
+
+        if( den > 0 )
+        {
+            /* t = num / den in 1.31 format, with 1/den = recip * 2^shift */
+            shift = arm_recip_q31( den, &recip, ( q31_t * ) armRecipTableQ31 );
+            t = ( ( q63_t ) num * recip ) >> ( 31U - shift );
+            t = ( t > 0x7FFFFFFF ) ? 0x7FFFFFFF : t;
+
+            /* Segment of t and fraction of the segment in 1.31 format */
+            pCoef = &atanTable_q31[4U * ( ( uint32_t ) t >> 26U )];
+            f = ( q31_t ) ( ( ( uint32_t ) t & 0x03FFFFFFU ) << 5U );
+
+            /* atan(t) / pi = c0 + f * (c1 + f * (c2 + f * c3)) in 1.31 format */
+            acc = pCoef[3];
+            acc = pCoef[2] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = pCoef[1] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = pCoef[0] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            angle = ( uint32_t ) acc;
+        }
+
+        /* Unfold the angle with wrap-around arithmetic: octant, then quadrant, then sign */
+        if( ay > ax )
+        {
+            angle = 0x40000000U - angle;
+        }
+
+        if( x < 0 )
+        {
+            angle = 0x80000000U - angle;
+        }
+
+        if( y < 0 )
+        {
+            angle = 0U - angle;
+        }
+
+        *pDst++ = ( q31_t ) angle;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp2_q15.c
+ * Description:  Q15 base 2 exponential function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup exp2 Base 2 Exponential
+ *
+ * Computes <code>2^x</code> for each element of a vector. This is the inverse of the
+ * \ref log2 "base 2 logarithm": the input has the format of the logarithm outputs and the output has the
+ * format of the logarithm inputs, so the functions convert a level in log domain (for instance a gain in dB
+ * multiplied by <code>log2(10)/20</code>) back to a linear value.
+ * There are separate functions for Q15 and Q31 data types.
+ *
+ * The input is split into an integer part <code>-n</code> and a fraction <code>f</code> in [0 1):
+ * <pre>
+ *    2^x = 2^f * 2^(-n)
+ * </pre>
+ * <code>2^f - 1</code> is read from a table of <code>FAST_MATH_POLY_SEGMENTS</code> segments.
+ * The Q15 function interpolates linearly between the segment ends (<code>exp2Table_q15</code>) and
+ * the Q31 function evaluates a cubic per segment (<code>exp2Table_q31</code>).
+ *
+ * \par Input and Output Formats
+ * The input of the Q15 function is in 5.11 format and the input of the Q31 function is in 6.26 format.
+ * The outputs are in 1.15 and 1.31 format. Inputs greater than or equal to zero saturate the output to
+ * 0x7FFF and 0x7FFFFFFF.
+ *
+ * \par Accuracy
+ * Measured over all negative inputs for Q15 and over inputs spread on the full range for Q31,
+ * the maximum errors are:
+ * <pre>
+ *    arm_exp2_q15  2 LSB (2^-15)
+ *    arm_exp2_q31  1 LSB (2^-31)
+ * </pre>
+ */
+
+/**
+ * @addtogroup exp2
+ * @{
+ */
+
+/**
+ * @brief Base 2 exponential of Q15 vector.
+ * @param[in]  *pSrc points to the input vector in 5.11 format.
+ * @param[out] *pDst points to the output vector in 1.15 format.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs are rounded to 1.15 format. Inputs greater than or equal to zero are saturated
+ * to 0x7FFF.
+ */
+
+void arm_exp2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t in;                                      /* Input sample */
+    q31_t t;                                       /* Fraction of the segment */
+    q31_t a, b;                                    /* Ends of the segment */
+    uint32_t n;                                    /* Minus the integer part of the input */
+    uint32_t index;                                /* Segment index */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in < 0 )
+        {
+            /* x = f - n with f in [0 1) and n in [1 16] */
+            n = ( uint32_t ) ( -( in >> 11 ) );
+            t = in & 0x7FF;
+
+            /* Linear interpolation of 2^f - 1 in 1.15 format */
+            index = ( uint32_t ) t >> 6U;
+            t = t & 0x3F;
+            a = exp2Table_q15[index];
+            b = exp2Table_q15[index + 1U];
+            a = 0x8000 + a + ( ( ( b - a ) * t ) >> 6 );
+
+            /* 2^x = 2^f * 2^(-n), rounded and saturated to 1.15 format */
+            a = ( a + ( 1 << ( n - 1U ) ) ) >> n;
+            *pDst++ = ( q15_t ) ( ( a > 0x7FFF ) ? 0x7FFF : a );
+        }
+        else
+        {
+            *pDst++ = 0x7FFF;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of exp2 group
+ */
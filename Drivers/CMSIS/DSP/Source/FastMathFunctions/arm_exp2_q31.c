@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp2_q31.c
+ * Description:  Q31 base 2 exponential function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup exp2
+ * @{
+ */
+
+/**
+ * @brief Base 2 exponential of Q31 vector.
+ * @param[in]  *pSrc points to the input vector in 6.26 format.
+ * @param[out] *pDst points to the output vector in 1.31 format.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The cubic is evaluated with 32 bit by 32 bit multiplications and 64-bit intermediates. The outputs
+ * are rounded to 1.31 format. Inputs greater than or equal to zero are saturated to 0x7FFFFFFF.
+ */
+
+void arm_exp2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    const q31_t *pCoef;                            /* Coefficients of the segment */
+    q31_t in;                                      /* Input sample */
+    q31_t f;                                       /* Fraction of the segment */
+    q31_t acc;                                     /* Polynomial value */
+    uint32_t t;                                    /* Fraction of the input */
+    uint32_t n;                                    /* Minus the integer part of the input */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in < 0 )
+        {
+            /* x = t - n with t in [0 1) and n in [1 32] */
+            n = ( uint32_t ) ( -( in >> 26 ) );
+            t = ( ( uint32_t ) in & 0x03FFFFFFU ) << 5U;
+
+            /* Segment of t and fraction of the segment in 1.31 format */
+            pCoef = &exp2Table_q31[4U * ( t >> 26U )];
+            f = ( q31_t ) ( ( t & 0x03FFFFFFU ) << 5U );
+
+            /* 2^t - 1 = c0 + f * (c1 + f * (c2 + f * c3)) in 1.31 format */
+            acc = pCoef[3];
+            acc = pCoef[2] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = pCoef[1] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = clip_q63_to_q31( ( q63_t ) pCoef[0] + ( ( ( q63_t ) acc * f ) >> 31 ) );
+
+            /* 2^x = 2^t * 2^(-n), rounded and saturated to 1.31 format */
+            t = ( 0x80000000U + ( uint32_t ) acc ) >> ( n - 1U );
+            t = ( t >> 1U ) + ( t & 1U );
+            *pDst++ = ( q31_t ) ( ( t > 0x7FFFFFFFU ) ? 0x7FFFFFFFU : t );
+        }
+        else
+        {
+            *pDst++ = 0x7FFFFFFF;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @} end of exp2 group
+ */
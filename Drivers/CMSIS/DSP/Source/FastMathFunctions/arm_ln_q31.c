@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_ln_q31.c
+ * Description:  Q31 natural logarithm function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log2
+ * @{
+ */
+
+/**
+ * @brief Natural logarithm of Q31 vector.
+ * @param[in]  *pSrc points to the input vector in 1.31 format.
+ * @param[out] *pDst points to the output vector in 6.26 format.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function computes <code>log2(x)</code> with <code>arm_log2_q31()</code> and multiplies it in place by
+ * <code>ln(2)</code> with <code>arm_scale_q31()</code>. The outputs are in 6.26 format and the result is
+ * truncated. Inputs that are zero or negative give <code>-32 * ln(2)</code>.
+ */
+
+arm_status arm_ln_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    arm_status status;                             /* Status of the conversion */
+
+    /* ln(x) = log2(x) * ln(2) */
+    status = arm_log2_q31( pSrc, pDst, blockSize );
+    arm_scale_q31( pDst, ( q31_t ) 0x58B90BFC, 0, pDst, blockSize );
+
+    return ( status );
+}
+
+/**
+ * @} end of log2 group
+ */
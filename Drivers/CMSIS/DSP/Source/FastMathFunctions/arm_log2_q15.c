@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log2_q15.c
+ * Description:  Q15 base 2 logarithm function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup log2 Logarithm
+ *
+ * Computes the base 2 logarithm or the natural logarithm of each element of a vector.
+ * There are separate functions for Q15 and Q31 data types.
+ *
+ * The input <code>x</code> is split into an exponent <code>e</code> and a mantissa in [1 2):
+ * <pre>
+ *    x = (1 + t) * 2^(-e),   0 <= t < 1
+ *    log2(x) = log2(1 + t) - e
+ * </pre>
+ * <code>log2(1 + t)</code> is read from a table of <code>FAST_MATH_POLY_SEGMENTS</code> segments.
+ * The Q15 functions interpolate linearly between the segment ends (<code>log2Table_q15</code>) and
+ * the Q31 functions evaluate a cubic per segment (<code>log2Table_q31</code>). The natural logarithm
+ * is the base 2 logarithm scaled by <code>ln(2)</code>.
+ *
+ * The functions work on blocks and only use 16 bit or 32 bit by 32 bit multiplications, so they are
+ * much faster than the floating-point <code>logf()</code> of the C library on cores without FPU.
+ *
+ * \par Output Format
+ * The logarithm of a 1.15 input is in [-15 0) and the outputs of the Q15 functions are in 5.11 format.
+ * The logarithm of a 1.31 input is in [-31 0) and the outputs of the Q31 functions are in 6.26 format.
+ *
+ * \par Accuracy
+ * Measured over all positive inputs for Q15 and over inputs spread on the full exponent range for Q31,
+ * the maximum errors are:
+ * <pre>
+ *    arm_log2_q15  1 LSB (2^-11)
+ *    arm_ln_q15    2 LSB (2^-11)
+ *    arm_log2_q31  1 LSB (2^-26)
+ *    arm_ln_q31    2 LSB (2^-26)
+ * </pre>
+ *
+ * \par Invalid Inputs
+ * The logarithm of zero or of a negative number is not defined. For those elements the output is the
+ * most negative value of the output format (or its scaled value for the natural logarithm), the other
+ * elements are still computed, and the function returns <code>ARM_MATH_ARGUMENT_ERROR</code>.
+ */
+
+/**
+ * @addtogroup log2
+ * @{
+ */
+
+/**
+ * @brief Base 2 logarithm of Q15 vector.
+ * @param[in]  *pSrc points to the input vector in 1.15 format.
+ * @param[out] *pDst points to the output vector in 5.11 format.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs are in [-15 0) and are rounded to 5.11 format. Inputs that are zero or negative give
+ * 0x8000 (-16).
+ */
+
+arm_status arm_log2_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t in;                                      /* Input sample */
+    q31_t t;                                       /* Mantissa minus one, then fraction of the segment */
+    q31_t a, b;                                    /* Ends of the segment */
+    uint32_t e;                                    /* Exponent of the input */
+    uint32_t index;                                /* Segment index */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+    arm_status status = ARM_MATH_SUCCESS;          /* Status of the conversion */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in > 0 )
+        {
+            /* Normalize: in * 2^e is in [1 2) with e in [1 15] */
+            e = __CLZ( ( uint32_t ) in ) - 16U;
+            t = ( in << e ) - 0x8000;
+
+            /* Linear interpolation of log2(1 + t) in 1.15 format */
+            index = ( uint32_t ) t >> 10U;
+            t = t & 0x3FF;
+            a = log2Table_q15[index];
+            b = log2Table_q15[index + 1U];
+            a = a + ( ( ( b - a ) * t ) >> 10 );
+
+            /* log2(x) = log2(1 + t) - e, rounded to 5.11 format */
+            *pDst++ = ( q15_t ) ( ( ( a + 8 ) >> 4 ) - ( q31_t ) ( e << 11 ) );
+        }
+        else
+        {
+            *pDst++ = ( q15_t ) 0x8000;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of log2 group
+ */
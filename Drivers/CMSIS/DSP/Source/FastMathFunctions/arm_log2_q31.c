@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log2_q31.c
+ * Description:  Q31 base 2 logarithm function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log2
+ * @{
+ */
+
+/**
+ * @brief Base 2 logarithm of Q31 vector.
+ * @param[in]  *pSrc points to the input vector in 1.31 format.
+ * @param[out] *pDst points to the output vector in 6.26 format.
+ * @param[in]  blockSize number of samples in the vector.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The cubic is evaluated with 32 bit by 32 bit multiplications and 64-bit intermediates. The outputs
+ * are in [-31 0) and are rounded to 6.26 format. Inputs that are zero or negative give 0x80000000 (-32).
+ */
+
+arm_status arm_log2_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    const q31_t *pCoef;                            /* Coefficients of the segment */
+    q31_t in;                                      /* Input sample */
+    q31_t f;                                       /* Fraction of the segment */
+    q31_t acc;                                     /* Polynomial value */
+    uint32_t t;                                    /* Mantissa minus one */
+    uint32_t e;                                    /* Exponent of the input */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+    arm_status status = ARM_MATH_SUCCESS;          /* Status of the conversion */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in > 0 )
+        {
+            /* Normalize: in * 2^e is in [1 2) with e in [1 31] */
+            e = __CLZ( ( uint32_t ) in );
+            t = ( ( uint32_t ) in << e ) - 0x80000000U;
+
+            /* Segment of t and fraction of the segment in 1.31 format */
+            pCoef = &log2Table_q31[4U * ( t >> 26U )];
+            f = ( q31_t ) ( ( t & 0x03FFFFFFU ) << 5U );
+
+            /* log2(1 + t) = c0 + f * (c1 + f * (c2 + f * c3)) in 1.31 format */
+            acc = pCoef[3];
+            acc = pCoef[2] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = pCoef[1] + ( q31_t ) ( ( ( q63_t ) acc * f ) >> 31 );
+            acc = clip_q63_to_q31( ( q63_t ) pCoef[0] + ( ( ( q63_t ) acc * f ) >> 31 ) );
+
+            /* log2(x) = log2(1 + t) - e, rounded to 6.26 format */
+            *pDst++ = ( q31_t ) ( ( ( uint32_t ) acc + 16U ) >> 5U ) - ( q31_t ) ( e << 26U );
+        }
+        else
+        {
+            *pDst++ = ( q31_t ) 0x80000000;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of log2 group
+ */
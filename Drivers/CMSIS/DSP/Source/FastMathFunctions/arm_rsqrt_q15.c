@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rsqrt_q15.c
+ * Description:  Q15 reciprocal square root function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup RSQRT Reciprocal Square Root
+ *
+ * Computes <code>1/sqrt(x)</code> for each element of a vector, for instance to normalize a vector
+ * by its energy without a square root and a division.
+ * There are separate functions for Q15 and Q31 data types.
+ *
+ * The reciprocal square root of a fractional input is greater than one, so each output is returned as
+ * a mantissa and a shift:
+ * <pre>
+ *    1/sqrt(pSrc[n]) = pDst[n] * 2^pShift[n]
+ * </pre>
+ * with the mantissa in [0.5 1). The input is normalized to <code>m</code> in [0.25 1) by an even
+ * shift, an initial estimate of <code>r = 1/(2*sqrt(m))</code> is interpolated from
+ * <code>rsqrtTable_q15</code>, and the estimate is refined with the Newton-Raphson iteration
+ * <pre>
+ *     r = r * (1.5 - 2 * m * r^2)
+ * </pre>
+ * once for Q15 and twice for Q31. The interpolated estimate is accurate to about 11 bits and
+ * each iteration doubles the number of correct bits.
+ *
+ * \par Accuracy
+ * Measured over all positive inputs for Q15 and over inputs spread on the full exponent range for Q31,
+ * the maximum error of the mantissa is:
+ * <pre>
+ *    arm_rsqrt_q15  2 LSB (2^-15)
+ *    arm_rsqrt_q31  2 LSB (2^-31)
+ * </pre>
+ *
+ * \par Invalid Inputs
+ * For inputs that are zero or negative the mantissa and the shift are set to zero, the other
+ * elements are still computed, and the function returns <code>ARM_MATH_ARGUMENT_ERROR</code>.
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * @brief Reciprocal square root of Q15 vector.
+ * @param[in]  *pSrc points to the input vector in 1.15 format.
+ * @param[out] *pDst points to the output mantissas in 1.15 format.
+ * @param[out] *pShift points to the output shifts, in [1 8].
+ * @param[in]  blockSize number of samples in the vector.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The iteration uses 16 bit by 16 bit multiplications with 32-bit intermediates. The mantissas are
+ * saturated to 0x7FFF.
+ */
+
+arm_status arm_rsqrt_q15(
+    q15_t *pSrc,
+    q15_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize )
+{
+    q31_t in;                                      /* Input sample */
+    q31_t m;                                       /* Normalized input */
+    q31_t r;                                       /* Estimate of 1/(2*sqrt(m)) */
+    q31_t a, b;                                    /* Ends of the segment */
+    q31_t t;                                       /* Temporary value */
+    uint32_t s;                                    /* Normalization shift */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+    arm_status status = ARM_MATH_SUCCESS;          /* Status of the conversion */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in > 0 )
+        {
+            /* Normalize by an even shift: m is in [0.25 1) */
+            s = ( __CLZ( ( uint32_t ) in ) - 17U ) & ~1U;
+            m = in << s;
+
+            /* Initial estimate interpolated from the table */
+            t = ( m >> 9 ) - 16;
+            a = rsqrtTable_q15[t];
+            b = rsqrtTable_q15[t + 1];
+            r = a + ( ( ( b - a ) * ( m & 0x1FF ) ) >> 9 );
+
+            /* Newton-Raphson iteration r = r * (1.5 - 2 * m * r^2) */
+            t = ( r * r ) >> 15;
+            t = ( m * t ) >> 15;
+            r = ( r * ( 0x6000 - t ) ) >> 14;
+
+            /* 1/sqrt(in) = 2 * r * 2^(s/2) */
+            *pDst++ = ( q15_t ) ( ( r > 0x7FFF ) ? 0x7FFF : r );
+            *pShift++ = ( int8_t ) ( ( s >> 1U ) + 1U );
+        }
+        else
+        {
+            *pDst++ = 0;
+            *pShift++ = 0;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of RSQRT group
+ */
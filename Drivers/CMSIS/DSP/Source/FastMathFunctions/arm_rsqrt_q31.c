@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rsqrt_q31.c
+ * Description:  Q31 reciprocal square root function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup RSQRT
+ * @{
+ */
+
+/**
+ * @brief Reciprocal square root of Q31 vector.
+ * @param[in]  *pSrc points to the input vector in 1.31 format.
+ * @param[out] *pDst points to the output mantissas in 1.31 format.
+ * @param[out] *pShift points to the output shifts, in [1 16].
+ * @param[in]  blockSize number of samples in the vector.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if an input is zero or negative.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The iterations use 32 bit by 32 bit multiplications with 64-bit intermediates. The mantissas are
+ * saturated to 0x7FFFFFFF.
+ */
+
+arm_status arm_rsqrt_q31(
+    q31_t *pSrc,
+    q31_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize )
+{
+    q31_t in;                                      /* Input sample */
+    q31_t m;                                       /* Normalized input */
+    q31_t r;                                       /* Estimate of 1/(2*sqrt(m)) */
+    q31_t a, b;                                    /* Ends of the segment */
+    q31_t t;                                       /* Temporary value */
+    uint32_t s;                                    /* Normalization shift */
+    uint32_t i;                                    /* Iteration counter */
+    uint32_t blkCnt = blockSize;                   /* Loop counter */
+    arm_status status = ARM_MATH_SUCCESS;          /* Status of the conversion */
+
+    while( blkCnt > 0U )
+    {
+        in = *pSrc++;
+
+        if( in > 0 )
+        {
+            /* Normalize by an even shift: m is in [0.25 1) */
+            s = ( __CLZ( ( uint32_t ) in ) - 1U ) & ~1U;
+            m = in << s;
+
+            /* Initial estimate interpolated from the table */
+            t = ( m >> 25 ) - 16;
+            a = rsqrtTable_q15[t];
+            b = rsqrtTable_q15[t + 1];
+            r = ( a << 16 ) + ( ( b - a ) * ( ( m >> 9 ) & 0xFFFF ) );
+
+            /* Newton-Raphson iterations r = r * (1.5 - 2 * m * r^2) */
+            for( i = 0U; i < 2U; i++ )
+            {
+                t = ( q31_t ) ( ( ( q63_t ) r * r ) >> 31 );
+                t = ( q31_t ) ( ( ( q63_t ) m * t ) >> 31 );
+                r = clip_q63_to_q31( ( ( q63_t ) r * ( 0x60000000 - t ) ) >> 30 );
+            }
+
+            /* 1/sqrt(in) = 2 * r * 2^(s/2) */
+            *pDst++ = r;
+            *pShift++ = ( int8_t ) ( ( s >> 1U ) + 1U );
+        }
+        else
+        {
+            *pDst++ = 0;
+            *pShift++ = 0;
+            status = ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of RSQRT group
+ */
@@ -56,6 +56,10 @@
  * Finally, the result is saturated to 1.15 format.
  *
  * \par
+ * On Cortex-M0, a stage whose coefficients have absolute values summing to at most 0xFFFF cannot
+ * overflow 32 bits and is computed with a 32-bit accumulator instead, with identical results.
+ *
+ * \par
  * Refer to the function <code>arm_biquad_cascade_df1_fast_q15()</code> for a faster but less precise implementation of this filter for Cortex-M3 and Cortex-M4.
  */
 
@@ -307,6 +311,8 @@ void arm_biquad_cascade_df1_q15(
     q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
     q15_t Xn;                                      /*  temporary input               */
     q63_t acc;                                     /*  Accumulator                                  */
+    q31_t acc32;                                   /*  32-bit accumulator                           */
+    uint32_t coeffSum;                             /*  Sum of the absolute values of the coefficients */
     int32_t shift = ( 15 - ( int32_t ) S->postShift ); /*  Post shift                                   */
     q15_t *pState = S->pState;                     /*  State pointer                                */
     q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
@@ -332,45 +338,113 @@ void arm_biquad_cascade_df1_q15(
          *    acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
          */
 
-        sample = blockSize;
+        /* |acc| <= (|b0| + |b1| + |b2| + |a1| + |a2|) * 32768, so when this sum does not
+         * exceed 0xFFFF the stage is computed with a 32-bit accumulator, with exactly the
+         * result of the 64-bit accumulator. */
+        coeffSum = ( uint32_t ) ( ( b0 < 0 ) ? -b0 : b0 ) + ( uint32_t ) ( ( b1 < 0 ) ? -b1 : b1 ) +
+                   ( uint32_t ) ( ( b2 < 0 ) ? -b2 : b2 ) + ( uint32_t ) ( ( a1 < 0 ) ? -a1 : a1 ) +
+                   ( uint32_t ) ( ( a2 < 0 ) ? -a2 : a2 );
 
-        while( sample > 0U )
+        if( coeffSum <= 0xFFFFU )
         {
-            /* Read the input */
-            Xn = *pIn++;
-
-            /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
-            /* acc =  b0 * x[n] */
-            acc = ( q31_t ) b0 * Xn;
-
-            /* acc +=  b1 * x[n-1] */
-            acc += ( q31_t ) b1 * Xn1;
-            /* acc +=  b[2] * x[n-2] */
-            acc += ( q31_t ) b2 * Xn2;
-            /* acc +=  a1 * y[n-1] */
-            acc += ( q31_t ) a1 * Yn1;
-            /* acc +=  a2 * y[n-2] */
-            acc += ( q31_t ) a2 * Yn2;
-
-            /* The result is converted to 1.31  */
-            acc = __SSAT( ( acc >> shift ), 16 );
-
-            /* Every time after the output is computed state should be updated. */
-            /* The states should be updated as:  */
-            /* Xn2 = Xn1    */
-            /* Xn1 = Xn     */
-            /* Yn2 = Yn1    */
-            /* Yn1 = acc    */
-            Xn2 = Xn1;
-            Xn1 = Xn;
-            Yn2 = Yn1;
-            Yn1 = ( q15_t ) acc;
-
-            /* Store the output in the destination buffer. */
-            *pOut++ = ( q15_t ) acc;
-
-            /* decrement the loop counter */
-            sample--;
+            /* Loop unrolling.  Compute 2 outputs at a time, the state variables are
+             * renamed instead of being moved between the two outputs. */
+            sample = blockSize >> 1U;
+
+            while( sample > 0U )
+            {
+                /* acc32 =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                Xn = *pIn++;
+                acc32 = ( q31_t ) b0 * Xn;
+                acc32 += ( q31_t ) b1 * Xn1;
+                acc32 += ( q31_t ) b2 * Xn2;
+                acc32 += ( q31_t ) a1 * Yn1;
+                acc32 += ( q31_t ) a2 * Yn2;
+
+                /* y[n] is kept in Yn2, y[n-2] is not needed anymore */
+                Yn2 = ( q15_t ) __SSAT( ( acc32 >> shift ), 16 );
+                *pOut++ = Yn2;
+
+                /* acc32 =  b0 * x[n+1] + b1 * x[n] + b2 * x[n-1] + a1 * y[n] + a2 * y[n-1] */
+                Xn2 = *pIn++;
+                acc32 = ( q31_t ) b0 * Xn2;
+                acc32 += ( q31_t ) b1 * Xn;
+                acc32 += ( q31_t ) b2 * Xn1;
+                acc32 += ( q31_t ) a1 * Yn2;
+                acc32 += ( q31_t ) a2 * Yn1;
+
+                /* y[n+1] is kept in Yn1 */
+                Yn1 = ( q15_t ) __SSAT( ( acc32 >> shift ), 16 );
+                *pOut++ = Yn1;
+
+                /* Xn1 = x[n+1], Xn2 = x[n] */
+                Xn1 = Xn2;
+                Xn2 = Xn;
+
+                /* decrement the loop counter */
+                sample--;
+            }
+
+            /* If the blockSize is not a multiple of 2, compute the last output sample */
+            if( ( blockSize & 0x1U ) != 0U )
+            {
+                Xn = *pIn++;
+                acc32 = ( q31_t ) b0 * Xn;
+                acc32 += ( q31_t ) b1 * Xn1;
+                acc32 += ( q31_t ) b2 * Xn2;
+                acc32 += ( q31_t ) a1 * Yn1;
+                acc32 += ( q31_t ) a2 * Yn2;
+
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+                Yn1 = ( q15_t ) __SSAT( ( acc32 >> shift ), 16 );
+
+                *pOut++ = Yn1;
+            }
+        }
+        else
+        {
+            sample = blockSize;
+
+            while( sample > 0U )
+            {
+                /* Read the input */
+                Xn = *pIn++;
+
+                /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+                /* acc =  b0 * x[n] */
+                acc = ( q31_t ) b0 * Xn;
+
+                /* acc +=  b1 * x[n-1] */
+                acc += ( q31_t ) b1 * Xn1;
+                /* acc +=  b[2] * x[n-2] */
+                acc += ( q31_t ) b2 * Xn2;
+                /* acc +=  a1 * y[n-1] */
+                acc += ( q31_t ) a1 * Yn1;
+                /* acc +=  a2 * y[n-2] */
+                acc += ( q31_t ) a2 * Yn2;
+
+                /* The result is converted to 1.31  */
+                acc = __SSAT( ( acc >> shift ), 16 );
+
+                /* Every time after the output is computed state should be updated. */
+                /* The states should be updated as:  */
+                /* Xn2 = Xn1    */
+                /* Xn1 = Xn     */
+                /* Yn2 = Yn1    */
+                /* Yn1 = acc    */
+                Xn2 = Xn1;
+                Xn1 = Xn;
+                Yn2 = Yn1;
+                Yn1 = ( q15_t ) acc;
+
+                /* Store the output in the destination buffer. */
+                *pOut++ = ( q15_t ) acc;
+
+                /* decrement the loop counter */
+                sample--;
+            }
         }
 
         /*  The first stage goes from the input buffer to the output buffer. */
@@ -0,0 +1,241 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_init_q15.c
+ * Description:  Initialization functions for the Q15 FFT convolution and correlation
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ConvFFT FFT Convolution and Correlation
+ *
+ * Streaming convolution of an input signal with a fixed set of taps, or
+ * correlation with a fixed template, computed by overlap-save with the real
+ * FFT. Direct convolution costs numTaps multiply-accumulates per sample; the
+ * FFT costs about 2*log2(fftLen)*fftLen/(fftLen-numTaps+1) butterflies per
+ * sample, whatever the number of taps, which pays off for long filters and
+ * matched filters.
+ *
+ * \par Algorithm
+ * The state holds the last <code>fftLen</code> input samples. For each block
+ * of at most <code>blockSize = fftLen - numTaps + 1</code> new samples, the
+ * state is shifted and the new samples are appended, then:
+ * <pre>
+ *     y = IFFT(FFT(state) * H)
+ * </pre>
+ * where H is the FFT of the zero padded taps, computed at initialization. The
+ * last samples of the circular convolution y, one per new sample, are the
+ * outputs of the linear convolution. The processing functions take any number
+ * of samples and split them into blocks. The full convolution of a finite
+ * sequence, as computed by arm_conv_q15(), is obtained by pushing
+ * <code>numTaps - 1</code> zeros after the sequence.
+ *
+ * \par
+ * For a correlation, the taps are the template in time reversed order:
+ * <pre>
+ *     y[n] = sum(template[k] * x[n - numTaps + 1 + k]), k = 0 ... numTaps-1
+ * </pre>
+ * is output when <code>x[n]</code>, the last sample matching the template, is
+ * pushed.
+ *
+ * \par Block Floating Point
+ * The fixed-point FFTs scale down their data by 2 at each stage, so that their
+ * outputs have log2(fftLen) bits less than their inputs. To keep the precision
+ * of small signals, each block is normalized before its FFT, so that its
+ * largest sample uses all the bits but one; the spectrum of the taps is
+ * normalized at initialization in the same way, and so is their product before
+ * the inverse FFT. The exponents of the three normalizations are added, and the
+ * output is scaled back once. The outputs have the format of the direct
+ * convolution, as computed by arm_fir_q15(), and saturate in the same way.
+ *
+ * \par Crossover
+ * When <code>numTaps</code> is below ARM_CONV_FFT_CROSSOVER_Q15 or
+ * ARM_CONV_FFT_CROSSOVER_Q31, the initialization functions select the direct
+ * convolution, computed on the same state, which is then faster and exact.
+ * The Q31 default comes from the crossover benchmark of DspLibBench_Host, run
+ * on the host and not on Cortex-M0. The Q15 default, 0, keeps the direct
+ * convolution for any number of taps: the SNR of the Q15 FFT path is 40 dB at
+ * best, so it is used only on request, by defining ARM_CONV_FFT_CROSSOVER_Q15
+ * or by setting <code>useFft</code> after the initialization.
+ * <code>useFft</code> in the instance gives the selected method.
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Initialization shared by the convolution and the correlation.
+ */
+static arm_status arm_conv_fft_init_common_q15(
+    arm_conv_fft_instance_q15 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q15_t *pCoeffs,
+    uint8_t reverse,
+    q15_t *pCoeffsFreq,
+    q15_t *pState,
+    q15_t *pScratch )
+{
+    q15_t *pTaps = pScratch;                       /* Zero padded taps */
+    q15_t *pSpectrum = pScratch + fftLen;          /* Full spectrum of the taps */
+    q31_t maxVal = 0;
+    q31_t absVal;
+    int32_t shift;
+    uint32_t i;
+
+    if( ( numTaps == 0U ) || ( numTaps > fftLen ) ||
+            ( arm_rfft_init_q15( &S->rfft, fftLen, 0U, 1U ) != ARM_MATH_SUCCESS ) ||
+            ( arm_rfft_init_q15( &S->rifft, fftLen, 1U, 1U ) != ARM_MATH_SUCCESS ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    S->fftLen = fftLen;
+    S->numTaps = numTaps;
+    S->blockSize = fftLen - numTaps + 1U;
+    S->reverse = reverse;
+    S->useFft = ( ( ARM_CONV_FFT_CROSSOVER_Q15 != 0U ) && ( numTaps >= ARM_CONV_FFT_CROSSOVER_Q15 ) ) ? 1U : 0U;
+    S->pCoeffs = pCoeffs;
+    S->pCoeffsFreq = pCoeffsFreq;
+    S->pState = pState;
+    S->pScratch = pScratch;
+
+    /* Clear the state */
+    memset( pState, 0, fftLen * sizeof( q15_t ) );
+
+    /* Zero padded taps, normalized to 14 bits */
+    for( i = 0U; i < numTaps; i++ )
+    {
+        absVal = pCoeffs[i];
+        absVal = ( absVal < 0 ) ? -absVal : absVal;
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    shift = ( maxVal == 0 ) ? 0 : ( int32_t ) __CLZ( ( uint32_t ) maxVal ) - 18;
+
+    for( i = 0U; i < fftLen; i++ )
+    {
+        pTaps[i] = ( i >= numTaps ) ? 0 :
+                   ( q15_t ) ( ( shift >= 0 ) ?
+                               ( ( q31_t ) pCoeffs[reverse ? numTaps - 1U - i : i] << shift ) :
+                               ( ( q31_t ) pCoeffs[reverse ? numTaps - 1U - i : i] >> -shift ) );
+    }
+
+    /* Spectrum, normalized again to 14 bits */
+    arm_rfft_q15( &S->rfft, pTaps, pSpectrum );
+
+    S->coeffsExp = shift;
+    maxVal = 0;
+
+    for( i = 0U; i < fftLen + 2U; i++ )
+    {
+        absVal = pSpectrum[i];
+        absVal = ( absVal < 0 ) ? -absVal : absVal;
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    shift = ( maxVal == 0 ) ? 0 : ( int32_t ) __CLZ( ( uint32_t ) maxVal ) - 18;
+    S->coeffsExp += shift;
+
+    for( i = 0U; i < fftLen + 2U; i++ )
+    {
+        pCoeffsFreq[i] = ( q15_t ) ( ( shift >= 0 ) ? ( ( q31_t ) pSpectrum[i] << shift ) :
+                                     ( ( q31_t ) pSpectrum[i] >> -shift ) );
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @brief  Initialization function for the Q15 FFT convolution.
+ * @param[out] *S            points to an instance of the Q15 FFT convolution structure.
+ * @param[in]  fftLen        length of the FFT, a length supported by arm_rfft_q15(): 32 to 8192.
+ * @param[in]  numTaps       number of taps, 1 to <code>fftLen</code>.
+ * @param[in]  *pCoeffs      points to the taps, in natural order, <code>numTaps</code> values.
+ * @param[out] *pCoeffsFreq  points to the spectrum of the taps, <code>fftLen+2</code> values.
+ * @param[out] *pState       points to the state buffer, <code>fftLen</code> samples.
+ * @param[in]  *pScratch     points to a scratch buffer of <code>3*fftLen</code> samples.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> or <code>numTaps</code> is not supported.
+ *
+ * \par
+ * Each output is <code>y[n] = sum(b[k] * x[n-k]), k = 0 ... numTaps-1</code>.
+ * The taps are kept for the direct convolution and must stay valid.
+ * <code>fftLen</code> of at least twice <code>numTaps</code> keeps the
+ * overlap below one half of the FFT.
+ */
+
+arm_status arm_conv_fft_init_q15(
+    arm_conv_fft_instance_q15 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q15_t *pCoeffs,
+    q15_t *pCoeffsFreq,
+    q15_t *pState,
+    q15_t *pScratch )
+{
+    return arm_conv_fft_init_common_q15( S, fftLen, numTaps, pCoeffs, 0U,
+                                         pCoeffsFreq, pState, pScratch );
+}
+
+/**
+ * @brief  Initialization function for the Q15 FFT correlation.
+ * @param[out] *S            points to an instance of the Q15 FFT convolution structure.
+ * @param[in]  fftLen        length of the FFT, a length supported by arm_rfft_q15(): 32 to 8192.
+ * @param[in]  numTaps       length of the template, 1 to <code>fftLen</code>.
+ * @param[in]  *pTemplate    points to the template, in natural order, <code>numTaps</code> values.
+ * @param[out] *pCoeffsFreq  points to the spectrum of the template, <code>fftLen+2</code> values.
+ * @param[out] *pState       points to the state buffer, <code>fftLen</code> samples.
+ * @param[in]  *pScratch     points to a scratch buffer of <code>3*fftLen</code> samples.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> or <code>numTaps</code> is not supported.
+ *
+ * \par
+ * The instance is processed by arm_conv_fft_q15(), and each output is the
+ * correlation of the template with the last <code>numTaps</code> input samples.
+ */
+
+arm_status arm_correlate_fft_init_q15(
+    arm_conv_fft_instance_q15 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q15_t *pTemplate,
+    q15_t *pCoeffsFreq,
+    q15_t *pState,
+    q15_t *pScratch )
+{
+    return arm_conv_fft_init_common_q15( S, fftLen, numTaps, pTemplate, 1U,
+                                         pCoeffsFreq, pState, pScratch );
+}
+
+/**
+ * @} end of ConvFFT group
+ */
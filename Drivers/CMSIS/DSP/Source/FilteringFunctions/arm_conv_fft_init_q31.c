@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_init_q31.c
+ * Description:  Initialization functions for the Q31 FFT convolution and correlation
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Initialization shared by the convolution and the correlation.
+ */
+static arm_status arm_conv_fft_init_common_q31(
+    arm_conv_fft_instance_q31 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q31_t *pCoeffs,
+    uint8_t reverse,
+    q31_t *pCoeffsFreq,
+    q31_t *pState,
+    q31_t *pScratch )
+{
+    q31_t *pTaps = pScratch;                       /* Zero padded taps */
+    q31_t *pSpectrum = pScratch + fftLen;          /* Full spectrum of the taps */
+    uint32_t maxVal = 0U;
+    uint32_t absVal;
+    int32_t shift;
+    uint32_t i;
+
+    if( ( numTaps == 0U ) || ( numTaps > fftLen ) ||
+            ( arm_rfft_init_q31( &S->rfft, fftLen, 0U, 1U ) != ARM_MATH_SUCCESS ) ||
+            ( arm_rfft_init_q31( &S->rifft, fftLen, 1U, 1U ) != ARM_MATH_SUCCESS ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    S->fftLen = fftLen;
+    S->numTaps = numTaps;
+    S->blockSize = fftLen - numTaps + 1U;
+    S->reverse = reverse;
+    S->useFft = ( numTaps >= ARM_CONV_FFT_CROSSOVER_Q31 ) ? 1U : 0U;
+    S->pCoeffs = pCoeffs;
+    S->pCoeffsFreq = pCoeffsFreq;
+    S->pState = pState;
+    S->pScratch = pScratch;
+
+    /* Clear the state */
+    memset( pState, 0, fftLen * sizeof( q31_t ) );
+
+    /* Zero padded taps, normalized to 30 bits */
+    for( i = 0U; i < numTaps; i++ )
+    {
+        absVal = ( pCoeffs[i] < 0 ) ? -( uint32_t ) pCoeffs[i] : ( uint32_t ) pCoeffs[i];
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    shift = ( maxVal == 0U ) ? 0 : ( int32_t ) __CLZ( maxVal ) - 2;
+
+    for( i = 0U; i < fftLen; i++ )
+    {
+        pTaps[i] = ( i >= numTaps ) ? 0 :
+                   ( ( shift >= 0 ) ? ( pCoeffs[reverse ? numTaps - 1U - i : i] << shift ) :
+                    ( pCoeffs[reverse ? numTaps - 1U - i : i] >> -shift ) );
+    }
+
+    /* Spectrum, normalized again to 30 bits */
+    arm_rfft_q31( &S->rfft, pTaps, pSpectrum );
+
+    S->coeffsExp = shift;
+    maxVal = 0U;
+
+    for( i = 0U; i < fftLen + 2U; i++ )
+    {
+        absVal = ( pSpectrum[i] < 0 ) ? -( uint32_t ) pSpectrum[i] : ( uint32_t ) pSpectrum[i];
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    shift = ( maxVal == 0U ) ? 0 : ( int32_t ) __CLZ( maxVal ) - 2;
+    S->coeffsExp += shift;
+
+    for( i = 0U; i < fftLen + 2U; i++ )
+    {
+        pCoeffsFreq[i] = ( shift >= 0 ) ? ( pSpectrum[i] << shift ) : ( pSpectrum[i] >> -shift );
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @brief  Initialization function for the Q31 FFT convolution.
+ * @param[out] *S            points to an instance of the Q31 FFT convolution structure.
+ * @param[in]  fftLen        length of the FFT, a length supported by arm_rfft_q31(): 32 to 8192.
+ * @param[in]  numTaps       number of taps, 1 to <code>fftLen</code>.
+ * @param[in]  *pCoeffs      points to the taps, in natural order, <code>numTaps</code> values.
+ * @param[out] *pCoeffsFreq  points to the spectrum of the taps, <code>fftLen+2</code> values.
+ * @param[out] *pState       points to the state buffer, <code>fftLen</code> samples.
+ * @param[in]  *pScratch     points to a scratch buffer of <code>3*fftLen</code> samples.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> or <code>numTaps</code> is not supported.
+ *
+ * \par
+ * Each output is <code>y[n] = sum(b[k] * x[n-k]), k = 0 ... numTaps-1</code>.
+ * The taps are kept for the direct convolution and must stay valid.
+ * <code>fftLen</code> of at least twice <code>numTaps</code> keeps the
+ * overlap below one half of the FFT.
+ */
+
+arm_status arm_conv_fft_init_q31(
+    arm_conv_fft_instance_q31 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q31_t *pCoeffs,
+    q31_t *pCoeffsFreq,
+    q31_t *pState,
+    q31_t *pScratch )
+{
+    return arm_conv_fft_init_common_q31( S, fftLen, numTaps, pCoeffs, 0U,
+                                         pCoeffsFreq, pState, pScratch );
+}
+
+/**
+ * @brief  Initialization function for the Q31 FFT correlation.
+ * @param[out] *S            points to an instance of the Q31 FFT convolution structure.
+ * @param[in]  fftLen        length of the FFT, a length supported by arm_rfft_q31(): 32 to 8192.
+ * @param[in]  numTaps       length of the template, 1 to <code>fftLen</code>.
+ * @param[in]  *pTemplate    points to the template, in natural order, <code>numTaps</code> values.
+ * @param[out] *pCoeffsFreq  points to the spectrum of the template, <code>fftLen+2</code> values.
+ * @param[out] *pState       points to the state buffer, <code>fftLen</code> samples.
+ * @param[in]  *pScratch     points to a scratch buffer of <code>3*fftLen</code> samples.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> or <code>numTaps</code> is not supported.
+ *
+ * \par
+ * The instance is processed by arm_conv_fft_q31(), and each output is the
+ * correlation of the template with the last <code>numTaps</code> input samples.
+ */
+
+arm_status arm_correlate_fft_init_q31(
+    arm_conv_fft_instance_q31 *S,
+    uint16_t fftLen,
+    uint16_t numTaps,
+    const q31_t *pTemplate,
+    q31_t *pCoeffsFreq,
+    q31_t *pState,
+    q31_t *pScratch )
+{
+    return arm_conv_fft_init_common_q31( S, fftLen, numTaps, pTemplate, 1U,
+                                         pCoeffsFreq, pState, pScratch );
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_q15.c
+ * Description:  Q15 streaming convolution and correlation with the real FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Direct convolution of the last blockSize samples of the state.
+ */
+static void arm_conv_fft_direct_q15(
+    const arm_conv_fft_instance_q15 *S,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    const q15_t *pCoeffs = S->pCoeffs;
+    const q15_t *px;
+    uint32_t numTaps = S->numTaps;
+    uint32_t n, k;
+    q63_t acc;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        /* Newest sample used by this output */
+        px = S->pState + S->fftLen - blockSize + n;
+        acc = 0;
+
+        if( S->reverse )
+        {
+            for( k = 0U; k < numTaps; k++ )
+            {
+                acc += ( q31_t ) pCoeffs[numTaps - 1U - k] * *px--;
+            }
+        }
+        else
+        {
+            for( k = 0U; k < numTaps; k++ )
+            {
+                acc += ( q31_t ) pCoeffs[k] * *px--;
+            }
+        }
+
+        /* Same format and saturation as arm_fir_q15() */
+        pDst[n] = ( q15_t ) ( __SSAT( ( acc >> 15 ), 16 ) );
+    }
+}
+
+/**
+ * @brief FFT convolution of the state, and output of its last blockSize samples.
+ */
+static void arm_conv_fft_block_q15(
+    const arm_conv_fft_instance_q15 *S,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t fftLen = S->fftLen;
+    const q15_t *pState = S->pState;
+    const q15_t *pCoeffsFreq = S->pCoeffsFreq;
+    q15_t *pTime = S->pScratch;                    /* Normalized block, then convolution */
+    q15_t *pFreq = S->pScratch + fftLen;           /* Spectrum, then product */
+    q31_t maxVal = 0;
+    q31_t absVal, re, im;
+    q15_t a, b, c, d;
+    int32_t blockExp, prodExp, shift;
+    uint32_t i;
+    q63_t out;
+
+    /* Normalize the block to 14 bits */
+    for( i = 0U; i < fftLen; i++ )
+    {
+        absVal = pState[i];
+        absVal = ( absVal < 0 ) ? -absVal : absVal;
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    if( maxVal == 0 )
+    {
+        memset( pDst, 0, blockSize * sizeof( q15_t ) );
+        return;
+    }
+
+    blockExp = ( int32_t ) __CLZ( ( uint32_t ) maxVal ) - 18;
+
+    for( i = 0U; i < fftLen; i++ )
+    {
+        pTime[i] = ( q15_t ) ( ( blockExp >= 0 ) ? ( ( q31_t ) pState[i] << blockExp ) :
+                               ( ( q31_t ) pState[i] >> -blockExp ) );
+    }
+
+    arm_rfft_q15( &S->rfft, pTime, pFreq );
+
+    /*
+     * Largest part of the product with the spectrum of the taps. Both spectra
+     * are below 2^14, so the products fit in 30 bits.
+     */
+    maxVal = 0;
+
+    for( i = 0U; i < fftLen + 2U; i += 2U )
+    {
+        a = pFreq[i];
+        b = pFreq[i + 1U];
+        c = pCoeffsFreq[i];
+        d = pCoeffsFreq[i + 1U];
+        re = ( q31_t ) a * c - ( q31_t ) b * d;
+        im = ( q31_t ) a * d + ( q31_t ) b * c;
+        re = ( re < 0 ) ? -re : re;
+        im = ( im < 0 ) ? -im : im;
+        maxVal = ( re > maxVal ) ? re : maxVal;
+        maxVal = ( im > maxVal ) ? im : maxVal;
+    }
+
+    if( maxVal == 0 )
+    {
+        memset( pDst, 0, blockSize * sizeof( q15_t ) );
+        return;
+    }
+
+    /* Product normalized to 14 bits, in place */
+    prodExp = 18 - ( int32_t ) __CLZ( ( uint32_t ) maxVal );
+
+    for( i = 0U; i < fftLen + 2U; i += 2U )
+    {
+        a = pFreq[i];
+        b = pFreq[i + 1U];
+        c = pCoeffsFreq[i];
+        d = pCoeffsFreq[i + 1U];
+        re = ( q31_t ) a * c - ( q31_t ) b * d;
+        im = ( q31_t ) a * d + ( q31_t ) b * c;
+
+        if( prodExp > 0 )
+        {
+            re = ( re + ( 1 << ( prodExp - 1 ) ) ) >> prodExp;
+            im = ( im + ( 1 << ( prodExp - 1 ) ) ) >> prodExp;
+        }
+        else
+        {
+            re = re << -prodExp;
+            im = im << -prodExp;
+        }
+
+        pFreq[i] = ( q15_t ) re;
+        pFreq[i + 1U] = ( q15_t ) im;
+    }
+
+    arm_rfft_q15( &S->rifft, pFreq, pTime );
+
+    /*
+     * Each FFT divides by fftLen, and the inverse FFT is normalized. Undo the
+     * normalizations and convert the 2.30 products to 1.15.
+     */
+    shift = 2 * ( 31 - ( int32_t ) __CLZ( fftLen ) ) + prodExp - blockExp - S->coeffsExp - 15;
+    shift = ( shift > 47 ) ? 47 : shift;
+    shift = ( shift < -62 ) ? -62 : shift;
+    pTime += fftLen - blockSize;
+
+    for( i = 0U; i < blockSize; i++ )
+    {
+        if( shift >= 0 )
+        {
+            out = ( q63_t ) pTime[i] << shift;
+        }
+        else
+        {
+            out = ( ( q63_t ) pTime[i] + ( ( q63_t ) 1 << ( -shift - 1 ) ) ) >> -shift;
+        }
+
+        pDst[i] = ( q15_t ) ( ( out > 0x7FFF ) ? 0x7FFF : ( ( out < -0x8000 ) ? -0x8000 : out ) );
+    }
+}
+
+/**
+ * @brief Processing function for the Q15 FFT convolution and correlation.
+ * @param[in,out] *S         points to an instance of the Q15 FFT convolution structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, any number.
+ * @return none.
+ *
+ * \par
+ * The input is processed in blocks of at most <code>S->blockSize</code>
+ * samples. A call with fewer samples costs a whole FFT block: for the best
+ * throughput, pass multiples of <code>S->blockSize</code>.
+ * <code>pDst</code> may be the same as <code>pSrc</code>.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The outputs are the 34.30 sums of products converted to 1.15 and saturated,
+ * as in arm_fir_q15(). With the FFT, the precision is limited by
+ * arm_rfft_q15(), which scales down its data at each stage: the SNR of the
+ * outputs is about 40 dB up to 128 points and 30 dB at 512 points, and it
+ * keeps decreasing for longer FFTs. Use arm_conv_fft_q31() when a higher
+ * precision is needed. The FFT is therefore only used when requested, see
+ * ARM_CONV_FFT_CROSSOVER_Q15; the direct convolution is selected otherwise.
+ */
+
+void arm_conv_fft_q15(
+    arm_conv_fft_instance_q15 *S,
+    const q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t fftLen = S->fftLen;
+    uint32_t blkCnt;
+
+    while( blockSize > 0U )
+    {
+        blkCnt = ( blockSize < S->blockSize ) ? blockSize : S->blockSize;
+
+        /* Shift the state and append the new samples */
+        memmove( S->pState, S->pState + blkCnt, ( fftLen - blkCnt ) * sizeof( q15_t ) );
+        memcpy( S->pState + fftLen - blkCnt, pSrc, blkCnt * sizeof( q15_t ) );
+
+        if( S->useFft )
+        {
+            arm_conv_fft_block_q15( S, pDst, blkCnt );
+        }
+        else
+        {
+            arm_conv_fft_direct_q15( S, pDst, blkCnt );
+        }
+
+        pSrc += blkCnt;
+        pDst += blkCnt;
+        blockSize -= blkCnt;
+    }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_q31.c
+ * Description:  Q31 streaming convolution and correlation with the real FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Direct convolution of the last blockSize samples of the state.
+ */
+static void arm_conv_fft_direct_q31(
+    const arm_conv_fft_instance_q31 *S,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    const q31_t *pCoeffs = S->pCoeffs;
+    const q31_t *px;
+    uint32_t numTaps = S->numTaps;
+    uint32_t n, k;
+    q63_t acc;
+
+    for( n = 0U; n < blockSize; n++ )
+    {
+        /* Newest sample used by this output */
+        px = S->pState + S->fftLen - blockSize + n;
+        acc = 0;
+
+        if( S->reverse )
+        {
+            for( k = 0U; k < numTaps; k++ )
+            {
+                acc += ( q63_t ) pCoeffs[numTaps - 1U - k] * *px--;
+            }
+        }
+        else
+        {
+            for( k = 0U; k < numTaps; k++ )
+            {
+                acc += ( q63_t ) pCoeffs[k] * *px--;
+            }
+        }
+
+        /* Same format as arm_fir_q31() */
+        pDst[n] = ( q31_t ) ( acc >> 31U );
+    }
+}
+
+/**
+ * @brief FFT convolution of the state, and output of its last blockSize samples.
+ */
+static void arm_conv_fft_block_q31(
+    const arm_conv_fft_instance_q31 *S,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t fftLen = S->fftLen;
+    const q31_t *pState = S->pState;
+    const q31_t *pCoeffsFreq = S->pCoeffsFreq;
+    q31_t *pTime = S->pScratch;                    /* Normalized block, then convolution */
+    q31_t *pFreq = S->pScratch + fftLen;           /* Spectrum, then product */
+    uint32_t maxVal = 0U;
+    uint32_t absVal;
+    uint64_t maxProd = 0U;
+    q63_t re, im;
+    q31_t a, b, c, d;
+    int32_t blockExp, prodExp, shift;
+    uint32_t i;
+    q63_t out;
+
+    /* Normalize the block to 30 bits */
+    for( i = 0U; i < fftLen; i++ )
+    {
+        absVal = ( pState[i] < 0 ) ? -( uint32_t ) pState[i] : ( uint32_t ) pState[i];
+        maxVal = ( absVal > maxVal ) ? absVal : maxVal;
+    }
+
+    if( maxVal == 0U )
+    {
+        memset( pDst, 0, blockSize * sizeof( q31_t ) );
+        return;
+    }
+
+    blockExp = ( int32_t ) __CLZ( maxVal ) - 2;
+
+    for( i = 0U; i < fftLen; i++ )
+    {
+        pTime[i] = ( blockExp >= 0 ) ? ( pState[i] << blockExp ) : ( pState[i] >> -blockExp );
+    }
+
+    arm_rfft_q31( &S->rfft, pTime, pFreq );
+
+    /*
+     * Largest part of the product with the spectrum of the taps. Both spectra
+     * are below 2^30, so the products fit in 62 bits.
+     */
+    for( i = 0U; i < fftLen + 2U; i += 2U )
+    {
+        a = pFreq[i];
+        b = pFreq[i + 1U];
+        c = pCoeffsFreq[i];
+        d = pCoeffsFreq[i + 1U];
+        re = ( q63_t ) a * c - ( q63_t ) b * d;
+        im = ( q63_t ) a * d + ( q63_t ) b * c;
+        re = ( re < 0 ) ? -re : re;
+        im = ( im < 0 ) ? -im : im;
+        maxProd = ( ( uint64_t ) re > maxProd ) ? ( uint64_t ) re : maxProd;
+        maxProd = ( ( uint64_t ) im > maxProd ) ? ( uint64_t ) im : maxProd;
+    }
+
+    if( maxProd == 0U )
+    {
+        memset( pDst, 0, blockSize * sizeof( q31_t ) );
+        return;
+    }
+
+    /* Product normalized to 30 bits, in place */
+    if( ( maxProd >> 32 ) != 0U )
+    {
+        prodExp = 34 - ( int32_t ) __CLZ( ( uint32_t ) ( maxProd >> 32 ) );
+    }
+    else
+    {
+        prodExp = 2 - ( int32_t ) __CLZ( ( uint32_t ) maxProd );
+    }
+
+    for( i = 0U; i < fftLen + 2U; i += 2U )
+    {
+        a = pFreq[i];
+        b = pFreq[i + 1U];
+        c = pCoeffsFreq[i];
+        d = pCoeffsFreq[i + 1U];
+        re = ( q63_t ) a * c - ( q63_t ) b * d;
+        im = ( q63_t ) a * d + ( q63_t ) b * c;
+
+        if( prodExp > 0 )
+        {
+            re = ( re + ( ( q63_t ) 1 << ( prodExp - 1 ) ) ) >> prodExp;
+            im = ( im + ( ( q63_t ) 1 << ( prodExp - 1 ) ) ) >> prodExp;
+        }
+        else
+        {
+            re = re << -prodExp;
+            im = im << -prodExp;
+        }
+
+        pFreq[i] = ( q31_t ) re;
+        pFreq[i + 1U] = ( q31_t ) im;
+    }
+
+    arm_rfft_q31( &S->rifft, pFreq, pTime );
+
+    /*
+     * Each FFT divides by fftLen, and the inverse FFT is normalized. Undo the
+     * normalizations and convert the 2.62 products to 1.31.
+     */
+    shift = 2 * ( 31 - ( int32_t ) __CLZ( fftLen ) ) + prodExp - blockExp - S->coeffsExp - 31;
+    shift = ( shift > 31 ) ? 31 : shift;
+    shift = ( shift < -62 ) ? -62 : shift;
+    pTime += fftLen - blockSize;
+
+    for( i = 0U; i < blockSize; i++ )
+    {
+        if( shift >= 0 )
+        {
+            out = ( q63_t ) pTime[i] << shift;
+        }
+        else
+        {
+            out = ( ( q63_t ) pTime[i] + ( ( q63_t ) 1 << ( -shift - 1 ) ) ) >> -shift;
+        }
+
+        pDst[i] = clip_q63_to_q31( out );
+    }
+}
+
+/**
+ * @brief Processing function for the Q31 FFT convolution and correlation.
+ * @param[in,out] *S         points to an instance of the Q31 FFT convolution structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, any number.
+ * @return none.
+ *
+ * \par
+ * The input is processed in blocks of at most <code>S->blockSize</code>
+ * samples. A call with fewer samples costs a whole FFT block: for the best
+ * throughput, pass multiples of <code>S->blockSize</code>.
+ * <code>pDst</code> may be the same as <code>pSrc</code>.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The outputs are the 2.62 sums of products converted to 1.31. The direct
+ * convolution wraps around on overflow, as arm_fir_q31(); the FFT convolution
+ * saturates. With the FFT, the SNR of the outputs is above 110 dB up to
+ * 512 points, and above 100 dB up to 8192 points.
+ */
+
+void arm_conv_fft_q31(
+    arm_conv_fft_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    uint32_t fftLen = S->fftLen;
+    uint32_t blkCnt;
+
+    while( blockSize > 0U )
+    {
+        blkCnt = ( blockSize < S->blockSize ) ? blockSize : S->blockSize;
+
+        /* Shift the state and append the new samples */
+        memmove( S->pState, S->pState + blkCnt, ( fftLen - blkCnt ) * sizeof( q31_t ) );
+        memcpy( S->pState + fftLen - blkCnt, pSrc, blkCnt * sizeof( q31_t ) );
+
+        if( S->useFft )
+        {
+            arm_conv_fft_block_q31( S, pDst, blkCnt );
+        }
+        else
+        {
+            arm_conv_fft_direct_q31( S, pDst, blkCnt );
+        }
+
+        pSrc += blkCnt;
+        pDst += blkCnt;
+        blockSize -= blkCnt;
+    }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
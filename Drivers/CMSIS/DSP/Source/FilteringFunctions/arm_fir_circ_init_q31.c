@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_init_q31.c
+ * Description:  Q31 FIR filter initialization function with circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 FIR filter with circular state buffer.
+ * @param[in,out] *S points to an instance of the Q31 circular-state FIR filter structure.
+ * @param[in]     numTaps  Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in]     blockSize maximum number of samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> or <code>blockSize</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> samples: the delay line of
+ * <code>numTaps+blockSize-1</code> samples is stored twice, so that the samples used for each output are
+ * always contiguous in memory whatever the position in the circular delay line.
+ * <code>blockSize</code> is the largest number of input samples processed by a call to <code>arm_fir_circ_q31()</code>.
+ */
+
+arm_status arm_fir_circ_init_q31(
+    arm_fir_circ_instance_q31 *S,
+    uint16_t numTaps,
+    q31_t *pCoeffs,
+    q31_t *pState,
+    uint32_t blockSize )
+{
+    arm_status status;
+
+    if( ( numTaps == 0U ) || ( blockSize == 0U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign filter taps */
+        S->numTaps = numTaps;
+
+        /* Assign coefficient pointer */
+        S->pCoeffs = pCoeffs;
+
+        /* The delay line holds (numTaps - 1) samples of history and one block of new samples */
+        S->stateLength = ( uint32_t ) numTaps + blockSize - 1U;
+
+        /* The first call reads the delay line from its start */
+        S->stateIndex = 0U;
+
+        /* Clear both copies of the delay line */
+        memset( pState, 0, 2U * S->stateLength * sizeof( q31_t ) );
+
+        /* Assign state pointer */
+        S->pState = pState;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q31.c
+ * Description:  Q31 FIR filter processing function with circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR filter with circular state buffer.
+ * @param[in,out] *S points to an instance of the Q31 circular-state FIR filter structure.
+ * @param[in]  *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call, at most the <code>blockSize</code> given to
+ * <code>arm_fir_circ_init_q31()</code>.
+ * @return none.
+ *
+ * \par
+ * The new input samples are written in a circular delay line held twice in the state buffer, and only the
+ * position of the delay line is updated at the end of the call. Unlike <code>arm_fir_q31()</code>, the
+ * <code>numTaps-1</code> last samples are not copied back to the start of the state buffer, which saves
+ * most of the overhead for short blocks.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs are identical to the outputs of <code>arm_fir_q31()</code>, refer to this function for
+ * the scaling and overflow behavior.
+ */
+
+void arm_fir_circ_q31(
+    arm_fir_circ_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState + S->stateIndex;     /* Oldest sample used by the first output */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t *px;                                     /* Temporary pointer for state buffer */
+    q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
+    q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+    q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+    uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+    uint32_t stateLength = S->stateLength;         /* Length of the delay line */
+    uint32_t writeIndex;                           /* Position of the first new sample in the delay line */
+    uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+    /* The new samples follow the (numTaps - 1) samples of history */
+    writeIndex = S->stateIndex + numTaps - 1U;
+
+    if( writeIndex >= stateLength )
+    {
+        writeIndex -= stateLength;
+    }
+
+    /* Copy the new samples in both copies of the delay line */
+    arm_circularWrite_mirror_q31( S->pState, stateLength, writeIndex, pSrc, blockSize );
+
+    /* Compute 4 outputs at a time, the samples used by the block are contiguous from pState */
+    blkCnt = blockSize >> 2U;
+
+    while( blkCnt > 0U )
+    {
+        /* Set all accumulators to zero */
+        acc0 = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        /* Initialize state pointer */
+        px = pState;
+
+        /* Initialize coefficient pointer */
+        pb = pCoeffs;
+
+        /* Read the first three samples of the state window */
+        x0 = *px++;
+        x1 = *px++;
+        x2 = *px++;
+
+        /* Loop unrolling.  Process 4 taps at a time. */
+        tapCnt = numTaps >> 2U;
+
+        while( tapCnt > 0U )
+        {
+            /* acc0 += b[k] * x[n-k], acc1 += b[k] * x[n-k+1], ... */
+            c0 = *pb++;
+            x3 = *px++;
+            acc0 += ( q63_t ) x0 * c0;
+            acc1 += ( q63_t ) x1 * c0;
+            acc2 += ( q63_t ) x2 * c0;
+            acc3 += ( q63_t ) x3 * c0;
+
+            c0 = *pb++;
+            x0 = *px++;
+            acc0 += ( q63_t ) x1 * c0;
+            acc1 += ( q63_t ) x2 * c0;
+            acc2 += ( q63_t ) x3 * c0;
+            acc3 += ( q63_t ) x0 * c0;
+
+            c0 = *pb++;
+            x1 = *px++;
+            acc0 += ( q63_t ) x2 * c0;
+            acc1 += ( q63_t ) x3 * c0;
+            acc2 += ( q63_t ) x0 * c0;
+            acc3 += ( q63_t ) x1 * c0;
+
+            c0 = *pb++;
+            x2 = *px++;
+            acc0 += ( q63_t ) x3 * c0;
+            acc1 += ( q63_t ) x0 * c0;
+            acc2 += ( q63_t ) x1 * c0;
+            acc3 += ( q63_t ) x2 * c0;
+
+            tapCnt--;
+        }
+
+        /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+        tapCnt = numTaps & 0x3U;
+
+        while( tapCnt > 0U )
+        {
+            c0 = *pb++;
+            x3 = *px++;
+            acc0 += ( q63_t ) x0 * c0;
+            acc1 += ( q63_t ) x1 * c0;
+            acc2 += ( q63_t ) x2 * c0;
+            acc3 += ( q63_t ) x3 * c0;
+
+            /* Slide the state window by one sample */
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+
+            tapCnt--;
+        }
+
+        /* Convert the results to 1.31 format and store the 4 outputs in the destination buffer */
+        *pDst++ = ( q31_t ) ( acc0 >> 31 );
+        *pDst++ = ( q31_t ) ( acc1 >> 31 );
+        *pDst++ = ( q31_t ) ( acc2 >> 31 );
+        *pDst++ = ( q31_t ) ( acc3 >> 31 );
+
+        /* Advance state pointer by 4 for the next 4 samples */
+        pState = pState + 4;
+
+        /* Decrement the samples loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+    blkCnt = blockSize & 0x3U;
+
+    while( blkCnt > 0U )
+    {
+        /* Set the accumulator to zero */
+        acc0 = 0;
+
+        /* Initialize state pointer */
+        px = pState;
+
+        /* Initialize coefficient pointer */
+        pb = pCoeffs;
+
+        tapCnt = numTaps;
+
+        /* Perform the multiply-accumulates */
+        do
+        {
+            acc0 += ( q63_t ) *px++ * *pb++;
+            tapCnt--;
+        } while( tapCnt > 0U );
+
+        /* Convert the result to 1.31 format and store the output in the destination buffer */
+        *pDst++ = ( q31_t ) ( acc0 >> 31 );
+
+        /* Advance state pointer by 1 for the next sample */
+        pState = pState + 1;
+
+        /* Decrement the samples loop counter */
+        blkCnt--;
+    }
+
+    /* Processing is complete.
+     ** Only the position of the oldest sample needed by the next call is updated. */
+    blkCnt = S->stateIndex + blockSize;
+
+    if( blkCnt >= stateLength )
+    {
+        blkCnt -= stateLength;
+    }
+
+    S->stateIndex = blkCnt;
+}
+
+/**
+ * @} end of FIR group
+ */
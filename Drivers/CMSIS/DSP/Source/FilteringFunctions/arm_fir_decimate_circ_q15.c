@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_decimate_circ_q15.c
+ * Description:  Q15 FIR decimator processing function with circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR decimator with circular state buffer.
+ * @param[in,out] *S points to an instance of the Q15 circular-state FIR decimator structure.
+ * @param[in] *pSrc points to the block of input data.
+ * @param[out] *pDst points to the location where the output result is written.
+ * @param[in] blockSize number of input samples to process per call, a multiple of <code>M</code> and at most
+ * the <code>blockSize</code> given to <code>arm_fir_decimate_circ_init_q15()</code>.
+ * @return none.
+ *
+ * \par
+ * The new input samples are written in a circular delay line held twice in the state buffer, so that no
+ * samples are copied back to the start of the state buffer at the end of the call.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs are identical to the outputs of <code>arm_fir_decimate_q15()</code>, refer to this function
+ * for the scaling and overflow behavior.
+ */
+
+void arm_fir_decimate_circ_q15(
+    arm_fir_decimate_circ_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState + S->stateIndex;     /* Oldest sample used by the first output */
+    q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q15_t *px;                                     /* Temporary pointer for state buffer */
+    q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+    q63_t sum0;                                    /* Accumulator */
+    uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+    uint32_t stateLength = S->stateLength;         /* Length of the delay line */
+    uint32_t writeIndex;                           /* Position of the first new sample in the delay line */
+    uint32_t M = S->M;                             /* Decimation factor */
+    uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+    /* The new samples follow the (numTaps - 1) samples of history */
+    writeIndex = S->stateIndex + numTaps - 1U;
+
+    if( writeIndex >= stateLength )
+    {
+        writeIndex -= stateLength;
+    }
+
+    /* Copy the new samples in both copies of the delay line */
+    arm_circularWrite_mirror_q15( S->pState, stateLength, writeIndex, pSrc, blockSize );
+
+    /* Total number of output samples to be computed */
+    blkCnt = blockSize / M;
+
+    while( blkCnt > 0U )
+    {
+        /* Set accumulator to zero */
+        sum0 = 0;
+
+        /* Initialize state pointer */
+        px = pState;
+
+        /* Initialize coefficient pointer */
+        pb = pCoeffs;
+
+        /* Loop unrolling.  Process 4 taps at a time. */
+        tapCnt = numTaps >> 2U;
+
+        while( tapCnt > 0U )
+        {
+            sum0 += ( q31_t ) *px++ * *pb++;
+            sum0 += ( q31_t ) *px++ * *pb++;
+            sum0 += ( q31_t ) *px++ * *pb++;
+            sum0 += ( q31_t ) *px++ * *pb++;
+
+            tapCnt--;
+        }
+
+        /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+        tapCnt = numTaps & 0x3U;
+
+        while( tapCnt > 0U )
+        {
+            sum0 += ( q31_t ) *px++ * *pb++;
+
+            tapCnt--;
+        }
+
+        /* Advance the state pointer by the decimation factor
+         * to process the next group of decimation factor number samples */
+        pState = pState + M;
+
+        /* Convert the result to 1.15 format and store the output in the destination buffer */
+        *pDst++ = ( q15_t ) __SSAT( ( sum0 >> 15 ), 16 );
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Processing is complete.
+     ** Only the position of the oldest sample needed by the next call is updated. */
+    blkCnt = S->stateIndex + blockSize;
+
+    if( blkCnt >= stateLength )
+    {
+        blkCnt -= stateLength;
+    }
+
+    S->stateIndex = blkCnt;
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_interpolate_circ_q31.c
+ * Description:  Q31 FIR interpolator processing function with circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Interpolate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR interpolator with circular state buffer.
+ * @param[in,out] *S points to an instance of the Q31 circular-state FIR interpolator structure.
+ * @param[in] *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in] blockSize number of input samples to process per call, at most the <code>blockSize</code> given to
+ * <code>arm_fir_interpolate_circ_init_q31()</code>.
+ * @return none.
+ *
+ * \par
+ * The new input samples are written in a circular delay line held twice in the state buffer, so that no
+ * samples are copied back to the start of the state buffer at the end of the call.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The outputs are identical to the outputs of <code>arm_fir_interpolate_q31()</code>, refer to this
+ * function for the scaling and overflow behavior.
+ */
+
+void arm_fir_interpolate_circ_q31(
+    arm_fir_interpolate_circ_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState + S->stateIndex;     /* Oldest sample used by the first outputs */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+    q63_t sum;                                     /* Accumulator */
+    uint32_t L = S->L;                             /* Interpolation factor */
+    uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+    uint32_t stateLength = S->stateLength;         /* Length of the delay line */
+    uint32_t writeIndex;                           /* Position of the first new sample in the delay line */
+    uint32_t i, blkCnt, tapCnt;                    /* Loop counters */
+
+    /* The new samples follow the (phaseLen - 1) samples of history */
+    writeIndex = S->stateIndex + phaseLen - 1U;
+
+    if( writeIndex >= stateLength )
+    {
+        writeIndex -= stateLength;
+    }
+
+    /* Copy the new samples in both copies of the delay line */
+    arm_circularWrite_mirror_q31( S->pState, stateLength, writeIndex, pSrc, blockSize );
+
+    /* Loop over the blockSize. */
+    blkCnt = blockSize;
+
+    while( blkCnt > 0U )
+    {
+        /* Loop over the Interpolation factor. */
+        i = L;
+
+        while( i > 0U )
+        {
+            /* Set accumulator to zero */
+            sum = 0;
+
+            /* Initialize state pointer */
+            ptr1 = pState;
+
+            /* Initialize coefficient pointer */
+            ptr2 = pCoeffs + ( i - 1U );
+
+            /* Loop unrolling.  Process 4 taps at a time. */
+            tapCnt = phaseLen >> 2U;
+
+            while( tapCnt > 0U )
+            {
+                sum += ( q63_t ) *ptr1++ * *ptr2;
+                ptr2 += L;
+                sum += ( q63_t ) *ptr1++ * *ptr2;
+                ptr2 += L;
+                sum += ( q63_t ) *ptr1++ * *ptr2;
+                ptr2 += L;
+                sum += ( q63_t ) *ptr1++ * *ptr2;
+                ptr2 += L;
+
+                tapCnt--;
+            }
+
+            /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+            tapCnt = phaseLen & 0x3U;
+
+            while( tapCnt > 0U )
+            {
+                sum += ( q63_t ) *ptr1++ * *ptr2;
+                ptr2 += L;
+
+                tapCnt--;
+            }
+
+            /* Convert the result to 1.31 format and store it in the destination buffer */
+            *pDst++ = ( q31_t ) ( sum >> 31 );
+
+            /* Decrement the loop counter */
+            i--;
+        }
+
+        /* Advance the state pointer by 1
+         * to process the next group of interpolation factor number samples */
+        pState = pState + 1;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Processing is complete.
+     ** Only the position of the oldest sample needed by the next call is updated. */
+    blkCnt = S->stateIndex + blockSize;
+
+    if( blkCnt >= stateLength )
+    {
+        blkCnt -= stateLength;
+    }
+
+    S->stateIndex = blkCnt;
+}
+
+/**
+ * @} end of FIR_Interpolate group
+ */
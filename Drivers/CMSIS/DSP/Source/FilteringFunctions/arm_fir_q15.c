@@ -60,6 +60,12 @@
  * Lastly, the accumulator is saturated to yield a result in 1.15 format.
  *
  * \par
+ * On Cortex-M0 the function first checks the sum of the absolute values of the coefficients.
+ * When it does not exceed 0xFFFF the accumulation cannot overflow 32 bits, and the filter is computed
+ * with 32-bit accumulators, four outputs at a time, with the same results as the 64-bit accumulator.
+ * Otherwise the 64-bit accumulator is used.
+ *
+ * \par
  * Refer to the function <code>arm_fir_fast_q15()</code> for a faster but less precise implementation of this function.
  */
 
@@ -597,12 +603,12 @@ void arm_fir_q15(
     q15_t *pState = S->pState;                     /* State pointer */
     q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
     q15_t *pStateCurnt;                            /* Points to the current sample of the state */
-
-
-
     q15_t *px;                                     /* Temporary pointer for state buffer */
     q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
     q63_t acc;                                     /* Accumulator */
+    q31_t acc0, acc1, acc2, acc3;                  /* 32-bit accumulators */
+    q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+    uint32_t coeffSum = 0U;                        /* Sum of the absolute values of the coefficients */
     uint32_t numTaps = S->numTaps;                 /* Number of nTaps in the filter */
     uint32_t tapCnt, blkCnt;                       /* Loop counters */
 
@@ -610,42 +616,209 @@ void arm_fir_q15(
     /* pStateCurnt points to the location where the new input data should be written */
     pStateCurnt = &( S->pState[( numTaps - 1U )] );
 
-    /* Initialize blkCnt with blockSize */
-    blkCnt = blockSize;
+    /* |acc| <= sum(|b[k]|) * 32768, so when the sum of the absolute values of the
+     ** coefficients does not exceed 0xFFFF the accumulation cannot leave the 32-bit range
+     ** and the 32-bit accumulators give exactly the result of the 64-bit accumulator. */
+    pb = pCoeffs;
+    tapCnt = numTaps;
 
-    while( blkCnt > 0U )
+    do
     {
-        /* Copy one sample at a time into state buffer */
-        *pStateCurnt++ = *pSrc++;
+        c0 = *pb++;
+        coeffSum += ( uint32_t ) ( ( c0 < 0 ) ? -c0 : c0 );
+        tapCnt--;
+    } while( tapCnt > 0U );
 
-        /* Set the accumulator to zero */
-        acc = 0;
+    if( coeffSum <= 0xFFFFU )
+    {
+        /* Compute 4 outputs at a time, each coefficient read is used for 4 outputs */
+        blkCnt = blockSize >> 2U;
 
-        /* Initialize state pointer */
-        px = pState;
+        while( blkCnt > 0U )
+        {
+            /* Copy four new input samples into the state buffer */
+            *pStateCurnt++ = *pSrc++;
+            *pStateCurnt++ = *pSrc++;
+            *pStateCurnt++ = *pSrc++;
+            *pStateCurnt++ = *pSrc++;
+
+            /* Set all accumulators to zero */
+            acc0 = 0;
+            acc1 = 0;
+            acc2 = 0;
+            acc3 = 0;
+
+            /* Initialize state pointer */
+            px = pState;
+
+            /* Initialize Coefficient pointer */
+            pb = pCoeffs;
+
+            /* Read the first three samples of the state window */
+            x0 = *px++;
+            x1 = *px++;
+            x2 = *px++;
+
+            /* Loop unrolling.  Process 4 taps at a time. */
+            tapCnt = numTaps >> 2U;
+
+            while( tapCnt > 0U )
+            {
+                /* acc0 += b[k] * x[n-k], acc1 += b[k] * x[n-k+1], ... */
+                c0 = *pb++;
+                x3 = *px++;
+                acc0 += x0 * c0;
+                acc1 += x1 * c0;
+                acc2 += x2 * c0;
+                acc3 += x3 * c0;
+
+                c0 = *pb++;
+                x0 = *px++;
+                acc0 += x1 * c0;
+                acc1 += x2 * c0;
+                acc2 += x3 * c0;
+                acc3 += x0 * c0;
+
+                c0 = *pb++;
+                x1 = *px++;
+                acc0 += x2 * c0;
+                acc1 += x3 * c0;
+                acc2 += x0 * c0;
+                acc3 += x1 * c0;
+
+                c0 = *pb++;
+                x2 = *px++;
+                acc0 += x3 * c0;
+                acc1 += x0 * c0;
+                acc2 += x1 * c0;
+                acc3 += x2 * c0;
+
+                tapCnt--;
+            }
+
+            /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+            tapCnt = numTaps & 0x3U;
+
+            while( tapCnt > 0U )
+            {
+                c0 = *pb++;
+                x3 = *px++;
+                acc0 += x0 * c0;
+                acc1 += x1 * c0;
+                acc2 += x2 * c0;
+                acc3 += x3 * c0;
+
+                /* Slide the state window by one sample */
+                x0 = x1;
+                x1 = x2;
+                x2 = x3;
+
+                tapCnt--;
+            }
+
+            /* The results are in 2.30 format.  Convert to 1.15
+             ** Then store the 4 outputs in the destination buffer. */
+            *pDst++ = ( q15_t ) __SSAT( ( acc0 >> 15 ), 16 );
+            *pDst++ = ( q15_t ) __SSAT( ( acc1 >> 15 ), 16 );
+            *pDst++ = ( q15_t ) __SSAT( ( acc2 >> 15 ), 16 );
+            *pDst++ = ( q15_t ) __SSAT( ( acc3 >> 15 ), 16 );
+
+            /* Advance state pointer by 4 for the next 4 samples */
+            pState = pState + 4;
+
+            /* Decrement the samples loop counter */
+            blkCnt--;
+        }
 
-        /* Initialize Coefficient pointer */
-        pb = pCoeffs;
+        /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+        blkCnt = blockSize & 0x3U;
 
-        tapCnt = numTaps;
+        while( blkCnt > 0U )
+        {
+            /* Copy one sample at a time into state buffer */
+            *pStateCurnt++ = *pSrc++;
 
-        /* Perform the multiply-accumulates */
-        do
+            /* Set the accumulator to zero */
+            acc0 = 0;
+
+            /* Initialize state pointer */
+            px = pState;
+
+            /* Initialize Coefficient pointer */
+            pb = pCoeffs;
+
+            /* Loop unrolling.  Process 4 taps at a time. */
+            tapCnt = numTaps >> 2U;
+
+            while( tapCnt > 0U )
+            {
+                acc0 += ( q31_t ) * px++ * *pb++;
+                acc0 += ( q31_t ) * px++ * *pb++;
+                acc0 += ( q31_t ) * px++ * *pb++;
+                acc0 += ( q31_t ) * px++ * *pb++;
+
+                tapCnt--;
+            }
+
+            tapCnt = numTaps & 0x3U;
+
+            while( tapCnt > 0U )
+            {
+                acc0 += ( q31_t ) * px++ * *pb++;
+
+                tapCnt--;
+            }
+
+            /* The result is in 2.30 format.  Convert to 1.15
+             ** Then store the output in the destination buffer. */
+            *pDst++ = ( q15_t ) __SSAT( ( acc0 >> 15 ), 16 );
+
+            /* Advance state pointer by 1 for the next sample */
+            pState = pState + 1;
+
+            /* Decrement the samples loop counter */
+            blkCnt--;
+        }
+    }
+    else
+    {
+        /* Not enough headroom for a 32-bit accumulator, use the 64-bit one */
+        blkCnt = blockSize;
+
+        while( blkCnt > 0U )
         {
-            /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
-            acc += ( q31_t ) * px++ * *pb++;
-            tapCnt--;
-        } while( tapCnt > 0U );
+            /* Copy one sample at a time into state buffer */
+            *pStateCurnt++ = *pSrc++;
 
-        /* The result is in 2.30 format.  Convert to 1.15
-         ** Then store the output in the destination buffer. */
-        *pDst++ = ( q15_t ) __SSAT( ( acc >> 15U ), 16 );
+            /* Set the accumulator to zero */
+            acc = 0;
 
-        /* Advance state pointer by 1 for the next sample */
-        pState = pState + 1;
+            /* Initialize state pointer */
+            px = pState;
 
-        /* Decrement the samples loop counter */
-        blkCnt--;
+            /* Initialize Coefficient pointer */
+            pb = pCoeffs;
+
+            tapCnt = numTaps;
+
+            /* Perform the multiply-accumulates */
+            do
+            {
+                /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+                acc += ( q31_t ) * px++ * *pb++;
+                tapCnt--;
+            } while( tapCnt > 0U );
+
+            /* The result is in 2.30 format.  Convert to 1.15
+             ** Then store the output in the destination buffer. */
+            *pDst++ = ( q15_t ) __SSAT( ( acc >> 15U ), 16 );
+
+            /* Advance state pointer by 1 for the next sample */
+            pState = pState + 1;
+
+            /* Decrement the samples loop counter */
+            blkCnt--;
+        }
     }
 
     /* Processing is complete.
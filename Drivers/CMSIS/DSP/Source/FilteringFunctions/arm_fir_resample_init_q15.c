@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_q15.c
+ * Description:  Q15 FIR rational resampler initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FIR rational resampler.
+ * @param[in,out] *S        points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     L         upsample factor.
+ * @param[in]     M         decimation factor.
+ * @param[in]     numTaps   number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+ * @param[in]     *pState   points to the state buffer.
+ * @param[in]     blockSize maximum number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>L</code> or <code>M</code> is zero, or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is
+ * zero or not a multiple of the interpolation factor <code>L</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * The length of the filter <code>numTaps</code> must be a non zero multiple of the interpolation factor <code>L</code>.
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>(numTaps/L)+blockSize-1</code> words
+ * where <code>blockSize</code> is the maximum number of input samples processed by each call to <code>arm_fir_resample_q15()</code>.
+ */
+
+arm_status arm_fir_resample_init_q15(
+    arm_fir_resample_instance_q15 *S,
+    uint16_t L,
+    uint16_t M,
+    uint16_t numTaps,
+    q15_t *pCoeffs,
+    q15_t *pState,
+    uint32_t blockSize )
+{
+    arm_status status;
+
+    if( ( L == 0U ) || ( M == 0U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    /* The filter length must be a non zero multiple of the interpolation factor */
+    else if( ( numTaps == 0U ) || ( ( numTaps % L ) != 0U ) )
+    {
+        /* Set status as ARM_MATH_LENGTH_ERROR */
+        status = ARM_MATH_LENGTH_ERROR;
+    }
+    else
+    {
+        /* Assign coefficient pointer */
+        S->pCoeffs = pCoeffs;
+
+        /* Assign the resampling ratio */
+        S->L = L;
+        S->M = M;
+
+        /* Each output moves M/L input samples forward */
+        S->stepInt = M / L;
+        S->stepFrac = M % L;
+
+        /* Assign polyPhaseLength */
+        S->phaseLength = numTaps / L;
+
+        /* The first output is computed from the first input sample with phase 0 */
+        S->phase = 0U;
+        S->inputOffset = 0U;
+
+        /* Clear state buffer and size of buffer is always phaseLength + blockSize - 1 */
+        memset( pState, 0,
+                ( blockSize + ( ( uint32_t ) S->phaseLength - 1U ) ) * sizeof( q15_t ) );
+
+        /* Assign state pointer */
+        S->pState = pState;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
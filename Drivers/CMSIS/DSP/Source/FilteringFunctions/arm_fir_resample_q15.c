@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 FIR rational resampler processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by a rational factor <code>L/M</code>. Conceptually the
+ * input is upsampled by <code>L</code> (<code>L-1</code> zeros inserted between samples), filtered by an FIR
+ * lowpass filter and downsampled by <code>M</code> (only every <code>M</code>-th sample kept):
+ * <pre>
+ *    y[m] = sum(b[k] * u[m*M - k], k = 0..numTaps-1)
+ * </pre>
+ * where <code>u</code> is the upsampled input. Chaining <code>arm_fir_interpolate</code> and
+ * <code>arm_fir_decimate</code> computes this with <code>M*numTaps/L</code> multiply-accumulates per output,
+ * most of them for samples that the decimator throws away. The resampler instead computes each retained output
+ * directly from its polyphase component: output <code>m</code> uses the input sample <code>n = floor(m*M/L)</code>
+ * and the phase <code>p = (m*M) mod L</code>,
+ * <pre>
+ *    y[m] = sum(b[p + j*L] * x[n - j], j = 0..phaseLength-1)
+ * </pre>
+ * which costs <code>phaseLength = numTaps/L</code> multiply-accumulates per output whatever the ratio.
+ *
+ * The phase and the position of the next output are kept in the instance between calls, so the input can be
+ * streamed in blocks of any size up to the one given at initialization. A block of <code>blockSize</code> input
+ * samples produces at most <code>ceil(blockSize*L/M)</code> outputs, and the processing functions return the
+ * number of outputs written.
+ *
+ * The filter is designed at the upsampled rate <code>L*Fs</code> with a cutoff of <code>min(Fs/2, L*Fs/(2*M))</code>
+ * and a passband gain of <code>L</code>, like the filter of the FIR interpolator. For fixed-point data the gain of
+ * <code>L</code> is split between the coefficients and the input scaling. The length of the filter must be a
+ * multiple of <code>L</code>.
+ *
+ * \par Instance Structure
+ * The ratio, the phase and position of the next output, and the coefficient and state pointers are stored in an
+ * instance data structure. A separate instance structure must be defined for each filter.
+ *
+ * \par Initialization Functions
+ * The initialization function checks the ratio and the filter length, precomputes the integer and fractional
+ * input steps <code>M/L</code> and <code>M%L</code> so that no division is needed per output, and clears the
+ * state. The coefficients are stored in time reversed order, as for the FIR interpolator.
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point functions accumulate in 64 bits and scale the result as the corresponding FIR interpolator.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR rational resampler.
+ * @param[in,out] *S        points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, of at least <code>ceil(blockSize*L/M)</code> samples.
+ * @param[in]     blockSize number of input samples to process, at most the block size given at initialization.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+    arm_fir_resample_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;                     /* State pointer */
+    q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+    q15_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+    q63_t sum;                                     /* Accumulator */
+    uint32_t n = S->inputOffset;                   /* Input sample of the next output */
+    uint32_t p = S->phase;                         /* Polyphase component of the next output */
+    uint32_t L = S->L;                             /* Upsample factor */
+    uint32_t outCnt = 0U;                          /* Number of outputs */
+    uint32_t i;                                    /* Loop counter */
+    uint16_t phaseLen = S->phaseLength, tapCnt;    /* Length of each polyphase filter component */
+
+    /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = S->pState + ( phaseLen - 1U );
+
+    /* Copy the new input samples into the state buffer */
+    i = blockSize;
+
+    while( i > 0U )
+    {
+        *pStateCurnt++ = *pSrc++;
+
+        /* Decrement the loop counter */
+        i--;
+    }
+
+    /* Compute only the outputs that fall in this block, each from one polyphase component */
+    while( n < blockSize )
+    {
+        /* Set accumulator to zero */
+        sum = 0;
+
+        /* The last phaseLen samples up to input sample n */
+        ptr1 = pState + n;
+
+        /* Coefficients b[p], b[p + L], ... in time reversed order */
+        ptr2 = pCoeffs + ( L - 1U - p );
+
+        /* Loop unrolling.  Compute 4 taps at a time. */
+        tapCnt = phaseLen >> 2U;
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulates */
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+        tapCnt = phaseLen % 0x4U;
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulate */
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* The result is in the accumulator, store in the destination buffer. */
+        *pDst++ = ( q15_t )( __SSAT( ( sum >> 15 ), 16 ) );
+        outCnt++;
+
+        /* Advance by M/L input samples: M/L whole samples and M%L phases */
+        p += S->stepFrac;
+        n += S->stepInt;
+
+        if( p >= L )
+        {
+            p -= L;
+            n++;
+        }
+    }
+
+    /* Position of the next output relative to the next block */
+    S->inputOffset = n - blockSize;
+    S->phase = ( uint16_t ) p;
+
+    /* Processing is complete.
+     ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+     ** This prepares the state buffer for the next function call. */
+
+    /* Points to the start of the state buffer */
+    pStateCurnt = S->pState;
+    pState = S->pState + blockSize;
+
+    tapCnt = phaseLen - 1U;
+
+    /* copy data */
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    return ( outCnt );
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
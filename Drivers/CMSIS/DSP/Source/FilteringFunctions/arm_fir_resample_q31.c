@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 FIR rational resampler processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR rational resampler.
+ * @param[in,out] *S        points to an instance of the Q31 FIR resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, of at least <code>ceil(blockSize*L/M)</code> samples.
+ * @param[in]     blockSize number of input samples to process, at most the block size given at initialization.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>
+ * since <code>numTaps/L</code> additions occur per output sample.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is shifted right by 31 bits and truncated to 1.31 format.
+ */
+
+uint32_t arm_fir_resample_q31(
+    arm_fir_resample_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;                     /* State pointer */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+    q31_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+    q63_t sum;                                     /* Accumulator */
+    uint32_t n = S->inputOffset;                   /* Input sample of the next output */
+    uint32_t p = S->phase;                         /* Polyphase component of the next output */
+    uint32_t L = S->L;                             /* Upsample factor */
+    uint32_t outCnt = 0U;                          /* Number of outputs */
+    uint32_t i;                                    /* Loop counter */
+    uint16_t phaseLen = S->phaseLength, tapCnt;    /* Length of each polyphase filter component */
+
+    /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+    /* pStateCurnt points to the location where the new input data should be written */
+    pStateCurnt = S->pState + ( phaseLen - 1U );
+
+    /* Copy the new input samples into the state buffer */
+    i = blockSize;
+
+    while( i > 0U )
+    {
+        *pStateCurnt++ = *pSrc++;
+
+        /* Decrement the loop counter */
+        i--;
+    }
+
+    /* Compute only the outputs that fall in this block, each from one polyphase component */
+    while( n < blockSize )
+    {
+        /* Set accumulator to zero */
+        sum = 0;
+
+        /* The last phaseLen samples up to input sample n */
+        ptr1 = pState + n;
+
+        /* Coefficients b[p], b[p + L], ... in time reversed order */
+        ptr2 = pCoeffs + ( L - 1U - p );
+
+        /* Loop unrolling.  Compute 4 taps at a time. */
+        tapCnt = phaseLen >> 2U;
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulates */
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+        tapCnt = phaseLen % 0x4U;
+
+        while( tapCnt > 0U )
+        {
+            /* Perform the multiply-accumulate */
+            sum += ( q63_t ) *ptr1++ * *ptr2;
+            ptr2 += L;
+
+            /* Decrement the loop counter */
+            tapCnt--;
+        }
+
+        /* The result is in the accumulator, store in the destination buffer. */
+        *pDst++ = ( q31_t )( sum >> 31 );
+        outCnt++;
+
+        /* Advance by M/L input samples: M/L whole samples and M%L phases */
+        p += S->stepFrac;
+        n += S->stepInt;
+
+        if( p >= L )
+        {
+            p -= L;
+            n++;
+        }
+    }
+
+    /* Position of the next output relative to the next block */
+    S->inputOffset = n - blockSize;
+    S->phase = ( uint16_t ) p;
+
+    /* Processing is complete.
+     ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+     ** This prepares the state buffer for the next function call. */
+
+    /* Points to the start of the state buffer */
+    pStateCurnt = S->pState;
+    pState = S->pState + blockSize;
+
+    tapCnt = phaseLen - 1U;
+
+    /* copy data */
+    while( tapCnt > 0U )
+    {
+        *pStateCurnt++ = *pState++;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+    }
+
+    return ( outCnt );
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
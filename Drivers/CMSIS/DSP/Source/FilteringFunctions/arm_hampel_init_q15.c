@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hampel_init_q15.c
+ * Description:  Initialization function for the Q15 Hampel filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Hampel Hampel Filter
+ *
+ * Outlier filter for sensor streams: a sample is replaced by the median of
+ * the window centered on it when it is too far from that median, and is
+ * output unchanged otherwise. Unlike the median filter, the Hampel filter
+ * keeps the details of the signal, and only removes the spikes. With
+ * <code>xc = x[n-(windowSize-1)/2]</code>, the center of the last
+ * <code>windowSize</code> input samples:
+ * <pre>
+ *     m    = median(x[n-windowSize+1], ..., x[n])
+ *     MAD  = median(|x[n-windowSize+1] - m|, ..., |x[n] - m|)
+ *     y[n] = xc    if |xc - m| <= t * MAD
+ *            m     otherwise
+ * </pre>
+ * The output is delayed by <code>(windowSize - 1) / 2</code> samples with
+ * respect to the input.
+ *
+ * \par Threshold
+ * The threshold is <code>t = thresholdFract * 2^shift</code>, in units of
+ * median absolute deviation. 1.4826 * MAD estimates the standard deviation of
+ * a Gaussian noise, so that the usual three sigma rule is
+ * <code>t = 3 * 1.4826 = 0.55598 * 2^3</code>: thresholdFract = 0x472A
+ * (Q15) or 0x472A3055 (Q31) with shift = 3. A threshold of 0 gives the
+ * running median.
+ *
+ * \par Algorithm
+ * The median absolute deviation needs the order of the window, which the
+ * heaps of the running median do not give: the Hampel filter keeps a sorted
+ * copy of the window instead. A new sample replaces the oldest one by two
+ * binary searches and a move of the samples between them. The median is the
+ * center of the sorted window, and the deviations below and above it are two
+ * increasing sequences, so that their median is found by bisection. Besides
+ * the move, the update costs O(log windowSize). The state and the sorted
+ * window are cleared at initialization, as for the running median.
+ */
+
+/**
+ * @addtogroup Hampel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Hampel filter.
+ * @param[out] *S               points to an instance of the Q15 Hampel structure.
+ * @param[in]  windowSize       number of samples in the window, odd.
+ * @param[in]  thresholdFract   fractional part of the threshold.
+ * @param[in]  shift            number of bits to shift the threshold, 0 to 15.
+ * @param[out] *pState          points to the state buffer, windowSize samples.
+ * @param[out] *pSorted         points to the sorted window buffer, windowSize samples.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowSize</code> is even, or if the threshold is negative or
+ * <code>shift</code> out of range.
+ */
+
+arm_status arm_hampel_init_q15(
+    arm_hampel_instance_q15 *S,
+    uint16_t windowSize,
+    q15_t thresholdFract,
+    int8_t shift,
+    q15_t *pState,
+    q15_t *pSorted )
+{
+    if( ( ( windowSize & 1U ) == 0U ) || ( thresholdFract < 0 ) ||
+            ( shift < 0 ) || ( shift > 15 ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    S->windowSize = windowSize;
+    S->index = 0U;
+    S->thresholdFract = thresholdFract;
+    S->shift = shift;
+    S->pState = pState;
+    S->pSorted = pSorted;
+
+    /* Clear the state and the sorted window */
+    memset( pState, 0, windowSize * sizeof( q15_t ) );
+    memset( pSorted, 0, windowSize * sizeof( q15_t ) );
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Hampel group
+ */
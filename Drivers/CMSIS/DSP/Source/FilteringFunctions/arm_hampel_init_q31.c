@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hampel_init_q31.c
+ * Description:  Initialization function for the Q31 Hampel filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hampel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Hampel filter.
+ * @param[out] *S               points to an instance of the Q31 Hampel structure.
+ * @param[in]  windowSize       number of samples in the window, odd.
+ * @param[in]  thresholdFract   fractional part of the threshold.
+ * @param[in]  shift            number of bits to shift the threshold, 0 to 31.
+ * @param[out] *pState          points to the state buffer, windowSize samples.
+ * @param[out] *pSorted         points to the sorted window buffer, windowSize samples.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowSize</code> is even, or if the threshold is negative or
+ * <code>shift</code> out of range.
+ */
+
+arm_status arm_hampel_init_q31(
+    arm_hampel_instance_q31 *S,
+    uint16_t windowSize,
+    q31_t thresholdFract,
+    int8_t shift,
+    q31_t *pState,
+    q31_t *pSorted )
+{
+    if( ( ( windowSize & 1U ) == 0U ) || ( thresholdFract < 0 ) ||
+            ( shift < 0 ) || ( shift > 31 ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    S->windowSize = windowSize;
+    S->index = 0U;
+    S->thresholdFract = thresholdFract;
+    S->shift = shift;
+    S->pState = pState;
+    S->pSorted = pSorted;
+
+    /* Clear the state and the sorted window */
+    memset( pState, 0, windowSize * sizeof( q31_t ) );
+    memset( pSorted, 0, windowSize * sizeof( q31_t ) );
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Hampel group
+ */
@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_hampel_q31.c
+ * Description:  Q31 Hampel filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hampel
+ * @{
+ */
+
+/**
+ * @brief Index of the first of the samples pSorted[lo ... hi-1] at or above val, or hi.
+ */
+CMSIS_INLINE __STATIC_INLINE uint32_t arm_hampel_search_q31(
+    const q31_t *pSorted,
+    uint32_t lo,
+    uint32_t hi,
+    q63_t val )
+{
+    uint32_t mid;
+
+    while( lo < hi )
+    {
+        mid = ( lo + hi ) / 2U;
+
+        if( pSorted[mid] < val )
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return ( lo );
+}
+
+/**
+ * @brief Median absolute deviation of the sorted window, around its median pSorted[half].
+ *
+ * The deviations below the median, <code>L[k] = med - pSorted[half-1-k]</code>,
+ * and above it, <code>R[k] = pSorted[half+1+k] - med</code>, are both
+ * increasing. With the deviation 0 of the median, the median absolute
+ * deviation is the largest of the half smallest values of L and R: i values
+ * of L and half-i of R, i being found by bisection.
+ */
+CMSIS_INLINE __STATIC_INLINE q63_t arm_hampel_mad_q31(
+    const q31_t *pSorted,
+    uint32_t half )
+{
+    q63_t med = pSorted[half];
+    uint32_t lo = 0U;
+    uint32_t hi = half;
+    uint32_t i;
+    q63_t devL, devR;
+
+    /* Smallest i for which L[i] >= R[half-i-1] */
+    while( lo < hi )
+    {
+        i = ( lo + hi ) / 2U;
+
+        if( ( med - pSorted[half - 1U - i] ) < ( pSorted[2U * half - i] - med ) )
+        {
+            lo = i + 1U;
+        }
+        else
+        {
+            hi = i;
+        }
+    }
+
+    /* Largest of L[lo-1] and R[half-lo-1] */
+    devL = ( lo > 0U ) ? med - pSorted[half - lo] : 0;
+    devR = ( lo < half ) ? pSorted[2U * half - lo] - med : 0;
+
+    return ( ( devL > devR ) ? devL : devR );
+}
+
+/**
+ * @brief Processing function for the Q31 Hampel filter.
+ * @param[in,out] *S         points to an instance of the Q31 Hampel structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each new sample replaces the oldest one in the sorted window, and outputs
+ * the center sample of the window or the median. <code>pDst</code> may be the
+ * same as <code>pSrc</code>.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The outputs are input samples or medians, so that there is no overflow. The
+ * deviations from the median are computed in 64 bits, and the median absolute
+ * deviation is saturated to Q31.
+ */
+
+void arm_hampel_q31(
+    arm_hampel_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;
+    q31_t *pSorted = S->pSorted;
+    uint32_t windowSize = S->windowSize;
+    uint32_t half = windowSize / 2U;
+    uint32_t index = S->index;
+    uint32_t center;
+    uint32_t pos, ins;
+    q31_t in, old, med;
+    q63_t mad, diff, limit;
+
+    while( blockSize > 0U )
+    {
+        in = *pSrc++;
+        old = pState[index];
+        pState[index] = in;
+        index = ( index + 1U == windowSize ) ? 0U : index + 1U;
+
+        /* Replace the oldest sample by the new one, moving the samples between them */
+        pos = arm_hampel_search_q31( pSorted, 0U, windowSize, old );
+
+        if( in > old )
+        {
+            ins = arm_hampel_search_q31( pSorted, pos + 1U, windowSize, in ) - 1U;
+            memmove( pSorted + pos, pSorted + pos + 1U, ( ins - pos ) * sizeof( q31_t ) );
+        }
+        else
+        {
+            ins = arm_hampel_search_q31( pSorted, 0U, pos, ( q63_t ) in + 1 );
+            memmove( pSorted + ins + 1U, pSorted + ins, ( pos - ins ) * sizeof( q31_t ) );
+        }
+
+        pSorted[ins] = in;
+
+        med = pSorted[half];
+        mad = arm_hampel_mad_q31( pSorted, half );
+        mad = ( mad > 0x7FFFFFFF ) ? 0x7FFFFFFF : mad;
+        limit = ( mad * S->thresholdFract ) >> ( 31 - S->shift );
+
+        /* The index points to the oldest sample, the center is half samples later */
+        center = index + half;
+        center = ( center >= windowSize ) ? center - windowSize : center;
+
+        diff = ( q63_t ) pState[center] - med;
+        diff = ( diff < 0 ) ? -diff : diff;
+
+        *pDst++ = ( diff > limit ) ? med : pState[center];
+        blockSize--;
+    }
+
+    S->index = ( uint16_t ) index;
+}
+
+/**
+ * @} end of Hampel group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_init_q15.c
+ * Description:  Initialization function for the Q15 running median filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Median Running Median Filter
+ *
+ * Streaming median of the last <code>windowSize</code> input samples, for
+ * removing impulsive noise from sensor data. Sorting the window for each
+ * sample costs O(windowSize log windowSize); the running median updates an
+ * ordered structure in O(log windowSize) per sample:
+ * <pre>
+ *     y[n] = median(x[n-windowSize+1], ..., x[n])
+ * </pre>
+ * The window size is odd, so that the median is one of the samples. The output
+ * is delayed by <code>(windowSize - 1) / 2</code> samples with respect to the
+ * input.
+ *
+ * \par Algorithm
+ * The window is split in two heaps around the median: a max-heap of the
+ * <code>(windowSize - 1) / 2</code> smaller samples and a min-heap of the
+ * larger ones. The heaps are stored in a single array of
+ * <code>windowSize</code> sample indexes, centered on the median: the
+ * max-heap at negative positions, the min-heap at positive ones, and the
+ * children of position <code>i</code> at <code>2*i</code> and
+ * <code>2*i + 1</code>, or <code>2*i - 1</code> when <code>i</code> is
+ * negative. A second array gives the position of each sample of the state.
+ * A new sample replaces the oldest one in the state and takes its position
+ * in the heaps, then it is moved up or down its heap, and through the median
+ * to the other heap if needed, in at most log2(windowSize) exchanges.
+ *
+ * \par
+ * The state and the heaps are in buffers given at initialization, and no
+ * memory is allocated. As for the FIR filters, the state is cleared at
+ * initialization, so that the first outputs are the median of a window
+ * padded with zeros.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 running median filter.
+ * @param[out] *S           points to an instance of the Q15 running median structure.
+ * @param[in]  windowSize   number of samples in the window, odd, 1 to 32767.
+ * @param[out] *pState      points to the state buffer, windowSize samples.
+ * @param[out] *pHeap       points to the heap buffer, 2*windowSize values.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowSize</code> is even or above 32767.
+ */
+
+arm_status arm_median_init_q15(
+    arm_median_instance_q15 *S,
+    uint16_t windowSize,
+    q15_t *pState,
+    int16_t *pHeap )
+{
+    int32_t half = ( int32_t ) windowSize / 2;
+    uint32_t i;
+
+    if( ( ( windowSize & 1U ) == 0U ) || ( windowSize > 0x7FFFU ) )
+    {
+        return ( ARM_MATH_ARGUMENT_ERROR );
+    }
+
+    S->windowSize = windowSize;
+    S->index = 0U;
+    S->pState = pState;
+    S->pHeap = pHeap;
+
+    /* Clear the state */
+    memset( pState, 0, windowSize * sizeof( q15_t ) );
+
+    /* The samples are all equal, so that any order is valid */
+    for( i = 0U; i < windowSize; i++ )
+    {
+        pHeap[i] = ( int16_t ) ( ( int32_t ) i - half );
+        pHeap[windowSize + i] = ( int16_t ) i;
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @} end of Median group
+ */
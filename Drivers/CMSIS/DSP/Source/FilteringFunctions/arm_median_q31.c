@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_q31.c
+ * Description:  Q31 running median filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Exchanges the samples at positions i and j of the heaps if the sample at i is the smaller.
+ * @return 1 if the samples were exchanged, 0 otherwise.
+ */
+CMSIS_INLINE __STATIC_INLINE uint32_t arm_median_exchange_q31(
+    const q31_t *pState,
+    int16_t *pPos,
+    int16_t *pHeap,
+    int32_t i,
+    int32_t j )
+{
+    int16_t a = pHeap[i];
+    int16_t b = pHeap[j];
+
+    if( pState[a] >= pState[b] )
+    {
+        return ( 0U );
+    }
+
+    pHeap[i] = b;
+    pHeap[j] = a;
+    pPos[b] = ( int16_t ) i;
+    pPos[a] = ( int16_t ) j;
+
+    return ( 1U );
+}
+
+/**
+ * @brief Moves the sample at position i > 0 down the min-heap.
+ */
+static void arm_median_min_down_q31(
+    const q31_t *pState,
+    int16_t *pPos,
+    int16_t *pHeap,
+    int32_t i,
+    int32_t half )
+{
+    for( i *= 2; i <= half; i *= 2 )
+    {
+        /* Smaller child */
+        if( ( i < half ) && ( pState[pHeap[i + 1]] < pState[pHeap[i]] ) )
+        {
+            i++;
+        }
+
+        if( arm_median_exchange_q31( pState, pPos, pHeap, i, i / 2 ) == 0U )
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Moves the sample at position i < 0 down the max-heap.
+ */
+static void arm_median_max_down_q31(
+    const q31_t *pState,
+    int16_t *pPos,
+    int16_t *pHeap,
+    int32_t i,
+    int32_t half )
+{
+    for( i *= 2; i >= -half; i *= 2 )
+    {
+        /* Larger child */
+        if( ( i > -half ) && ( pState[pHeap[i]] < pState[pHeap[i - 1]] ) )
+        {
+            i--;
+        }
+
+        if( arm_median_exchange_q31( pState, pPos, pHeap, i / 2, i ) == 0U )
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Processing function for the Q31 running median filter.
+ * @param[in,out] *S         points to an instance of the Q31 running median structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Each output is the median of the new sample and of the
+ * <code>windowSize - 1</code> previous ones, in O(log windowSize) operations.
+ * The outputs are input samples, so that there is no overflow.
+ * <code>pDst</code> may be the same as <code>pSrc</code>.
+ */
+
+void arm_median_q31(
+    arm_median_instance_q31 *S,
+    const q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;
+    uint32_t windowSize = S->windowSize;
+    uint32_t index = S->index;
+    int32_t half = ( int32_t ) windowSize / 2;
+    int16_t *pPos = S->pHeap;                                /* Position of each sample */
+    int16_t *pHeap = S->pHeap + windowSize + half;           /* Heaps, centered on the median */
+    q31_t in, old;
+    int32_t i;
+
+    while( blockSize > 0U )
+    {
+        /* The new sample replaces the oldest one, at its position in the heaps */
+        in = *pSrc++;
+        old = pState[index];
+        pState[index] = in;
+        i = pPos[index];
+        index = ( index + 1U == windowSize ) ? 0U : index + 1U;
+
+        if( i > 0 )
+        {
+            if( in > old )
+            {
+                arm_median_min_down_q31( pState, pPos, pHeap, i, half );
+            }
+            else
+            {
+                /* Up the min-heap, and through the median to the max-heap */
+                while( ( i > 0 ) && arm_median_exchange_q31( pState, pPos, pHeap, i, i / 2 ) )
+                {
+                    i /= 2;
+                }
+
+                if( ( i == 0 ) && arm_median_exchange_q31( pState, pPos, pHeap, 0, -1 ) )
+                {
+                    arm_median_max_down_q31( pState, pPos, pHeap, -1, half );
+                }
+            }
+        }
+        else if( i < 0 )
+        {
+            if( in < old )
+            {
+                arm_median_max_down_q31( pState, pPos, pHeap, i, half );
+            }
+            else
+            {
+                /* Up the max-heap, and through the median to the min-heap */
+                while( ( i < 0 ) && arm_median_exchange_q31( pState, pPos, pHeap, i / 2, i ) )
+                {
+                    i /= 2;
+                }
+
+                if( ( i == 0 ) && arm_median_exchange_q31( pState, pPos, pHeap, 1, 0 ) )
+                {
+                    arm_median_min_down_q31( pState, pPos, pHeap, 1, half );
+                }
+            }
+        }
+        else if( half > 0 )
+        {
+            /* The new sample replaces the median, and moves to at most one heap */
+            if( arm_median_exchange_q31( pState, pPos, pHeap, 0, -1 ) )
+            {
+                arm_median_max_down_q31( pState, pPos, pHeap, -1, half );
+            }
+            else if( arm_median_exchange_q31( pState, pPos, pHeap, 1, 0 ) )
+            {
+                arm_median_min_down_q31( pState, pPos, pHeap, 1, half );
+            }
+        }
+
+        *pDst++ = pState[pHeap[0]];
+        blockSize--;
+    }
+
+    S->index = ( uint16_t ) index;
+}
+
+/**
+ * @} end of Median group
+ */
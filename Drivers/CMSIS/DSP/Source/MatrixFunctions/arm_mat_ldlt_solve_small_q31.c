@@ -0,0 +1,244 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_solve_small_q31.c
+ * Description:  Q31 fixed-size symmetric positive definite solver
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SmallMatrix
+ * @{
+ */
+
+/**
+ * @brief Division by a pivot, x / d in the format of fracBits, with the
+ * reciprocal of the pivot as a 1.31 mantissa and a right shift.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_mat_ldlt_div_q31(
+    q31_t x,
+    q31_t recip,
+    uint32_t shift )
+{
+    q63_t prod = ( q63_t ) x * recip;
+
+    return clip_q63_to_q31( ( prod + ( ( ( q63_t ) 1 << shift ) >> 1 ) ) >> shift );
+}
+
+/**
+ * @brief Solution of A * X = B for a symmetric positive definite N x N
+ * matrix A, N at most 6, and B with numCols columns.
+ */
+CMSIS_INLINE __STATIC_INLINE arm_status arm_mat_ldlt_solve_nxn_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    q31_t L[6 * 6];                                /* Unit lower triangular factor, below the diagonal */
+    q31_t W[6];                                    /* Row of L * D being computed */
+    q31_t recip[6];                                /* Reciprocals of the pivots, 1.31 mantissa */
+    uint32_t shift[6];                             /* Shifts of the reciprocals */
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    q31_t d, dNorm;
+    uint32_t i, j, k, norm;
+    uint16_t c;
+
+    /*
+     * A = L * D * L' with W(i,j) = L(i,j) * d(j):
+     * W(i,j) = a(i,j) - sum over k < j of W(i,k) * L(j,k), L(i,j) = W(i,j) / d(j),
+     * d(i) = a(i,i) - sum over k < i of W(i,k) * L(i,k)
+     * The lower triangle of A is read.
+     */
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < i; j++ )
+        {
+            sum = ( ( q63_t ) pSrcA[i * n + j] << fracBits ) + round;
+
+            for( k = 0U; k < j; k++ )
+            {
+                sum -= ( q63_t ) W[k] * L[j * n + k];
+            }
+
+            W[j] = clip_q63_to_q31( sum >> fracBits );
+            L[i * n + j] = arm_mat_ldlt_div_q31( W[j], recip[j], shift[j] );
+        }
+
+        sum = ( ( q63_t ) pSrcA[i * n + i] << fracBits ) + round;
+
+        for( k = 0U; k < i; k++ )
+        {
+            sum -= ( q63_t ) W[k] * L[i * n + k];
+        }
+
+        d = clip_q63_to_q31( sum >> fracBits );
+
+        if( d <= 0 )
+        {
+            /* Not positive definite, or not enough precision left for the pivot */
+            return ( ARM_MATH_SINGULAR );
+        }
+
+        /*
+         * d = dNorm * 2^-norm with dNorm in [2^30 2^31), and
+         * x / d = x * (2^61 / dNorm) * 2^(fracBits + norm - 61) in the format
+         */
+        norm = ( uint32_t ) __CLZ( ( uint32_t ) d ) - 1U;
+        dNorm = d << norm;
+        recip[i] = clip_q63_to_q31( ( ( q63_t ) 1 << 61 ) / dNorm );
+        shift[i] = 61U - fracBits - norm;
+    }
+
+    /* Solve each column of B in place in pDst */
+    for( c = 0U; c < numCols; c++ )
+    {
+        /* L * z = b */
+        for( i = 0U; i < n; i++ )
+        {
+            sum = ( ( q63_t ) pSrcB[i * numCols + c] << fracBits ) + round;
+
+            for( k = 0U; k < i; k++ )
+            {
+                sum -= ( q63_t ) L[i * n + k] * pDst[k * numCols + c];
+            }
+
+            pDst[i * numCols + c] = clip_q63_to_q31( sum >> fracBits );
+        }
+
+        /* D * y = z */
+        for( i = 0U; i < n; i++ )
+        {
+            pDst[i * numCols + c] = arm_mat_ldlt_div_q31( pDst[i * numCols + c], recip[i], shift[i] );
+        }
+
+        /* L' * x = y */
+        for( i = n; i > 0U; i-- )
+        {
+            sum = ( ( q63_t ) pDst[( i - 1U ) * numCols + c] << fracBits ) + round;
+
+            for( k = i; k < n; k++ )
+            {
+                sum -= ( q63_t ) L[k * n + i - 1U] * pDst[k * numCols + c];
+            }
+
+            pDst[( i - 1U ) * numCols + c] = clip_q63_to_q31( sum >> fracBits );
+        }
+    }
+
+    return ( ARM_MATH_SUCCESS );
+}
+
+/**
+ * @brief Q31 3x3 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the 3x3 symmetric positive definite matrix A. Only its lower triangle is read.
+ * @param[in]  *pSrcB    points to the 3 x numCols matrix B.
+ * @param[out] *pDst     points to the 3 x numCols solution X of <code>A * X = B</code>.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or
+ * ARM_MATH_SUCCESS.
+ *
+ * \par
+ * A is factored as <code>L * D * L'</code>, with L unit lower triangular and
+ * D diagonal: unlike a Cholesky factorization, there is no square root. The
+ * factorization needs one division per row, and the solution one
+ * multiplication by the reciprocal of each pivot. ARM_MATH_SINGULAR is also
+ * returned when a pivot rounds to 0 in the format; the content of pDst is then
+ * undefined.
+ *
+ * \par
+ * <code>pDst</code> may be the same as <code>pSrcB</code>. Each row of B
+ * takes numCols consecutive values.
+ */
+
+arm_status arm_mat_ldlt_solve_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits )
+{
+    return arm_mat_ldlt_solve_nxn_q31( pSrcA, pSrcB, pDst, numCols, 3U, fracBits );
+}
+
+/**
+ * @brief Q31 4x4 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the 4x4 symmetric positive definite matrix A. Only its lower triangle is read.
+ * @param[in]  *pSrcB    points to the 4 x numCols matrix B.
+ * @param[out] *pDst     points to the 4 x numCols solution X of <code>A * X = B</code>.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or
+ * ARM_MATH_SUCCESS.
+ *
+ * \par
+ * See arm_mat_ldlt_solve_3x3_q31().
+ */
+
+arm_status arm_mat_ldlt_solve_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits )
+{
+    return arm_mat_ldlt_solve_nxn_q31( pSrcA, pSrcB, pDst, numCols, 4U, fracBits );
+}
+
+/**
+ * @brief Q31 6x6 symmetric positive definite solver.
+ * @param[in]  *pSrcA    points to the 6x6 symmetric positive definite matrix A. Only its lower triangle is read.
+ * @param[in]  *pSrcB    points to the 6 x numCols matrix B.
+ * @param[out] *pDst     points to the 6 x numCols solution X of <code>A * X = B</code>.
+ * @param[in]  numCols   number of columns of B and X.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return The function returns ARM_MATH_SINGULAR if A is not positive definite, or
+ * ARM_MATH_SUCCESS.
+ *
+ * \par
+ * See arm_mat_ldlt_solve_3x3_q31().
+ */
+
+arm_status arm_mat_ldlt_solve_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint16_t numCols,
+    uint32_t fracBits )
+{
+    return arm_mat_ldlt_solve_nxn_q31( pSrcA, pSrcB, pDst, numCols, 6U, fracBits );
+}
+
+/**
+ * @} end of SmallMatrix group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_q31.c
+ * Description:  Q31 fixed-size matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup SmallMatrix Fixed-Size Matrix Functions
+ *
+ * Q31 functions for the 3x3, 4x4 and 6x6 matrices of state estimation
+ * and sensor fusion.
+ *
+ * The matrices are arrays of <code>N*N</code> values in row order, without
+ * <code>arm_matrix_instance_q31</code>, and the size is part of the function
+ * name: there is no dimension check and the loops have constant bounds, so
+ * the compiler unrolls them.
+ *
+ * The values are fixed-point numbers with <code>fracBits</code> fractional
+ * bits, the same for all the operands of a call: 31 for the 1.31 format, 24
+ * for 8.24 and so on. The integer bits let covariance matrices and their
+ * products exceed 1.
+ *
+ * - arm_mat_mult_NxN_q31(): <code>A * B</code>
+ * - arm_mat_mult_trans_NxN_q31(): <code>A * B'</code>
+ * - arm_mat_sym_update_NxN_q31(): <code>A * P * A' + Q</code>, symmetric
+ * - arm_mat_ldlt_solve_NxN_q31(): solution of <code>A * X = B</code> for
+ *   a symmetric positive definite <code>A</code>
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in 64 bits and rounded to the nearest value
+ * of the format, with saturation. The accumulator has 63 - 2*fracBits guard
+ * bits above the integer bits of the result.
+ */
+
+/**
+ * @addtogroup SmallMatrix
+ * @{
+ */
+
+/**
+ * @brief Multiplication of two N x N matrices.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_mat_mult_nxn_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    uint32_t i, j, k;
+
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            /* c(i,j) = a(i,0) * b(0,j) + ... + a(i,n-1) * b(n-1,j) */
+            sum = round;
+
+            for( k = 0U; k < n; k++ )
+            {
+                sum += ( q63_t ) pSrcA[i * n + k] * pSrcB[k * n + j];
+            }
+
+            pDst[i * n + j] = clip_q63_to_q31( sum >> fracBits );
+        }
+    }
+}
+
+/**
+ * @brief Q31 3x3 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_nxn_q31( pSrcA, pSrcB, pDst, 3U, fracBits );
+}
+
+/**
+ * @brief Q31 4x4 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_nxn_q31( pSrcA, pSrcB, pDst, 4U, fracBits );
+}
+
+/**
+ * @brief Q31 6x6 matrix multiplication.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix.
+ * @param[out] *pDst     points to the output matrix, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_nxn_q31( pSrcA, pSrcB, pDst, 6U, fracBits );
+}
+
+/**
+ * @} end of SmallMatrix group
+ */
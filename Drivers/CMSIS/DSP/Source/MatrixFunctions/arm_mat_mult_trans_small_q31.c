@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_trans_small_q31.c
+ * Description:  Q31 fixed-size multiplication by a transposed matrix
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SmallMatrix
+ * @{
+ */
+
+/**
+ * @brief Multiplication of an N x N matrix by a transposed N x N matrix.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_mat_mult_trans_nxn_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    uint32_t i, j, k;
+
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            /* c(i,j) = a(i,0) * b(j,0) + ... + a(i,n-1) * b(j,n-1), both read along rows */
+            sum = round;
+
+            for( k = 0U; k < n; k++ )
+            {
+                sum += ( q63_t ) pSrcA[i * n + k] * pSrcB[j * n + k];
+            }
+
+            pDst[i * n + j] = clip_q63_to_q31( sum >> fracBits );
+        }
+    }
+}
+
+/**
+ * @brief Q31 3x3 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix <code>A * B'</code>, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_trans_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_trans_nxn_q31( pSrcA, pSrcB, pDst, 3U, fracBits );
+}
+
+/**
+ * @brief Q31 4x4 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix <code>A * B'</code>, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_trans_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_trans_nxn_q31( pSrcA, pSrcB, pDst, 4U, fracBits );
+}
+
+/**
+ * @brief Q31 6x6 multiplication by a transposed matrix.
+ * @param[in]  *pSrcA    points to the first input matrix.
+ * @param[in]  *pSrcB    points to the second input matrix, used transposed.
+ * @param[out] *pDst     points to the output matrix <code>A * B'</code>, distinct from the inputs.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ */
+
+void arm_mat_mult_trans_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcB,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_mult_trans_nxn_q31( pSrcA, pSrcB, pDst, 6U, fracBits );
+}
+
+/**
+ * @} end of SmallMatrix group
+ */
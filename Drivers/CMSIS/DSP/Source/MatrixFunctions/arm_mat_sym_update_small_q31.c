@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_sym_update_small_q31.c
+ * Description:  Q31 fixed-size symmetric update A * P * A' + Q
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SmallMatrix
+ * @{
+ */
+
+/**
+ * @brief Symmetric update of an N x N matrix, N at most 6.
+ */
+CMSIS_INLINE __STATIC_INLINE void arm_mat_sym_update_nxn_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t n,
+    uint32_t fracBits )
+{
+    q31_t AP[6 * 6];                               /* A * P */
+    q63_t round = ( ( q63_t ) 1 << fracBits ) >> 1;
+    q63_t sum;
+    q31_t out;
+    uint32_t i, j, k;
+
+    /* AP = A * P */
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = 0U; j < n; j++ )
+        {
+            sum = round;
+
+            for( k = 0U; k < n; k++ )
+            {
+                sum += ( q63_t ) pSrcA[i * n + k] * pSrcP[k * n + j];
+            }
+
+            AP[i * n + j] = clip_q63_to_q31( sum >> fracBits );
+        }
+    }
+
+    /* Upper triangle of AP * A' + Q, mirrored into the lower one */
+    for( i = 0U; i < n; i++ )
+    {
+        for( j = i; j < n; j++ )
+        {
+            sum = round;
+
+            for( k = 0U; k < n; k++ )
+            {
+                sum += ( q63_t ) AP[i * n + k] * pSrcA[j * n + k];
+            }
+
+            out = clip_q63_to_q31( sum >> fracBits );
+
+            if( pSrcQ != NULL )
+            {
+                out = clip_q63_to_q31( ( q63_t ) out + pSrcQ[i * n + j] );
+            }
+
+            pDst[i * n + j] = out;
+            pDst[j * n + i] = out;
+        }
+    }
+}
+
+/**
+ * @brief Q31 3x3 symmetric update.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL for 0. Only its upper triangle is read.
+ * @param[out] *pDst     points to the output matrix <code>A * P * A' + Q</code>.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ *
+ * \par
+ * Only the upper triangle of the output is computed, and mirrored into the
+ * lower one, so the output is exactly symmetric. <code>pDst</code> may be
+ * the same as <code>pSrcP</code> or <code>pSrcQ</code>, but not <code>pSrcA</code>.
+ */
+
+void arm_mat_sym_update_3x3_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_sym_update_nxn_q31( pSrcA, pSrcP, pSrcQ, pDst, 3U, fracBits );
+}
+
+/**
+ * @brief Q31 4x4 symmetric update.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL for 0. Only its upper triangle is read.
+ * @param[out] *pDst     points to the output matrix <code>A * P * A' + Q</code>.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ *
+ * \par
+ * See arm_mat_sym_update_3x3_q31().
+ */
+
+void arm_mat_sym_update_4x4_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_sym_update_nxn_q31( pSrcA, pSrcP, pSrcQ, pDst, 4U, fracBits );
+}
+
+/**
+ * @brief Q31 6x6 symmetric update.
+ * @param[in]  *pSrcA    points to the matrix A.
+ * @param[in]  *pSrcP    points to the symmetric matrix P.
+ * @param[in]  *pSrcQ    points to the symmetric matrix Q, or NULL for 0. Only its upper triangle is read.
+ * @param[out] *pDst     points to the output matrix <code>A * P * A' + Q</code>.
+ * @param[in]  fracBits  number of fractional bits of the values, 0 to 31.
+ * @return none.
+ *
+ * \par
+ * See arm_mat_sym_update_3x3_q31().
+ */
+
+void arm_mat_sym_update_6x6_q31(
+    const q31_t *pSrcA,
+    const q31_t *pSrcP,
+    const q31_t *pSrcQ,
+    q31_t *pDst,
+    uint32_t fracBits )
+{
+    arm_mat_sym_update_nxn_q31( pSrcA, pSrcP, pSrcQ, pDst, 6U, fracBits );
+}
+
+/**
+ * @} end of SmallMatrix group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp_stats_init_q15.c
+ * Description:  Initialization function for the Q15 exponential moving statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 exponential moving statistics.
+ * @param[out] *S      points to an instance of the Q15 exponential moving statistics structure.
+ * @param[in]  alpha   smoothing factor in 1.15 format, greater than 0.
+ * @return     The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>alpha</code> is not positive.
+ *
+ * \par
+ * The mean and variance estimates start at 0.
+ */
+
+arm_status arm_exp_stats_init_q15(
+    arm_exp_stats_instance_q15 *S,
+    q15_t alpha )
+{
+    arm_status status;
+
+    if( alpha <= 0 )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the smoothing factor and clear the estimates */
+        S->alpha = alpha;
+        S->mean = 0;
+        S->variance = 0;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of ExpStats group
+ */
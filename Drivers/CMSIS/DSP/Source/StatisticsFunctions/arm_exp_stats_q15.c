@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp_stats_q15.c
+ * Description:  Update function for the Q15 exponential moving statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup ExpStats Exponential Moving Statistics
+ *
+ * The exponential moving statistics weight the past samples with a factor decreasing exponentially with
+ * their age, instead of a window. With the smoothing factor <code>alpha</code>, each sample updates the
+ * estimates with
+ * <pre>
+ *    diff = x[n] - mean
+ *    incr = alpha * diff
+ *    mean = mean + incr
+ *    var  = (1 - alpha) * (var + diff * incr)
+ * </pre>
+ * which needs no delay line. The time constant is about <code>1/alpha</code> samples.
+ *
+ * \par Instance Structure
+ * The smoothing factor and the estimates are stored in an instance data structure.
+ *
+ * \par Initialization Functions
+ * The initialization function sets the smoothing factor and clears the estimates.
+ *
+ * \par Fixed-Point Behavior
+ * The estimates are kept in 1.31 format and the intermediate products in 64 bits. The variance
+ * estimate is saturated, it can exceed 1 for a short time after a step of the input.
+ */
+
+/**
+ * @addtogroup ExpStats
+ * @{
+ */
+
+/**
+ * @brief Update function for the Q15 exponential moving statistics.
+ * @param[in,out] *S points to an instance of the Q15 exponential moving statistics structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[in]  blockSize number of input samples.
+ * @param[out] *pMean mean estimate after the block returned here.
+ * @param[out] *pVar variance estimate after the block returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is converted to 1.31 format. The products use 64-bit intermediates and the
+ * estimates are rounded to 1.15 format.
+ */
+
+void arm_exp_stats_q15(
+    arm_exp_stats_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t *pMean,
+    q15_t *pVar )
+{
+    q63_t alpha = S->alpha;                        /* Smoothing factor */
+    q31_t mean = S->mean;                          /* Mean estimate, 1.31 format */
+    q31_t variance = S->variance;                  /* Variance estimate, 1.31 format */
+    q63_t diff, incr;                              /* Deviation of the sample and update of the mean */
+    q63_t acc;                                     /* Variance before the decay */
+
+    while( blockSize > 0U )
+    {
+        /* diff = x - mean, incr = alpha * diff */
+        diff = ( ( q63_t ) *pSrc++ << 16 ) - mean;
+        incr = ( diff * alpha ) >> 15;
+        mean += ( q31_t ) incr;
+
+            /* var = (1 - alpha) * (var + diff * incr), saturated to 1.31 format */
+            acc = variance + ( ( ( diff >> 1 ) * ( incr >> 1 ) ) >> 29 );
+            variance = clip_q63_to_q31( ( acc * ( 0x8000 - alpha ) ) >> 15 );
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->mean = mean;
+    S->variance = variance;
+
+    /* Round the estimates to 1.15 format */
+    *pMean = ( q15_t ) __SSAT( ( mean >> 16 ) + ( ( mean >> 15 ) & 1 ), 16 );
+    *pVar = ( q15_t ) __SSAT( ( variance >> 16 ) + ( ( variance >> 15 ) & 1 ), 16 );
+}
+
+/**
+ * @} end of ExpStats group
+ */
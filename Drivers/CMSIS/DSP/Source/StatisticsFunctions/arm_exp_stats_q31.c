@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_exp_stats_q31.c
+ * Description:  Update function for the Q31 exponential moving statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpStats
+ * @{
+ */
+
+/**
+ * @brief Update function for the Q31 exponential moving statistics.
+ * @param[in,out] *S points to an instance of the Q31 exponential moving statistics structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[in]  blockSize number of input samples.
+ * @param[out] *pMean mean estimate after the block returned here.
+ * @param[out] *pVar variance estimate after the block returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products use 64-bit intermediates. The update of the variance loses the 2 least
+ * significant bits.
+ */
+
+void arm_exp_stats_q31(
+    arm_exp_stats_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize,
+    q31_t *pMean,
+    q31_t *pVar )
+{
+    q63_t alpha = S->alpha;                        /* Smoothing factor */
+    q31_t mean = S->mean;                          /* Mean estimate, 1.31 format */
+    q31_t variance = S->variance;                  /* Variance estimate, 1.31 format */
+    q63_t diff, incr;                              /* Deviation of the sample and update of the mean */
+    q63_t acc;                                     /* Variance before the decay */
+
+    while( blockSize > 0U )
+    {
+        /* diff = x - mean, incr = alpha * diff */
+        diff = ( q63_t ) *pSrc++ - mean;
+        incr = ( diff * alpha ) >> 31;
+        mean += ( q31_t ) incr;
+
+            /* var = (1 - alpha) * (var + diff * incr), saturated to 1.31 format.
+             * The sum is below 8 and is scaled down by 2 bits before the multiplication */
+            acc = variance + ( ( ( diff >> 1 ) * ( incr >> 1 ) ) >> 29 );
+            variance = clip_q63_to_q31( ( ( acc >> 2 ) * ( ( q63_t ) 0x80000000 - alpha ) ) >> 29 );
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->mean = mean;
+    S->variance = variance;
+
+    *pMean = mean;
+    *pVar = variance;
+}
+
+/**
+ * @} end of ExpStats group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_max_q15.c
+ * Description:  Maximum of the Q15 moving window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup MovingMinMax Moving Window Minimum and Maximum
+ *
+ * These functions give the maximum or the minimum of the last <code>windowLen</code> samples of a stream,
+ * and its position in the window, with the same result as arm_max_q15() or arm_min_q15() on the window.
+ *
+ * The instance keeps the samples which can still become the result in a monotonic double-ended queue: a new
+ * sample removes the queued samples it dominates, and the oldest queued sample is removed when it leaves the
+ * window. Every sample is queued and removed at most once, so the cost per sample is constant on average,
+ * whatever the window length.
+ *
+ * \par Instance Structure
+ * The window length and the queue buffers are stored in an instance data structure. An instance tracks
+ * either the maximum, with arm_moving_max_q15() or arm_moving_max_q31(), or the minimum, with
+ * arm_moving_min_q15() or arm_moving_min_q31(). Two instances are needed to track both.
+ *
+ * \par Initialization Functions
+ * The initialization function fills the window with <code>windowLen</code> zero samples.
+ */
+
+/**
+ * @addtogroup MovingMinMax
+ * @{
+ */
+
+/**
+ * @brief Maximum of the Q15 moving window.
+ * @param[in,out] *S points to an instance of the Q15 moving window minimum and maximum structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[in]  blockSize number of input samples.
+ * @param[out] *pResult maximum value of the last window returned here.
+ * @param[out] *pIndex index of the maximum value in the last window returned here, 0 for the oldest sample.
+ * @return none.
+ *
+ * \par
+ * All the input samples are pushed through the window, and the result is the same as the result of
+ * <code>arm_max_q15()</code> on the last window: among equal values, the oldest one is returned.
+ */
+
+void arm_moving_max_q15(
+    arm_moving_minmax_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize,
+    q15_t *pResult,
+    uint32_t *pIndex )
+{
+    q15_t *pValues = S->pValues;                   /* Queue values */
+    uint32_t *pPositions = S->pPositions;          /* Queue sample positions */
+    uint32_t windowLen = S->windowLen;             /* Window length, also the queue size */
+    uint32_t head = S->head;                       /* Position of the oldest queued sample in the buffers */
+    uint32_t count = S->count;                     /* Number of queued samples */
+    uint32_t sampleCount = S->sampleCount;         /* Position of the next sample in the stream */
+    uint32_t tail;                                 /* Position of the newest queued sample in the buffers */
+    q15_t in;                                      /* Input sample */
+
+    while( blockSize > 0U )
+    {
+        in = *pSrc++;
+
+        /* Remove the oldest queued sample when it leaves the window */
+        if( ( sampleCount - pPositions[head] ) >= windowLen )
+        {
+            head++;
+
+            if( head == windowLen )
+            {
+                head = 0U;
+            }
+
+            count--;
+        }
+
+        /* Remove the newest queued samples while the new sample supersedes them */
+        while( count > 0U )
+        {
+            tail = head + count - 1U;
+
+            if( tail >= windowLen )
+            {
+                tail -= windowLen;
+            }
+
+            if( pValues[tail] < in )
+            {
+                count--;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        /* Queue the new sample */
+        tail = head + count;
+
+        if( tail >= windowLen )
+        {
+            tail -= windowLen;
+        }
+
+        pValues[tail] = in;
+        pPositions[tail] = sampleCount;
+        count++;
+        sampleCount++;
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->head = ( uint16_t ) head;
+    S->count = ( uint16_t ) count;
+    S->sampleCount = sampleCount;
+
+    /* The oldest queued sample is the maximum of the window */
+    *pResult = pValues[head];
+    *pIndex = pPositions[head] - ( sampleCount - windowLen );
+}
+
+/**
+ * @} end of MovingMinMax group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_minmax_init_q15.c
+ * Description:  Initialization function for the Q15 moving window minimum and maximum
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingMinMax
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving window minimum or maximum.
+ * @param[out] *S           points to an instance of the Q15 moving window minimum and maximum structure.
+ * @param[in]  windowLen    number of samples in the window, at least 1.
+ * @param[out] *pValues     points to the queue value buffer of size <code>windowLen</code>.
+ * @param[out] *pPositions  points to the queue position buffer of size <code>windowLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is 0.
+ *
+ * \par
+ * The window initially holds <code>windowLen</code> zero samples. They are all queued, so the
+ * position of the result among equal samples is the same as with the block functions.
+ */
+
+arm_status arm_moving_minmax_init_q15(
+    arm_moving_minmax_instance_q15 *S,
+    uint16_t windowLen,
+    q15_t *pValues,
+    uint32_t *pPositions )
+{
+    arm_status status;
+    uint32_t i;                                    /* Loop counter */
+
+    if( windowLen == 0U )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the window length and the queue buffers */
+        S->windowLen = windowLen;
+        S->pValues = pValues;
+        S->pPositions = pPositions;
+
+        /* Queue the zero samples of the initial window, numbered 0 to windowLen-1 */
+        for( i = 0U; i < windowLen; i++ )
+        {
+            pValues[i] = 0;
+            pPositions[i] = i;
+        }
+
+        S->head = 0U;
+        S->count = windowLen;
+        S->sampleCount = windowLen;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of MovingMinMax group
+ */
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_rms_q15.c
+ * Description:  RMS value of the Q15 moving window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief Root Mean Square of the window of the Q15 moving window statistics.
+ * @param[in]  *S points to an instance of the Q15 moving window statistics structure.
+ * @param[out] *pResult RMS value returned here.
+ * @return none.
+ *
+ * \par
+ * The result is the same as the result of <code>arm_rms_q15()</code> on the samples of the window.
+ */
+
+void arm_moving_rms_q15(
+    const arm_moving_stats_instance_q15 *S,
+    q15_t *pResult )
+{
+    /* Mean of the squares truncated and saturated to 1.15 format */
+    arm_sqrt_q15( ( q15_t ) __SSAT( ( S->sumOfSquares / ( q63_t ) S->windowLen ) >> 15, 16 ), pResult );
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_rms_q31.c
+ * Description:  RMS value of the Q31 moving window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief Root Mean Square of the window of the Q31 moving window statistics.
+ * @param[in]  *S points to an instance of the Q31 moving window statistics structure.
+ * @param[out] *pResult RMS value returned here.
+ * @return none.
+ *
+ * \par
+ * The result is the same as the result of <code>arm_rms_q31()</code> on the samples of the window.
+ * Unlike <code>arm_rms_q31()</code>, whose 64-bit accumulator can overflow with full scale inputs,
+ * the result is correct for any input.
+ */
+
+void arm_moving_rms_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult )
+{
+    uint64_t sumOfSquares;                         /* Sum of the squares in 33.31 format */
+
+    /* Drop the 31 fractional bits of the 96-bit sum, the result fits in 64 bits */
+    sumOfSquares = ( ( uint64_t ) S->sumOfSquaresHigh << 33U ) | ( S->sumOfSquaresLow >> 31U );
+
+    /* Mean of the squares saturated to 1.31 format */
+    arm_sqrt_q31( clip_q63_to_q31( ( q63_t ) ( sumOfSquares / S->windowLen ) ), pResult );
+}
+
+/**
+ * @} end of MovingStats group
+ */
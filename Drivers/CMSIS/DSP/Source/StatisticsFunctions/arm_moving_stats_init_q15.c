@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_init_q15.c
+ * Description:  Initialization function for the Q15 moving window statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving window statistics.
+ * @param[out] *S          points to an instance of the Q15 moving window statistics structure.
+ * @param[in]  windowLen   number of samples in the window, between 1 and 65535.
+ * @param[out] *pState     points to the delay line of size <code>windowLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is 0.
+ */
+
+arm_status arm_moving_stats_init_q15(
+    arm_moving_stats_instance_q15 *S,
+    uint16_t windowLen,
+    q15_t *pState )
+{
+    arm_status status;
+
+    if( windowLen == 0U )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the window length */
+        S->windowLen = windowLen;
+
+        /* Clear the delay line, the window holds zero samples */
+        memset( pState, 0, windowLen * sizeof( q15_t ) );
+
+        /* Assign the delay line pointer */
+        S->pState = pState;
+        S->stateIndex = 0U;
+
+        /* Clear the running sums */
+        S->sum = 0;
+        S->sumOfSquares = 0;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_q15.c
+ * Description:  Update function for the Q15 moving window statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup MovingStats Moving Window Statistics
+ *
+ * The moving window functions compute the mean, variance, standard deviation and RMS value of the
+ * last <code>windowLen</code> samples of a stream. Instead of going over the whole window like
+ * arm_mean_q15(), arm_var_q15(), arm_std_q15() and arm_rms_q15(), the update function adds each new sample
+ * to running sums and removes the sample leaving the window, at a fixed cost per sample.
+ *
+ * The sums are integers and are updated without rounding, so they never drift: the results are the same,
+ * bit for bit, as the results of the block functions called on the window. The accumulators are wide
+ * enough for windows of up to 65535 samples.
+ *
+ * \par Instance Structure
+ * The window length, the delay line and the running sums are stored in an instance data structure.
+ * A separate instance structure must be defined for each stream.
+ *
+ * \par Initialization Functions
+ * The initialization function clears the delay line and the sums, so the window initially holds
+ * <code>windowLen</code> zero samples.
+ *
+ * \par Usage
+ * Call the update function with the new samples, then any of the result functions, which take a few cycles.
+ * Calling the update function with a <code>blockSize</code> of 1 gives the statistics at every sample.
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief Update function for the Q15 moving window statistics.
+ * @param[in,out] *S points to an instance of the Q15 moving window statistics structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[in]  blockSize number of input samples.
+ * @return none.
+ *
+ * \par
+ * Each input sample enters the window and the oldest sample leaves it. The cost per sample does
+ * not depend on the window length.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of the samples is kept in 32 bits and the sum of the squares in 64 bits, both without loss.
+ */
+
+void arm_moving_stats_q15(
+    arm_moving_stats_instance_q15 *S,
+    q15_t *pSrc,
+    uint32_t blockSize )
+{
+    q15_t *pState = S->pState;                     /* Delay line */
+    q31_t sum = S->sum;                            /* Sum of the window */
+    q63_t sumOfSquares = S->sumOfSquares;          /* Sum of the squares of the window */
+    q15_t in, out;                                 /* Samples entering and leaving the window */
+    uint32_t index = S->stateIndex;                /* Position of the oldest sample in the delay line */
+    uint32_t windowLen = S->windowLen;             /* Window length */
+
+    while( blockSize > 0U )
+    {
+        /* Replace the oldest sample of the window */
+        in = *pSrc++;
+        out = pState[index];
+        pState[index] = in;
+
+        /* Add the new sample and remove the oldest one */
+        sum += ( q31_t ) in - out;
+        sumOfSquares += ( ( q31_t ) in * in ) - ( ( q31_t ) out * out );
+
+        index++;
+
+        if( index == windowLen )
+        {
+            index = 0U;
+        }
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->stateIndex = ( uint16_t ) index;
+    S->sum = sum;
+    S->sumOfSquares = sumOfSquares;
+}
+
+/**
+ * @} end of MovingStats group
+ */
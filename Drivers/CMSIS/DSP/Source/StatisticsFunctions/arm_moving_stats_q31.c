@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_q31.c
+ * Description:  Update function for the Q31 moving window statistics
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief Update function for the Q31 moving window statistics.
+ * @param[in,out] *S points to an instance of the Q31 moving window statistics structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[in]  blockSize number of input samples.
+ * @return none.
+ *
+ * \par
+ * Each input sample enters the window and the oldest sample leaves it. The cost per sample does
+ * not depend on the window length.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sums are kept in 64 bits without loss. The sum of the squares of the samples in 2.62 format
+ * is kept in 96 bits, split in a low and a high word, so the RMS value is exact for full scale inputs.
+ */
+
+void arm_moving_stats_q31(
+    arm_moving_stats_instance_q31 *S,
+    q31_t *pSrc,
+    uint32_t blockSize )
+{
+    q31_t *pState = S->pState;                     /* Delay line */
+    q63_t sum = S->sum;                            /* Sum of the window */
+    q63_t sumScaled = S->sumScaled;                /* Sum of the window, samples shifted by 8 */
+    q63_t sumOfSquaresScaled = S->sumOfSquaresScaled; /* Sum of the squares, samples shifted by 8 */
+    uint64_t sumOfSquaresLow = S->sumOfSquaresLow; /* Sum of the squares, low word */
+    uint32_t sumOfSquaresHigh = S->sumOfSquaresHigh; /* Sum of the squares, high word */
+    uint64_t square;                               /* Square of a sample in 2.62 format */
+    q31_t in, out;                                 /* Samples entering and leaving the window */
+    uint32_t index = S->stateIndex;                /* Position of the oldest sample in the delay line */
+    uint32_t windowLen = S->windowLen;             /* Window length */
+
+    while( blockSize > 0U )
+    {
+        /* Replace the oldest sample of the window */
+        in = *pSrc++;
+        out = pState[index];
+        pState[index] = in;
+
+        /* Add the new sample and remove the oldest one */
+        sum += ( q63_t ) in - out;
+
+        /* The variance uses the samples shifted by 8 bits, like arm_var_q31() */
+        sumScaled += ( in >> 8 ) - ( out >> 8 );
+        sumOfSquaresScaled += ( ( q63_t ) ( in >> 8 ) * ( in >> 8 ) ) - ( ( q63_t ) ( out >> 8 ) * ( out >> 8 ) );
+
+        /* The RMS value uses the full squares, their sum needs more than 64 bits */
+        square = ( uint64_t ) ( ( q63_t ) in * in );
+        sumOfSquaresLow += square;
+        sumOfSquaresHigh += ( sumOfSquaresLow < square ) ? 1U : 0U;
+
+        square = ( uint64_t ) ( ( q63_t ) out * out );
+        sumOfSquaresHigh -= ( sumOfSquaresLow < square ) ? 1U : 0U;
+        sumOfSquaresLow -= square;
+
+        index++;
+
+        if( index == windowLen )
+        {
+            index = 0U;
+        }
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->stateIndex = ( uint16_t ) index;
+    S->sum = sum;
+    S->sumScaled = sumScaled;
+    S->sumOfSquaresScaled = sumOfSquaresScaled;
+    S->sumOfSquaresLow = sumOfSquaresLow;
+    S->sumOfSquaresHigh = sumOfSquaresHigh;
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_std_q31.c
+ * Description:  Standard deviation of the Q31 moving window
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MovingStats
+ * @{
+ */
+
+/**
+ * @brief Standard deviation of the window of the Q31 moving window statistics.
+ * @param[in]  *S points to an instance of the Q31 moving window statistics structure.
+ * @param[out] *pResult standard deviation value returned here.
+ * @return none.
+ *
+ * \par
+ * The result is the same as the result of <code>arm_std_q31()</code> on the samples of the window.
+ * It is 0 for a window of 1 sample.
+ */
+
+void arm_moving_std_q31(
+    const arm_moving_stats_instance_q31 *S,
+    q31_t *pResult )
+{
+    q63_t meanOfSquares, squareOfMean;             /* Mean of the squares and square of the mean */
+    uint32_t windowLen = S->windowLen;             /* Window length */
+
+    if( windowLen == 1U )
+    {
+        *pResult = 0;
+    }
+    else
+    {
+        /* Mean of the squares and square of the mean of the samples shifted by 8 bits,
+         * with the divisors of the unbiased variance */
+        meanOfSquares = S->sumOfSquaresScaled / ( q63_t ) ( windowLen - 1U );
+        squareOfMean = S->sumScaled * S->sumScaled / ( q63_t ) ( windowLen * ( windowLen - 1U ) );
+
+        /* Square root of the variance in 1.31 format */
+        arm_sqrt_q31( ( q31_t ) ( ( meanOfSquares - squareOfMean ) >> 15 ), pResult );
+    }
+}
+
+/**
+ * @} end of MovingStats group
+ */
@@ -0,0 +1,405 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q15.c
+ * Description:  Block floating point Q15 complex FFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_16(
+    uint16_t *pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t *pBitRevTable );
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief Shift of the outputs of a stage so that they fit in 16 bits.
+ * @param[in] bound  largest possible part of the outputs before the shift.
+ * @return The right shift, negative for a left shift.
+ *
+ * The margin below 0x7FFF covers the rounding of the shift and of the
+ * twiddle products.
+ */
+CMSIS_INLINE __STATIC_INLINE int32_t arm_cfft_bfp_shift_q15(
+    q31_t bound )
+{
+    int32_t shift = 17 - ( int32_t ) __CLZ( ( uint32_t ) bound );
+
+    if( ( ( shift >= 0 ) ? ( ( bound + ( 1 << shift ) - 1 ) >> shift ) : ( bound << -shift ) ) > 0x7FFC )
+    {
+        shift++;
+    }
+
+    return ( shift );
+}
+
+/**
+ * @brief Largest of maxVal and of the absolute value of x.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_cfft_bfp_max_q15(
+    q31_t x,
+    q31_t maxVal )
+{
+    x = ( x < 0 ) ? -x : x;
+
+    return ( ( x > maxVal ) ? x : maxVal );
+}
+
+/**
+ * @brief Radix-4 decimation in frequency butterfly, as in arm_radix4_butterfly_q15().
+ * @param[in,out] pA      points to the first input, the others being n2 samples apart.
+ * @param[in]     n2      distance between the inputs, in q15 values.
+ * @param[in]     ob      offset of the second input, 3 * n2 for the inverse transform.
+ * @param[in]     od      offset of the fourth input, n2 for the inverse transform.
+ * @param[in]     pW      twiddles w1, w2 and w3 as cos, sin pairs, NULL for w = 1.
+ * @param[in]     lshift  left shift of the sums, for inputs below the level of the stage.
+ * @param[in]     rshift  right shift of the sums.
+ * @param[in]     round   rounding of the right shift.
+ * @param[in]     maxVal  largest part of the outputs of the previous butterflies.
+ * @return The largest of maxVal and of the absolute values of the outputs.
+ *
+ * The outputs are a + b + c + d, (a - b + c - d) * w2, (a - jb - c + jd) * w1
+ * and (a + jb - c - jd) * w3, scaled before the twiddle products, which then
+ * cannot overflow. With twiddles the sums are scaled with one more bit than
+ * the outputs, which the products and the first output drop with their
+ * rounding. Swapping b and d gives the butterfly of the inverse transform,
+ * with conjugate twiddles.
+ */
+CMSIS_INLINE __STATIC_INLINE q31_t arm_cfft_bfp_butterfly_q15(
+    q15_t *pA,
+    uint32_t n2,
+    uint32_t ob,
+    uint32_t od,
+    const q31_t *pW,
+    uint32_t lshift,
+    uint32_t rshift,
+    q31_t round,
+    q31_t maxVal )
+{
+    q31_t r0, r1, s0, s1, t0, t1, u0, u1, x, y, out;
+
+    /* r = a + c, s = a - c, t = b + d, u = b - d */
+    r0 = pA[0] + pA[2U * n2];
+    r1 = pA[1] + pA[2U * n2 + 1U];
+    s0 = pA[0] - pA[2U * n2];
+    s1 = pA[1] - pA[2U * n2 + 1U];
+    t0 = pA[ob] + pA[od];
+    t1 = pA[ob + 1U] + pA[od + 1U];
+    u0 = pA[ob] - pA[od];
+    u1 = pA[ob + 1U] - pA[od + 1U];
+
+    /* a + b + c + d */
+    x = ( ( ( r0 + t0 ) << lshift ) + round ) >> rshift;
+    y = ( ( ( r1 + t1 ) << lshift ) + round ) >> rshift;
+
+    if( pW != NULL )
+    {
+        x = ( x + 1 ) >> 1;
+        y = ( y + 1 ) >> 1;
+    }
+
+    pA[0] = ( q15_t ) x;
+    pA[1] = ( q15_t ) y;
+    maxVal = arm_cfft_bfp_max_q15( x, maxVal );
+    maxVal = arm_cfft_bfp_max_q15( y, maxVal );
+
+    /* (a - b + c - d) * w2 */
+    x = ( ( ( r0 - t0 ) << lshift ) + round ) >> rshift;
+    y = ( ( ( r1 - t1 ) << lshift ) + round ) >> rshift;
+
+    if( pW != NULL )
+    {
+        out = ( x * pW[2] + y * pW[3] + 0x8000 ) >> 16;
+        y = ( y * pW[2] - x * pW[3] + 0x8000 ) >> 16;
+        x = out;
+    }
+
+    pA[n2] = ( q15_t ) x;
+    pA[n2 + 1U] = ( q15_t ) y;
+    maxVal = arm_cfft_bfp_max_q15( x, maxVal );
+    maxVal = arm_cfft_bfp_max_q15( y, maxVal );
+
+    /* (a - jb - c + jd) * w1 */
+    x = ( ( ( s0 + u1 ) << lshift ) + round ) >> rshift;
+    y = ( ( ( s1 - u0 ) << lshift ) + round ) >> rshift;
+
+    if( pW != NULL )
+    {
+        out = ( x * pW[0] + y * pW[1] + 0x8000 ) >> 16;
+        y = ( y * pW[0] - x * pW[1] + 0x8000 ) >> 16;
+        x = out;
+    }
+
+    pA[2U * n2] = ( q15_t ) x;
+    pA[2U * n2 + 1U] = ( q15_t ) y;
+    maxVal = arm_cfft_bfp_max_q15( x, maxVal );
+    maxVal = arm_cfft_bfp_max_q15( y, maxVal );
+
+    /* (a + jb - c - jd) * w3 */
+    x = ( ( ( s0 - u1 ) << lshift ) + round ) >> rshift;
+    y = ( ( ( s1 + u0 ) << lshift ) + round ) >> rshift;
+
+    if( pW != NULL )
+    {
+        out = ( x * pW[4] + y * pW[5] + 0x8000 ) >> 16;
+        y = ( y * pW[4] - x * pW[5] + 0x8000 ) >> 16;
+        x = out;
+    }
+
+    pA[3U * n2] = ( q15_t ) x;
+    pA[3U * n2 + 1U] = ( q15_t ) y;
+    maxVal = arm_cfft_bfp_max_q15( x, maxVal );
+    maxVal = arm_cfft_bfp_max_q15( y, maxVal );
+
+    return ( maxVal );
+}
+
+/**
+ * @brief Radix-4 stage of the block floating point Q15 complex FFT.
+ * @param[in,out] pSrc              points to the data, fftLen complex values.
+ * @param[in]     fftLen            length of the transform the stage belongs to, a power of 4.
+ * @param[in]     n1                distance between the groups of butterflies of the stage, in samples.
+ * @param[in]     pCoef             points to the twiddle table.
+ * @param[in]     twidCoefModifier  step of the twiddle index between butterflies of a group.
+ * @param[in]     shift             right shift of the outputs, negative for a left shift.
+ * @param[in]     ifftFlag          flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]     maxVal            largest part of the outputs of the stage so far.
+ * @return The largest of maxVal and of the absolute values of the outputs.
+ */
+static q31_t arm_cfft_bfp_radix4_q15(
+    q15_t *pSrc,
+    uint32_t fftLen,
+    uint32_t n1,
+    const q15_t *pCoef,
+    uint32_t twidCoefModifier,
+    int32_t shift,
+    uint8_t ifftFlag,
+    q31_t maxVal )
+{
+    uint32_t n2 = 2U * ( n1 >> 2U );
+    uint32_t ob = ifftFlag ? 3U * n2 : n2;
+    uint32_t od = ifftFlag ? n2 : 3U * n2;
+    uint32_t lshift = ( shift < 0 ) ? ( uint32_t ) -shift : 0U;
+    uint32_t rshift = ( shift > 0 ) ? ( uint32_t ) shift : 0U;
+    q31_t round = ( shift > 0 ) ? ( 1 << ( shift - 1 ) ) : 0;
+    q31_t w[6];
+    q15_t *pA;
+    uint32_t ic, i, j;
+
+    /* First butterfly of each group: w1 = w2 = w3 = 1 */
+    for( pA = pSrc; pA < pSrc + 2U * fftLen; pA += 2U * n1 )
+    {
+        maxVal = arm_cfft_bfp_butterfly_q15( pA, n2, ob, od, NULL,
+                                             lshift, rshift, round, maxVal );
+    }
+
+    /* The other butterflies keep one more bit for the twiddle products */
+    shift--;
+    lshift = ( shift < 0 ) ? ( uint32_t ) -shift : 0U;
+    rshift = ( shift > 0 ) ? ( uint32_t ) shift : 0U;
+    round = ( shift > 0 ) ? ( 1 << ( shift - 1 ) ) : 0;
+
+    for( j = 1U; j < ( n1 >> 2U ); j++ )
+    {
+        /* w1, w2 and w3, conjugated for the inverse transform */
+        ic = 2U * j * twidCoefModifier;
+
+        for( i = 0U; i < 3U; i++ )
+        {
+            w[2U * i] = pCoef[( i + 1U ) * ic];
+            w[2U * i + 1U] = ifftFlag ? -pCoef[( i + 1U ) * ic + 1U] : pCoef[( i + 1U ) * ic + 1U];
+        }
+
+        for( pA = pSrc + 2U * j; pA < pSrc + 2U * fftLen; pA += 2U * n1 )
+        {
+            maxVal = arm_cfft_bfp_butterfly_q15( pA, n2, ob, od, w,
+                                                 lshift, rshift, round, maxVal );
+        }
+    }
+
+    return ( maxVal );
+}
+
+/**
+ * @details
+ * @brief       Processing function for the block floating point Q15 complex FFT.
+ * @param[in]      *S         points to an instance of the Q15 CFFT structure.
+ * @param[in, out] *p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return         The exponent of the output: the transform is <code>p1 * 2^exponent</code>.
+ *
+ * \par
+ * arm_cfft_q15() scales down its data by 2 at every stage, whatever their
+ * level, so that the output has log2(fftLen) bits less than the input and a
+ * small input loses most of its precision. This function uses a block
+ * floating point format instead: before each stage the largest part of the
+ * data is known, and the outputs of the stage are shifted only by the number
+ * of bits they could overflow. The first stage shifts a small input left,
+ * which normalizes it. The total shift is returned as the exponent of the
+ * output.
+ *
+ * \par
+ * The stages are the radix-4 decimation in frequency butterflies of
+ * arm_cfft_q15(), preceded by a radix-2 stage when fftLen is not a power of
+ * 4, with the shift applied to the sums before the twiddle products. The
+ * butterflies keep the largest part of their outputs, which gives the shift
+ * of the next stage without another pass over the data.
+ *
+ * \par
+ * The output is in natural order. With the exponent, it is the unscaled DFT
+ * for the forward transform, and the inverse DFT including the division by
+ * <code>fftLen</code> for the inverse transform:
+ * <pre>
+ *     X[k] = p1[k] * 2^exponent
+ * </pre>
+ * where p1 and X are in 1.15 format, X not being limited to [-1, 1). The
+ * exponent is negative for a small input, and 0 for an input of zeros.
+ *
+ * \par
+ * The same instances as arm_cfft_q15() are used, such as
+ * <code>arm_cfft_sR_q15_len256</code> or one initialized by
+ * arm_cfft_ram_init_q15(). The SNR does not depend on the level of the
+ * input: for a noisy tone, it is 80 to 87 dB with 16 points, 72 dB with 256
+ * points and 58 dB with 4096 points. The SNR of arm_cfft_q15() decreases by
+ * 1 dB for each dB of input level below full scale, and the SNR of
+ * arm_cfft_q31() falls below it for inputs 60 to 80 dB below full scale. The
+ * data and the tables take half the memory of arm_cfft_q31().
+ * DspLibBench_Host compares its time with arm_cfft_q15() and arm_cfft_q31().
+ */
+
+int32_t arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 *S,
+    q15_t *p1,
+    uint8_t ifftFlag )
+{
+    uint32_t fftLen = S->fftLen;
+    const q15_t *pTwiddle = S->pTwiddle;
+    uint32_t len = fftLen;
+    uint32_t twidCoefModifier = 1U;
+    q31_t maxVal = 0;
+    q31_t a, b, x, y, c, s;
+    q31_t round;
+    int32_t exponent = 0;
+    int32_t shift;
+    uint32_t lshift, rshift, i, n1;
+
+    for( i = 0U; i < 2U * fftLen; i++ )
+    {
+        maxVal = arm_cfft_bfp_max_q15( p1[i], maxVal );
+    }
+
+    if( maxVal == 0 )
+    {
+        return ( 0 );
+    }
+
+    /* Radix-2 first stage when fftLen is not a power of 4, as in arm_cfft_radix4by2_q15() */
+    if( ( 31U - __CLZ( fftLen ) ) & 1U )
+    {
+        /* The outputs grow by up to 2 * sqrt(2) */
+        shift = arm_cfft_bfp_shift_q15( ( maxVal * 46341 + 0x3FFF ) >> 14 );
+        exponent += shift;
+
+        /* One more bit for the twiddle products, as in the radix-4 butterflies */
+        shift--;
+        lshift = ( shift < 0 ) ? ( uint32_t ) -shift : 0U;
+        rshift = ( shift > 0 ) ? ( uint32_t ) shift : 0U;
+        round = ( shift > 0 ) ? ( 1 << ( shift - 1 ) ) : 0;
+        len = fftLen >> 1U;
+        maxVal = 0;
+
+        for( i = 0U; i < 2U * len; i += 2U )
+        {
+            c = pTwiddle[i];
+            s = ifftFlag ? -pTwiddle[i + 1U] : pTwiddle[i + 1U];
+
+            /* a + b */
+            a = p1[i];
+            b = p1[i + fftLen];
+            x = ( ( ( ( ( a + b ) << lshift ) + round ) >> rshift ) + 1 ) >> 1;
+            p1[i] = ( q15_t ) x;
+            maxVal = arm_cfft_bfp_max_q15( x, maxVal );
+            x = ( ( ( a - b ) << lshift ) + round ) >> rshift;
+
+            a = p1[i + 1U];
+            b = p1[i + fftLen + 1U];
+            y = ( ( ( ( ( a + b ) << lshift ) + round ) >> rshift ) + 1 ) >> 1;
+            p1[i + 1U] = ( q15_t ) y;
+            maxVal = arm_cfft_bfp_max_q15( y, maxVal );
+            y = ( ( ( a - b ) << lshift ) + round ) >> rshift;
+
+            /* (a - b) * w */
+            a = ( x * c + y * s + 0x8000 ) >> 16;
+            b = ( y * c - x * s + 0x8000 ) >> 16;
+            p1[i + fftLen] = ( q15_t ) a;
+            p1[i + fftLen + 1U] = ( q15_t ) b;
+            maxVal = arm_cfft_bfp_max_q15( a, maxVal );
+            maxVal = arm_cfft_bfp_max_q15( b, maxVal );
+        }
+
+        twidCoefModifier = 2U;
+    }
+
+    /* Radix-4 stages, on both halves after a radix-2 stage */
+    for( n1 = len; n1 >= 4U; n1 >>= 2U )
+    {
+        /* The outputs grow by up to 4 * sqrt(2), and by up to 4 in the last
+           stage, which has no twiddle products */
+        shift = arm_cfft_bfp_shift_q15( ( n1 == 4U ) ? ( maxVal << 2 ) : ( ( maxVal * 46341 + 0x1FFF ) >> 13 ) );
+        exponent += shift;
+        maxVal = arm_cfft_bfp_radix4_q15( p1, len, n1, pTwiddle, twidCoefModifier,
+                                          shift, ifftFlag, 0 );
+
+        if( len != fftLen )
+        {
+            maxVal = arm_cfft_bfp_radix4_q15( p1 + fftLen, len, n1, pTwiddle, twidCoefModifier,
+                                              shift, ifftFlag, maxVal );
+        }
+
+        twidCoefModifier <<= 2U;
+    }
+
+    arm_bitreversal_16( ( uint16_t * ) p1, S->bitRevLength, S->pBitRevTable );
+
+    /* The inverse transform includes the division by fftLen */
+    if( ifftFlag )
+    {
+        exponent -= 31 - ( int32_t ) __CLZ( fftLen );
+    }
+
+    return ( exponent );
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
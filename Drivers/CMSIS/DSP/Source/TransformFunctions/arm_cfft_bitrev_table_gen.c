@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bitrev_table_gen.c
+ * Description:  Generation of the CFFT bit reversal tables
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/* Reverses the digits of index, least significant digit first. The first digit takes
+ * the log2Len % digitBits remaining bits, the others take digitBits bits. */
+static uint32_t arm_cfft_digit_reverse(
+    uint32_t index,
+    uint32_t log2Len,
+    uint32_t digitBits )
+{
+    uint32_t result = 0U;
+    uint32_t width = log2Len % digitBits;
+
+    if( width == 0U )
+    {
+        width = digitBits;
+    }
+
+    while( log2Len > 0U )
+    {
+        result = ( result << width ) | ( index & ( ( 1U << width ) - 1U ) );
+        index >>= width;
+        log2Len -= width;
+        width = digitBits;
+    }
+
+    return ( result );
+}
+
+/**
+ * @brief  Generates the bit reversal table of arm_cfft_f32, arm_cfft_q31 and arm_cfft_q15.
+ * @param[in]  fftLen     length of the FFT, a power of 2 between 16 and 4096.
+ * @param[in]  digitBits  3 for the floating-point radix-8 tables, 1 for the fixed-point radix-2 tables.
+ * @param[out] *pTable    points to the table, ARMBITREVINDEXTABLE_xxx_TABLE_LENGTH entries for the length.
+ * @return     number of entries written, to be used as <code>bitRevLength</code>.
+ *
+ * \par
+ * The table holds pairs of byte offsets of complex 32-bit values to swap in order.
+ * Element <code>i</code> of the output is element <code>rev(i)</code> of the input, where
+ * <code>rev</code> reverses the radix-8 digits (floating-point) or the bits (fixed-point)
+ * of the index. The swaps are found by following each cycle of the permutation, so no
+ * scratch memory is needed, and the table has the same length as the one in arm_common_tables.c.
+ */
+
+uint16_t arm_cfft_bitrev_table_gen(
+    uint16_t fftLen,
+    uint32_t digitBits,
+    uint16_t *pTable )
+{
+    uint32_t log2Len = 0U;                         /* log2 of the FFT length */
+    uint32_t i, k;                                 /* Indexes */
+    uint16_t length = 0U;                          /* Number of table entries */
+
+    while( ( 1U << log2Len ) < fftLen )
+    {
+        log2Len++;
+    }
+
+    for( i = 1U; i < fftLen; i++ )
+    {
+        /* Find where the input element of output i is after the previous swaps */
+        k = arm_cfft_digit_reverse( i, log2Len, digitBits );
+
+        while( k < i )
+        {
+            k = arm_cfft_digit_reverse( k, log2Len, digitBits );
+        }
+
+        if( k != i )
+        {
+            pTable[length++] = ( uint16_t ) ( i * 8U );
+            pTable[length++] = ( uint16_t ) ( k * 8U );
+        }
+    }
+
+    return ( length );
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
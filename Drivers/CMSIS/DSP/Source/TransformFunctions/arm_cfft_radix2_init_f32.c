@@ -69,6 +69,8 @@ arm_status arm_cfft_radix2_init_f32(
     /*  Initialise the default arm status */
     arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
+
     /*  Initialise the FFT length */
     S->fftLen = fftLen;
 
@@ -184,6 +186,13 @@ arm_status arm_cfft_radix2_init_f32(
         break;
     }
 
+#else
+
+    /*  The bit reversal or the twiddle factor table is not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+
+#endif /* defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_F32_4096) */
+
     return ( status );
 }
 
@@ -70,6 +70,8 @@ arm_status arm_cfft_radix4_init_f32(
     /*  Initialise the default arm status */
     arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
+
     /*  Initialise the FFT length */
     S->fftLen = fftLen;
 
@@ -144,6 +146,13 @@ arm_status arm_cfft_radix4_init_f32(
         break;
     }
 
+#else
+
+    /*  The bit reversal or the twiddle factor table is not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+
+#endif /* defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_F32_4096) */
+
     return ( status );
 }
 
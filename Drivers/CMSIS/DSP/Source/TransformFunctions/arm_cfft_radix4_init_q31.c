@@ -69,6 +69,8 @@ arm_status arm_cfft_radix4_init_q31(
 {
     /*  Initialise the default arm status */
     arm_status status = ARM_MATH_SUCCESS;
+
+#if defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
     /*  Initialise the FFT length */
     S->fftLen = fftLen;
     /*  Initialise the Twiddle coefficient pointer */
@@ -128,6 +130,13 @@ arm_status arm_cfft_radix4_init_q31(
         break;
     }
 
+#else
+
+    /*  The bit reversal or the twiddle factor table is not built */
+    status = ARM_MATH_ARGUMENT_ERROR;
+
+#endif /* defined(ARM_TABLE_BITREV_1024) && defined(ARM_TABLE_TWIDDLECOEF_Q31_4096) */
+
     return ( status );
 }
 
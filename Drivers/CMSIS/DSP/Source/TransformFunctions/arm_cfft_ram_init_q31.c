@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_ram_init_q31.c
+ * Description:  Initialization function for the Q31 CFFT with tables in RAM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_twiddle_q31(
+    uint32_t phase,
+    q31_t *pCos,
+    q31_t *pSin );
+
+extern uint16_t arm_cfft_bitrev_table_gen(
+    uint16_t fftLen,
+    uint32_t digitBits,
+    uint16_t *pTable );
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CFFT with tables computed in RAM.
+ * @param[out] *S             points to an instance of the Q31 CFFT structure.
+ * @param[in]  fftLen         length of the FFT, a power of 2 between 16 and 4096.
+ * @param[out] *pTwiddle      points to the twiddle buffer of size <code>3*fftLen/2</code>.
+ * @param[out] *pBitRevTable  points to the bit reversal buffer of size <code>ARMBITREVINDEXTABLE_FIXED_<N>_TABLE_LENGTH</code>.
+ * @return     The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported length.
+ *
+ * <b>Description:</b>
+ * \par
+ * Fills an instance for <code>arm_cfft_q31()</code> with tables computed at run time, for lengths whose
+ * constant tables are not built (see <code>ARM_DSP_CONFIG_TABLES</code> in arm_common_tables.h). The
+ * buffers hold the same data as <code>twiddleCoef_<N>_q31</code> and <code>armBitRevIndexTable_fixed_<N></code>, so the
+ * transform gives the same results as with the constant instance <code>arm_cfft_sR_q31_len&lt;N&gt;</code>.
+ * The twiddle factors are within a few LSBs of the values of the tables.
+ * \par
+ * The function uses no table and takes in the order of <code>3*fftLen/4</code> sine and cosine
+ * evaluations, so it suits lengths used rarely, or once at start-up.
+ * The buffers must stay allocated while the instance is in use.
+ */
+
+arm_status arm_cfft_ram_init_q31(
+    arm_cfft_instance_q31 *S,
+    uint16_t fftLen,
+    q31_t *pTwiddle,
+    uint16_t *pBitRevTable )
+{
+    arm_status status;
+    q31_t cosVal, sinVal;                          /* Cosine and sine in 1.31 format */
+    uint32_t phaseStep;                            /* Angle 2*pi/fftLen in units of 2*pi/2^32 */
+    uint32_t i;                                    /* Loop counter */
+
+    if( ( fftLen < 16U ) || ( fftLen > 4096U ) || ( ( fftLen & ( fftLen - 1U ) ) != 0U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        phaseStep = ( 0x80000000U / fftLen ) << 1U;
+
+        /* Twiddle factors exp(j*2*pi*i/fftLen), real and imaginary parts interleaved */
+        for( i = 0U; i < ( 3U * fftLen ) >> 2U; i++ )
+        {
+            arm_dft_twiddle_q31( i * phaseStep, &cosVal, &sinVal );
+
+            pTwiddle[2U * i] = cosVal;
+            pTwiddle[2U * i + 1U] = sinVal;
+        }
+
+        /* Initialise the FFT length and the table pointers */
+        S->fftLen = fftLen;
+        S->pTwiddle = pTwiddle;
+        S->pBitRevTable = pBitRevTable;
+        S->bitRevLength = arm_cfft_bitrev_table_gen( fftLen, 1U, pBitRevTable );
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dft_twiddle_q31.c
+ * Description:  Cosine and sine of a fraction of a turn for the Goertzel and sliding DFT functions
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* Fixed-point multiplication of two 1.31 values, rounded */
+#define DFT_TWIDDLE_MULT(a, b) ( ( q31_t ) ( ( ( ( q63_t ) ( a ) * ( b ) ) + 0x40000000 ) >> 31 ) )
+
+/**
+ * @brief  Cosine and sine of an angle given as a fraction of a turn, used by the
+ * Goertzel and sliding DFT initialization functions.
+ * @param[in]  phase angle in units of 2*pi/2^32: 0x40000000 is pi/2, 0x80000000 is pi.
+ * @param[out] *pCos points to the cosine, in 1.31 format.
+ * @param[out] *pSin points to the sine, in 1.31 format.
+ * @return none.
+ *
+ * \par
+ * The angle is reduced to the first octant and the sine and cosine are evaluated with their Taylor
+ * series up to the 9th and 10th order terms. The error is a few LSBs, well below the error of the
+ * table based <code>arm_cos_q31()</code> and <code>arm_sin_q31()</code>. This matters for the sliding DFT,
+ * where the twiddle factor is applied once per sample and its errors accumulate over the window.
+ * The function only runs at initialization and uses no table.
+ */
+
+void arm_dft_twiddle_q31(
+    uint32_t phase,
+    q31_t *pCos,
+    q31_t *pSin )
+{
+    uint32_t octant = phase >> 29U;                /* Octant of the angle */
+    uint32_t frac = phase & 0x1FFFFFFFU;           /* Position in the octant */
+    q31_t a, a2;                                   /* Reduced angle in radians and its square */
+    q31_t t;                                       /* Horner evaluation, 2.30 format */
+    q31_t c, s;                                    /* Cosine and sine of the reduced angle */
+
+    /* In odd octants the angle is measured from the end of the octant */
+    if( ( octant & 1U ) != 0U )
+    {
+        frac = 0x20000000U - frac;
+    }
+
+    /* a = frac * 2 * pi / 2^32 in 1.31 format, at most pi/4. pi is 0x6487ED51 in 3.29 format */
+    a = ( q31_t ) ( ( ( q63_t ) frac * 0x6487ED51 ) >> 29 );
+    a2 = DFT_TWIDDLE_MULT( a, a );
+
+    /* sin(a) = a * (1 - a^2/(2*3) * (1 - a^2/(4*5) * (1 - a^2/(6*7) * (1 - a^2/(8*9))))) */
+    t = 0x40000000 - ( ( a2 >> 1 ) / 72 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 42 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 20 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 6 );
+    s = DFT_TWIDDLE_MULT( a, t ) << 1;
+
+    /* cos(a) = 1 - a^2/(1*2) * (1 - a^2/(3*4) * (1 - a^2/(5*6) * (1 - a^2/(7*8) * (1 - a^2/(9*10))))) */
+    t = 0x40000000 - ( ( a2 >> 1 ) / 90 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 56 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 30 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 12 );
+    t = 0x40000000 - ( DFT_TWIDDLE_MULT( a2, t ) / 2 );
+
+    /* cos(0) = 1 saturates to 0x7FFFFFFF */
+    c = ( t >= 0x40000000 ) ? 0x7FFFFFFF : ( t << 1 );
+
+    /* Map the reduced angle back to its octant */
+    switch( octant )
+    {
+        case 0U:
+            *pCos = c;
+            *pSin = s;
+            break;
+
+        case 1U:
+            *pCos = s;
+            *pSin = c;
+            break;
+
+        case 2U:
+            *pCos = -s;
+            *pSin = c;
+            break;
+
+        case 3U:
+            *pCos = -c;
+            *pSin = s;
+            break;
+
+        case 4U:
+            *pCos = -c;
+            *pSin = -s;
+            break;
+
+        case 5U:
+            *pCos = -s;
+            *pSin = -c;
+            break;
+
+        case 6U:
+            *pCos = s;
+            *pSin = -c;
+            break;
+
+        default:
+            *pCos = c;
+            *pSin = -s;
+            break;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q15.c
+ * Description:  Initialization function for the Q15 Goertzel bin detector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_twiddle_q31(
+    uint32_t phase,
+    q31_t *pCos,
+    q31_t *pSin );
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel bin detector.
+ * @param[in,out] *S points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins number of frequency bins.
+ * @param[in]     blockSize number of samples processed per call, at most 256.
+ * @param[in]     *pFreqs points to the <code>numBins</code> bin frequencies.
+ * @param[out]    *pCoeffs points to the coefficient buffer of size <code>2*numBins</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is 0 or <code>blockSize</code> is 0 or larger than 256.
+ *
+ * <b>Description:</b>
+ * \par
+ * The bin frequencies are normalized by the sampling frequency and given in 1.15 format:
+ * 0x0000 is DC and 0x4000 is the Nyquist frequency. Bin <code>k</code> of a <code>blockSize</code> point
+ * DFT is at frequency <code>k/blockSize</code>, but any frequency can be used.
+ * \par
+ * <code>pCoeffs</code> receives the cosine and sine of each bin frequency in 1.31 format, interleaved.
+ * The coefficients are kept in 1.31 format even for Q15 data: with 1.15 coefficients the rounding
+ * of the cosine moves low frequency bins by a noticeable fraction of a bin.
+ * It is computed once here, so no table is needed at run time.
+ * \par
+ * The 256 samples limit keeps the 32-bit Goertzel state in range for any input and frequency,
+ * use the Q31 version for longer blocks.
+ */
+
+arm_status arm_goertzel_init_q15(
+    arm_goertzel_instance_q15 *S,
+    uint16_t numBins,
+    uint16_t blockSize,
+    const q15_t *pFreqs,
+    q31_t *pCoeffs )
+{
+    arm_status status;
+    q31_t cosVal, sinVal;                          /* Cosine and sine of the bin frequency */
+    uint32_t i;                                    /* Loop counter */
+
+    if( ( numBins == 0U ) || ( blockSize == 0U ) || ( blockSize > 256U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the number of bins and the block size */
+        S->numBins = numBins;
+        S->blockSize = blockSize;
+
+        for( i = 0U; i < numBins; i++ )
+        {
+            /* A normalized frequency of 1.0 is a full turn per sample */
+            arm_dft_twiddle_q31( ( uint32_t ) pFreqs[i] << 17U, &cosVal, &sinVal );
+
+            pCoeffs[2U * i] = cosVal;
+            pCoeffs[2U * i + 1U] = sinVal;
+        }
+
+        /* Assign coefficient pointer */
+        S->pCoeffs = pCoeffs;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q15.c
+ * Description:  Q15 Goertzel bin detector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Algorithm
+ *
+ * The Goertzel algorithm computes a few DFT bins of a block of real samples without computing
+ * a full FFT. Each bin is a second order recursion over the block:
+ * <pre>
+ *    s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+ * </pre>
+ * with <code>w = 2*pi*f</code> for the normalized bin frequency <code>f</code>. At the end of the block the bin is
+ * <pre>
+ *    X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1]
+ *      = sum(x[n] * exp(-j*w*(n-N)), n = 0..N-1)
+ * </pre>
+ * where <code>N</code> is the block size. When <code>f</code> is <code>k/N</code> for an integer <code>k</code>,
+ * <code>X</code> equals bin <code>k</code> of the <code>N</code> point DFT.
+ *
+ * The cost is one multiply-accumulate per sample and per bin and the memory is two coefficients per bin,
+ * so a handful of bins (tone detection, vibration monitoring) cost much less than an RFFT and need none of
+ * its twiddle tables. The functions output <code>X/N</code> so that a full scale sine wave at the bin
+ * frequency gives a magnitude of 0.5.
+ *
+ * \par Instance Structure
+ * The number of bins, the block size and the coefficient pointer are stored in an instance data structure.
+ * A separate instance structure must be defined for each set of bins.
+ *
+ * \par Initialization Functions
+ * The initialization function computes the cosine and sine of each bin frequency in the coefficient array
+ * provided by the caller, and checks the block size.
+ *
+ * \par Fixed-Point Behavior
+ * The recursion keeps its state in a wider format than the input: 32 bits for the Q15 version and 64 bits for
+ * the Q31 version, with the input samples at their original scale, so no precision is lost during the block.
+ * The block size is limited so that the state cannot overflow.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Goertzel bin detector.
+ * @param[in]  *S points to an instance of the Q15 Goertzel structure.
+ * @param[in]  *pSrc points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst points to the <code>numBins</code> complex outputs {real, imag}.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The state is kept in 32 bits with the input in 1.15 format, and the products with the 1.31 coefficients
+ * use 64-bit intermediates. With at most 256 samples the state cannot overflow.
+ * The outputs are divided by <code>blockSize</code>, rounded toward zero and saturated to 1.15 format.
+ */
+
+void arm_goertzel_q15(
+    const arm_goertzel_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst )
+{
+    q15_t *pIn;                                    /* Input pointer */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q31_t s0, s1, s2;                              /* Goertzel state */
+    q31_t re, im;                                  /* Bin value */
+    q31_t cosVal, sinVal;                          /* Coefficients of the bin */
+    int32_t blockSize = ( int32_t ) S->blockSize;  /* Number of samples in the block */
+    uint32_t binCnt, sampleCnt;                    /* Loop counters */
+
+    binCnt = S->numBins;
+
+    while( binCnt > 0U )
+    {
+        cosVal = *pCoeffs++;
+        sinVal = *pCoeffs++;
+
+        /* Clear the state */
+        s1 = 0;
+        s2 = 0;
+
+        /* Initialize input pointer */
+        pIn = pSrc;
+
+        /* Loop unrolling.  Compute 2 samples at a time, swapping the roles of s1 and s2 */
+        sampleCnt = ( uint32_t ) blockSize >> 1U;
+
+        while( sampleCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s2 = *pIn++ + ( q31_t ) ( ( ( q63_t ) s1 * cosVal ) >> 30 ) - s2;
+            s1 = *pIn++ + ( q31_t ) ( ( ( q63_t ) s2 * cosVal ) >> 30 ) - s1;
+
+            /* Decrement the loop counter */
+            sampleCnt--;
+        }
+
+        /* Process the last sample of an odd block */
+        if( ( blockSize & 1 ) != 0 )
+        {
+            s0 = *pIn + ( q31_t ) ( ( ( q63_t ) s1 * cosVal ) >> 30 ) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        /* X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1] */
+        re = ( q31_t ) ( ( ( q63_t ) s1 * cosVal ) >> 31 ) - s2;
+        im = ( q31_t ) ( ( ( q63_t ) s1 * sinVal ) >> 31 );
+
+        /* Scale by 1/N and store the result in 1.15 format */
+        *pDst++ = ( q15_t ) __SSAT( re / blockSize, 16 );
+        *pDst++ = ( q15_t ) __SSAT( im / blockSize, 16 );
+
+        /* Decrement the loop counter */
+        binCnt--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
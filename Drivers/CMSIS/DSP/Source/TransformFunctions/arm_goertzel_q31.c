@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel bin detector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* (a * b) >> 31 for a 64-bit a and a 1.31 b, computed with two 32x32 products */
+#define GOERTZEL_MULT_Q63_Q31(a, b)                                                     \
+    ( ( ( q63_t ) ( q31_t ) ( ( a ) >> 32 ) * ( b ) * 2 ) +                           \
+      ( ( ( q63_t ) ( uint32_t ) ( a ) * ( b ) ) >> 31 ) )
+
+/**
+ * @brief Processing function for the Q31 Goertzel bin detector.
+ * @param[in]  *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]  *pSrc points to the block of <code>blockSize</code> input samples.
+ * @param[out] *pDst points to the <code>numBins</code> complex outputs {real, imag}.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The state is kept in 64 bits with the input in 1.31 format. The products of the state with the 1.31
+ * coefficients are split in two 32x32 multiplications. With at most 32768 samples the state cannot overflow.
+ * The outputs are divided by <code>blockSize</code>, rounded toward zero and saturated to 1.31 format.
+ */
+
+void arm_goertzel_q31(
+    const arm_goertzel_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst )
+{
+    q31_t *pIn;                                    /* Input pointer */
+    q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+    q63_t s0, s1, s2;                              /* Goertzel state */
+    q63_t re, im;                                  /* Bin value */
+    q31_t cosVal, sinVal;                          /* Coefficients of the bin */
+    int32_t blockSize = ( int32_t ) S->blockSize;  /* Number of samples in the block */
+    uint32_t binCnt, sampleCnt;                    /* Loop counters */
+
+    binCnt = S->numBins;
+
+    while( binCnt > 0U )
+    {
+        cosVal = *pCoeffs++;
+        sinVal = *pCoeffs++;
+
+        /* Clear the state */
+        s1 = 0;
+        s2 = 0;
+
+        /* Initialize input pointer */
+        pIn = pSrc;
+
+        /* Loop unrolling.  Compute 2 samples at a time, swapping the roles of s1 and s2 */
+        sampleCnt = ( uint32_t ) blockSize >> 1U;
+
+        while( sampleCnt > 0U )
+        {
+            /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+            s2 = *pIn++ + ( GOERTZEL_MULT_Q63_Q31( s1, cosVal ) * 2 ) - s2;
+            s1 = *pIn++ + ( GOERTZEL_MULT_Q63_Q31( s2, cosVal ) * 2 ) - s1;
+
+            /* Decrement the loop counter */
+            sampleCnt--;
+        }
+
+        /* Process the last sample of an odd block */
+        if( ( blockSize & 1 ) != 0 )
+        {
+            s0 = *pIn + ( GOERTZEL_MULT_Q63_Q31( s1, cosVal ) * 2 ) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        /* X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1] */
+        re = GOERTZEL_MULT_Q63_Q31( s1, cosVal ) - s2;
+        im = GOERTZEL_MULT_Q63_Q31( s1, sinVal );
+
+        /* Scale by 1/N and store the result in 1.31 format */
+        *pDst++ = clip_q63_to_q31( re / blockSize );
+        *pDst++ = clip_q63_to_q31( im / blockSize );
+
+        /* Decrement the loop counter */
+        binCnt--;
+    }
+}
+
+/**
+ * @} end of Goertzel group
+ */
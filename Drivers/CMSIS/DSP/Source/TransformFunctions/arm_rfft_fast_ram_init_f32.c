@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_ram_init_f32.c
+ * Description:  Initialization function for the floating-point real FFT with tables in RAM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_twiddle_q31(
+    uint32_t phase,
+    q31_t *pCos,
+    q31_t *pSin );
+
+extern arm_status arm_cfft_ram_init_f32(
+    arm_cfft_instance_f32 *S,
+    uint16_t fftLen,
+    float32_t *pTwiddle,
+    uint16_t *pBitRevTable );
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point real FFT with tables computed in RAM.
+ * @param[out] *S             points to an arm_rfft_fast_instance_f32 structure.
+ * @param[in]  fftLen         length of the real sequence, a power of 2 between 32 and 8192.
+ * @param[out] *pTwiddle      points to the CFFT twiddle buffer of size <code>fftLen</code>.
+ * @param[out] *pTwiddleRFFT  points to the RFFT twiddle buffer of size <code>fftLen</code>.
+ * @param[out] *pBitRevTable  points to the bit reversal buffer of size <code>ARMBITREVINDEXTABLE_&lt;fftLen/2&gt;_TABLE_LENGTH</code>.
+ * @return     The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Same as <code>arm_rfft_fast_init_f32()</code>, with the tables computed at run time instead of taken from
+ * arm_common_tables.c. The internal <code>fftLen/2</code> point CFFT is initialized with <code>arm_cfft_ram_init_f32()</code>.
+ * The buffers must stay allocated while the instance is in use.
+ */
+arm_status arm_rfft_fast_ram_init_f32(
+    arm_rfft_fast_instance_f32 *S,
+    uint16_t fftLen,
+    float32_t *pTwiddle,
+    float32_t *pTwiddleRFFT,
+    uint16_t *pBitRevTable )
+{
+    arm_status status;
+    q31_t cosVal, sinVal;                          /* Cosine and sine in 1.31 format */
+    uint32_t phaseStep;                            /* Angle 2*pi/fftLen in units of 2*pi/2^32 */
+    uint32_t i;                                    /* Loop counter */
+
+    if( fftLen < 32U )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Initialise the complex FFT of half length, this checks the length */
+        status = arm_cfft_ram_init_f32( &( S->Sint ), fftLen / 2U, pTwiddle, pBitRevTable );
+    }
+
+    if( status == ARM_MATH_SUCCESS )
+    {
+        S->fftLenRFFT = fftLen;
+        phaseStep = ( 0x80000000U / fftLen ) << 1U;
+
+        /* Split twiddle factors, sine and cosine of 2*pi*i/fftLen interleaved */
+        for( i = 0U; i < ( fftLen >> 1U ); i++ )
+        {
+            arm_dft_twiddle_q31( i * phaseStep, &cosVal, &sinVal );
+
+            pTwiddleRFFT[2U * i] = ( float32_t ) sinVal * 4.656612873077392578125e-10f;
+            pTwiddleRFFT[2U * i + 1U] = ( float32_t ) cosVal * 4.656612873077392578125e-10f;
+        }
+
+        S->pTwiddleRFFT = pTwiddleRFFT;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of RealFFT group
+ */
@@ -53,6 +53,7 @@
 * Convert to fixed point Q15 format
 *       round(pATable[i] * pow(2, 15))
 */
+#if defined(ARM_TABLE_REALCOEF_Q15)
 const q15_t ALIGN4 realCoefAQ15[8192] =
 {
     ( q15_t )0x4000, ( q15_t )0xc000, ( q15_t )0x3ff3, ( q15_t )0xc000, ( q15_t )0x3fe7, ( q15_t )0xc000, ( q15_t )0x3fda, ( q15_t )0xc000,
@@ -1080,6 +1081,7 @@ const q15_t ALIGN4 realCoefAQ15[8192] =
     ( q15_t )0x3f9b, ( q15_t )0x4000, ( q15_t )0x3fa8, ( q15_t )0x4000, ( q15_t )0x3fb5, ( q15_t )0x4000, ( q15_t )0x3fc1, ( q15_t )0x4000,
     ( q15_t )0x3fce, ( q15_t )0x4000, ( q15_t )0x3fda, ( q15_t )0x4000, ( q15_t )0x3fe7, ( q15_t )0x4000, ( q15_t )0x3ff3, ( q15_t )0x4000,
 };
+#endif
 
 /**
 * \par
@@ -1096,6 +1098,7 @@ const q15_t ALIGN4 realCoefAQ15[8192] =
 *       round(pBTable[i] * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_REALCOEF_Q15)
 const q15_t ALIGN4 realCoefBQ15[8192] =
 {
     ( q15_t )0x4000, ( q15_t )0x4000, ( q15_t )0x400d, ( q15_t )0x4000, ( q15_t )0x4019, ( q15_t )0x4000, ( q15_t )0x4026, ( q15_t )0x4000,
@@ -2123,6 +2126,7 @@ const q15_t ALIGN4 realCoefBQ15[8192] =
     ( q15_t )0x4065, ( q15_t )0xc000, ( q15_t )0x4058, ( q15_t )0xc000, ( q15_t )0x404b, ( q15_t )0xc000, ( q15_t )0x403f, ( q15_t )0xc000,
     ( q15_t )0x4032, ( q15_t )0xc000, ( q15_t )0x4026, ( q15_t )0xc000, ( q15_t )0x4019, ( q15_t )0xc000, ( q15_t )0x400d, ( q15_t )0xc000,
 };
+#endif
 
 /**
 * @} end of RealFFT_Table group
@@ -2165,11 +2169,13 @@ arm_status arm_rfft_init_q15(
     /*  Initialize the Real FFT length */
     S->fftLenReal = ( uint16_t ) fftLenReal;
 
+#if defined(ARM_TABLE_REALCOEF_Q15)
     /*  Initialize the Twiddle coefficientA pointer */
     S->pTwiddleAReal = ( q15_t * ) realCoefAQ15;
 
     /*  Initialize the Twiddle coefficientB pointer */
     S->pTwiddleBReal = ( q15_t * ) realCoefBQ15;
+#endif
 
     /*  Initialize the Flag for selection of RFFT or RIFFT */
     S->ifftFlagR = ( uint8_t ) ifftFlagR;
@@ -2180,50 +2186,68 @@ arm_status arm_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch( S->fftLenReal )
     {
+#if defined(ARM_TABLE_RFFT_Q15_8192)
     case 8192U:
         S->twidCoefRModifier = 1U;
         S->pCfft = &arm_cfft_sR_q15_len4096;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_4096)
     case 4096U:
         S->twidCoefRModifier = 2U;
         S->pCfft = &arm_cfft_sR_q15_len2048;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_2048)
     case 2048U:
         S->twidCoefRModifier = 4U;
         S->pCfft = &arm_cfft_sR_q15_len1024;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_1024)
     case 1024U:
         S->twidCoefRModifier = 8U;
         S->pCfft = &arm_cfft_sR_q15_len512;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_512)
     case 512U:
         S->twidCoefRModifier = 16U;
         S->pCfft = &arm_cfft_sR_q15_len256;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_256)
     case 256U:
         S->twidCoefRModifier = 32U;
         S->pCfft = &arm_cfft_sR_q15_len128;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_128)
     case 128U:
         S->twidCoefRModifier = 64U;
         S->pCfft = &arm_cfft_sR_q15_len64;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_64)
     case 64U:
         S->twidCoefRModifier = 128U;
         S->pCfft = &arm_cfft_sR_q15_len32;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q15_32)
     case 32U:
         S->twidCoefRModifier = 256U;
         S->pCfft = &arm_cfft_sR_q15_len16;
         break;
+#endif
 
     default:
         /*  Reporting argument error if rfftSize is not valid value */
@@ -53,6 +53,7 @@
 * Convert to fixed point Q31 format
 *     round(pATable[i] * pow(2, 31))
 */
+#if defined(ARM_TABLE_REALCOEF_Q31)
 const q31_t realCoefAQ31[8192] =
 {
     ( q31_t )0x40000000, ( q31_t )0xc0000000, ( q31_t )0x3ff36f02, ( q31_t )0xc000013c,
@@ -2104,6 +2105,7 @@ const q31_t realCoefAQ31[8192] =
     ( q31_t )0x3fcdbc0f, ( q31_t )0x3fffec43, ( q31_t )0x3fda4d09, ( q31_t )0x3ffff4e6,
     ( q31_t )0x3fe6de05, ( q31_t )0x3ffffb11, ( q31_t )0x3ff36f02, ( q31_t )0x3ffffec4,
 };
+#endif
 
 
 /**
@@ -2122,6 +2124,7 @@ const q31_t realCoefAQ31[8192] =
 *
 */
 
+#if defined(ARM_TABLE_REALCOEF_Q31)
 const q31_t realCoefBQ31[8192] =
 {
     ( q31_t )0x40000000, ( q31_t )0x40000000, ( q31_t )0x400c90fe, ( q31_t )0x3ffffec4,
@@ -4173,6 +4176,7 @@ const q31_t realCoefBQ31[8192] =
     ( q31_t )0x403243f1, ( q31_t )0xc00013bd, ( q31_t )0x4025b2f7, ( q31_t )0xc0000b1a,
     ( q31_t )0x401921fb, ( q31_t )0xc00004ef, ( q31_t )0x400c90fe, ( q31_t )0xc000013c,
 };
+#endif
 
 /**
 * @} end of RealFFT_Table group
@@ -4216,11 +4220,13 @@ arm_status arm_rfft_init_q31(
     /*  Initialize the Real FFT length */
     S->fftLenReal = ( uint16_t ) fftLenReal;
 
+#if defined(ARM_TABLE_REALCOEF_Q31)
     /*  Initialize the Twiddle coefficientA pointer */
     S->pTwiddleAReal = ( q31_t * ) realCoefAQ31;
 
     /*  Initialize the Twiddle coefficientB pointer */
     S->pTwiddleBReal = ( q31_t * ) realCoefBQ31;
+#endif
 
     /*  Initialize the Flag for selection of RFFT or RIFFT */
     S->ifftFlagR = ( uint8_t ) ifftFlagR;
@@ -4231,50 +4237,68 @@ arm_status arm_rfft_init_q31(
     /*  Initialization of coef modifier depending on the FFT length */
     switch( S->fftLenReal )
     {
+#if defined(ARM_TABLE_RFFT_Q31_8192)
     case 8192U:
         S->twidCoefRModifier = 1U;
         S->pCfft = &arm_cfft_sR_q31_len4096;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_4096)
     case 4096U:
         S->twidCoefRModifier = 2U;
         S->pCfft = &arm_cfft_sR_q31_len2048;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_2048)
     case 2048U:
         S->twidCoefRModifier = 4U;
         S->pCfft = &arm_cfft_sR_q31_len1024;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_1024)
     case 1024U:
         S->twidCoefRModifier = 8U;
         S->pCfft = &arm_cfft_sR_q31_len512;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_512)
     case 512U:
         S->twidCoefRModifier = 16U;
         S->pCfft = &arm_cfft_sR_q31_len256;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_256)
     case 256U:
         S->twidCoefRModifier = 32U;
         S->pCfft = &arm_cfft_sR_q31_len128;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_128)
     case 128U:
         S->twidCoefRModifier = 64U;
         S->pCfft = &arm_cfft_sR_q31_len64;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_64)
     case 64U:
         S->twidCoefRModifier = 128U;
         S->pCfft = &arm_cfft_sR_q31_len32;
         break;
+#endif
 
+#if defined(ARM_TABLE_RFFT_Q31_32)
     case 32U:
         S->twidCoefRModifier = 256U;
         S->pCfft = &arm_cfft_sR_q31_len16;
         break;
+#endif
 
     default:
         /*  Reporting argument error if rfftSize is not valid value */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_init_q15.c
+ * Description:  Initialization function for the Q15 sliding DFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_dft_twiddle_q31(
+    uint32_t phase,
+    q31_t *pCos,
+    q31_t *pSin );
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     numBins number of DFT bins to track.
+ * @param[in]     dftLength length <code>N</code> of the sliding window, at least 2.
+ * @param[in]     *pBins points to the <code>numBins</code> bin indexes, between 0 and <code>N-1</code>.
+ * @param[out]    *pTwiddle points to the twiddle buffer of size <code>2*numBins</code>.
+ * @param[out]    *pDelay points to the delay line of size <code>N</code>.
+ * @param[out]    *pState points to the bin state buffer of size <code>2*numBins</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is 0 or <code>dftLength</code> is less than 2.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pTwiddle</code> receives the damped twiddle factor <code>r*exp(j*2*pi*k/N)</code> of each bin in 1.31 format,
+ * real and imaginary parts interleaved. The delay line and the bin states are cleared, so the window
+ * initially holds <code>N</code> zero samples.
+ */
+
+arm_status arm_sliding_dft_init_q15(
+    arm_sliding_dft_instance_q15 *S,
+    uint16_t numBins,
+    uint16_t dftLength,
+    const uint16_t *pBins,
+    q31_t *pTwiddle,
+    q15_t *pDelay,
+    q31_t *pState )
+{
+    arm_status status;
+    q31_t cosVal, sinVal;                          /* Cosine and sine of the bin frequency */
+    q31_t combCoeff;                               /* r^N */
+    uint32_t i;                                    /* Loop counter */
+
+    if( ( numBins == 0U ) || ( dftLength < 2U ) )
+    {
+        /* Set status as ARM_MATH_ARGUMENT_ERROR */
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+        /* Assign the number of bins and the window length */
+        S->numBins = numBins;
+        S->dftLength = dftLength;
+
+        /* 1/N in 1.31 format */
+        S->invLength = ( q31_t ) ( 0x80000000U / dftLength );
+
+        /* Damped twiddle factors r * exp(j*2*pi*k/N) */
+        for( i = 0U; i < numBins; i++ )
+        {
+            arm_dft_twiddle_q31( ( uint32_t ) ( ( ( uint64_t ) pBins[i] << 32U ) / dftLength ), &cosVal, &sinVal );
+
+            pTwiddle[2U * i] = ( q31_t ) ( ( ( q63_t ) cosVal * ARM_SLIDING_DFT_DAMPING ) >> 31 );
+            pTwiddle[2U * i + 1U] = ( q31_t ) ( ( ( q63_t ) sinVal * ARM_SLIDING_DFT_DAMPING ) >> 31 );
+        }
+
+        /* r^N, applied to the sample leaving the window */
+        combCoeff = ARM_SLIDING_DFT_DAMPING;
+
+        for( i = 1U; i < dftLength; i++ )
+        {
+            combCoeff = ( q31_t ) ( ( ( q63_t ) combCoeff * ARM_SLIDING_DFT_DAMPING ) >> 31 );
+        }
+
+        S->combCoeff = combCoeff;
+
+        /* Assign twiddle pointer */
+        S->pTwiddle = pTwiddle;
+
+        /* Clear the delay line and the bins */
+        memset( pDelay, 0, dftLength * sizeof( q15_t ) );
+        memset( pState, 0, 2U * numBins * sizeof( q31_t ) );
+
+        /* Assign delay line and state pointers */
+        S->pDelay = pDelay;
+        S->pState = pState;
+        S->stateIndex = 0U;
+
+        status = ARM_MATH_SUCCESS;
+    }
+
+    return ( status );
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
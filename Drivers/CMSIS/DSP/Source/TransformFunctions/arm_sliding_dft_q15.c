@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_q15.c
+ * Description:  Q15 sliding DFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * The sliding DFT updates a few bins of an <code>N</code> point DFT over the last <code>N</code> input samples
+ * at every new sample. Bin <code>k</code> is updated with
+ * <pre>
+ *    X[k] = exp(j*2*pi*k/N) * (X[k] + x[n] - x[n-N])
+ * </pre>
+ * which costs one complex multiplication per sample and per bin, and a delay line of <code>N</code> samples.
+ * It suits continuous monitoring of a few frequencies where the Goertzel algorithm would have to wait
+ * for a full block.
+ *
+ * The functions output <code>X/N</code> for the window ending with the last input sample, so a full scale
+ * sine wave at the bin frequency gives a magnitude of 0.5.
+ *
+ * \par Instance Structure
+ * The window length, the bins, the twiddle factors, the delay line and the bin states are stored in an
+ * instance data structure. A separate instance structure must be defined for each input signal.
+ *
+ * \par Initialization Functions
+ * The initialization function computes the twiddle factors in a buffer provided by the caller, and clears
+ * the delay line and the bin states.
+ *
+ * \par Fixed-Point Behavior
+ * The bins are kept as <code>X/N</code> in 1.31 format, so they cannot overflow. The recursion is not
+ * stable with rounded twiddle factors, errors would accumulate forever. The twiddle factors are therefore
+ * multiplied by <code>r = 1 - 2^-20</code> and the sample leaving the window by <code>r^N</code>, which
+ * makes rounding errors decay. The outputs are the DFT of the window weighted by <code>r^(N-1-m)</code>,
+ * a deviation below <code>N * 2^-20</code> relative to the exact DFT.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q15 sliding DFT structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[out] *pDst points to the <code>numBins</code> complex outputs {real, imag}.
+ * @param[in]  blockSize number of input samples to process.
+ * @return none.
+ *
+ * \par
+ * All the input samples are pushed through the window, and the bins of the last window are written to
+ * <code>pDst</code>. Call the function with a <code>blockSize</code> of 1 to get the bins at every sample.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The bin states are in 1.31 format and the outputs are rounded to 1.15 format.
+ */
+
+void arm_sliding_dft_q15(
+    arm_sliding_dft_instance_q15 *S,
+    q15_t *pSrc,
+    q15_t *pDst,
+    uint32_t blockSize )
+{
+    q15_t *pDelay = S->pDelay;                     /* Delay line */
+    q31_t *pState;                                 /* Bin state pointer */
+    q31_t *pTwiddle;                               /* Twiddle pointer */
+    q63_t diff;                                    /* (x[n] - r^N * x[n-N]) / N */
+    q63_t aRe, aIm;                                /* Bin before rotation */
+    q31_t twRe, twIm;                              /* Twiddle factor of the bin */
+    q15_t xNew, xOld;                              /* Samples entering and leaving the window */
+    uint32_t dftLength = S->dftLength;             /* Window length */
+    uint32_t index = S->stateIndex;                /* Position of the oldest sample in the delay line */
+    uint32_t binCnt;                               /* Loop counter */
+
+    while( blockSize > 0U )
+    {
+        /* Replace the oldest sample of the window */
+        xNew = *pSrc++;
+        xOld = pDelay[index];
+        pDelay[index] = xNew;
+
+        index++;
+
+        if( index == dftLength )
+        {
+            index = 0U;
+        }
+
+        /* Difference in 1.31 format, scaled by 1/N */
+        diff = ( ( q63_t ) xNew << 16 ) - ( ( ( ( q63_t ) xOld << 16 ) * S->combCoeff ) >> 31 );
+        diff = ( diff * S->invLength ) >> 31;
+
+        pState = S->pState;
+        pTwiddle = S->pTwiddle;
+        binCnt = S->numBins;
+
+        while( binCnt > 0U )
+        {
+            aRe = pState[0] + diff;
+            aIm = pState[1];
+            twRe = *pTwiddle++;
+            twIm = *pTwiddle++;
+
+            /* X = r * exp(j*2*pi*k/N) * (X + diff), rounded */
+            *pState++ = clip_q63_to_q31( ( ( aRe * twRe ) - ( aIm * twIm ) + 0x40000000 ) >> 31 );
+            *pState++ = clip_q63_to_q31( ( ( aRe * twIm ) + ( aIm * twRe ) + 0x40000000 ) >> 31 );
+
+            /* Decrement the loop counter */
+            binCnt--;
+        }
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->stateIndex = ( uint16_t ) index;
+
+    /* Output the bins of the last window in 1.15 format */
+    pState = S->pState;
+    binCnt = 2U * S->numBins;
+
+    while( binCnt > 0U )
+    {
+        *pDst++ = ( q15_t ) __SSAT( ( *pState >> 16 ) + ( ( *pState >> 15 ) & 1 ), 16 );
+        pState++;
+
+        /* Decrement the loop counter */
+        binCnt--;
+    }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[out] *pDst points to the <code>numBins</code> complex outputs {real, imag}.
+ * @param[in]  blockSize number of input samples to process.
+ * @return none.
+ *
+ * \par
+ * All the input samples are pushed through the window, and the bins of the last window are written to
+ * <code>pDst</code>. Call the function with a <code>blockSize</code> of 1 to get the bins at every sample.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The bin states are in 1.31 format and are copied to the outputs.
+ */
+
+void arm_sliding_dft_q31(
+    arm_sliding_dft_instance_q31 *S,
+    q31_t *pSrc,
+    q31_t *pDst,
+    uint32_t blockSize )
+{
+    q31_t *pDelay = S->pDelay;                     /* Delay line */
+    q31_t *pState;                                 /* Bin state pointer */
+    q31_t *pTwiddle;                               /* Twiddle pointer */
+    q63_t diff;                                    /* (x[n] - r^N * x[n-N]) / N */
+    q63_t aRe, aIm;                                /* Bin before rotation */
+    q31_t twRe, twIm;                              /* Twiddle factor of the bin */
+    q31_t xNew, xOld;                              /* Samples entering and leaving the window */
+    uint32_t dftLength = S->dftLength;             /* Window length */
+    uint32_t index = S->stateIndex;                /* Position of the oldest sample in the delay line */
+    uint32_t binCnt;                               /* Loop counter */
+
+    while( blockSize > 0U )
+    {
+        /* Replace the oldest sample of the window */
+        xNew = *pSrc++;
+        xOld = pDelay[index];
+        pDelay[index] = xNew;
+
+        index++;
+
+        if( index == dftLength )
+        {
+            index = 0U;
+        }
+
+        /* Difference in 1.31 format, scaled by 1/N */
+        diff = ( q63_t ) xNew - ( ( ( q63_t ) xOld * S->combCoeff ) >> 31 );
+        diff = ( diff * S->invLength ) >> 31;
+
+        pState = S->pState;
+        pTwiddle = S->pTwiddle;
+        binCnt = S->numBins;
+
+        while( binCnt > 0U )
+        {
+            aRe = pState[0] + diff;
+            aIm = pState[1];
+            twRe = *pTwiddle++;
+            twIm = *pTwiddle++;
+
+            /* X = r * exp(j*2*pi*k/N) * (X + diff), rounded */
+            *pState++ = clip_q63_to_q31( ( ( aRe * twRe ) - ( aIm * twIm ) + 0x40000000 ) >> 31 );
+            *pState++ = clip_q63_to_q31( ( ( aRe * twIm ) + ( aIm * twRe ) + 0x40000000 ) >> 31 );
+
+            /* Decrement the loop counter */
+            binCnt--;
+        }
+
+        /* Decrement the loop counter */
+        blockSize--;
+    }
+
+    S->stateIndex = ( uint16_t ) index;
+
+    /* Output the bins of the last window */
+    memcpy( pDst, S->pState, 2U * S->numBins * sizeof( q31_t ) );
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
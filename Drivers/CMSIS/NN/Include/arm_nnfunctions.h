@@ -44,6 +44,7 @@
    * - Neural Network Pooling Functions
    * - Softmax Functions
    * - Neural Network Support Functions
+   * - Neural Network Graph Functions
    *
    * The library has separate functions for operating on different weight and activation data
    * types including 8-bit integers (q7_t) and 16-bit integers (q15_t). The descrition of the
@@ -204,6 +205,54 @@ arm_status arm_convolve_HWC_q7_basic_nonsquare( const q7_t *Im_in,
         q15_t *bufferA,
         q7_t *bufferB );
 
+/**
+ * @brief Q7 convolution followed by ReLU and max pooling
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in    input tensor dimention
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       wt           pointer to kernel weights
+ * @param[in]       ch_im_out    number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel   filter kernel size
+ * @param[in]       padding      padding sizes
+ * @param[in]       stride       convolution stride
+ * @param[in]       bias         pointer to bias
+ * @param[in]       bias_shift   amount of left-shift for bias
+ * @param[in]       out_shift    amount of right-shift for output
+ * @param[in]       dim_conv_out dimension of the convolution output, i.e., of the pooling input
+ * @param[in]       pool_kernel  pooling window size
+ * @param[in]       pool_padding pooling padding sizes
+ * @param[in]       pool_stride  pooling stride
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @param[in]       dim_im_out   output tensor dimension
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   bufferB      pointer to buffer space for the convolution rows
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * Same output as arm_convolve_HWC_q7_basic(), arm_relu_q7() and
+ * arm_maxpool_q7_HWC(), with a buffer of pool_kernel convolution rows
+ * instead of the whole convolution output.
+ */
+
+arm_status arm_convolve_HWC_q7_relu_maxpool( const q7_t *Im_in,
+        const uint16_t dim_im_in,
+        const uint16_t ch_im_in,
+        const q7_t *wt,
+        const uint16_t ch_im_out,
+        const uint16_t dim_kernel,
+        const uint16_t padding,
+        const uint16_t stride,
+        const q7_t *bias,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        const uint16_t dim_conv_out,
+        const uint16_t pool_kernel,
+        const uint16_t pool_padding,
+        const uint16_t pool_stride,
+        q7_t *Im_out,
+        const uint16_t dim_im_out,
+        q15_t *bufferA,
+        q7_t *bufferB );
+
 /**
  * @brief Basic Q15 convolution function
  * @param[in]       Im_in       pointer to input tensor
@@ -629,6 +678,135 @@ arm_status arm_depthwise_separable_conv_HWC_q7_nonsquare( const q7_t *Im_in,
         q15_t *bufferA,
         q7_t *bufferB );
 
+/**
+ * @defgroup NNStream Neural Network Streaming Convolution Functions
+ *
+ * Run convolution layers over a time series one time step at a time.
+ *
+ * The time series is a tensor whose y dimension is time: each time step,
+ * or frame, is one row of dim_im_in_x * ch_im_in values in HWC order. A
+ * network run on a sliding window of frames recomputes every output row
+ * of every layer at each hop, although only the newest row of each layer
+ * is new. The streaming functions keep the last dim_kernel_y input frames
+ * of a layer in a state buffer and compute only the output frame of the
+ * newest input frame, with arm_convolve_HWC_q7_basic_nonsquare() or
+ * arm_depthwise_separable_conv_HWC_q7_nonsquare() over those rows.
+ *
+ * The state starts with zeros, so the output frames are those of the
+ * whole series with dim_kernel_y - 1 rows of zero padding before the
+ * first frame, and no padding after. The stride in time is 1.
+ *
+ */
+
+/**
+ * @brief Instance structure of the Q7 streaming convolution layers
+ */
+typedef struct
+{
+    const q7_t *wt;
+    /**< pointer to kernel weights */
+    const q7_t *bias;
+    /**< pointer to bias */
+    q7_t     *pState;
+    /**< pointer to the state buffer, (2*dim_kernel_y-1)*dim_im_in_x*ch_im_in values */
+    uint16_t  dim_im_in_x;
+    /**< input frame dimension */
+    uint16_t  ch_im_in;
+    /**< number of input channels */
+    uint16_t  ch_im_out;
+    /**< number of output channels */
+    uint16_t  dim_kernel_x;
+    /**< filter kernel size x */
+    uint16_t  dim_kernel_y;
+    /**< filter kernel size in time */
+    uint16_t  padding_x;
+    /**< padding size x */
+    uint16_t  stride_x;
+    /**< convolution stride x */
+    uint16_t  bias_shift;
+    /**< amount of left-shift for bias */
+    uint16_t  out_shift;
+    /**< amount of right-shift for output */
+    uint16_t  dim_im_out_x;
+    /**< output frame dimension */
+    uint16_t  stateIndex;
+    /**< state slot of the oldest frame */
+} arm_nn_stream_conv_instance_q7;
+
+/**
+ * @brief Initialization function of the Q7 streaming convolution layers
+ * @param[in,out]   S             points to an instance of the streaming convolution structure
+ * @param[in]       dim_im_in_x   input frame dimension
+ * @param[in]       ch_im_in      number of input channels
+ * @param[in]       wt            pointer to kernel weights
+ * @param[in]       ch_im_out     number of filters, i.e., output channels
+ * @param[in]       dim_kernel_x  filter kernel size x
+ * @param[in]       dim_kernel_y  filter kernel size in time
+ * @param[in]       padding_x     padding size x
+ * @param[in]       stride_x      convolution stride x
+ * @param[in]       bias          pointer to bias
+ * @param[in]       bias_shift    amount of left-shift for bias
+ * @param[in]       out_shift     amount of right-shift for output
+ * @param[in]       dim_im_out_x  output frame dimension
+ * @param[in]       pState        pointer to the state buffer
+ * @return none.
+ *
+ * <b>Buffer size:</b>
+ *
+ * pState size: (2*dim_kernel_y-1)*dim_im_in_x*ch_im_in
+ */
+
+void      arm_nn_stream_conv_init_q7( arm_nn_stream_conv_instance_q7 *S,
+                                      const uint16_t dim_im_in_x,
+                                      const uint16_t ch_im_in,
+                                      const q7_t *wt,
+                                      const uint16_t ch_im_out,
+                                      const uint16_t dim_kernel_x,
+                                      const uint16_t dim_kernel_y,
+                                      const uint16_t padding_x,
+                                      const uint16_t stride_x,
+                                      const q7_t *bias,
+                                      const uint16_t bias_shift,
+                                      const uint16_t out_shift,
+                                      const uint16_t dim_im_out_x,
+                                      q7_t *pState );
+
+/**
+ * @brief Q7 streaming convolution, one time step
+ * @param[in,out]   S             points to an instance of the streaming convolution structure
+ * @param[in]       frame_in      pointer to the newest input frame
+ * @param[out]      frame_out     pointer to the output frame
+ * @param[in,out]   bufferA       pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+ */
+
+arm_status arm_nn_stream_conv_q7( arm_nn_stream_conv_instance_q7 *S,
+                                  const q7_t *frame_in,
+                                  q7_t *frame_out,
+                                  q15_t *bufferA );
+
+/**
+ * @brief Q7 streaming depthwise separable convolution, one time step
+ * @param[in,out]   S             points to an instance of the streaming convolution structure
+ * @param[in]       frame_in      pointer to the newest input frame
+ * @param[out]      frame_out     pointer to the output frame
+ * @param[in,out]   bufferA       pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+ */
+
+arm_status arm_nn_stream_depthwise_conv_q7( arm_nn_stream_conv_instance_q7 *S,
+        const q7_t *frame_in,
+        q7_t *frame_out,
+        q15_t *bufferA );
 
 /**
  * @defgroup FC Fully-connected Layer Functions
@@ -644,6 +822,10 @@ arm_status arm_depthwise_separable_conv_HWC_q7_nonsquare( const q7_t *Im_in,
  * implements the function using regular GEMV approach. The opt functions
  * operates with weights in interleaved formats.
  *
+ * The q4 and sparse functions read compressed weights, 4-bit weights
+ * with a scale per row or blocks of 4 weights in compressed sparse row
+ * format, for the layers that do not fit in flash with 8-bit weights.
+ *
  */
 
 /**
@@ -696,6 +878,63 @@ arm_status arm_fully_connected_q7_opt( const q7_t *pV,
                                        q7_t *pOut,
                                        q15_t *vec_buffer );
 
+/**
+ * @brief Q7 fully-connected layer function with 4-bit weights
+ * @param[in]       pV          pointer to input vector
+ * @param[in]       pM          pointer to packed matrix weights
+ * @param[in]       scale       pointer to the scale of each row
+ * @param[in]       dim_vec     length of the vector
+ * @param[in]       num_of_rows number of rows in weight matrix
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       bias        pointer to bias
+ * @param[in,out]   pOut        pointer to output vector
+ * @param[in,out]   vec_buffer  pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ */
+
+arm_status arm_fully_connected_q4( const q7_t *pV,
+                                   const q7_t *pM,
+                                   const q7_t *scale,
+                                   const uint16_t dim_vec,
+                                   const uint16_t num_of_rows,
+                                   const uint16_t bias_shift,
+                                   const uint16_t out_shift,
+                                   const q7_t *bias,
+                                   q7_t *pOut,
+                                   q15_t *vec_buffer );
+
+/**
+ * @brief Q7 fully-connected layer function with block sparse weights
+ * @param[in]       pV          pointer to input vector
+ * @param[in]       pM          pointer to the weights of the blocks
+ * @param[in]       col_index   pointer to the first column of each block
+ * @param[in]       row_start   pointer to the first block of each row, num_of_rows + 1 entries
+ * @param[in]       dim_vec     length of the vector
+ * @param[in]       num_of_rows number of rows in weight matrix
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       bias        pointer to bias
+ * @param[in,out]   pOut        pointer to output vector
+ * @param[in,out]   vec_buffer  pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ */
+
+arm_status arm_fully_connected_q7_sparse( const q7_t *pV,
+        const q7_t *pM,
+        const uint16_t *col_index,
+        const uint16_t *row_start,
+        const uint16_t dim_vec,
+        const uint16_t num_of_rows,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        const q7_t *bias,
+        q7_t *pOut,
+        q15_t *vec_buffer );
+
 /**
  * @brief Q15 basic fully-connected layer function
  * @param[in]       pV          pointer to input vector
@@ -1003,6 +1242,156 @@ void      arm_softmax_q7( const q7_t *vec_in, const uint16_t dim_vec, q7_t *p_ou
 
 void      arm_softmax_q15( const q15_t *vec_in, const uint16_t dim_vec, q15_t *p_out );
 
+/**
+ * @defgroup NNGraph Neural Network Graph Functions
+ *
+ * Run a whole network from a list of layers, with all the activation
+ * tensors and the scratch buffers of the layer functions packed into a
+ * single arena.
+ *
+ * Each layer reads one tensor and writes one tensor, identified by their
+ * index in the graph. A tensor lives from the first layer that writes it
+ * to the last layer that reads it; the graph input lives from the start
+ * and the graph output until the end. The scratch buffer of a layer
+ * (bufferA of the convolution and pooling functions, vec_buffer of the
+ * fully-connected functions) only lives during that layer. Buffers whose
+ * lifetimes do not overlap share the same bytes of the arena.
+ *
+ * The placement of the buffers is stored in an offsets array: the byte
+ * offsets of the tensors, followed by the offsets of the scratch buffers
+ * of each layer. It is normally computed offline by
+ * Scripts/NNFunctions/nn_graph_gen.py, which also writes the layer list
+ * and the arena size as a C header. arm_nn_graph_plan_q7() computes the
+ * same placement at run time. None of the functions uses the heap.
+ *
+ */
+
+/**
+ * @brief Layer types of the graph functions
+ */
+typedef enum
+{
+    ARM_NN_LAYER_CONV_Q7_BASIC = 0,
+    /**< arm_convolve_HWC_q7_basic */
+    ARM_NN_LAYER_CONV_Q7_FAST = 1,
+    /**< arm_convolve_HWC_q7_fast */
+    ARM_NN_LAYER_CONV_Q7_RGB = 2,
+    /**< arm_convolve_HWC_q7_RGB */
+    ARM_NN_LAYER_DEPTHWISE_CONV_Q7 = 3,
+    /**< arm_depthwise_separable_conv_HWC_q7 */
+    ARM_NN_LAYER_FC_Q7 = 4,
+    /**< arm_fully_connected_q7 */
+    ARM_NN_LAYER_FC_Q7_OPT = 5,
+    /**< arm_fully_connected_q7_opt */
+    ARM_NN_LAYER_RELU_Q7 = 6,
+    /**< arm_relu_q7 */
+    ARM_NN_LAYER_MAXPOOL_Q7 = 7,
+    /**< arm_maxpool_q7_HWC */
+    ARM_NN_LAYER_AVEPOOL_Q7 = 8,
+    /**< arm_avepool_q7_HWC */
+    ARM_NN_LAYER_SOFTMAX_Q7 = 9,
+    /**< arm_softmax_q7 */
+} arm_nn_layer_type;
+
+/**
+ * @brief Q7 layer of a graph
+ *
+ * The input tensor has dim_im_in * dim_im_in * ch_im_in elements and the
+ * output tensor dim_im_out * dim_im_out * ch_im_out elements. For the
+ * fully-connected layers, the input is flattened (dim_vec is
+ * dim_im_in * dim_im_in * ch_im_in), ch_im_out is the number of rows and
+ * dim_im_out is 1. Unused fields are 0.
+ */
+typedef struct
+{
+    uint8_t   type;
+    /**< layer type, one of arm_nn_layer_type */
+    uint8_t   input;
+    /**< index of the input tensor */
+    uint8_t   output;
+    /**< index of the output tensor, equal to input to run ReLU or softmax in place */
+    uint16_t  dim_im_in;
+    /**< input tensor dimension */
+    uint16_t  ch_im_in;
+    /**< number of input tensor channels */
+    uint16_t  ch_im_out;
+    /**< number of output tensor channels */
+    uint16_t  dim_kernel;
+    /**< filter or pooling kernel size */
+    uint16_t  padding;
+    /**< padding sizes */
+    uint16_t  stride;
+    /**< convolution or pooling stride */
+    uint16_t  dim_im_out;
+    /**< output tensor dimension */
+    uint16_t  bias_shift;
+    /**< amount of left-shift for bias */
+    uint16_t  out_shift;
+    /**< amount of right-shift for output */
+    const q7_t *wt;
+    /**< pointer to the weights */
+    const q7_t *bias;
+    /**< pointer to the bias */
+} arm_nn_layer_q7;
+
+/**
+ * @brief Q7 graph, a list of layers run in order
+ */
+typedef struct
+{
+    const arm_nn_layer_q7 *layers;
+    /**< pointer to the layers, in execution order */
+    uint16_t  num_layers;
+    /**< number of layers */
+    uint16_t  num_tensors;
+    /**< number of tensors */
+    uint16_t  input;
+    /**< index of the tensor written by the caller before running the graph */
+    uint16_t  output;
+    /**< index of the tensor holding the result */
+} arm_nn_graph_q7;
+
+/**
+ * @brief Alignment of the buffers in the arena, in bytes
+ */
+#define ARM_NN_GRAPH_ALIGN 4
+
+/**
+ * @brief Computes the placement of the tensors and scratch buffers in the arena
+ * @param[in]       graph       pointer to the graph
+ * @param[out]      offsets     pointer to the offsets, num_tensors + num_layers entries
+ * @param[out]      arena_size  size of the arena, in bytes
+ * @param[in,out]   bufferA     pointer to buffer space for the lifetimes
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of graph checking.
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*(num_tensors + num_layers) words
+ */
+
+arm_status arm_nn_graph_plan_q7( const arm_nn_graph_q7 *graph,
+                                 uint32_t *offsets,
+                                 uint32_t *arena_size,
+                                 uint32_t *bufferA );
+
+/**
+ * @brief Runs all the layers of a graph
+ * @param[in]       graph       pointer to the graph
+ * @param[in]       offsets     pointer to the offsets of the tensors and scratch buffers
+ * @param[in,out]   arena       pointer to the arena, aligned on ARM_NN_GRAPH_ALIGN bytes
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code>
+ * based on the outcome of the layer functions.
+ *
+ * The input must be written at arena + offsets[graph->input] before the
+ * call, and the result is read at arena + offsets[graph->output].
+ */
+
+arm_status arm_nn_graph_run_q7( const arm_nn_graph_q7 *graph,
+                                const uint32_t *offsets,
+                                q7_t *arena );
+
 #ifdef __cplusplus
 }
 #endif
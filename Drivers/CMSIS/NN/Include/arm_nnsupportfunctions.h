@@ -133,6 +133,51 @@ __STATIC_FORCEINLINE void *read_and_pad_reordered( void *source, q31_t *out1, q3
 
     return source;
 }
+
+#else
+
+/**
+ * @brief read one Q7 word and sign-extend its four values, for cores without SXTB16
+ */
+
+__STATIC_FORCEINLINE const q7_t *read_and_extend_q7x4( const q7_t *source, q31_t *out1, q31_t *out2, q31_t *out3, q31_t *out4 )
+{
+    q31_t     inA = *( const q31_t * )source;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    *out1 = ( q31_t )( ( uint32_t )inA << 24 ) >> 24;
+    *out2 = ( q31_t )( ( uint32_t )inA << 16 ) >> 24;
+    *out3 = ( q31_t )( ( uint32_t )inA << 8 ) >> 24;
+    *out4 = inA >> 24;
+#else
+    *out4 = ( q31_t )( ( uint32_t )inA << 24 ) >> 24;
+    *out3 = ( q31_t )( ( uint32_t )inA << 16 ) >> 24;
+    *out2 = ( q31_t )( ( uint32_t )inA << 8 ) >> 24;
+    *out1 = inA >> 24;
+#endif
+
+    return source + 4;
+}
+
+/**
+ * @brief read one Q15 word and sign-extend its two values, for cores without SXTB16
+ */
+
+__STATIC_FORCEINLINE const q15_t *read_and_extend_q15x2( const q15_t *source, q31_t *out1, q31_t *out2 )
+{
+    q31_t     inA = *( const q31_t * )source;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    *out1 = ( q31_t )( ( uint32_t )inA << 16 ) >> 16;
+    *out2 = inA >> 16;
+#else
+    *out2 = ( q31_t )( ( uint32_t )inA << 16 ) >> 16;
+    *out1 = inA >> 16;
+#endif
+
+    return source + 2;
+}
+
 #endif
 
 /**
@@ -195,6 +240,11 @@ void arm_nn_mult_q7(
 #define NN_ROUND(out_shift) 0
 #endif
 
+/**
+ * @brief check that a pointer can be used for word loads on Cortex-M0
+ */
+#define NN_WORD_ALIGNED(ptr) ( ( ( size_t )( ptr ) & 0x3 ) == 0 )
+
 #ifdef __cplusplus
 }
 #endif
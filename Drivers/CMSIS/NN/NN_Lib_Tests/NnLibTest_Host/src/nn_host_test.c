@@ -0,0 +1,1299 @@
+/*
+ * Host test harness for the CMSIS-NN library.
+ *
+ * Runs every kernel of the library that has a reference implementation in
+ * nn_test/Ref_Implementations on randomized shapes, and checks that the
+ * outputs are bit exact. For each kernel it prints the number of cases and
+ * failures, the throughput of the kernel and of the reference in MAC/s, and
+ * the largest scratch buffer use next to the documented size.
+ *
+ * The scratch buffers are allocated with their documented size plus a guard
+ * area and filled with a pattern, so a kernel that writes past the documented
+ * size is reported as a failure. The q7 inputs and weights are sometimes
+ * offset by one byte to exercise the unaligned fallbacks.
+ *
+ * Usage: NnLibTest_Host [--quick] [--cases N] [--seed N] [--csv]
+ *   --quick    20 cases per kernel (used by ctest)
+ *   --cases N  cases per kernel, 200 by default
+ *   --seed N   seed of the shape and data generator
+ *   --csv      print comma separated values instead of a table
+ *
+ * The program returns 1 when a kernel fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+#include "ref_functions.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define NN_MAX_DIM        12      /* Largest input dimension of the convolutions and pooling */
+#define NN_MAX_CH         16      /* Largest number of channels */
+#define NN_MAX_KERNEL     5       /* Largest kernel dimension */
+#define NN_MAX_VEC        320     /* Largest vector of the fully-connected layers */
+#define NN_MAX_ROWS       64      /* Largest number of rows of the fully-connected layers */
+#define NN_MAX_SIZE       1024    /* Largest vector of the element-wise functions */
+
+#define NN_GUARD_BYTES    64      /* Guard area after the scratch buffers */
+#define NN_FILL           0xA5    /* Fill pattern of the scratch buffers */
+
+/* The q15 data is limited to 11 bits so that the accumulators can not overflow */
+#define NN_Q15_RANGE      1024
+
+static uint32_t nn_cases = 200;
+static uint32_t nn_seed = 1;
+static int      nn_csv = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Results */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    const char *name;
+    uint32_t    cases;
+    uint32_t    failures;
+    uint64_t    macs;               /* Multiply-accumulates, or compares for pooling */
+    uint64_t    fut_ns;
+    uint64_t    ref_ns;
+    uint32_t    scratch_used;       /* Largest scratch use, in bytes */
+    uint32_t    scratch_doc;        /* Largest documented scratch size, in bytes */
+} nn_stats;
+
+static uint32_t nn_total_failures = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Random shapes and data */
+/*--------------------------------------------------------------------------------*/
+
+static uint32_t nn_rand_state;
+
+static uint32_t nn_rand( void )
+{
+    /* xorshift32 */
+    nn_rand_state ^= nn_rand_state << 13;
+    nn_rand_state ^= nn_rand_state >> 17;
+    nn_rand_state ^= nn_rand_state << 5;
+    return nn_rand_state;
+}
+
+/* Random integer in [lo hi] */
+static int32_t nn_rand_range( int32_t lo, int32_t hi )
+{
+    return lo + ( int32_t ) ( nn_rand() % ( uint32_t ) ( hi - lo + 1 ) );
+}
+
+/* Random integer in [1 max] rounded up to a multiple of mult */
+static uint16_t nn_rand_mult( int32_t max, int32_t mult )
+{
+    int32_t   v = nn_rand_range( 1, max );
+
+    return ( uint16_t ) ( ( v + mult - 1 ) / mult * mult );
+}
+
+static void nn_fill_q7( q7_t *p, uint32_t n )
+{
+    uint32_t  i;
+
+    for( i = 0; i < n; i++ )
+    {
+        p[i] = ( q7_t ) nn_rand();
+    }
+}
+
+static void nn_fill_q15( q15_t *p, uint32_t n )
+{
+    uint32_t  i;
+
+    for( i = 0; i < n; i++ )
+    {
+        p[i] = ( q15_t ) nn_rand_range( -NN_Q15_RANGE, NN_Q15_RANGE - 1 );
+    }
+}
+
+static uint32_t nn_log2( uint32_t n )
+{
+    uint32_t  l = 0;
+
+    while( n > 1U )
+    {
+        n >>= 1;
+        l++;
+    }
+
+    return l;
+}
+
+/*
+ * Output shift that keeps most outputs out of saturation, for a sum of n
+ * products of data_bits by data_bits values and an output of out_bits
+ */
+static uint16_t nn_out_shift( uint32_t n, uint32_t data_bits, uint32_t out_bits )
+{
+    int32_t   shift = ( int32_t ) ( 2 * data_bits + nn_log2( n ) / 2 ) - ( int32_t ) out_bits + nn_rand_range( -1, 1 );
+
+    return ( uint16_t ) ( shift < 1 ? 1 : shift );
+}
+
+/* Offset of a q7 pointer, 1 byte in one case out of 4 */
+static uint32_t nn_offset( void )
+{
+    return ( nn_rand() & 3U ) == 0U ? 1U : 0U;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Scratch buffers */
+/*--------------------------------------------------------------------------------*/
+
+static void *nn_scratch_alloc( uint32_t bytes )
+{
+    uint8_t  *p = malloc( bytes + NN_GUARD_BYTES );
+
+    memset( p, NN_FILL, bytes + NN_GUARD_BYTES );
+    return p;
+}
+
+/* Bytes of the buffer written by the kernel, up to the last modified byte */
+static uint32_t nn_scratch_used( const void *buf, uint32_t bytes )
+{
+    const uint8_t *p = buf;
+    uint32_t  n = bytes + NN_GUARD_BYTES;
+
+    while( n > 0U && p[n - 1U] == NN_FILL )
+    {
+        n--;
+    }
+
+    return n;
+}
+
+/* Updates the largest use and sets fail when a buffer is written past its documented size */
+static void nn_scratch_check( nn_stats *s, const void *bufA, uint32_t docA, const void *bufB, uint32_t docB, int *fail )
+{
+    uint32_t  usedA = nn_scratch_used( bufA, docA );
+    uint32_t  usedB = bufB ? nn_scratch_used( bufB, docB ) : 0U;
+
+    if( usedA > docA || usedB > docB )
+    {
+        *fail = 1;
+    }
+
+    if( usedA + usedB > s->scratch_used )
+    {
+        s->scratch_used = usedA + usedB;
+    }
+
+    if( docA + docB > s->scratch_doc )
+    {
+        s->scratch_doc = docA + docB;
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Timing */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t nn_now_ns( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( ( uint64_t ) ts.tv_sec * 1000000000U ) + ( uint64_t ) ts.tv_nsec;
+}
+
+/* Run call and add its time, in nanoseconds, to total */
+#define NN_TIME(total, call)                                            \
+    do                                                                  \
+    {                                                                   \
+        uint64_t __nn_start = nn_now_ns();                              \
+                                                                        \
+        call;                                                           \
+        total += nn_now_ns() - __nn_start;                              \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Case bookkeeping */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint16_t  dim_in_x, dim_in_y;
+    uint16_t  ch_in, ch_out;
+    uint16_t  k_x, k_y;
+    uint16_t  pad_x, pad_y;
+    uint16_t  stride_x, stride_y;
+    uint16_t  dim_out_x, dim_out_y;
+    uint16_t  bias_shift, out_shift;
+} nn_shape;
+
+/*
+ * Random convolution or pooling shape. ch_in_mult and ch_out_mult are the
+ * required multiples of the channels, a fixed ch_in is used when not zero.
+ */
+static void nn_gen_shape( nn_shape *sh, int square, int32_t ch_in_mult, int32_t ch_out_mult, uint16_t ch_in, int kernel_1x1 )
+{
+    sh->k_x = kernel_1x1 ? 1 : ( uint16_t ) nn_rand_range( 1, NN_MAX_KERNEL );
+    sh->k_y = square ? sh->k_x : ( kernel_1x1 ? 1 : ( uint16_t ) nn_rand_range( 1, NN_MAX_KERNEL ) );
+    sh->pad_x = kernel_1x1 ? 0 : ( uint16_t ) nn_rand_range( 0, sh->k_x / 2 );
+    sh->pad_y = square ? sh->pad_x : ( kernel_1x1 ? 0 : ( uint16_t ) nn_rand_range( 0, sh->k_y / 2 ) );
+    sh->stride_x = kernel_1x1 ? 1 : ( uint16_t ) nn_rand_range( 1, 2 );
+    sh->stride_y = square ? sh->stride_x : ( kernel_1x1 ? 1 : ( uint16_t ) nn_rand_range( 1, 2 ) );
+
+    /* The input covers at least one kernel */
+    sh->dim_in_x = ( uint16_t ) nn_rand_range( sh->k_x > 2 * sh->pad_x ? sh->k_x - 2 * sh->pad_x : 1, NN_MAX_DIM );
+    sh->dim_in_y = square ? sh->dim_in_x :
+                   ( uint16_t ) nn_rand_range( sh->k_y > 2 * sh->pad_y ? sh->k_y - 2 * sh->pad_y : 1, NN_MAX_DIM );
+    sh->dim_out_x = ( uint16_t ) ( ( sh->dim_in_x + 2 * sh->pad_x - sh->k_x ) / sh->stride_x + 1 );
+    sh->dim_out_y = ( uint16_t ) ( ( sh->dim_in_y + 2 * sh->pad_y - sh->k_y ) / sh->stride_y + 1 );
+
+    sh->ch_in = ch_in ? ch_in : nn_rand_mult( NN_MAX_CH, ch_in_mult );
+    sh->ch_out = ch_out_mult ? nn_rand_mult( NN_MAX_CH, ch_out_mult ) : sh->ch_in;
+    sh->bias_shift = ( uint16_t ) nn_rand_range( 0, 2 );
+}
+
+static void nn_report_failure( const char *name, const nn_shape *sh )
+{
+    fprintf( stderr, "%s: mismatch for in %ux%ux%u, out %ux%ux%u, kernel %ux%u, padding %u,%u, stride %u,%u, "
+             "bias_shift %u, out_shift %u\n", name,
+             sh->dim_in_x, sh->dim_in_y, sh->ch_in, sh->dim_out_x, sh->dim_out_y, sh->ch_out,
+             sh->k_x, sh->k_y, sh->pad_x, sh->pad_y, sh->stride_x, sh->stride_y, sh->bias_shift, sh->out_shift );
+}
+
+static void nn_case_done( nn_stats *s, const nn_shape *sh, int fail, uint64_t macs )
+{
+    s->cases++;
+    s->macs += macs;
+
+    if( fail )
+    {
+        s->failures++;
+
+        /* Only the first failures of a kernel are detailed */
+        if( s->failures <= 3U )
+        {
+            nn_report_failure( s->name, sh );
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Convolutions */
+/*--------------------------------------------------------------------------------*/
+
+enum
+{
+    NN_CONV_Q7_BASIC,
+    NN_CONV_Q7_FAST,
+    NN_CONV_Q7_RGB,
+    NN_CONV_Q7_BASIC_NONSQUARE,
+    NN_CONV_Q7_FAST_NONSQUARE,
+    NN_CONV_Q7_1X1_FAST_NONSQUARE,
+    NN_DEPTHWISE_CONV_Q7,
+    NN_DEPTHWISE_CONV_Q7_NONSQUARE
+};
+
+static void nn_test_conv_q7( nn_stats *s, int variant )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        int       square = variant == NN_CONV_Q7_BASIC || variant == NN_CONV_Q7_FAST || variant == NN_CONV_Q7_RGB
+                           || variant == NN_DEPTHWISE_CONV_Q7;
+        int       depthwise = variant == NN_DEPTHWISE_CONV_Q7 || variant == NN_DEPTHWISE_CONV_Q7_NONSQUARE;
+        int       fast = variant == NN_CONV_Q7_FAST || variant == NN_CONV_Q7_FAST_NONSQUARE
+                         || variant == NN_CONV_Q7_1X1_FAST_NONSQUARE;
+        uint32_t  in_size, wt_size, out_size, bufA_doc, in_off, wt_off;
+        q7_t     *in, *wt, *bias, *out_ref, *out_fut;
+        q15_t    *bufA_ref, *bufA;
+        q7_t     *bufB;
+        arm_status status = ARM_MATH_SUCCESS;
+        int       fail;
+
+        nn_gen_shape( &sh, square, fast ? 4 : 1, depthwise ? 0 : ( fast ? 2 : 1 ),
+                      variant == NN_CONV_Q7_RGB ? 3 : 0, variant == NN_CONV_Q7_1X1_FAST_NONSQUARE );
+        sh.out_shift = nn_out_shift( ( uint32_t ) ( depthwise ? 1 : sh.ch_in ) * sh.k_x * sh.k_y, 7, 7 );
+
+        in_size = ( uint32_t ) sh.dim_in_x * sh.dim_in_y * sh.ch_in;
+        wt_size = ( uint32_t ) sh.ch_out * sh.k_x * sh.k_y * ( depthwise ? 1 : sh.ch_in );
+        out_size = ( uint32_t ) sh.dim_out_x * sh.dim_out_y * sh.ch_out;
+        in_off = nn_offset();
+        wt_off = nn_offset();
+
+        in = ( q7_t * ) malloc( in_size + 1 ) + in_off;
+        wt = ( q7_t * ) malloc( wt_size + 1 ) + wt_off;
+        bias = malloc( sh.ch_out );
+        out_ref = malloc( out_size );
+        out_fut = malloc( out_size );
+        nn_fill_q7( in, in_size );
+        nn_fill_q7( wt, wt_size );
+        nn_fill_q7( bias, sh.ch_out );
+
+        /* bufferA size: 2*ch_im_in*dim_kernel*dim_kernel q15_t, bufferB size: 0 */
+        bufA_doc = 2U * sizeof( q15_t ) * sh.ch_in * sh.k_x * sh.k_y;
+        bufA_ref = malloc( bufA_doc );
+        bufA = nn_scratch_alloc( bufA_doc );
+        bufB = nn_scratch_alloc( 0 );
+
+        if( square && !depthwise )
+        {
+            NN_TIME( s->ref_ns, arm_convolve_HWC_q7_ref( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x, sh.pad_x,
+                     sh.stride_x, bias, sh.bias_shift, sh.out_shift, out_ref,
+                     sh.dim_out_x, bufA_ref, NULL ) );
+        }
+        else if( square )
+        {
+            NN_TIME( s->ref_ns, arm_depthwise_separable_conv_HWC_q7_ref( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out,
+                     sh.k_x, sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                     sh.out_shift, out_ref, sh.dim_out_x, bufA_ref, NULL ) );
+        }
+        else if( !depthwise )
+        {
+            NN_TIME( s->ref_ns, arm_convolve_HWC_q7_ref_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt, sh.ch_out,
+                     sh.k_x, sh.k_y, sh.pad_x, sh.pad_y, sh.stride_x, sh.stride_y,
+                     bias, sh.bias_shift, sh.out_shift, out_ref,
+                     sh.dim_out_x, sh.dim_out_y, bufA_ref, NULL ) );
+        }
+        else
+        {
+            NN_TIME( s->ref_ns, arm_depthwise_separable_conv_HWC_q7_ref_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in,
+                     wt, sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                     sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                     sh.out_shift, out_ref, sh.dim_out_x, sh.dim_out_y,
+                     bufA_ref, NULL ) );
+        }
+
+        switch( variant )
+        {
+        case NN_CONV_Q7_BASIC:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_basic( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x,
+                                         sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q7_FAST:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_fast( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x,
+                                         sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q7_RGB:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_RGB( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x,
+                                         sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q7_BASIC_NONSQUARE:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_basic_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt,
+                                         sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                                         sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, sh.dim_out_y,
+                                         bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q7_FAST_NONSQUARE:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_fast_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt,
+                                         sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                                         sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, sh.dim_out_y,
+                                         bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q7_1X1_FAST_NONSQUARE:
+            NN_TIME( s->fut_ns, status = arm_convolve_1x1_HWC_q7_fast_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in,
+                                         wt, sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                                         sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, sh.dim_out_y,
+                                         bufA, bufB ) );
+            break;
+
+        case NN_DEPTHWISE_CONV_Q7:
+            NN_TIME( s->fut_ns, status = arm_depthwise_separable_conv_HWC_q7( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out,
+                                         sh.k_x, sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        default:
+            NN_TIME( s->fut_ns, status = arm_depthwise_separable_conv_HWC_q7_nonsquare( in, sh.dim_in_x, sh.dim_in_y,
+                                         sh.ch_in, wt, sh.ch_out, sh.k_x, sh.k_y,
+                                         sh.pad_x, sh.pad_y, sh.stride_x, sh.stride_y,
+                                         bias, sh.bias_shift, sh.out_shift, out_fut,
+                                         sh.dim_out_x, sh.dim_out_y, bufA, bufB ) );
+            break;
+        }
+
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, out_size ) != 0;
+        nn_scratch_check( s, bufA, bufA_doc, bufB, 0, &fail );
+        nn_case_done( s, &sh, fail, ( uint64_t ) out_size * sh.k_x * sh.k_y * ( depthwise ? 1 : sh.ch_in ) );
+
+        free( in - in_off );
+        free( wt - wt_off );
+        free( bias );
+        free( out_ref );
+        free( out_fut );
+        free( bufA_ref );
+        free( bufA );
+        free( bufB );
+    }
+}
+
+enum
+{
+    NN_CONV_Q15_BASIC,
+    NN_CONV_Q15_FAST,
+    NN_CONV_Q15_FAST_NONSQUARE
+};
+
+static void nn_test_conv_q15( nn_stats *s, int variant )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        int       fast = variant != NN_CONV_Q15_BASIC;
+        uint32_t  in_size, wt_size, out_size, bufA_doc;
+        q15_t    *in, *wt, *bias, *out_ref, *out_fut, *bufA_ref, *bufA;
+        q7_t     *bufB;
+        arm_status status = ARM_MATH_SUCCESS;
+        int       fail;
+
+        nn_gen_shape( &sh, variant != NN_CONV_Q15_FAST_NONSQUARE, fast ? 2 : 1, fast ? 2 : 1, 0, 0 );
+        sh.out_shift = nn_out_shift( ( uint32_t ) sh.ch_in * sh.k_x * sh.k_y, 10, 15 );
+
+        in_size = ( uint32_t ) sh.dim_in_x * sh.dim_in_y * sh.ch_in;
+        wt_size = ( uint32_t ) sh.ch_out * sh.k_x * sh.k_y * sh.ch_in;
+        out_size = ( uint32_t ) sh.dim_out_x * sh.dim_out_y * sh.ch_out;
+
+        in = malloc( in_size * sizeof( q15_t ) );
+        wt = malloc( wt_size * sizeof( q15_t ) );
+        bias = malloc( sh.ch_out * sizeof( q15_t ) );
+        out_ref = malloc( out_size * sizeof( q15_t ) );
+        out_fut = malloc( out_size * sizeof( q15_t ) );
+        nn_fill_q15( in, in_size );
+        nn_fill_q15( wt, wt_size );
+        nn_fill_q15( bias, sh.ch_out );
+
+        /* bufferA size: ch_im_in*dim_kernel*dim_kernel q15_t, twice that for the fast versions */
+        bufA_doc = ( fast ? 2U : 1U ) * sizeof( q15_t ) * sh.ch_in * sh.k_x * sh.k_y;
+        bufA_ref = malloc( 2U * bufA_doc );
+        bufA = nn_scratch_alloc( bufA_doc );
+        bufB = nn_scratch_alloc( 0 );
+
+        if( variant != NN_CONV_Q15_FAST_NONSQUARE )
+        {
+            NN_TIME( s->ref_ns, arm_convolve_HWC_q15_ref( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x, sh.pad_x,
+                     sh.stride_x, bias, sh.bias_shift, sh.out_shift, out_ref,
+                     sh.dim_out_x, bufA_ref, NULL ) );
+        }
+        else
+        {
+            NN_TIME( s->ref_ns, arm_convolve_HWC_q15_nonsquare_ref( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt, sh.ch_out,
+                     sh.k_x, sh.k_y, sh.pad_x, sh.pad_y, sh.stride_x,
+                     sh.stride_y, bias, sh.bias_shift, sh.out_shift,
+                     out_ref, sh.dim_out_x, sh.dim_out_y, bufA_ref, NULL ) );
+        }
+
+        switch( variant )
+        {
+        case NN_CONV_Q15_BASIC:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q15_basic( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x,
+                                         sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        case NN_CONV_Q15_FAST:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q15_fast( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x,
+                                         sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, bufA, bufB ) );
+            break;
+
+        default:
+            NN_TIME( s->fut_ns, status = arm_convolve_HWC_q15_fast_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt,
+                                         sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                                         sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                                         sh.out_shift, out_fut, sh.dim_out_x, sh.dim_out_y,
+                                         bufA, bufB ) );
+            break;
+        }
+
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, out_size * sizeof( q15_t ) ) != 0;
+        nn_scratch_check( s, bufA, bufA_doc, bufB, 0, &fail );
+        nn_case_done( s, &sh, fail, ( uint64_t ) out_size * sh.k_x * sh.k_y * sh.ch_in );
+
+        free( in );
+        free( wt );
+        free( bias );
+        free( out_ref );
+        free( out_fut );
+        free( bufA_ref );
+        free( bufA );
+        free( bufB );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Fully-connected layers */
+/*--------------------------------------------------------------------------------*/
+
+enum
+{
+    NN_FC_Q7,
+    NN_FC_Q7_OPT,
+    NN_FC_Q15,
+    NN_FC_Q15_OPT,
+    NN_FC_MAT_Q7_VEC_Q15,
+    NN_FC_MAT_Q7_VEC_Q15_OPT
+};
+
+static void nn_test_fc( nn_stats *s, int variant )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        int       q7_vec = variant == NN_FC_Q7 || variant == NN_FC_Q7_OPT;
+        int       q7_mat = variant != NN_FC_Q15 && variant != NN_FC_Q15_OPT;
+        uint32_t  vec_bytes = q7_vec ? sizeof( q7_t ) : sizeof( q15_t );
+        uint32_t  mat_bytes = q7_mat ? sizeof( q7_t ) : sizeof( q15_t );
+        uint32_t  out_bytes = q7_vec ? sizeof( q7_t ) : sizeof( q15_t );
+        uint32_t  mat_size, buf_doc, vec_off, mat_off;
+        uint8_t  *vec, *mat, *bias, *out_ref, *out_fut;
+        q15_t    *buf_ref, *buf;
+        arm_status status = ARM_MATH_SUCCESS;
+        int       fail;
+
+        memset( &sh, 0, sizeof( sh ) );
+        sh.dim_in_x = ( uint16_t ) nn_rand_range( 1, NN_MAX_VEC );
+        sh.dim_in_y = 1;
+        sh.ch_in = 1;
+        sh.ch_out = ( uint16_t ) nn_rand_range( 1, NN_MAX_ROWS );
+        sh.dim_out_x = 1;
+        sh.dim_out_y = 1;
+        sh.bias_shift = ( uint16_t ) nn_rand_range( 0, 2 );
+        sh.out_shift = nn_out_shift( sh.dim_in_x, q7_vec ? 7 : ( q7_mat ? 9 : 10 ), q7_vec ? 7 : 15 );
+
+        /* Only the q7 pointers are moved, the q15 ones must stay aligned on their type */
+        mat_size = ( uint32_t ) sh.dim_in_x * sh.ch_out;
+        vec_off = q7_vec ? nn_offset() : 0U;
+        mat_off = q7_mat ? nn_offset() : 0U;
+
+        vec = ( uint8_t * ) malloc( sh.dim_in_x * vec_bytes + 1 ) + vec_off;
+        mat = ( uint8_t * ) malloc( mat_size * mat_bytes + 1 ) + mat_off;
+        bias = malloc( sh.ch_out * mat_bytes );
+        out_ref = malloc( sh.ch_out * out_bytes );
+        out_fut = malloc( sh.ch_out * out_bytes );
+
+        if( q7_vec )
+        {
+            nn_fill_q7( ( q7_t * ) vec, sh.dim_in_x );
+        }
+        else
+        {
+            nn_fill_q15( ( q15_t * ) vec, sh.dim_in_x );
+        }
+
+        if( q7_mat )
+        {
+            nn_fill_q7( ( q7_t * ) mat, mat_size );
+            nn_fill_q7( ( q7_t * ) bias, sh.ch_out );
+        }
+        else
+        {
+            nn_fill_q15( ( q15_t * ) mat, mat_size );
+            nn_fill_q15( ( q15_t * ) bias, sh.ch_out );
+        }
+
+        /* vec_buffer size: dim_vec q15_t for the q7 versions, 0 for the others */
+        buf_doc = q7_vec ? sizeof( q15_t ) * sh.dim_in_x : 0U;
+        buf_ref = malloc( sizeof( q15_t ) * sh.dim_in_x );
+        buf = nn_scratch_alloc( buf_doc );
+
+        switch( variant )
+        {
+        case NN_FC_Q7:
+            NN_TIME( s->ref_ns, arm_fully_connected_q7_ref( ( q7_t * ) vec, ( q7_t * ) mat, sh.dim_in_x, sh.ch_out,
+                     sh.bias_shift, sh.out_shift, ( q7_t * ) bias,
+                     ( q7_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q7( ( q7_t * ) vec, ( q7_t * ) mat, sh.dim_in_x, sh.ch_out,
+                                         sh.bias_shift, sh.out_shift, ( q7_t * ) bias,
+                                         ( q7_t * ) out_fut, buf ) );
+            break;
+
+        case NN_FC_Q7_OPT:
+            NN_TIME( s->ref_ns, arm_fully_connected_q7_opt_ref( ( q7_t * ) vec, ( q7_t * ) mat, sh.dim_in_x, sh.ch_out,
+                     sh.bias_shift, sh.out_shift, ( q7_t * ) bias,
+                     ( q7_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q7_opt( ( q7_t * ) vec, ( q7_t * ) mat, sh.dim_in_x,
+                                         sh.ch_out, sh.bias_shift, sh.out_shift,
+                                         ( q7_t * ) bias, ( q7_t * ) out_fut, buf ) );
+            break;
+
+        case NN_FC_Q15:
+            NN_TIME( s->ref_ns, arm_fully_connected_q15_ref( ( q15_t * ) vec, ( q15_t * ) mat, sh.dim_in_x, sh.ch_out,
+                     sh.bias_shift, sh.out_shift, ( q15_t * ) bias,
+                     ( q15_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q15( ( q15_t * ) vec, ( q15_t * ) mat, sh.dim_in_x,
+                                         sh.ch_out, sh.bias_shift, sh.out_shift,
+                                         ( q15_t * ) bias, ( q15_t * ) out_fut, buf ) );
+            break;
+
+        case NN_FC_Q15_OPT:
+            NN_TIME( s->ref_ns, arm_fully_connected_q15_opt_ref( ( q15_t * ) vec, ( q15_t * ) mat, sh.dim_in_x,
+                     sh.ch_out, sh.bias_shift, sh.out_shift, ( q15_t * ) bias,
+                     ( q15_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q15_opt( ( q15_t * ) vec, ( q15_t * ) mat, sh.dim_in_x,
+                                         sh.ch_out, sh.bias_shift, sh.out_shift,
+                                         ( q15_t * ) bias, ( q15_t * ) out_fut, buf ) );
+            break;
+
+        case NN_FC_MAT_Q7_VEC_Q15:
+            NN_TIME( s->ref_ns, arm_fully_connected_mat_q7_vec_q15_ref( ( q15_t * ) vec, ( q7_t * ) mat, sh.dim_in_x,
+                     sh.ch_out, sh.bias_shift, sh.out_shift,
+                     ( q7_t * ) bias, ( q15_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_mat_q7_vec_q15( ( q15_t * ) vec, ( q7_t * ) mat,
+                                         sh.dim_in_x, sh.ch_out, sh.bias_shift,
+                                         sh.out_shift, ( q7_t * ) bias,
+                                         ( q15_t * ) out_fut, buf ) );
+            break;
+
+        default:
+            NN_TIME( s->ref_ns, arm_fully_connected_mat_q7_vec_q15_opt_ref( ( q15_t * ) vec, ( q7_t * ) mat,
+                     sh.dim_in_x, sh.ch_out, sh.bias_shift,
+                     sh.out_shift, ( q7_t * ) bias,
+                     ( q15_t * ) out_ref, buf_ref ) );
+            NN_TIME( s->fut_ns, status = arm_fully_connected_mat_q7_vec_q15_opt( ( q15_t * ) vec, ( q7_t * ) mat,
+                                         sh.dim_in_x, sh.ch_out, sh.bias_shift,
+                                         sh.out_shift, ( q7_t * ) bias,
+                                         ( q15_t * ) out_fut, buf ) );
+            break;
+        }
+
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, sh.ch_out * out_bytes ) != 0;
+        nn_scratch_check( s, buf, buf_doc, NULL, 0, &fail );
+        nn_case_done( s, &sh, fail, mat_size );
+
+        free( vec - vec_off );
+        free( mat - mat_off );
+        free( bias );
+        free( out_ref );
+        free( out_fut );
+        free( buf_ref );
+        free( buf );
+    }
+}
+
+/*
+ * Fully-connected layers with compressed weights, checked with
+ * arm_fully_connected_q7_ref() on the dense weights they stand for. The
+ * multiply-accumulates are the ones of the dense layer.
+ */
+static void nn_test_fc_compressed( nn_stats *s, int sparse )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        uint32_t  mat_size, row_bytes, num_blocks, buf_doc, vec_off, mat_off, i, j, k;
+        q7_t     *vec, *dense, *mat, *scale, *bias, *out_ref, *out_fut;
+        uint16_t *col_index, *row_start;
+        q15_t    *buf_ref, *buf;
+        arm_status status = ARM_MATH_SUCCESS;
+        int       fail;
+
+        memset( &sh, 0, sizeof( sh ) );
+
+        /* The word paths of the 4-bit kernel need a multiple of 8 */
+        if( sparse )
+        {
+            sh.dim_in_x = nn_rand_mult( NN_MAX_VEC, 4 );
+        }
+        else
+        {
+            sh.dim_in_x = ( nn_rand() & 1U ) ? nn_rand_mult( NN_MAX_VEC, 8 ) : ( uint16_t ) nn_rand_range( 1, NN_MAX_VEC );
+        }
+
+        sh.dim_in_y = 1;
+        sh.ch_in = 1;
+        sh.ch_out = ( uint16_t ) nn_rand_range( 1, NN_MAX_ROWS );
+        sh.dim_out_x = 1;
+        sh.dim_out_y = 1;
+        sh.bias_shift = ( uint16_t ) nn_rand_range( 0, 2 );
+        sh.out_shift = nn_out_shift( sh.dim_in_x, 7, 7 );
+
+        mat_size = ( uint32_t ) sh.dim_in_x * sh.ch_out;
+        row_bytes = ( sh.dim_in_x + 1U ) / 2U;
+        vec_off = nn_offset();
+        mat_off = nn_offset();
+
+        vec = ( q7_t * ) malloc( sh.dim_in_x + 1 ) + vec_off;
+        dense = malloc( mat_size );
+        mat = ( q7_t * ) malloc( ( sparse ? mat_size : sh.ch_out * row_bytes ) + 1 ) + mat_off;
+        scale = malloc( sh.ch_out );
+        col_index = malloc( sizeof( uint16_t ) * ( mat_size / 4U + 1U ) );
+        row_start = malloc( sizeof( uint16_t ) * ( sh.ch_out + 1U ) );
+        bias = malloc( sh.ch_out );
+        out_ref = malloc( sh.ch_out );
+        out_fut = malloc( sh.ch_out );
+
+        nn_fill_q7( vec, sh.dim_in_x );
+        nn_fill_q7( bias, sh.ch_out );
+        num_blocks = 0;
+
+        for( i = 0; i < sh.ch_out; i++ )
+        {
+            if( sparse )
+            {
+                /* A random share of the blocks of 4 weights is kept */
+                uint32_t  density = nn_rand() % 5U;
+
+                row_start[i] = ( uint16_t ) num_blocks;
+
+                for( j = 0; j < sh.dim_in_x; j += 4U )
+                {
+                    int       keep = nn_rand() % 4U < density;
+
+                    for( k = 0; k < 4U; k++ )
+                    {
+                        q7_t      w = keep ? ( q7_t ) nn_rand() : 0;
+
+                        dense[i * sh.dim_in_x + j + k] = w;
+                        mat[num_blocks * 4U + k] = w;
+                    }
+
+                    if( keep )
+                    {
+                        col_index[num_blocks++] = ( uint16_t ) j;
+                    }
+                }
+            }
+            else
+            {
+                /* The scales keep the dense weights in q7 */
+                scale[i] = ( q7_t ) nn_rand_range( 1, 16 );
+                nn_fill_q7( mat + i * row_bytes, row_bytes );
+
+                for( j = 0; j < sh.dim_in_x; j++ )
+                {
+                    uint32_t  w = ( uint8_t ) mat[i * row_bytes + j / 2U];
+                    int32_t   w4 = ( ( ( j & 1U ) ? w >> 4 : w ) & 0xFU ) ^ 0x8U;
+
+                    dense[i * sh.dim_in_x + j] = ( q7_t ) ( ( w4 - 8 ) * scale[i] );
+                }
+            }
+        }
+
+        row_start[sh.ch_out] = ( uint16_t ) num_blocks;
+
+        /* vec_buffer size: dim_vec q15_t */
+        buf_doc = sizeof( q15_t ) * sh.dim_in_x;
+        buf_ref = malloc( buf_doc );
+        buf = nn_scratch_alloc( buf_doc );
+
+        NN_TIME( s->ref_ns, arm_fully_connected_q7_ref( vec, dense, sh.dim_in_x, sh.ch_out, sh.bias_shift, sh.out_shift,
+                 bias, out_ref, buf_ref ) );
+
+        if( sparse )
+        {
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q7_sparse( vec, mat, col_index, row_start, sh.dim_in_x,
+                                         sh.ch_out, sh.bias_shift, sh.out_shift, bias,
+                                         out_fut, buf ) );
+        }
+        else
+        {
+            NN_TIME( s->fut_ns, status = arm_fully_connected_q4( vec, mat, scale, sh.dim_in_x, sh.ch_out,
+                                         sh.bias_shift, sh.out_shift, bias, out_fut, buf ) );
+        }
+
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, sh.ch_out ) != 0;
+        nn_scratch_check( s, buf, buf_doc, NULL, 0, &fail );
+        nn_case_done( s, &sh, fail, mat_size );
+
+        free( vec - vec_off );
+        free( dense );
+        free( mat - mat_off );
+        free( scale );
+        free( col_index );
+        free( row_start );
+        free( bias );
+        free( out_ref );
+        free( out_fut );
+        free( buf_ref );
+        free( buf );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Pooling */
+/*--------------------------------------------------------------------------------*/
+
+static void nn_test_pool( nn_stats *s, int average )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        uint32_t  in_size, out_size, bufA_doc;
+        q7_t     *in_ref, *in_fut, *out_ref, *out_fut, *bufA_ref, *bufA;
+
+        nn_gen_shape( &sh, 1, 1, 0, 0, 0 );
+        sh.bias_shift = 0;
+        sh.out_shift = 0;
+
+        in_size = ( uint32_t ) sh.dim_in_x * sh.dim_in_y * sh.ch_in;
+        out_size = ( uint32_t ) sh.dim_out_x * sh.dim_out_y * sh.ch_in;
+
+        /* The pooling functions may use their input as scratch, each one gets a copy */
+        in_ref = malloc( in_size );
+        in_fut = malloc( in_size );
+        out_ref = malloc( out_size );
+        out_fut = malloc( out_size );
+        nn_fill_q7( in_ref, in_size );
+        memcpy( in_fut, in_ref, in_size );
+
+        /* bufferA size: 2*dim_im_out*ch_im_in for the average, 0 for the max pooling */
+        bufA_doc = average ? 2U * sh.dim_out_x * sh.ch_in : 0U;
+        bufA_ref = malloc( 2U * sh.dim_out_x * sh.ch_in );
+        bufA = nn_scratch_alloc( bufA_doc );
+
+        if( average )
+        {
+            NN_TIME( s->ref_ns, arm_avepool_q7_HWC_ref( in_ref, sh.dim_in_x, sh.ch_in, sh.k_x, sh.pad_x, sh.stride_x,
+                     sh.dim_out_x, bufA_ref, out_ref ) );
+            NN_TIME( s->fut_ns, arm_avepool_q7_HWC( in_fut, sh.dim_in_x, sh.ch_in, sh.k_x, sh.pad_x, sh.stride_x,
+                                                    sh.dim_out_x, bufA, out_fut ) );
+        }
+        else
+        {
+            NN_TIME( s->ref_ns, arm_maxpool_q7_HWC_ref( in_ref, sh.dim_in_x, sh.ch_in, sh.k_x, sh.pad_x, sh.stride_x,
+                     sh.dim_out_x, bufA_ref, out_ref ) );
+            NN_TIME( s->fut_ns, arm_maxpool_q7_HWC( in_fut, sh.dim_in_x, sh.ch_in, sh.k_x, sh.pad_x, sh.stride_x,
+                                                    sh.dim_out_x, bufA, out_fut ) );
+        }
+
+        {
+            int       fail = memcmp( out_ref, out_fut, out_size ) != 0;
+
+            nn_scratch_check( s, bufA, bufA_doc, NULL, 0, &fail );
+            nn_case_done( s, &sh, fail, ( uint64_t ) out_size * sh.k_x * sh.k_y );
+        }
+
+        free( in_ref );
+        free( in_fut );
+        free( out_ref );
+        free( out_fut );
+        free( bufA_ref );
+        free( bufA );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Fused layers */
+/*--------------------------------------------------------------------------------*/
+
+/* arm_convolve_HWC_q7_relu_maxpool against the reference convolution, ReLU and max pooling */
+static void nn_test_conv_relu_pool( nn_stats *s, int variant )
+{
+    uint32_t  c;
+
+    ( void ) variant;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        uint16_t  pool_k, pool_pad, pool_stride, pool_dim;
+        uint32_t  in_size, wt_size, conv_size, out_size, bufA_doc, bufB_doc, in_off, wt_off;
+        q7_t     *in, *wt, *bias, *conv_ref, *out_ref, *out_fut;
+        q15_t    *bufA_ref, *bufA;
+        q7_t     *bufB;
+        arm_status status;
+        int       fail;
+
+        nn_gen_shape( &sh, 1, 1, 1, 0, 0 );
+        sh.out_shift = nn_out_shift( ( uint32_t ) sh.ch_in * sh.k_x * sh.k_y, 7, 7 );
+
+        /* Pooling window inside the padded convolution output */
+        pool_k = ( uint16_t ) nn_rand_range( 1, sh.dim_out_x < 3 ? sh.dim_out_x : 3 );
+        pool_pad = ( uint16_t ) nn_rand_range( 0, pool_k / 2 );
+        pool_stride = ( uint16_t ) nn_rand_range( 1, 3 );
+        pool_dim = ( uint16_t ) ( ( sh.dim_out_x + 2 * pool_pad - pool_k ) / pool_stride + 1 );
+
+        in_size = ( uint32_t ) sh.dim_in_x * sh.dim_in_x * sh.ch_in;
+        wt_size = ( uint32_t ) sh.ch_out * sh.k_x * sh.k_x * sh.ch_in;
+        conv_size = ( uint32_t ) sh.dim_out_x * sh.dim_out_x * sh.ch_out;
+        out_size = ( uint32_t ) pool_dim * pool_dim * sh.ch_out;
+        in_off = nn_offset();
+        wt_off = nn_offset();
+
+        in = ( q7_t * ) malloc( in_size + 1 ) + in_off;
+        wt = ( q7_t * ) malloc( wt_size + 1 ) + wt_off;
+        bias = malloc( sh.ch_out );
+        conv_ref = malloc( conv_size );
+        out_ref = malloc( out_size );
+        out_fut = malloc( out_size );
+        nn_fill_q7( in, in_size );
+        nn_fill_q7( wt, wt_size );
+        nn_fill_q7( bias, sh.ch_out );
+
+        /* bufferA size: 2*ch_im_in*dim_kernel*dim_kernel q15_t, bufferB size: pool_kernel*dim_conv_out*ch_im_out */
+        bufA_doc = 2U * sizeof( q15_t ) * sh.ch_in * sh.k_x * sh.k_x;
+        bufB_doc = ( uint32_t ) pool_k * sh.dim_out_x * sh.ch_out;
+        bufA_ref = malloc( bufA_doc );
+        bufA = nn_scratch_alloc( bufA_doc );
+        bufB = nn_scratch_alloc( bufB_doc );
+
+        NN_TIME( s->ref_ns,
+                 arm_convolve_HWC_q7_ref( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x, sh.pad_x, sh.stride_x,
+                                          bias, sh.bias_shift, sh.out_shift, conv_ref, sh.dim_out_x, bufA_ref, NULL );
+                 arm_relu_q7_ref( conv_ref, ( uint16_t ) conv_size );
+                 arm_maxpool_q7_HWC_ref( conv_ref, sh.dim_out_x, sh.ch_out, pool_k, pool_pad, pool_stride, pool_dim,
+                                         NULL, out_ref ) );
+
+        NN_TIME( s->fut_ns, status = arm_convolve_HWC_q7_relu_maxpool( in, sh.dim_in_x, sh.ch_in, wt, sh.ch_out,
+                                     sh.k_x, sh.pad_x, sh.stride_x, bias, sh.bias_shift,
+                                     sh.out_shift, sh.dim_out_x, pool_k, pool_pad, pool_stride,
+                                     out_fut, pool_dim, bufA, bufB ) );
+
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, out_size ) != 0;
+        nn_scratch_check( s, bufA, bufA_doc, bufB, bufB_doc, &fail );
+        nn_case_done( s, &sh, fail, ( uint64_t ) conv_size * sh.k_x * sh.k_x * sh.ch_in );
+
+        free( in - in_off );
+        free( wt - wt_off );
+        free( bias );
+        free( conv_ref );
+        free( out_ref );
+        free( out_fut );
+        free( bufA_ref );
+        free( bufA );
+        free( bufB );
+    }
+}
+
+/*
+ * Streaming convolutions fed one frame at a time, against the reference
+ * convolution of the whole series with dim_kernel_y - 1 rows of padding.
+ * The frames are the rows of the shape.
+ */
+static void nn_test_stream_conv( nn_stats *s, int depthwise )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        arm_nn_stream_conv_instance_q7 S;
+        uint32_t  in_size, wt_size, frame_in, frame_out, out_size, bufA_doc, state_doc, t;
+        q7_t     *in, *wt, *bias, *out_ref, *out_fut, *state;
+        q15_t    *bufA_ref, *bufA;
+        arm_status status = ARM_MATH_SUCCESS;
+        int       fail;
+
+        nn_gen_shape( &sh, 0, 1, depthwise ? 0 : 1, 0, 0 );
+        sh.pad_y = sh.k_y - 1;
+        sh.stride_y = 1;
+        sh.dim_out_y = ( uint16_t ) ( sh.dim_in_y + sh.k_y - 1 );
+        sh.out_shift = nn_out_shift( ( uint32_t ) ( depthwise ? 1 : sh.ch_in ) * sh.k_x * sh.k_y, 7, 7 );
+
+        frame_in = ( uint32_t ) sh.dim_in_x * sh.ch_in;
+        frame_out = ( uint32_t ) sh.dim_out_x * sh.ch_out;
+        in_size = frame_in * sh.dim_in_y;
+        wt_size = ( uint32_t ) sh.ch_out * sh.k_x * sh.k_y * ( depthwise ? 1 : sh.ch_in );
+        out_size = frame_out * sh.dim_in_y;
+
+        in = malloc( in_size );
+        wt = malloc( wt_size );
+        bias = malloc( sh.ch_out );
+        out_ref = malloc( ( size_t ) frame_out * sh.dim_out_y );
+        out_fut = malloc( out_size );
+        nn_fill_q7( in, in_size );
+        nn_fill_q7( wt, wt_size );
+        nn_fill_q7( bias, sh.ch_out );
+
+        /* bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y q15_t, pState size: (2*dim_kernel_y-1)*dim_im_in_x*ch_im_in */
+        bufA_doc = 2U * sizeof( q15_t ) * sh.ch_in * sh.k_x * sh.k_y;
+        state_doc = ( 2U * sh.k_y - 1U ) * frame_in;
+        bufA_ref = malloc( bufA_doc );
+        bufA = nn_scratch_alloc( bufA_doc );
+        state = nn_scratch_alloc( state_doc );
+
+        if( depthwise )
+        {
+            NN_TIME( s->ref_ns, arm_depthwise_separable_conv_HWC_q7_ref_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in,
+                     wt, sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.pad_y,
+                     sh.stride_x, sh.stride_y, bias, sh.bias_shift,
+                     sh.out_shift, out_ref, sh.dim_out_x, sh.dim_out_y,
+                     bufA_ref, NULL ) );
+        }
+        else
+        {
+            NN_TIME( s->ref_ns, arm_convolve_HWC_q7_ref_nonsquare( in, sh.dim_in_x, sh.dim_in_y, sh.ch_in, wt, sh.ch_out,
+                     sh.k_x, sh.k_y, sh.pad_x, sh.pad_y, sh.stride_x, sh.stride_y,
+                     bias, sh.bias_shift, sh.out_shift, out_ref,
+                     sh.dim_out_x, sh.dim_out_y, bufA_ref, NULL ) );
+        }
+
+        arm_nn_stream_conv_init_q7( &S, sh.dim_in_x, sh.ch_in, wt, sh.ch_out, sh.k_x, sh.k_y, sh.pad_x, sh.stride_x,
+                                    bias, sh.bias_shift, sh.out_shift, sh.dim_out_x, state );
+
+        for( t = 0; t < sh.dim_in_y && status == ARM_MATH_SUCCESS; t++ )
+        {
+            if( depthwise )
+            {
+                NN_TIME( s->fut_ns, status = arm_nn_stream_depthwise_conv_q7( &S, in + t * frame_in,
+                                             out_fut + t * frame_out, bufA ) );
+            }
+            else
+            {
+                NN_TIME( s->fut_ns, status = arm_nn_stream_conv_q7( &S, in + t * frame_in, out_fut + t * frame_out, bufA ) );
+            }
+        }
+
+        /* Only the first dim_in_y output rows of the reference use the frames received so far */
+        fail = status != ARM_MATH_SUCCESS || memcmp( out_ref, out_fut, out_size ) != 0;
+        nn_scratch_check( s, bufA, bufA_doc, state, state_doc, &fail );
+        nn_case_done( s, &sh, fail, ( uint64_t ) out_size * sh.k_x * sh.k_y * ( depthwise ? 1 : sh.ch_in ) );
+
+        free( in );
+        free( wt );
+        free( bias );
+        free( out_ref );
+        free( out_fut );
+        free( bufA_ref );
+        free( bufA );
+        free( state );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Element-wise functions */
+/*--------------------------------------------------------------------------------*/
+
+enum
+{
+    NN_RELU_Q7,
+    NN_RELU_Q15,
+    NN_MULT_Q7,
+    NN_MULT_Q15
+};
+
+static void nn_test_elementwise( nn_stats *s, int variant )
+{
+    uint32_t  c;
+
+    for( c = 0; c < nn_cases; c++ )
+    {
+        nn_shape  sh;
+        int       q7 = variant == NN_RELU_Q7 || variant == NN_MULT_Q7;
+        uint32_t  bytes = q7 ? sizeof( q7_t ) : sizeof( q15_t );
+        uint32_t  size = ( uint32_t ) nn_rand_range( 1, NN_MAX_SIZE );
+        uint8_t  *a = malloc( size * bytes );
+        uint8_t  *b = malloc( size * bytes );
+        uint8_t  *out_ref = malloc( size * bytes );
+        uint8_t  *out_fut = malloc( size * bytes );
+        int       fail;
+
+        memset( &sh, 0, sizeof( sh ) );
+        sh.dim_in_x = ( uint16_t ) size;
+        sh.out_shift = ( uint16_t ) nn_rand_range( 1, q7 ? 7 : 15 );
+
+        if( q7 )
+        {
+            nn_fill_q7( ( q7_t * ) a, size );
+            nn_fill_q7( ( q7_t * ) b, size );
+        }
+        else
+        {
+            /* Full range, the products are 32-bit */
+            uint32_t  i;
+
+            for( i = 0; i < size; i++ )
+            {
+                ( ( q15_t * ) a )[i] = ( q15_t ) nn_rand();
+                ( ( q15_t * ) b )[i] = ( q15_t ) nn_rand();
+            }
+        }
+
+        switch( variant )
+        {
+        case NN_RELU_Q7:
+            memcpy( out_ref, a, size );
+            memcpy( out_fut, a, size );
+            NN_TIME( s->ref_ns, arm_relu_q7_ref( ( q7_t * ) out_ref, ( uint16_t ) size ) );
+            NN_TIME( s->fut_ns, arm_relu_q7( ( q7_t * ) out_fut, ( uint16_t ) size ) );
+            break;
+
+        case NN_RELU_Q15:
+            memcpy( out_ref, a, size * bytes );
+            memcpy( out_fut, a, size * bytes );
+            NN_TIME( s->ref_ns, arm_relu_q15_ref( ( q15_t * ) out_ref, ( uint16_t ) size ) );
+            NN_TIME( s->fut_ns, arm_relu_q15( ( q15_t * ) out_fut, ( uint16_t ) size ) );
+            break;
+
+        case NN_MULT_Q7:
+            NN_TIME( s->ref_ns, arm_nn_mult_q7_ref( ( q7_t * ) a, ( q7_t * ) b, ( q7_t * ) out_ref, sh.out_shift, size ) );
+            NN_TIME( s->fut_ns, arm_nn_mult_q7( ( q7_t * ) a, ( q7_t * ) b, ( q7_t * ) out_fut, sh.out_shift, size ) );
+            break;
+
+        default:
+            NN_TIME( s->ref_ns, arm_nn_mult_q15_ref( ( q15_t * ) a, ( q15_t * ) b, ( q15_t * ) out_ref, sh.out_shift,
+                     size ) );
+            NN_TIME( s->fut_ns, arm_nn_mult_q15( ( q15_t * ) a, ( q15_t * ) b, ( q15_t * ) out_fut, sh.out_shift,
+                                                 size ) );
+            break;
+        }
+
+        fail = memcmp( out_ref, out_fut, size * bytes ) != 0;
+        nn_case_done( s, &sh, fail, size );
+
+        free( a );
+        free( b );
+        free( out_ref );
+        free( out_fut );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Report */
+/*--------------------------------------------------------------------------------*/
+
+static void nn_print_header( void )
+{
+    if( nn_csv )
+    {
+        printf( "kernel,cases,failures,fut_mmac_per_s,ref_mmac_per_s,speedup,scratch_used,scratch_doc\n" );
+    }
+    else
+    {
+        printf( "%-46s %6s %6s %12s %12s %8s %16s\n",
+                "kernel", "cases", "fail", "fut MMAC/s", "ref MMAC/s", "speedup", "scratch used/doc" );
+    }
+}
+
+static void nn_print( const nn_stats *s )
+{
+    /* MAC per ns is GMAC/s */
+    double    fut = s->fut_ns ? 1000.0 * ( double ) s->macs / ( double ) s->fut_ns : 0.0;
+    double    ref = s->ref_ns ? 1000.0 * ( double ) s->macs / ( double ) s->ref_ns : 0.0;
+    double    speedup = ref > 0.0 ? fut / ref : 0.0;
+
+    if( nn_csv )
+    {
+        printf( "%s,%u,%u,%.1f,%.1f,%.2f,%u,%u\n", s->name, ( unsigned ) s->cases, ( unsigned ) s->failures,
+                fut, ref, speedup, ( unsigned ) s->scratch_used, ( unsigned ) s->scratch_doc );
+    }
+    else
+    {
+        printf( "%-46s %6u %6u %12.1f %12.1f %8.2f %7u/%-8u\n", s->name, ( unsigned ) s->cases,
+                ( unsigned ) s->failures, fut, ref, speedup, ( unsigned ) s->scratch_used, ( unsigned ) s->scratch_doc );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Kernels */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    const char *name;
+    void        ( *test )( nn_stats *s, int variant );
+    int         variant;
+} nn_kernel;
+
+static const nn_kernel nn_kernels[] =
+{
+    { "arm_convolve_HWC_q7_basic",                  nn_test_conv_q7,     NN_CONV_Q7_BASIC },
+    { "arm_convolve_HWC_q7_fast",                   nn_test_conv_q7,     NN_CONV_Q7_FAST },
+    { "arm_convolve_HWC_q7_RGB",                    nn_test_conv_q7,     NN_CONV_Q7_RGB },
+    { "arm_convolve_HWC_q7_basic_nonsquare",        nn_test_conv_q7,     NN_CONV_Q7_BASIC_NONSQUARE },
+    { "arm_convolve_HWC_q7_fast_nonsquare",         nn_test_conv_q7,     NN_CONV_Q7_FAST_NONSQUARE },
+    { "arm_convolve_1x1_HWC_q7_fast_nonsquare",     nn_test_conv_q7,     NN_CONV_Q7_1X1_FAST_NONSQUARE },
+    { "arm_depthwise_separable_conv_HWC_q7",        nn_test_conv_q7,     NN_DEPTHWISE_CONV_Q7 },
+    { "arm_depthwise_separable_conv_HWC_q7_nonsquare", nn_test_conv_q7,  NN_DEPTHWISE_CONV_Q7_NONSQUARE },
+    { "arm_convolve_HWC_q15_basic",                 nn_test_conv_q15,    NN_CONV_Q15_BASIC },
+    { "arm_convolve_HWC_q15_fast",                  nn_test_conv_q15,    NN_CONV_Q15_FAST },
+    { "arm_convolve_HWC_q15_fast_nonsquare",        nn_test_conv_q15,    NN_CONV_Q15_FAST_NONSQUARE },
+    { "arm_fully_connected_q7",                     nn_test_fc,          NN_FC_Q7 },
+    { "arm_fully_connected_q7_opt",                 nn_test_fc,          NN_FC_Q7_OPT },
+    { "arm_fully_connected_q15",                    nn_test_fc,          NN_FC_Q15 },
+    { "arm_fully_connected_q15_opt",                nn_test_fc,          NN_FC_Q15_OPT },
+    { "arm_fully_connected_mat_q7_vec_q15",         nn_test_fc,          NN_FC_MAT_Q7_VEC_Q15 },
+    { "arm_fully_connected_mat_q7_vec_q15_opt",     nn_test_fc,          NN_FC_MAT_Q7_VEC_Q15_OPT },
+    { "arm_fully_connected_q4",                     nn_test_fc_compressed, 0 },
+    { "arm_fully_connected_q7_sparse",              nn_test_fc_compressed, 1 },
+    { "arm_maxpool_q7_HWC",                         nn_test_pool,        0 },
+    { "arm_avepool_q7_HWC",                         nn_test_pool,        1 },
+    { "arm_convolve_HWC_q7_relu_maxpool",           nn_test_conv_relu_pool, 0 },
+    { "arm_nn_stream_conv_q7",                      nn_test_stream_conv, 0 },
+    { "arm_nn_stream_depthwise_conv_q7",            nn_test_stream_conv, 1 },
+    { "arm_relu_q7",                                nn_test_elementwise, NN_RELU_Q7 },
+    { "arm_relu_q15",                               nn_test_elementwise, NN_RELU_Q15 },
+    { "arm_nn_mult_q7",                             nn_test_elementwise, NN_MULT_Q7 },
+    { "arm_nn_mult_q15",                            nn_test_elementwise, NN_MULT_Q15 },
+};
+
+int main( int argc, char *argv[] )
+{
+    uint32_t  i;
+    int       arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            nn_cases = 20;
+        }
+        else if( strcmp( argv[arg], "--cases" ) == 0 && arg + 1 < argc )
+        {
+            nn_cases = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else if( strcmp( argv[arg], "--seed" ) == 0 && arg + 1 < argc )
+        {
+            nn_seed = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else if( strcmp( argv[arg], "--csv" ) == 0 )
+        {
+            nn_csv = 1;
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--cases N] [--seed N] [--csv]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    nn_print_header();
+
+    for( i = 0; i < sizeof( nn_kernels ) / sizeof( nn_kernels[0] ); i++ )
+    {
+        nn_stats  s;
+
+        memset( &s, 0, sizeof( s ) );
+        s.name = nn_kernels[i].name;
+
+        /* Same shapes and data for every run of a kernel with a given seed */
+        nn_rand_state = nn_seed * 2654435761U + i + 1U;
+        nn_kernels[i].test( &s, nn_kernels[i].variant );
+
+        nn_print( &s );
+        nn_total_failures += s.failures;
+    }
+
+    if( !nn_csv )
+    {
+        printf( "%s: %u failure(s), seed %u\n", nn_total_failures ? "FAILED" : "PASSED",
+                ( unsigned ) nn_total_failures, ( unsigned ) nn_seed );
+    }
+
+    return nn_total_failures ? 1 : 0;
+}
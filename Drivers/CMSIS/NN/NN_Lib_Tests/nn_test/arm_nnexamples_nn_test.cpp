@@ -46,6 +46,8 @@
 #define TEST_CONV
 #define TEST_NONSQUARE
 #define TEST_NNMULT
+#define TEST_STREAM
+#define TEST_GRAPH
 
 int test_index = 0;
 q7_t test_flags[50];
@@ -472,6 +474,90 @@ int main()
 
     verify_results_q15( ip_out_q15_ref, ip_out_q15_opt, IP_ROW_DIM );
 
+    /* compressed weights, checked with the dense weights they stand for */
+#define IP_Q4_BYTES ( ( IP_COL_DIM + 1 ) / 2 )
+#define IP_SPARSE_COL_DIM ( IP_COL_DIM & ~3 )
+
+    q7_t     *ip_q4_weights = new q7_t[IP_ROW_DIM * IP_Q4_BYTES];
+    q7_t     *ip_q4_scale = new q7_t[IP_ROW_DIM];
+    q7_t     *ip_sparse_weights = new q7_t[IP_ROW_DIM * IP_SPARSE_COL_DIM];
+    uint16_t *ip_sparse_col = new uint16_t[IP_ROW_DIM * IP_SPARSE_COL_DIM / 4];
+    uint16_t *ip_sparse_row = new uint16_t[IP_ROW_DIM + 1];
+    uint16_t  ip_num_blocks = 0;
+
+    for( int i = 0; i < IP_ROW_DIM; i++ )
+    {
+        ip_q4_scale[i] = rand() % 16 + 1;
+
+        for( int j = 0; j < IP_Q4_BYTES; j++ )
+        {
+            ip_q4_weights[i * IP_Q4_BYTES + j] = rand() % 256 - 128;
+        }
+
+        for( int j = 0; j < IP_COL_DIM; j++ )
+        {
+            q7_t      w4 = ip_q4_weights[i * IP_Q4_BYTES + j / 2];
+
+            w4 = ( j & 1 ) ? ( w4 >> 4 ) : ( ( q7_t )( w4 << 4 ) >> 4 );
+            ip_weights[i * IP_COL_DIM + j] = w4 * ip_q4_scale[i];
+        }
+    }
+
+    initialize_results_q7( ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM );
+
+    printf( "Start q4 implementation\n" );
+
+    arm_fully_connected_q7_ref( test1, ip_weights, IP_COL_DIM, IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q7_ref, test2 );
+
+    arm_fully_connected_q4( test1, ip_q4_weights, ip_q4_scale, IP_COL_DIM, IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q7_opt,
+                            test2 );
+
+    verify_results_q7( ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM );
+
+    /* keep about half of the blocks of 4 weights */
+    for( int i = 0; i < IP_ROW_DIM; i++ )
+    {
+        ip_sparse_row[i] = ip_num_blocks;
+
+        for( int j = 0; j < IP_SPARSE_COL_DIM; j += 4 )
+        {
+            bool      keep = rand() % 2;
+
+            for( int k = 0; k < 4; k++ )
+            {
+                q7_t      w = keep ? rand() % 256 - 128 : 0;
+
+                ip_weights[i * IP_SPARSE_COL_DIM + j + k] = w;
+                ip_sparse_weights[ip_num_blocks * 4 + k] = w;
+            }
+
+            if( keep )
+            {
+                ip_sparse_col[ip_num_blocks++] = j;
+            }
+        }
+    }
+
+    ip_sparse_row[IP_ROW_DIM] = ip_num_blocks;
+
+    initialize_results_q7( ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM );
+
+    printf( "Start sparse q7 implementation\n" );
+
+    arm_fully_connected_q7_ref( test1, ip_weights, IP_SPARSE_COL_DIM, IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q7_ref,
+                                test2 );
+
+    arm_fully_connected_q7_sparse( test1, ip_sparse_weights, ip_sparse_col, ip_sparse_row, IP_SPARSE_COL_DIM,
+                                   IP_ROW_DIM, 1, 7, ip_bias_q7, ip_out_q7_opt, test2 );
+
+    verify_results_q7( ip_out_q7_ref, ip_out_q7_opt, IP_ROW_DIM );
+
+    delete[]ip_q4_weights;
+    delete[]ip_q4_scale;
+    delete[]ip_sparse_weights;
+    delete[]ip_sparse_col;
+    delete[]ip_sparse_row;
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
@@ -782,11 +868,247 @@ int main()
 
     verify_results_q7( conv_im_out_ref_q7, conv_im_out_opt_q7, CONV_OUT_DIM * CONV_OUT_DIM * CONV_OUT_CH );
 
+    // fused conv + relu + maxpool, against the three layers run separately
+    q7_t     *conv_pool_buf = ( q7_t * ) ( conv_buf + 2 * CONV_KER_DIM * CONV_KER_DIM * CONV_IM_CH );
+    q7_t     *conv_pool_out_ref_q7 = conv_im_out_opt_q7 + CONV_OUT_DIM * CONV_OUT_DIM * CONV_OUT_CH / 2;
+
+    for( int pool_padding = 0; pool_padding < 2; pool_padding++ )
+    {
+        int       pool_out_dim = ( CONV_OUT_DIM + 2 * pool_padding - 3 + 1 ) / 2 + 1;
+
+        initialize_results_q7( conv_pool_out_ref_q7, conv_im_out_opt_q7, pool_out_dim * pool_out_dim * CONV_OUT_CH );
+
+        printf( "start q7 conv relu maxpool layer by layer implementation\n" );
+
+        arm_convolve_HWC_q7_fast( conv_im_in_q7, CONV_IM_DIM, CONV_IM_CH, conv_weight_q7,
+                                  CONV_OUT_CH, CONV_KER_DIM, 2, 1, conv_bias_q7, 1, 7, conv_im_out_ref_q7,
+                                  CONV_OUT_DIM, conv_buf, NULL );
+
+        arm_relu_q7( conv_im_out_ref_q7, CONV_OUT_DIM * CONV_OUT_DIM * CONV_OUT_CH );
+
+        arm_maxpool_q7_HWC( conv_im_out_ref_q7, CONV_OUT_DIM, CONV_OUT_CH, 3, pool_padding, 2, pool_out_dim,
+                            ( q7_t * ) conv_buf, conv_pool_out_ref_q7 );
+
+        printf( "start q7 conv relu maxpool fused implementation\n" );
+
+        arm_convolve_HWC_q7_relu_maxpool( conv_im_in_q7, CONV_IM_DIM, CONV_IM_CH, conv_weight_q7,
+                                          CONV_OUT_CH, CONV_KER_DIM, 2, 1, conv_bias_q7, 1, 7, CONV_OUT_DIM,
+                                          3, pool_padding, 2, conv_im_out_opt_q7, pool_out_dim, conv_buf,
+                                          conv_pool_buf );
+
+        verify_results_q7( conv_pool_out_ref_q7, conv_im_out_opt_q7, pool_out_dim * pool_out_dim * CONV_OUT_CH );
+    }
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+    delete[]test4;
+
+#endif
+
+#ifdef TEST_STREAM
+
+#define STREAM_FRAMES 24
+#define STREAM_DIM_X 8
+#define STREAM_CH 4
+#define STREAM_KER_DIM_X 3
+#define STREAM_KER_DIM_Y 5
+#define STREAM_OUT_DIM_Y ( STREAM_FRAMES + STREAM_KER_DIM_Y - 1 )
+#define STREAM_FRAME_SIZE ( STREAM_DIM_X * STREAM_CH )
+
+    /* This part tests the streaming layers, one frame at a time, against the whole series with causal padding */
+
+    test1 = new q7_t[STREAM_KER_DIM_Y * STREAM_KER_DIM_X * STREAM_CH * STREAM_CH + STREAM_CH];
+    test2 = new q15_t[2 * STREAM_KER_DIM_Y * STREAM_KER_DIM_X * STREAM_CH];
+    test3 = new q7_t[STREAM_FRAMES * STREAM_FRAME_SIZE + 2 * STREAM_OUT_DIM_Y * STREAM_FRAME_SIZE];
+    test4 = new q15_t[( 2 * STREAM_KER_DIM_Y - 1 ) * STREAM_FRAME_SIZE / 2];
+
+    for( int i = 0; i < STREAM_KER_DIM_Y * STREAM_KER_DIM_X * STREAM_CH * STREAM_CH + STREAM_CH; i++ )
+    {
+        test1[i] = rand() % 256 - 100;
+    }
+
+    for( int i = 0; i < STREAM_FRAMES * STREAM_FRAME_SIZE; i++ )
+    {
+        test3[i] = rand() % 256 - 100;
+    }
+
+    q7_t     *stream_weight_q7 = test1;
+    q7_t     *stream_bias_q7 = test1 + STREAM_KER_DIM_Y * STREAM_KER_DIM_X * STREAM_CH * STREAM_CH;
+    q7_t     *stream_in_q7 = test3;
+    q7_t     *stream_out_ref_q7 = test3 + STREAM_FRAMES * STREAM_FRAME_SIZE;
+    q7_t     *stream_out_opt_q7 = stream_out_ref_q7 + STREAM_OUT_DIM_Y * STREAM_FRAME_SIZE;
+    q7_t     *stream_state_q7 = ( q7_t * ) test4;
+    arm_nn_stream_conv_instance_q7 stream_conv;
+
+    initialize_results_q7( stream_out_ref_q7, stream_out_opt_q7, STREAM_FRAMES * STREAM_FRAME_SIZE );
+
+    printf( "start stream conv q7 ref implementation\n" );
+
+    arm_convolve_HWC_q7_ref_nonsquare( stream_in_q7, STREAM_DIM_X, STREAM_FRAMES, STREAM_CH, stream_weight_q7,
+                                       STREAM_CH, STREAM_KER_DIM_X, STREAM_KER_DIM_Y, 1, STREAM_KER_DIM_Y - 1,
+                                       1, 1, stream_bias_q7, 1, 7, stream_out_ref_q7,
+                                       STREAM_DIM_X, STREAM_OUT_DIM_Y, test2, NULL );
+
+    printf( "start stream conv q7 opt implementation\n" );
+
+    arm_nn_stream_conv_init_q7( &stream_conv, STREAM_DIM_X, STREAM_CH, stream_weight_q7, STREAM_CH,
+                                STREAM_KER_DIM_X, STREAM_KER_DIM_Y, 1, 1, stream_bias_q7, 1, 7, STREAM_DIM_X,
+                                stream_state_q7 );
+
+    for( int i = 0; i < STREAM_FRAMES; i++ )
+    {
+        arm_nn_stream_conv_q7( &stream_conv, stream_in_q7 + i * STREAM_FRAME_SIZE,
+                               stream_out_opt_q7 + i * STREAM_FRAME_SIZE, test2 );
+    }
+
+    verify_results_q7( stream_out_ref_q7, stream_out_opt_q7, STREAM_FRAMES * STREAM_FRAME_SIZE );
+
+    initialize_results_q7( stream_out_ref_q7, stream_out_opt_q7, STREAM_FRAMES * STREAM_FRAME_SIZE );
+
+    printf( "start stream depthwise conv q7 ref implementation\n" );
+
+    arm_depthwise_separable_conv_HWC_q7_ref_nonsquare( stream_in_q7, STREAM_DIM_X, STREAM_FRAMES, STREAM_CH,
+            stream_weight_q7, STREAM_CH, STREAM_KER_DIM_X, STREAM_KER_DIM_Y,
+            1, STREAM_KER_DIM_Y - 1, 1, 1, stream_bias_q7, 1, 7,
+            stream_out_ref_q7, STREAM_DIM_X, STREAM_OUT_DIM_Y, test2, NULL );
+
+    printf( "start stream depthwise conv q7 opt implementation\n" );
+
+    arm_nn_stream_conv_init_q7( &stream_conv, STREAM_DIM_X, STREAM_CH, stream_weight_q7, STREAM_CH,
+                                STREAM_KER_DIM_X, STREAM_KER_DIM_Y, 1, 1, stream_bias_q7, 1, 7, STREAM_DIM_X,
+                                stream_state_q7 );
+
+    for( int i = 0; i < STREAM_FRAMES; i++ )
+    {
+        arm_nn_stream_depthwise_conv_q7( &stream_conv, stream_in_q7 + i * STREAM_FRAME_SIZE,
+                                         stream_out_opt_q7 + i * STREAM_FRAME_SIZE, test2 );
+    }
+
+    verify_results_q7( stream_out_ref_q7, stream_out_opt_q7, STREAM_FRAMES * STREAM_FRAME_SIZE );
+
     delete[]test1;
     delete[]test2;
     delete[]test3;
     delete[]test4;
 
+#endif
+
+#ifdef TEST_GRAPH
+
+#define GRAPH_IM_DIM 16
+#define GRAPH_IM_CH 4
+#define GRAPH_CONV_CH 8
+#define GRAPH_FC_DIM ( 4 * 4 * GRAPH_CONV_CH )
+#define GRAPH_FC_OUT 10
+#define GRAPH_LAYERS 8
+#define GRAPH_TENSORS 7
+
+    /* This part tests the graph functions against the same layers run with separate buffers */
+
+    q7_t     *graph_conv1_wt = new q7_t[GRAPH_CONV_CH * 3 * 3 * GRAPH_IM_CH];
+    q7_t     *graph_conv2_wt = new q7_t[GRAPH_CONV_CH * 3 * 3 * GRAPH_CONV_CH];
+    q7_t     *graph_fc_wt = new q7_t[GRAPH_FC_OUT * GRAPH_FC_DIM];
+    q7_t     *graph_bias = new q7_t[GRAPH_FC_OUT];
+    q7_t     *graph_in = new q7_t[GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH];
+
+    for( int i = 0; i < GRAPH_CONV_CH * 3 * 3 * GRAPH_IM_CH; i++ )
+    {
+        graph_conv1_wt[i] = ( rand() % 256 - 128 );
+    }
+
+    for( int i = 0; i < GRAPH_CONV_CH * 3 * 3 * GRAPH_CONV_CH; i++ )
+    {
+        graph_conv2_wt[i] = ( rand() % 256 - 128 );
+    }
+
+    for( int i = 0; i < GRAPH_FC_OUT * GRAPH_FC_DIM; i++ )
+    {
+        graph_fc_wt[i] = ( rand() % 256 - 128 );
+    }
+
+    for( int i = 0; i < GRAPH_FC_OUT; i++ )
+    {
+        graph_bias[i] = ( rand() % 256 - 128 );
+    }
+
+    for( int i = 0; i < GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH; i++ )
+    {
+        graph_in[i] = ( rand() % 256 - 128 );
+    }
+
+    const arm_nn_layer_q7 graph_layers[GRAPH_LAYERS] = {
+        { ARM_NN_LAYER_CONV_Q7_FAST, 0, 1, GRAPH_IM_DIM, GRAPH_IM_CH, GRAPH_CONV_CH, 3, 1, 1, GRAPH_IM_DIM, 0, 7,
+          graph_conv1_wt, graph_bias },
+        { ARM_NN_LAYER_RELU_Q7, 1, 1, GRAPH_IM_DIM, GRAPH_CONV_CH, GRAPH_CONV_CH, 0, 0, 0, GRAPH_IM_DIM, 0, 0, NULL, NULL },
+        { ARM_NN_LAYER_MAXPOOL_Q7, 1, 2, GRAPH_IM_DIM, GRAPH_CONV_CH, GRAPH_CONV_CH, 2, 0, 2, 8, 0, 0, NULL, NULL },
+        { ARM_NN_LAYER_CONV_Q7_BASIC, 2, 3, 8, GRAPH_CONV_CH, GRAPH_CONV_CH, 3, 1, 1, 8, 0, 8,
+          graph_conv2_wt, graph_bias },
+        { ARM_NN_LAYER_RELU_Q7, 3, 4, 8, GRAPH_CONV_CH, GRAPH_CONV_CH, 0, 0, 0, 8, 0, 0, NULL, NULL },
+        { ARM_NN_LAYER_AVEPOOL_Q7, 4, 5, 8, GRAPH_CONV_CH, GRAPH_CONV_CH, 2, 0, 2, 4, 0, 0, NULL, NULL },
+        { ARM_NN_LAYER_FC_Q7, 5, 6, 4, GRAPH_CONV_CH, GRAPH_FC_OUT, 0, 0, 0, 1, 0, 9, graph_fc_wt, graph_bias },
+        { ARM_NN_LAYER_SOFTMAX_Q7, 6, 6, 1, GRAPH_FC_OUT, GRAPH_FC_OUT, 0, 0, 0, 1, 0, 0, NULL, NULL },
+    };
+    const arm_nn_graph_q7 graph = { graph_layers, GRAPH_LAYERS, GRAPH_TENSORS, 0, 6 };
+
+    uint32_t  graph_offsets[GRAPH_TENSORS + GRAPH_LAYERS];
+    uint32_t  graph_plan_buffer[2 * ( GRAPH_TENSORS + GRAPH_LAYERS )];
+    uint32_t  graph_arena_size;
+
+    arm_nn_graph_plan_q7( &graph, graph_offsets, &graph_arena_size, graph_plan_buffer );
+
+    printf( "Graph arena size: %d bytes\n", ( int )graph_arena_size );
+
+    /* The arena is allocated as words for the alignment */
+    q31_t    *graph_arena = new q31_t[( graph_arena_size + 3 ) / 4];
+    q7_t     *graph_out_opt = ( q7_t * )graph_arena + graph_offsets[graph.output];
+
+    for( int i = 0; i < GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_IM_CH; i++ )
+    {
+        ( ( q7_t * )graph_arena )[graph_offsets[graph.input] + i] = graph_in[i];
+    }
+
+    printf( "Start graph implementation\n" );
+
+    arm_nn_graph_run_q7( &graph, graph_offsets, ( q7_t * )graph_arena );
+
+    /* Same layers, each with its own buffers */
+    q7_t     *graph_conv1_out = new q7_t[GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_CONV_CH];
+    q7_t     *graph_pool1_out = new q7_t[8 * 8 * GRAPH_CONV_CH];
+    q7_t     *graph_conv2_out = new q7_t[8 * 8 * GRAPH_CONV_CH];
+    q7_t     *graph_pool2_out = new q7_t[4 * 4 * GRAPH_CONV_CH];
+    q7_t     *graph_out_ref = new q7_t[GRAPH_FC_OUT];
+    q15_t    *graph_buffer = new q15_t[2 * 3 * 3 * GRAPH_CONV_CH + GRAPH_FC_DIM];
+
+    printf( "Start layer by layer implementation\n" );
+
+    arm_convolve_HWC_q7_fast( graph_in, GRAPH_IM_DIM, GRAPH_IM_CH, graph_conv1_wt, GRAPH_CONV_CH, 3, 1, 1, graph_bias, 0, 7,
+                              graph_conv1_out, GRAPH_IM_DIM, graph_buffer, NULL );
+    arm_relu_q7( graph_conv1_out, GRAPH_IM_DIM * GRAPH_IM_DIM * GRAPH_CONV_CH );
+    arm_maxpool_q7_HWC( graph_conv1_out, GRAPH_IM_DIM, GRAPH_CONV_CH, 2, 0, 2, 8, NULL, graph_pool1_out );
+    arm_convolve_HWC_q7_basic( graph_pool1_out, 8, GRAPH_CONV_CH, graph_conv2_wt, GRAPH_CONV_CH, 3, 1, 1, graph_bias, 0, 8,
+                               graph_conv2_out, 8, graph_buffer, NULL );
+    arm_relu_q7( graph_conv2_out, 8 * 8 * GRAPH_CONV_CH );
+    arm_avepool_q7_HWC( graph_conv2_out, 8, GRAPH_CONV_CH, 2, 0, 2, 4, ( q7_t * )graph_buffer, graph_pool2_out );
+    arm_fully_connected_q7( graph_pool2_out, graph_fc_wt, GRAPH_FC_DIM, GRAPH_FC_OUT, 0, 9, graph_bias, graph_out_ref,
+                            graph_buffer );
+    arm_softmax_q7( graph_out_ref, GRAPH_FC_OUT, graph_out_ref );
+
+    verify_results_q7( graph_out_ref, graph_out_opt, GRAPH_FC_OUT );
+
+    delete[]graph_conv1_wt;
+    delete[]graph_conv2_wt;
+    delete[]graph_fc_wt;
+    delete[]graph_bias;
+    delete[]graph_in;
+    delete[]graph_arena;
+    delete[]graph_conv1_out;
+    delete[]graph_pool1_out;
+    delete[]graph_conv2_out;
+    delete[]graph_pool2_out;
+    delete[]graph_out_ref;
+    delete[]graph_buffer;
+
 #endif
 
     test_pass = true;
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+
+"""
+Generates the compressed weights of a q7 fully-connected layer.
+
+The weights are read from a .npy file of q7 values, either a matrix of
+num_of_rows x dim_vec or an array of num_of_rows x h x w x c as for
+fully_connected_opt_weight_generation.py.
+
+q4: weights for arm_fully_connected_q4(). Each row is scaled by the
+    smallest integer that brings it into [-8 7], and rounded to 4 bits.
+    Two weights per byte, the first one in the low nibble, each row
+    starting on a byte. Writes <name>_wt and <name>_scale. The q4 weights
+    are an approximation: the largest error is printed, and the bias and
+    output shifts of the layer should be checked with the dense weights
+    replaced by <name>_wt * <name>_scale.
+
+sparse: weights for arm_fully_connected_q7_sparse(). The blocks of 4
+    weights of a row that are not all 0 are kept. dim_vec must be a
+    multiple of 4. Writes <name>_wt, <name>_col and <name>_row. The layer
+    is unchanged.
+
+The sizes of the compressed and of the dense weights are printed.
+
+usage: fully_connected_compressed_weight_generation.py q4|sparse weights.npy name [output.h]
+"""
+
+import sys
+
+import numpy as np
+
+
+def to_matrix(weights):
+    weights = np.asarray(weights, dtype=int)
+    return np.reshape(weights, (weights.shape[0], -1))
+
+
+def convert_to_q4_weights(weights):
+    weights = to_matrix(weights)
+    [num_of_rows, num_of_cols] = weights.shape
+    row_bytes = (num_of_cols + 1) // 2
+
+    # smallest scale with max/scale <= 7 and -min/scale <= 8
+    max_pos = np.maximum(weights.max(axis=1), 0)
+    max_neg = np.maximum(-weights.min(axis=1), 0)
+    scale = np.maximum(np.ceil(np.maximum(max_pos / 7.0, max_neg / 8.0)), 1).astype(int)
+
+    w4 = np.clip(np.round(weights / scale[:, None]), -8, 7).astype(int)
+
+    packed = np.zeros((num_of_rows, row_bytes), dtype=int)
+    nibbles = w4 & 0xF
+    packed[:, :] = nibbles[:, 0::2]
+    packed[:, :num_of_cols // 2] |= nibbles[:, 1::2] << 4
+    # as q7 values
+    packed = np.where(packed > 127, packed - 256, packed)
+
+    error = np.abs(w4 * scale[:, None] - weights).max()
+    return np.reshape(packed, (-1)), scale, error
+
+
+def convert_to_sparse_q7_weights(weights):
+    weights = to_matrix(weights)
+    [num_of_rows, num_of_cols] = weights.shape
+    if num_of_cols % 4:
+        raise ValueError('dim_vec must be a multiple of 4')
+
+    blocks = np.reshape(weights, (num_of_rows, num_of_cols // 4, 4))
+    keep = np.any(blocks != 0, axis=2)
+
+    values = blocks[keep]
+    rows, cols = np.nonzero(keep)
+    col_index = cols * 4
+    row_start = np.zeros(num_of_rows + 1, dtype=int)
+    row_start[1:] = np.cumsum(keep.sum(axis=1))
+
+    if row_start[-1] > 65535:
+        raise ValueError('too many blocks for the 16-bit row indices')
+
+    return np.reshape(values, (-1)), col_index, row_start
+
+
+def write_array(outfile, ctype, name, values):
+    outfile.write('const %s %s[%d] = {' % (ctype, name, len(values)))
+    np.asarray(values).tofile(outfile, sep=',', format='%d')
+    outfile.write('};\n\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 4 or sys.argv[1] not in ('q4', 'sparse'):
+        sys.exit('usage: fully_connected_compressed_weight_generation.py q4|sparse weights.npy name [output.h]')
+
+    weight = to_matrix(np.load(sys.argv[2]))
+    name = sys.argv[3]
+    dense_size = weight.size
+
+    outfile = open(sys.argv[4], 'w') if len(sys.argv) > 4 else sys.stdout
+
+    if sys.argv[1] == 'q4':
+        packed, scale, error = convert_to_q4_weights(weight)
+        write_array(outfile, 'q7_t', name + '_wt', packed)
+        write_array(outfile, 'q7_t', name + '_scale', scale)
+        size = len(packed) + len(scale)
+        sys.stderr.write('largest weight error: %d\n' % error)
+    else:
+        values, col_index, row_start = convert_to_sparse_q7_weights(weight)
+        write_array(outfile, 'q7_t', name + '_wt', values)
+        write_array(outfile, 'uint16_t', name + '_col', col_index)
+        write_array(outfile, 'uint16_t', name + '_row', row_start)
+        size = len(values) + 2 * (len(col_index) + len(row_start))
+
+    sys.stderr.write('weights: %d bytes, dense: %d bytes (%.2fx smaller)\n'
+                     % (size, dense_size, float(dense_size) / size))
+
+    if outfile is not sys.stdout:
+        outfile.close()
@@ -0,0 +1,248 @@
+#!/usr/bin/env python
+
+"""
+Generates the C header of a network for arm_nn_graph_run_q7().
+
+The network is described by a JSON file:
+
+{
+  "name": "cifar10",
+  "input": {"dim": 32, "ch": 3},
+  "layers": [
+    {"type": "conv_rgb", "ch_out": 32, "kernel": 5, "padding": 2, "stride": 1,
+     "bias_shift": 0, "out_shift": 9, "wt": "conv1_wt", "bias": "conv1_bias"},
+    {"type": "relu"},
+    {"type": "maxpool", "kernel": 3, "padding": 0, "stride": 2},
+    ...
+    {"type": "fc_opt", "ch_out": 10, "bias_shift": 3, "out_shift": 5,
+     "wt": "ip1_wt", "bias": "ip1_bias"},
+    {"type": "softmax"}
+  ]
+}
+
+The layers form a chain, each one reads the output of the previous one.
+ReLU and softmax run in place unless "in_place" is false. The output
+dimension is derived with floor rounding for the convolutions and ceil
+rounding for the pooling layers, or given with "dim_out".
+
+The tensor lifetimes and the arena offsets are computed with the same rules
+as arm_nn_graph_plan_q7(). The header defines <NAME>_ARENA_SIZE, the layer
+table <name>_layers, the graph <name>_graph and the offsets <name>_offsets.
+The weight and bias arrays named in the JSON file must be declared before
+the header is included.
+
+usage: nn_graph_gen.py model.json [output.h]
+"""
+
+import json
+import sys
+
+ALIGN = 4
+
+LAYER_TYPES = {
+    'conv_basic': 'ARM_NN_LAYER_CONV_Q7_BASIC',
+    'conv_fast': 'ARM_NN_LAYER_CONV_Q7_FAST',
+    'conv_rgb': 'ARM_NN_LAYER_CONV_Q7_RGB',
+    'depthwise_conv': 'ARM_NN_LAYER_DEPTHWISE_CONV_Q7',
+    'fc': 'ARM_NN_LAYER_FC_Q7',
+    'fc_opt': 'ARM_NN_LAYER_FC_Q7_OPT',
+    'relu': 'ARM_NN_LAYER_RELU_Q7',
+    'maxpool': 'ARM_NN_LAYER_MAXPOOL_Q7',
+    'avepool': 'ARM_NN_LAYER_AVEPOOL_Q7',
+    'softmax': 'ARM_NN_LAYER_SOFTMAX_Q7',
+}
+
+FIELDS = ['type', 'input', 'output', 'dim_im_in', 'ch_im_in', 'ch_im_out',
+          'dim_kernel', 'padding', 'stride', 'dim_im_out', 'bias_shift',
+          'out_shift', 'wt', 'bias']
+
+
+def align_size(size):
+    return (size + ALIGN - 1) & ~(ALIGN - 1)
+
+
+def scratch_size(layer):
+    # Same sizes as scratch_size() in arm_nn_graph_plan_q7.c, in bytes
+    kind = layer['kind']
+    if kind in ('conv_basic', 'conv_fast', 'conv_rgb', 'depthwise_conv'):
+        return 2 * 2 * layer['ch_im_in'] * layer['dim_kernel'] ** 2
+    if kind in ('fc', 'fc_opt'):
+        return 2 * layer['dim_im_in'] ** 2 * layer['ch_im_in']
+    if kind == 'avepool':
+        return 2 * 2 * layer['dim_im_out'] * layer['ch_im_in']
+    return 0
+
+
+def build_layers(model):
+    dim = model['input']['dim']
+    ch = model['input']['ch']
+    tensor = 0
+    num_tensors = 1
+    layers = []
+
+    for desc in model['layers']:
+        kind = desc['type']
+        if kind not in LAYER_TYPES:
+            raise ValueError('unknown layer type ' + kind)
+
+        kernel = desc.get('kernel', 0)
+        padding = desc.get('padding', 0)
+        stride = desc.get('stride', 1 if kernel else 0)
+
+        if kind in ('conv_basic', 'conv_fast', 'conv_rgb'):
+            ch_out = desc['ch_out']
+            dim_out = (dim + 2 * padding - kernel) // stride + 1
+        elif kind == 'depthwise_conv':
+            ch_out = ch
+            dim_out = (dim + 2 * padding - kernel) // stride + 1
+        elif kind in ('maxpool', 'avepool'):
+            ch_out = ch
+            dim_out = (dim + 2 * padding - kernel + stride - 1) // stride + 1
+        elif kind in ('fc', 'fc_opt'):
+            ch_out = desc['ch_out']
+            dim_out = 1
+        else:
+            ch_out = ch
+            dim_out = dim
+        dim_out = desc.get('dim_out', dim_out)
+
+        if kind in ('relu', 'softmax') and desc.get('in_place', True):
+            output = tensor
+        else:
+            output = num_tensors
+            num_tensors += 1
+
+        layers.append({
+            'kind': kind,
+            'type': LAYER_TYPES[kind],
+            'input': tensor,
+            'output': output,
+            'dim_im_in': dim,
+            'ch_im_in': ch,
+            'ch_im_out': ch_out,
+            'dim_kernel': kernel,
+            'padding': padding,
+            'stride': stride,
+            'dim_im_out': dim_out,
+            'bias_shift': desc.get('bias_shift', 0),
+            'out_shift': desc.get('out_shift', 0),
+            'wt': desc.get('wt', 'NULL'),
+            'bias': desc.get('bias', 'NULL'),
+        })
+
+        tensor = output
+        dim = dim_out
+        ch = ch_out
+
+    return layers, num_tensors, tensor
+
+
+def plan(layers, num_tensors, graph_input, graph_output):
+    """Returns the offsets and the arena size, as arm_nn_graph_plan_q7()."""
+    num_buffers = num_tensors + len(layers)
+    sizes = [0] * num_buffers
+    lives = [None] * num_buffers
+    lives[graph_input] = [0, 0]
+
+    for i, layer in enumerate(layers):
+        in_size = layer['dim_im_in'] ** 2 * layer['ch_im_in']
+        out_size = layer['dim_im_out'] ** 2 * layer['ch_im_out']
+        sizes[layer['input']] = max(sizes[layer['input']], in_size)
+        lives[layer['input']][1] = i
+        sizes[layer['output']] = max(sizes[layer['output']], out_size)
+        if lives[layer['output']] is None:
+            lives[layer['output']] = [i, i]
+        else:
+            lives[layer['output']][1] = i
+        sizes[num_tensors + i] = scratch_size(layer)
+        lives[num_tensors + i] = [i, i]
+
+    if layers:
+        lives[graph_output][1] = len(layers) - 1
+
+    offsets = [None] * num_buffers
+    arena_size = 0
+
+    for _ in range(num_buffers):
+        # Largest buffer not placed yet, the first one for equal sizes
+        best = None
+        for i in range(num_buffers):
+            if offsets[i] is None and (best is None or sizes[i] > sizes[best]):
+                best = i
+
+        size = align_size(sizes[best])
+        offset = 0
+        moved = True
+        while moved and size > 0:
+            moved = False
+            for j in range(num_buffers):
+                if offsets[j] is None or sizes[j] == 0:
+                    continue
+                if lives[j][0] > lives[best][1] or lives[best][0] > lives[j][1]:
+                    continue
+                end = offsets[j] + align_size(sizes[j])
+                if offset < end and offsets[j] < offset + size:
+                    offset = end
+                    moved = True
+
+        offsets[best] = offset
+        arena_size = max(arena_size, offset + size)
+
+    separate_size = sum(align_size(s) for s in sizes)
+    return offsets, arena_size, separate_size
+
+
+def generate(model):
+    name = model['name']
+    layers, num_tensors, graph_output = build_layers(model)
+    offsets, arena_size, separate_size = plan(layers, num_tensors, 0, graph_output)
+    guard = '_' + name.upper() + '_GRAPH_H_'
+
+    lines = []
+    lines.append('/* Generated by nn_graph_gen.py, do not edit */')
+    lines.append('')
+    lines.append('#ifndef ' + guard)
+    lines.append('#define ' + guard)
+    lines.append('')
+    lines.append('#include "arm_nnfunctions.h"')
+    lines.append('')
+    lines.append('/* %d bytes with one buffer per tensor and layer */' % separate_size)
+    lines.append('#define %s_ARENA_SIZE %d' % (name.upper(), arena_size))
+    lines.append('')
+    lines.append('static const arm_nn_layer_q7 %s_layers[] = {' % name)
+    lines.append('    /* ' + ', '.join(FIELDS) + ' */')
+    for layer in layers:
+        lines.append('    { ' + ', '.join(str(layer[f]) for f in FIELDS) + ' },')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const arm_nn_graph_q7 %s_graph = { %s_layers, %d, %d, %d, %d };'
+                 % (name, name, len(layers), num_tensors, 0, graph_output))
+    lines.append('')
+    lines.append('/* Offsets of tensors 0 to %d, then of the scratch buffers of layers 0 to %d */'
+                 % (num_tensors - 1, len(layers) - 1))
+    lines.append('static const uint32_t %s_offsets[] = {' % name)
+    for i in range(0, len(offsets), 8):
+        lines.append('    ' + ', '.join(str(o) for o in offsets[i:i + 8]) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif')
+    lines.append('')
+
+    sys.stderr.write('%s: arena %d bytes, %d bytes with separate buffers\n'
+                     % (name, arena_size, separate_size))
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) not in (2, 3):
+        sys.stderr.write(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1]) as f:
+        header = generate(json.load(f))
+
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], 'w') as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_relu_maxpool.c
+ * Description:  Q7 convolution fused with ReLU and max pooling
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief Q7 convolution followed by ReLU and max pooling
+ * @param[in]       Im_in        pointer to input tensor
+ * @param[in]       dim_im_in    input tensor dimention
+ * @param[in]       ch_im_in     number of input tensor channels
+ * @param[in]       wt           pointer to kernel weights
+ * @param[in]       ch_im_out    number of filters, i.e., output tensor channels
+ * @param[in]       dim_kernel   filter kernel size
+ * @param[in]       padding      padding sizes
+ * @param[in]       stride       convolution stride
+ * @param[in]       bias         pointer to bias
+ * @param[in]       bias_shift   amount of left-shift for bias
+ * @param[in]       out_shift    amount of right-shift for output
+ * @param[in]       dim_conv_out dimension of the convolution output, i.e., of the pooling input
+ * @param[in]       pool_kernel  pooling window size
+ * @param[in]       pool_padding pooling padding sizes
+ * @param[in]       pool_stride  pooling stride
+ * @param[in,out]   Im_out       pointer to output tensor
+ * @param[in]       dim_im_out   output tensor dimension
+ * @param[in,out]   bufferA      pointer to buffer space for input
+ * @param[in,out]   bufferB      pointer to buffer space for the convolution rows
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+ *
+ * bufferB size: pool_kernel*dim_conv_out*ch_im_out
+ *
+ * This function gives the same output as arm_convolve_HWC_q7_basic(),
+ * then arm_relu_q7() and arm_maxpool_q7_HWC() on the convolution output,
+ * without storing the dim_conv_out x dim_conv_out x ch_im_out convolution
+ * output. The convolution rows are computed when the pooling window first
+ * reaches them and kept in bufferB, which holds the last pool_kernel rows.
+ * Rows that no pooling window covers are not computed.
+ *
+ * ReLU and max pooling commute, so the maximum of each window starts at
+ * zero instead of applying ReLU to every convolution output.
+ *
+ * The rows are computed with arm_convolve_HWC_q7_basic_nonsquare(), which
+ * checks the borders of every window: the padding regions of the fast
+ * convolutions assume the whole output is computed in one call.
+ */
+
+arm_status arm_convolve_HWC_q7_relu_maxpool( const q7_t *Im_in,
+        const uint16_t dim_im_in,
+        const uint16_t ch_im_in,
+        const q7_t *wt,
+        const uint16_t ch_im_out,
+        const uint16_t dim_kernel,
+        const uint16_t padding,
+        const uint16_t stride,
+        const q7_t *bias,
+        const uint16_t bias_shift,
+        const uint16_t out_shift,
+        const uint16_t dim_conv_out,
+        const uint16_t pool_kernel,
+        const uint16_t pool_padding,
+        const uint16_t pool_stride,
+        q7_t *Im_out,
+        const uint16_t dim_im_out,
+        q15_t *bufferA,
+        q7_t *bufferB )
+{
+    int32_t   i_out_y, i_out_x, i_row, i_col, i_ch;
+    int32_t   next_row = 0;                         /* First convolution row not computed yet */
+    uint32_t  row_size = ( uint32_t ) dim_conv_out * ch_im_out;
+    arm_status status;
+
+    for( i_out_y = 0; i_out_y < dim_im_out; i_out_y++ )
+    {
+        /* Convolution rows of the pooling window, clipped to the convolution output */
+        int32_t   row_start = i_out_y * pool_stride - pool_padding;
+        int32_t   row_end = row_start + pool_kernel;
+
+        row_start = row_start < 0 ? 0 : row_start;
+        row_end = row_end > dim_conv_out ? dim_conv_out : row_end;
+
+        /* Skip the rows between the windows when pool_stride is larger than pool_kernel */
+        if( next_row < row_start )
+        {
+            next_row = row_start;
+        }
+
+        for( ; next_row < row_end; next_row++ )
+        {
+            /* Input rows of the convolution row, the clipped rows are handled as padding */
+            int32_t   in_start = next_row * stride - padding;
+            int32_t   in_end = in_start + dim_kernel;
+            int32_t   pad_top = in_start < 0 ? -in_start : 0;
+
+            in_start += pad_top;
+            in_end = in_end > dim_im_in ? dim_im_in : in_end;
+
+            if( in_end < in_start )
+            {
+                in_end = in_start;
+            }
+
+            status = arm_convolve_HWC_q7_basic_nonsquare( Im_in + in_start * dim_im_in * ch_im_in,
+                     dim_im_in, ( uint16_t ) ( in_end - in_start ), ch_im_in, wt,
+                     ch_im_out, dim_kernel, dim_kernel, padding, ( uint16_t ) pad_top,
+                     stride, 1, bias, bias_shift, out_shift,
+                     bufferB + ( next_row % pool_kernel ) * row_size,
+                     dim_conv_out, 1, bufferA, NULL );
+
+            if( status != ARM_MATH_SUCCESS )
+            {
+                return status;
+            }
+        }
+
+        for( i_out_x = 0; i_out_x < dim_im_out; i_out_x++ )
+        {
+            int32_t   col_start = i_out_x * pool_stride - pool_padding;
+            int32_t   col_end = col_start + pool_kernel;
+            q7_t     *pOut = Im_out + ( i_out_y * dim_im_out + i_out_x ) * ch_im_out;
+
+            col_start = col_start < 0 ? 0 : col_start;
+            col_end = col_end > dim_conv_out ? dim_conv_out : col_end;
+
+            /* ReLU: the maximum starts at zero */
+            memset( pOut, 0, ch_im_out );
+
+            for( i_row = row_start; i_row < row_end; i_row++ )
+            {
+                const q7_t *pRow = bufferB + ( i_row % pool_kernel ) * row_size;
+
+                for( i_col = col_start; i_col < col_end; i_col++ )
+                {
+                    const q7_t *pIn = pRow + i_col * ch_im_out;
+
+                    for( i_ch = 0; i_ch < ch_im_out; i_ch++ )
+                    {
+                        if( pIn[i_ch] > pOut[i_ch] )
+                        {
+                            pOut[i_ch] = pIn[i_ch];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
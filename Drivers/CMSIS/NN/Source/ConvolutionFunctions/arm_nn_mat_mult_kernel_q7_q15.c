@@ -46,6 +46,10 @@
  *
  * This function does the matrix multiplication with weight matrix
  * and 2 columns from im2col.
+ *
+ * On cores without the DSP extension, pA and pInBuffer are read in words.
+ * They must be word aligned on Cortex-M0, with numCol_A a multiple of 4 so
+ * that every row and column starts on a word.
  */
 
 q7_t     *arm_nn_mat_mult_kernel_q7_q15( const q7_t *pA,
@@ -188,8 +192,147 @@ q7_t     *arm_nn_mat_mult_kernel_q7_q15( const q7_t *pA,
     /* return the new output pointer with offset */
     return pOut;
 #else
-    /* To be completed */
-    return NULL;
+    /* Run the following code for Cortex-M0 and Cortex-M3 */
+
+    /*
+     * Without SXTB16, the weights are read one word of 4 q7_t and the columns
+     * one word of 2 q15_t, then sign-extended with shifts. Each value is used
+     * twice in the 2 x 2 block of rows and columns.
+     */
+
+    /* set up the second output pointers */
+    q7_t     *pOut2 = pOut + ch_im_out;
+    const q7_t *pBias = bias;
+
+    uint16_t  rowCnt = ch_im_out >> 1;
+
+    /* this loop over rows in A */
+    while( rowCnt )
+    {
+        /* setup pointers for B */
+        const q15_t *pB = pInBuffer;
+        const q15_t *pB2 = pB + numCol_A;
+
+        /* align the second pointer for A */
+        const q7_t *pA2 = pA + numCol_A;
+
+        /* init the sum with bias */
+        q31_t     sum = ( ( q31_t )( *pBias ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     sum2 = ( ( q31_t )( *pBias++ ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     sum3 = ( ( q31_t )( *pBias ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     sum4 = ( ( q31_t )( *pBias++ ) << bias_shift ) + NN_ROUND( out_shift );
+
+        uint16_t  colCnt = numCol_A >> 2;
+
+        /* accumulate over the vector */
+        while( colCnt )
+        {
+            q31_t     inA11, inA12, inA13, inA14;
+            q31_t     inA21, inA22, inA23, inA24;
+            q31_t     inB1, inB2, inB3, inB4;
+
+            pA = read_and_extend_q7x4( pA, &inA11, &inA12, &inA13, &inA14 );
+            pA2 = read_and_extend_q7x4( pA2, &inA21, &inA22, &inA23, &inA24 );
+
+            pB = read_and_extend_q15x2( pB, &inB1, &inB2 );
+            pB2 = read_and_extend_q15x2( pB2, &inB3, &inB4 );
+
+            sum += inA11 * inB1 + inA12 * inB2;
+            sum2 += inA11 * inB3 + inA12 * inB4;
+            sum3 += inA21 * inB1 + inA22 * inB2;
+            sum4 += inA21 * inB3 + inA22 * inB4;
+
+            pB = read_and_extend_q15x2( pB, &inB1, &inB2 );
+            pB2 = read_and_extend_q15x2( pB2, &inB3, &inB4 );
+
+            sum += inA13 * inB1 + inA14 * inB2;
+            sum2 += inA13 * inB3 + inA14 * inB4;
+            sum3 += inA23 * inB1 + inA24 * inB2;
+            sum4 += inA23 * inB3 + inA24 * inB4;
+
+            colCnt--;
+        }                       /* while over colCnt */
+
+        colCnt = numCol_A & 0x3;
+
+        while( colCnt )
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q7_t      inA2 = *pA2++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            sum3 += inA2 * inB1;
+            sum4 += inA2 * inB2;
+            colCnt--;
+        }                       /* while over colCnt */
+
+        *pOut++ = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
+        *pOut++ = ( q7_t ) __SSAT( ( sum3 >> out_shift ), 8 );
+        *pOut2++ = ( q7_t ) __SSAT( ( sum2 >> out_shift ), 8 );
+        *pOut2++ = ( q7_t ) __SSAT( ( sum4 >> out_shift ), 8 );
+
+        /* skip the row computed with A2 */
+        pA += numCol_A;
+        rowCnt--;
+    }                           /* for over ch_im_out */
+
+    /* compute left-over row if any */
+    if( ch_im_out & 0x1 )
+    {
+        /* setup pointers for B */
+        const q15_t *pB = pInBuffer;
+        const q15_t *pB2 = pB + numCol_A;
+
+        /* load the bias */
+        q31_t     sum = ( ( q31_t )( *pBias ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     sum2 = ( ( q31_t )( *pBias++ ) << bias_shift ) + NN_ROUND( out_shift );
+
+        uint16_t  colCnt = numCol_A >> 2;
+
+        while( colCnt )
+        {
+            q31_t     inA11, inA12, inA13, inA14;
+            q31_t     inB1, inB2, inB3, inB4;
+
+            pA = read_and_extend_q7x4( pA, &inA11, &inA12, &inA13, &inA14 );
+
+            pB = read_and_extend_q15x2( pB, &inB1, &inB2 );
+            pB2 = read_and_extend_q15x2( pB2, &inB3, &inB4 );
+            sum += inA11 * inB1 + inA12 * inB2;
+            sum2 += inA11 * inB3 + inA12 * inB4;
+
+            pB = read_and_extend_q15x2( pB, &inB1, &inB2 );
+            pB2 = read_and_extend_q15x2( pB2, &inB3, &inB4 );
+            sum += inA13 * inB1 + inA14 * inB2;
+            sum2 += inA13 * inB3 + inA14 * inB4;
+
+            colCnt--;
+        }
+
+        colCnt = numCol_A & 0x3;
+
+        while( colCnt )
+        {
+            q7_t      inA1 = *pA++;
+            q15_t     inB1 = *pB++;
+            q15_t     inB2 = *pB2++;
+
+            sum += inA1 * inB1;
+            sum2 += inA1 * inB2;
+            colCnt--;
+        }
+
+        *pOut++ = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
+        *pOut2++ = ( q7_t ) __SSAT( ( sum2 >> out_shift ), 8 );
+    }
+
+    pOut += ch_im_out;
+
+    /* return the new output pointer with offset */
+    return pOut;
 #endif                          /* ARM_MATH_DSP */
 
 }
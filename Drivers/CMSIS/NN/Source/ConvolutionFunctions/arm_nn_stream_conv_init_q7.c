@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_stream_conv_init_q7.c
+ * Description:  Initialization function of the Q7 streaming convolution layers
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNStream
+ * @{
+ */
+
+/**
+ * @brief Initialization function of the Q7 streaming convolution layers
+ * @param[in,out]   S             points to an instance of the streaming convolution structure
+ * @param[in]       dim_im_in_x   input frame dimension
+ * @param[in]       ch_im_in      number of input channels
+ * @param[in]       wt            pointer to kernel weights
+ * @param[in]       ch_im_out     number of filters, i.e., output channels
+ * @param[in]       dim_kernel_x  filter kernel size x
+ * @param[in]       dim_kernel_y  filter kernel size in time
+ * @param[in]       padding_x     padding size x
+ * @param[in]       stride_x      convolution stride x
+ * @param[in]       bias          pointer to bias
+ * @param[in]       bias_shift    amount of left-shift for bias
+ * @param[in]       out_shift     amount of right-shift for output
+ * @param[in]       dim_im_out_x  output frame dimension
+ * @param[in]       pState        pointer to the state buffer
+ * @return none.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * pState size: (2*dim_kernel_y-1)*dim_im_in_x*ch_im_in
+ *
+ * The state is cleared, as if dim_kernel_y - 1 frames of zeros had been
+ * received. The weights have the layout of the non-square convolution
+ * functions, with dim_kernel_y rows in time.
+ */
+
+void arm_nn_stream_conv_init_q7( arm_nn_stream_conv_instance_q7 *S,
+                                 const uint16_t dim_im_in_x,
+                                 const uint16_t ch_im_in,
+                                 const q7_t *wt,
+                                 const uint16_t ch_im_out,
+                                 const uint16_t dim_kernel_x,
+                                 const uint16_t dim_kernel_y,
+                                 const uint16_t padding_x,
+                                 const uint16_t stride_x,
+                                 const q7_t *bias,
+                                 const uint16_t bias_shift,
+                                 const uint16_t out_shift,
+                                 const uint16_t dim_im_out_x,
+                                 q7_t *pState )
+{
+    S->wt = wt;
+    S->bias = bias;
+    S->pState = pState;
+    S->dim_im_in_x = dim_im_in_x;
+    S->ch_im_in = ch_im_in;
+    S->ch_im_out = ch_im_out;
+    S->dim_kernel_x = dim_kernel_x;
+    S->dim_kernel_y = dim_kernel_y;
+    S->padding_x = padding_x;
+    S->stride_x = stride_x;
+    S->bias_shift = bias_shift;
+    S->out_shift = out_shift;
+    S->dim_im_out_x = dim_im_out_x;
+    S->stateIndex = 0;
+
+    /* Clear the state buffer */
+    memset( pState, 0, ( 2U * dim_kernel_y - 1U ) * dim_im_in_x * ch_im_in );
+}
+
+/**
+ * @} end of NNStream group
+ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_stream_depthwise_conv_q7.c
+ * Description:  Q7 streaming depthwise separable convolution, one time step
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNStream
+ * @{
+ */
+
+/**
+ * @brief Q7 streaming depthwise separable convolution, one time step
+ * @param[in,out]   S             points to an instance of the streaming convolution structure
+ * @param[in]       frame_in      pointer to the newest input frame
+ * @param[out]      frame_out     pointer to the output frame
+ * @param[in,out]   bufferA       pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*ch_im_in*dim_kernel_x*dim_kernel_y
+ *
+ * The state holds the last dim_kernel_y frames in a ring of dim_kernel_y
+ * slots. Each frame is also written dim_kernel_y slots further, except in
+ * the last slot, so that the frames from the oldest to the newest are
+ * always contiguous and are the input rows of
+ * arm_depthwise_separable_conv_HWC_q7_nonsquare(), which has the same
+ * constraints here: ch_im_in is equal to ch_im_out.
+ */
+
+arm_status arm_nn_stream_depthwise_conv_q7( arm_nn_stream_conv_instance_q7 *S,
+        const q7_t *frame_in,
+        q7_t *frame_out,
+        q15_t *bufferA )
+{
+    uint32_t  frameSize = ( uint32_t ) S->dim_im_in_x * S->ch_im_in;
+    uint16_t  numFrames = S->dim_kernel_y;
+    uint16_t  index = S->stateIndex;
+
+    /* The newest frame replaces the oldest one, and its copy */
+    memcpy( S->pState + index * frameSize, frame_in, frameSize );
+
+    if( index + 1U < numFrames )
+    {
+        memcpy( S->pState + ( index + numFrames ) * frameSize, frame_in, frameSize );
+        index++;
+    }
+    else
+    {
+        index = 0;
+    }
+
+    S->stateIndex = index;
+
+    /* One output row from the dim_kernel_y frames starting at the oldest one */
+    return arm_depthwise_separable_conv_HWC_q7_nonsquare( S->pState + index * frameSize, S->dim_im_in_x, numFrames,
+            S->ch_im_in, S->wt, S->ch_im_out, S->dim_kernel_x, numFrames,
+            S->padding_x, 0, S->stride_x, 1, S->bias, S->bias_shift,
+            S->out_shift, frame_out, S->dim_im_out_x, 1, bufferA, NULL );
+}
+
+/**
+ * @} end of NNStream group
+ */
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q4.c
+ * Description:  Q7 fully-connected layer function with 4-bit weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#if !defined (ARM_MATH_DSP)
+
+/*
+ * Sum of the products of 8 values of the vector, packed by pairs in pA, by
+ * the 8 weights of inM, with 4 multiplications. The weights are made
+ * unsigned, w + 8, and weights k and k+4 are placed in the two halves of
+ * a word: the middle half of its product with the pair (v[k] << 16) + v[k+4]
+ * is v[k] * (w[k] + 8) + v[k+4] * (w[k+4] + 8). The sums of 4 products
+ * stay within 16 bits, the caller removes 8 times the sum of the values.
+ */
+__STATIC_FORCEINLINE q31_t fc_q4_dot8( const q31_t *pA, uint32_t inM )
+{
+    uint32_t  sum;
+
+    inM ^= 0x88888888;
+
+    sum = ( uint32_t )pA[0] * ( inM & 0x000F000F );
+    sum += ( uint32_t )pA[1] * ( ( inM >> 4 ) & 0x000F000F );
+    sum += ( uint32_t )pA[2] * ( ( inM >> 8 ) & 0x000F000F );
+    sum += ( uint32_t )pA[3] * ( ( inM >> 12 ) & 0x000F000F );
+
+    return ( q31_t )( sum + 0x8000 ) >> 16;
+}
+
+#endif /* #if !defined (ARM_MATH_DSP) */
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/**
+ * @brief Q7 fully-connected layer function with 4-bit weights
+ * @param[in]       pV          pointer to input vector
+ * @param[in]       pM          pointer to packed matrix weights
+ * @param[in]       scale       pointer to the scale of each row
+ * @param[in]       dim_vec     length of the vector
+ * @param[in]       num_of_rows number of rows in weight matrix
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       bias        pointer to bias
+ * @param[in,out]   pOut        pointer to output vector
+ * @param[in,out]   vec_buffer  pointer to buffer space for input
+ * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * vec_buffer size: dim_vec
+ *
+ * The weights are signed 4-bit values in [-8 7], two per byte: the first
+ * weight of each pair in the low nibble. Each row starts on a byte, so a
+ * row takes (dim_vec+1)/2 bytes. The weight of row i is the 4-bit value
+ * multiplied by scale[i], and the output is the one of
+ * arm_fully_connected_q7() with these weights. The weights are
+ * generated by Scripts/NNFunctions/fully_connected_compressed_weight_generation.py.
+ *
+ * On cores with the DSP extension, the vector is expanded to q15 in
+ * vec_buffer, in an order that matches the unpacking of 8 weights from
+ * one word. On the other cores, the vector is packed by pairs in
+ * vec_buffer, and the 8 weights of a word are multiplied with 4
+ * multiplications by fc_q4_dot8(). The weights are read in words when
+ * each row starts on a word, and byte by byte otherwise.
+ *
+ * This does not reach the speed of dense q7 weights in every case. In
+ * NnLibTest_Host (x86, Cortex-M0 code), it runs at about 0.8x the
+ * speed of arm_fully_connected_q7_ref(), which the compiler vectorizes.
+ * Built without vectorization, it runs at about 2x the speed of
+ * arm_fully_connected_q7() for 256 columns and 64 rows.
+ * Cycles on Cortex-M0 have not been measured.
+ *
+ */
+
+arm_status arm_fully_connected_q4( const q7_t *pV,
+                                   const q7_t *pM,
+                                   const q7_t *scale,
+                                   const uint16_t dim_vec,
+                                   const uint16_t num_of_rows,
+                                   const uint16_t bias_shift,
+                                   const uint16_t out_shift, const q7_t *bias, q7_t *pOut, q15_t *vec_buffer )
+{
+    uint16_t  rowBytes = ( dim_vec + 1 ) >> 1;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    const q7_t *pB;
+    const q7_t *pSrc = pV;
+    q15_t    *pA = vec_buffer;
+    q7_t     *pO = pOut;
+    uint16_t  rowCnt;
+    uint16_t  colCnt = dim_vec >> 3;
+
+    /*
+     * expand the vector into the buffer, each group of 8 values as the
+     * pairs (0,4), (2,6), (1,5) and (3,7), the left-over in order
+     */
+    while( colCnt )
+    {
+        *__SIMD32( pA )++ = __PKHBT( pSrc[0], pSrc[4], 16 );
+        *__SIMD32( pA )++ = __PKHBT( pSrc[2], pSrc[6], 16 );
+        *__SIMD32( pA )++ = __PKHBT( pSrc[1], pSrc[5], 16 );
+        *__SIMD32( pA )++ = __PKHBT( pSrc[3], pSrc[7], 16 );
+        pSrc += 8;
+        colCnt--;
+    }
+
+    colCnt = dim_vec & 0x7;
+
+    while( colCnt )
+    {
+        *pA++ = *pSrc++;
+        colCnt--;
+    }
+
+    for( rowCnt = 0; rowCnt < num_of_rows; rowCnt++ )
+    {
+        q31_t     sum = ( ( q31_t )( bias[rowCnt] ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     sum16 = 0;
+        q31_t     acc;
+
+        pB = pM + rowCnt * rowBytes;
+        pA = vec_buffer;
+        colCnt = dim_vec >> 3;
+
+        while( colCnt )
+        {
+            q31_t     inM = *__SIMD32( pB )++;
+            q31_t     inLo, inHi, inV;
+
+#ifdef ARM_MATH_BIG_ENDIAN
+            inM = ( q31_t ) __REV( ( uint32_t ) inM );
+#endif
+
+            /* the nibbles in the top of each byte, i.e. the weights multiplied by 16 */
+            inLo = ( q31_t ) ( ( ( uint32_t ) inM << 4 ) & 0xF0F0F0F0 );
+            inHi = ( q31_t ) ( ( uint32_t ) inM & 0xF0F0F0F0 );
+
+            inV = *__SIMD32( pA )++;
+            sum16 = __SMLAD( inV, __SXTB16( inLo ), sum16 );
+            inV = *__SIMD32( pA )++;
+            sum16 = __SMLAD( inV, __SXTB16( __ROR( inLo, 8 ) ), sum16 );
+            inV = *__SIMD32( pA )++;
+            sum16 = __SMLAD( inV, __SXTB16( inHi ), sum16 );
+            inV = *__SIMD32( pA )++;
+            sum16 = __SMLAD( inV, __SXTB16( __ROR( inHi, 8 ) ), sum16 );
+
+            colCnt--;
+        }
+
+        /* sum16 is a multiple of 16 */
+        acc = sum16 >> 4;
+
+        /* left-over of the vector */
+        colCnt = dim_vec & 0x7;
+
+        while( colCnt >= 2 )
+        {
+            q31_t     inM = *pB++;
+
+            acc += *pA++ * ( ( q31_t )( ( uint32_t )inM << 28 ) >> 28 );
+            acc += *pA++ * ( ( q31_t )( ( uint32_t )inM << 24 ) >> 28 );
+            colCnt -= 2;
+        }
+
+        if( colCnt )
+        {
+            acc += *pA * ( ( q31_t )( ( uint32_t )*pB << 28 ) >> 28 );
+        }
+
+        sum += acc * scale[rowCnt];
+        *pO++ = ( q7_t )( __SSAT( ( sum >> out_shift ), 8 ) );
+    }
+
+#else
+    /* Run the following code for Cortex-M0 and Cortex-M3 */
+
+    const q7_t *pB = pM;
+    const q7_t *pSrc = pV;
+    q31_t    *pA = ( q31_t * ) vec_buffer;
+    q7_t     *pO = pOut;
+    q31_t     sumV = 0;
+    uint16_t  rowCnt;
+    uint16_t  colCnt = dim_vec >> 3;
+    /* the weights are read in words when each row starts on a word */
+    int       wordRows = ( rowBytes & 0x3 ) == 0 && NN_WORD_ALIGNED( pM );
+
+    /*
+     * pack each group of 8 values of the vector in 4 words, value k in
+     * the top half and value k+4 in the bottom half, and sum them
+     */
+    while( colCnt )
+    {
+        *pA++ = ( q31_t )( ( uint32_t ) pSrc[0] << 16 ) + pSrc[4];
+        *pA++ = ( q31_t )( ( uint32_t ) pSrc[1] << 16 ) + pSrc[5];
+        *pA++ = ( q31_t )( ( uint32_t ) pSrc[2] << 16 ) + pSrc[6];
+        *pA++ = ( q31_t )( ( uint32_t ) pSrc[3] << 16 ) + pSrc[7];
+        sumV += pSrc[0] + pSrc[1] + pSrc[2] + pSrc[3] + pSrc[4] + pSrc[5] + pSrc[6] + pSrc[7];
+        pSrc += 8;
+        colCnt--;
+    }
+
+    for( rowCnt = 0; rowCnt < num_of_rows; rowCnt++ )
+    {
+        q31_t     sum = ( ( q31_t )( bias[rowCnt] ) << bias_shift ) + NN_ROUND( out_shift );
+        q31_t     acc = 0;
+
+        pA = ( q31_t * ) vec_buffer;
+        colCnt = dim_vec >> 3;
+
+        if( wordRows )
+        {
+            while( colCnt )
+            {
+                uint32_t  inM = *( const uint32_t * )pB;
+
+#ifdef ARM_MATH_BIG_ENDIAN
+                inM = __REV( inM );
+#endif
+
+                acc += fc_q4_dot8( pA, inM );
+                pA += 4;
+                pB += 4;
+                colCnt--;
+            }
+        }
+        else
+        {
+            while( colCnt )
+            {
+                uint32_t  inM = ( uint32_t )( uint8_t )pB[0] | ( ( uint32_t )( uint8_t )pB[1] << 8 ) |
+                                ( ( uint32_t )( uint8_t )pB[2] << 16 ) | ( ( uint32_t )( uint8_t )pB[3] << 24 );
+
+                acc += fc_q4_dot8( pA, inM );
+                pA += 4;
+                pB += 4;
+                colCnt--;
+            }
+        }
+
+        /* the offset of the weights packed by fc_q4_dot8() */
+        acc -= sumV * 8;
+
+        /* left-over of the vector */
+        pSrc = pV + ( dim_vec & ~0x7 );
+        colCnt = dim_vec & 0x7;
+
+        while( colCnt >= 2 )
+        {
+            q31_t     inM = *pB++;
+
+            acc += *pSrc++ * ( ( q31_t )( ( uint32_t )inM << 28 ) >> 28 );
+            acc += *pSrc++ * ( ( q31_t )( ( uint32_t )inM << 24 ) >> 28 );
+            colCnt -= 2;
+        }
+
+        if( colCnt )
+        {
+            acc += *pSrc * ( ( q31_t )( ( uint32_t )*pB++ << 28 ) >> 28 );
+        }
+
+        sum += acc * scale[rowCnt];
+        *pO++ = ( q7_t )( __SSAT( ( sum >> out_shift ), 8 ) );
+    }
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to ARM_MATH_SUCCESS */
+    return ( ARM_MATH_SUCCESS );
+
+}
+
+/**
+ * @} end of FC group
+ */
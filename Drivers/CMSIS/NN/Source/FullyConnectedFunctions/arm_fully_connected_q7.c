@@ -62,6 +62,10 @@
  * This basic function is designed to work with regular weight
  * matrix without interleaving.
  *
+ * On cores without the DSP extension, the vector and the weights are
+ * read in words when pV and pM are word aligned and dim_vec is a
+ * multiple of 4.
+ *
  */
 
 arm_status arm_fully_connected_q7( const q7_t *pV,
@@ -176,19 +180,95 @@ arm_status arm_fully_connected_q7( const q7_t *pV,
     }
 
 #else
-    int       i, j;
+    /* Run the following code for Cortex-M0 and Cortex-M3 */
 
-    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
-    for( i = 0; i < num_of_rows; i++ )
+    if( ( dim_vec & 0x3 ) == 0 && NN_WORD_ALIGNED( pV ) && NN_WORD_ALIGNED( pM ) )
     {
-        int       ip_out = ( ( q31_t )( bias[i] ) << bias_shift ) + NN_ROUND( out_shift );
+        /*
+         * The vector and the weights are read in words and each word of
+         * the vector is used for 2 rows
+         */
+        uint16_t  rowCnt = num_of_rows >> 1;
+        const q7_t *pB = pM;
+        const q7_t *pA;
+        q7_t     *pO = pOut;
+        const q7_t *pBias = bias;
+
+        while( rowCnt )
+        {
+            const q7_t *pB2 = pB + dim_vec;
+            q31_t     sum = ( ( q31_t )( *pBias++ ) << bias_shift ) + NN_ROUND( out_shift );
+            q31_t     sum2 = ( ( q31_t )( *pBias++ ) << bias_shift ) + NN_ROUND( out_shift );
+
+            uint16_t  colCnt = dim_vec >> 2;
+
+            pA = pV;
+
+            while( colCnt )
+            {
+                q31_t     inV1, inV2, inV3, inV4;
+                q31_t     inM11, inM12, inM13, inM14;
+                q31_t     inM21, inM22, inM23, inM24;
+
+                pA = read_and_extend_q7x4( pA, &inV1, &inV2, &inV3, &inV4 );
+                pB = read_and_extend_q7x4( pB, &inM11, &inM12, &inM13, &inM14 );
+                pB2 = read_and_extend_q7x4( pB2, &inM21, &inM22, &inM23, &inM24 );
 
-        for( j = 0; j < dim_vec; j++ )
+                sum += inV1 * inM11 + inV2 * inM12 + inV3 * inM13 + inV4 * inM14;
+                sum2 += inV1 * inM21 + inV2 * inM22 + inV3 * inM23 + inV4 * inM24;
+
+                colCnt--;
+            }
+
+            *pO++ = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
+            *pO++ = ( q7_t ) __SSAT( ( sum2 >> out_shift ), 8 );
+
+            /* skip the row computed with pB2 */
+            pB += dim_vec;
+            rowCnt--;
+        }
+
+        /* left-over row if any */
+        if( num_of_rows & 0x1 )
         {
-            ip_out += pV[j] * pM[i * dim_vec + j];
+            q31_t     sum = ( ( q31_t )( *pBias ) << bias_shift ) + NN_ROUND( out_shift );
+
+            uint16_t  colCnt = dim_vec >> 2;
+
+            pA = pV;
+
+            while( colCnt )
+            {
+                q31_t     inV1, inV2, inV3, inV4;
+                q31_t     inM11, inM12, inM13, inM14;
+
+                pA = read_and_extend_q7x4( pA, &inV1, &inV2, &inV3, &inV4 );
+                pB = read_and_extend_q7x4( pB, &inM11, &inM12, &inM13, &inM14 );
+
+                sum += inV1 * inM11 + inV2 * inM12 + inV3 * inM13 + inV4 * inM14;
+
+                colCnt--;
+            }
+
+            *pO = ( q7_t ) __SSAT( ( sum >> out_shift ), 8 );
         }
+    }
+    else
+    {
+        /* Run the following code as reference implementation */
+        int       i, j;
+
+        for( i = 0; i < num_of_rows; i++ )
+        {
+            int       ip_out = ( ( q31_t )( bias[i] ) << bias_shift ) + NN_ROUND( out_shift );
+
+            for( j = 0; j < dim_vec; j++ )
+            {
+                ip_out += pV[j] * pM[i * dim_vec + j];
+            }
 
-        pOut[i] = ( q7_t ) __SSAT( ( ip_out >> out_shift ), 8 );
+            pOut[i] = ( q7_t ) __SSAT( ( ip_out >> out_shift ), 8 );
+        }
     }
 
 #endif                          /* ARM_MATH_DSP */
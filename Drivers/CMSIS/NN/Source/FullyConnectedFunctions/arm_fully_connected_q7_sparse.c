@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q7_sparse.c
+ * Description:  Q7 fully-connected layer function with block sparse weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+/**
+ * @brief Q7 fully-connected layer function with block sparse weights
+ * @param[in]       pV          pointer to input vector
+ * @param[in]       pM          pointer to the weights of the blocks
+ * @param[in]       col_index   pointer to the first column of each block
+ * @param[in]       row_start   pointer to the first block of each row, num_of_rows + 1 entries
+ * @param[in]       dim_vec     length of the vector
+ * @param[in]       num_of_rows number of rows in weight matrix
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       bias        pointer to bias
+ * @param[in,out]   pOut        pointer to output vector
+ * @param[in,out]   vec_buffer  pointer to buffer space for input
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * vec_buffer size: dim_vec
+ *
+ * The weight matrix is stored in compressed sparse row format with
+ * blocks of 4 columns: the blocks of row i are the blocks row_start[i]
+ * to row_start[i+1]-1, block k holds the 4 weights of columns
+ * col_index[k] to col_index[k]+3 at pM + 4*k, and the other weights
+ * are 0. The first column of a block is a multiple of 4. The output is
+ * the one of arm_fully_connected_q7() with the dense matrix. The blocks
+ * are generated by Scripts/NNFunctions/fully_connected_compressed_weight_generation.py.
+ *
+ * A block takes 6 bytes for 4 weights, so the weights are smaller than
+ * the dense matrix when less than two thirds of the blocks are kept.
+ *
+ * The time is proportional to the number of blocks kept, but each block
+ * costs more than 4 dense weights. The speed of dense q7 weights is not
+ * reached in every case. In NnLibTest_Host (x86, Cortex-M0 code), with
+ * half of the blocks kept, it runs at 0.6x to 0.7x the speed of
+ * arm_fully_connected_q7_ref(), which the compiler vectorizes. Built
+ * without vectorization, it runs at about 1.5x the speed of
+ * arm_fully_connected_q7() for 256 columns and 64 rows.
+ * Cycles on Cortex-M0 have not been measured.
+ *
+ * This function has the constraint:
+ *   dim_vec is multiple of 4
+ *
+ */
+
+arm_status arm_fully_connected_q7_sparse( const q7_t *pV,
+        const q7_t *pM,
+        const uint16_t *col_index,
+        const uint16_t *row_start,
+        const uint16_t dim_vec,
+        const uint16_t num_of_rows,
+        const uint16_t bias_shift,
+        const uint16_t out_shift, const q7_t *bias, q7_t *pOut, q15_t *vec_buffer )
+{
+    uint16_t  rowCnt;
+
+    /* check the constraints first */
+    if( dim_vec & 0x3 )
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    const q7_t *pB = pM + 4 * row_start[0];
+    const uint16_t *pCol = col_index + row_start[0];
+
+    /* expand the vector into the buffer */
+    arm_q7_to_q15_no_shift( pV, vec_buffer, dim_vec );
+
+    for( rowCnt = 0; rowCnt < num_of_rows; rowCnt++ )
+    {
+        q31_t     sum = ( ( q31_t )( bias[rowCnt] ) << bias_shift ) + NN_ROUND( out_shift );
+        uint16_t  blkCnt = row_start[rowCnt + 1] - row_start[rowCnt];
+
+        while( blkCnt )
+        {
+            q15_t    *pA = vec_buffer + *pCol++;
+            q31_t     inM11, inM12;
+
+            pB = ( q7_t * ) read_and_pad( ( void * )pB, &inM11, &inM12 );
+
+            sum = __SMLAD( *__SIMD32( pA )++, inM11, sum );
+            sum = __SMLAD( *__SIMD32( pA ), inM12, sum );
+
+            blkCnt--;
+        }
+
+        pOut[rowCnt] = ( q7_t )( __SSAT( ( sum >> out_shift ), 8 ) );
+    }
+
+#else
+    /* Run the following code for Cortex-M0 and Cortex-M3 */
+
+    const q7_t *pB = pM + 4 * row_start[0];
+    const uint16_t *pCol = col_index + row_start[0];
+
+    if( NN_WORD_ALIGNED( pV ) && NN_WORD_ALIGNED( pB ) )
+    {
+        /* The blocks of the weights and of the vector are read in words, two blocks per iteration */
+        for( rowCnt = 0; rowCnt < num_of_rows; rowCnt++ )
+        {
+            q31_t     sum = ( ( q31_t )( bias[rowCnt] ) << bias_shift ) + NN_ROUND( out_shift );
+            q31_t     sum2 = 0;
+            uint16_t  blkCnt = row_start[rowCnt + 1] - row_start[rowCnt];
+
+            while( blkCnt >= 2 )
+            {
+                q31_t     inV1, inV2, inV3, inV4, inM1, inM2, inM3, inM4;
+                q31_t     inV5, inV6, inV7, inV8, inM5, inM6, inM7, inM8;
+
+                read_and_extend_q7x4( pV + pCol[0], &inV1, &inV2, &inV3, &inV4 );
+                read_and_extend_q7x4( pV + pCol[1], &inV5, &inV6, &inV7, &inV8 );
+                pB = read_and_extend_q7x4( pB, &inM1, &inM2, &inM3, &inM4 );
+                pB = read_and_extend_q7x4( pB, &inM5, &inM6, &inM7, &inM8 );
+                pCol += 2;
+
+                sum += inV1 * inM1;
+                sum2 += inV5 * inM5;
+                sum += inV2 * inM2;
+                sum2 += inV6 * inM6;
+                sum += inV3 * inM3;
+                sum2 += inV7 * inM7;
+                sum += inV4 * inM4;
+                sum2 += inV8 * inM8;
+
+                blkCnt -= 2;
+            }
+
+            if( blkCnt )
+            {
+                q31_t     inV1, inV2, inV3, inV4, inM1, inM2, inM3, inM4;
+
+                read_and_extend_q7x4( pV + *pCol++, &inV1, &inV2, &inV3, &inV4 );
+                pB = read_and_extend_q7x4( pB, &inM1, &inM2, &inM3, &inM4 );
+
+                sum += inV1 * inM1;
+                sum2 += inV2 * inM2;
+                sum += inV3 * inM3;
+                sum2 += inV4 * inM4;
+            }
+
+            sum += sum2;
+            pOut[rowCnt] = ( q7_t )( __SSAT( ( sum >> out_shift ), 8 ) );
+        }
+    }
+    else
+    {
+        /* Run the following code as reference implementation */
+        for( rowCnt = 0; rowCnt < num_of_rows; rowCnt++ )
+        {
+            q31_t     sum = ( ( q31_t )( bias[rowCnt] ) << bias_shift ) + NN_ROUND( out_shift );
+            uint16_t  blkCnt = row_start[rowCnt + 1] - row_start[rowCnt];
+
+            while( blkCnt >= 2 )
+            {
+                const q7_t *pA = pV + pCol[0];
+                const q7_t *pA2 = pV + pCol[1];
+
+                sum += pA[0] * pB[0];
+                sum += pA2[0] * pB[4];
+                sum += pA[1] * pB[1];
+                sum += pA2[1] * pB[5];
+                sum += pA[2] * pB[2];
+                sum += pA2[2] * pB[6];
+                sum += pA[3] * pB[3];
+                sum += pA2[3] * pB[7];
+                pCol += 2;
+                pB += 8;
+
+                blkCnt -= 2;
+            }
+
+            if( blkCnt )
+            {
+                const q7_t *pA = pV + *pCol++;
+
+                sum += pA[0] * pB[0];
+                sum += pA[1] * pB[1];
+                sum += pA[2] * pB[2];
+                sum += pA[3] * pB[3];
+                pB += 4;
+            }
+
+            pOut[rowCnt] = ( q7_t )( __SSAT( ( sum >> out_shift ), 8 ) );
+        }
+    }
+
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to ARM_MATH_SUCCESS */
+    return ( ARM_MATH_SUCCESS );
+
+}
+
+/**
+ * @} end of FC group
+ */
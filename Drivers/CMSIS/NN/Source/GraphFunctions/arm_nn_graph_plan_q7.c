@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_plan_q7.c
+ * Description:  Arena placement of the tensors and scratch buffers of a Q7 graph
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#define UNPLACED      0xFFFFFFFFu
+#define NOT_WRITTEN   0xFFFFFFFFu
+
+/* Lifetimes are packed as ( first layer << 16 ) | last layer */
+#define LIFE_FIRST(life) ( ( life ) >> 16 )
+#define LIFE_LAST(life)  ( ( life ) & 0xFFFFu )
+
+static uint32_t align_size( uint32_t size )
+{
+    return ( size + ARM_NN_GRAPH_ALIGN - 1 ) & ~( uint32_t ) ( ARM_NN_GRAPH_ALIGN - 1 );
+}
+
+/*
+ * Size in bytes of the scratch buffer of a layer, from the buffer sizes
+ * documented for each layer function.
+ */
+static uint32_t scratch_size( const arm_nn_layer_q7 *layer )
+{
+    uint32_t  kernel_size = ( uint32_t ) layer->dim_kernel * layer->dim_kernel;
+
+    switch( layer->type )
+    {
+    case ARM_NN_LAYER_CONV_Q7_BASIC:
+    case ARM_NN_LAYER_CONV_Q7_FAST:
+    case ARM_NN_LAYER_CONV_Q7_RGB:
+    case ARM_NN_LAYER_DEPTHWISE_CONV_Q7:
+        /* 2*ch_im_in*dim_kernel*dim_kernel q15_t */
+        return 2 * sizeof( q15_t ) * layer->ch_im_in * kernel_size;
+
+    case ARM_NN_LAYER_FC_Q7:
+    case ARM_NN_LAYER_FC_Q7_OPT:
+        /* dim_vec q15_t */
+        return sizeof( q15_t ) * layer->dim_im_in * layer->dim_im_in * layer->ch_im_in;
+
+    case ARM_NN_LAYER_AVEPOOL_Q7:
+        /* 2*dim_im_out*ch_im_in q15_t */
+        return 2 * sizeof( q15_t ) * layer->dim_im_out * layer->ch_im_in;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+/**
+ * @brief Computes the placement of the tensors and scratch buffers in the arena
+ * @param[in]       graph       pointer to the graph
+ * @param[out]      offsets     pointer to the offsets, num_tensors + num_layers entries
+ * @param[out]      arena_size  size of the arena, in bytes
+ * @param[in,out]   bufferA     pointer to buffer space for the lifetimes
+ * @return     The function returns either
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of graph checking.
+ *
+ * @details
+ *
+ * <b>Buffer size:</b>
+ *
+ * bufferA size: 2*(num_tensors + num_layers) words
+ *
+ * The size of a tensor is the largest size seen by the layers that read
+ * or write it. The buffers are placed from the largest to the smallest,
+ * each at the lowest offset that does not overlap an already placed buffer
+ * living at the same time. Buffers of equal sizes are placed in index
+ * order, and all offsets and sizes are multiples of ARM_NN_GRAPH_ALIGN,
+ * so that the result is the same as the one of nn_graph_gen.py.
+ *
+ * The function returns <code>ARM_MATH_ARGUMENT_ERROR</code> if an index is
+ * out of range or if a layer reads a tensor that nothing wrote before.
+ */
+
+arm_status arm_nn_graph_plan_q7( const arm_nn_graph_q7 *graph,
+                                 uint32_t *offsets,
+                                 uint32_t *arena_size,
+                                 uint32_t *bufferA )
+{
+    const uint32_t num_tensors = graph->num_tensors;
+    const uint32_t num_buffers = num_tensors + graph->num_layers;
+    uint32_t *sizes = bufferA;
+    uint32_t *lives = bufferA + num_buffers;
+    uint32_t  i, j, n, best, offset, size, moved;
+    uint32_t  in_size, out_size;
+
+    if( graph->input >= num_tensors || graph->output >= num_tensors )
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    for( i = 0; i < num_buffers; i++ )
+    {
+        sizes[i] = 0;
+        lives[i] = NOT_WRITTEN;
+        offsets[i] = UNPLACED;
+    }
+
+    /* The input is written by the caller before the first layer */
+    lives[graph->input] = 0;
+
+    for( i = 0; i < graph->num_layers; i++ )
+    {
+        const arm_nn_layer_q7 *layer = &graph->layers[i];
+
+        if( layer->input >= num_tensors || layer->output >= num_tensors || lives[layer->input] == NOT_WRITTEN )
+        {
+            return ARM_MATH_ARGUMENT_ERROR;
+        }
+
+        in_size = ( uint32_t ) layer->dim_im_in * layer->dim_im_in * layer->ch_im_in;
+        out_size = ( uint32_t ) layer->dim_im_out * layer->dim_im_out * layer->ch_im_out;
+
+        sizes[layer->input] = ( in_size > sizes[layer->input] ) ? in_size : sizes[layer->input];
+        lives[layer->input] = ( lives[layer->input] & 0xFFFF0000u ) | i;
+
+        sizes[layer->output] = ( out_size > sizes[layer->output] ) ? out_size : sizes[layer->output];
+        if( lives[layer->output] == NOT_WRITTEN )
+        {
+            lives[layer->output] = ( i << 16 ) | i;
+        }
+        else
+        {
+            lives[layer->output] = ( lives[layer->output] & 0xFFFF0000u ) | i;
+        }
+
+        sizes[num_tensors + i] = scratch_size( layer );
+        lives[num_tensors + i] = ( i << 16 ) | i;
+    }
+
+    /* The output is read by the caller after the last layer */
+    if( lives[graph->output] == NOT_WRITTEN )
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    if( graph->num_layers > 0 )
+    {
+        lives[graph->output] = ( lives[graph->output] & 0xFFFF0000u ) | ( graph->num_layers - 1u );
+    }
+
+    *arena_size = 0;
+
+    for( n = 0; n < num_buffers; n++ )
+    {
+        /* Pick the largest buffer not placed yet */
+        best = num_buffers;
+        for( i = 0; i < num_buffers; i++ )
+        {
+            if( offsets[i] == UNPLACED && ( best == num_buffers || sizes[i] > sizes[best] ) )
+            {
+                best = i;
+            }
+        }
+
+        size = align_size( sizes[best] );
+        offset = 0;
+
+        /* Move past every placed buffer that lives at the same time and overlaps */
+        do
+        {
+            moved = 0;
+
+            for( j = 0; j < num_buffers && size > 0; j++ )
+            {
+                if( offsets[j] == UNPLACED || sizes[j] == 0
+                    || LIFE_FIRST( lives[j] ) > LIFE_LAST( lives[best] )
+                    || LIFE_FIRST( lives[best] ) > LIFE_LAST( lives[j] ) )
+                {
+                    continue;
+                }
+
+                if( offset < offsets[j] + align_size( sizes[j] ) && offsets[j] < offset + size )
+                {
+                    offset = offsets[j] + align_size( sizes[j] );
+                    moved = 1;
+                }
+            }
+        }
+        while( moved );
+
+        offsets[best] = offset;
+
+        if( offset + size > *arena_size )
+        {
+            *arena_size = offset + size;
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNGraph group
+ */
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_graph_run_q7.c
+ * Description:  Runs the layers of a Q7 graph in a single arena
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNGraph
+ * @{
+ */
+
+/**
+ * @brief Runs all the layers of a graph
+ * @param[in]       graph       pointer to the graph
+ * @param[in]       offsets     pointer to the offsets of the tensors and scratch buffers
+ * @param[in,out]   arena       pointer to the arena, aligned on ARM_NN_GRAPH_ALIGN bytes
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code>, <code>ARM_MATH_ARGUMENT_ERROR</code> or <code>ARM_MATH_SUCCESS</code>
+ * based on the outcome of the layer functions.
+ *
+ * @details
+ *
+ * The layers are run in order, each one with its input tensor, output
+ * tensor and scratch buffer taken from the arena at the given offsets.
+ * The run stops at the first layer function that fails, and returns
+ * <code>ARM_MATH_ARGUMENT_ERROR</code> for an unknown layer type.
+ *
+ * A ReLU layer whose output is another tensor first copies its input. The
+ * pooling layers use their input tensor as working space, so it must not
+ * be read by a later layer.
+ */
+
+arm_status arm_nn_graph_run_q7( const arm_nn_graph_q7 *graph,
+                                const uint32_t *offsets,
+                                q7_t *arena )
+{
+    const arm_nn_layer_q7 *layer = graph->layers;
+    arm_status status = ARM_MATH_SUCCESS;
+    q7_t     *pIn;
+    q7_t     *pOut;
+    q15_t    *pBuffer;
+    uint16_t  size;
+    uint16_t  i;
+
+    for( i = 0; i < graph->num_layers && status == ARM_MATH_SUCCESS; i++, layer++ )
+    {
+        pIn = arena + offsets[layer->input];
+        pOut = arena + offsets[layer->output];
+        pBuffer = ( q15_t * ) ( arena + offsets[graph->num_tensors + i] );
+
+        /* Number of input elements, also the vector length of the fully-connected layers */
+        size = layer->dim_im_in * layer->dim_im_in * layer->ch_im_in;
+
+        switch( layer->type )
+        {
+        case ARM_NN_LAYER_CONV_Q7_BASIC:
+            status = arm_convolve_HWC_q7_basic( pIn, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                                layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                                layer->bias_shift, layer->out_shift, pOut, layer->dim_im_out,
+                                                pBuffer, NULL );
+            break;
+
+        case ARM_NN_LAYER_CONV_Q7_FAST:
+            status = arm_convolve_HWC_q7_fast( pIn, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                               layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                               layer->bias_shift, layer->out_shift, pOut, layer->dim_im_out,
+                                               pBuffer, NULL );
+            break;
+
+        case ARM_NN_LAYER_CONV_Q7_RGB:
+            status = arm_convolve_HWC_q7_RGB( pIn, layer->dim_im_in, layer->ch_im_in, layer->wt, layer->ch_im_out,
+                                              layer->dim_kernel, layer->padding, layer->stride, layer->bias,
+                                              layer->bias_shift, layer->out_shift, pOut, layer->dim_im_out,
+                                              pBuffer, NULL );
+            break;
+
+        case ARM_NN_LAYER_DEPTHWISE_CONV_Q7:
+            status = arm_depthwise_separable_conv_HWC_q7( pIn, layer->dim_im_in, layer->ch_im_in, layer->wt,
+                                                          layer->ch_im_out, layer->dim_kernel, layer->padding,
+                                                          layer->stride, layer->bias, layer->bias_shift,
+                                                          layer->out_shift, pOut, layer->dim_im_out, pBuffer, NULL );
+            break;
+
+        case ARM_NN_LAYER_FC_Q7:
+            status = arm_fully_connected_q7( pIn, layer->wt, size, layer->ch_im_out, layer->bias_shift,
+                                             layer->out_shift, layer->bias, pOut, pBuffer );
+            break;
+
+        case ARM_NN_LAYER_FC_Q7_OPT:
+            status = arm_fully_connected_q7_opt( pIn, layer->wt, size, layer->ch_im_out, layer->bias_shift,
+                                                 layer->out_shift, layer->bias, pOut, pBuffer );
+            break;
+
+        case ARM_NN_LAYER_RELU_Q7:
+            if( pOut != pIn )
+            {
+                memcpy( pOut, pIn, size );
+            }
+            arm_relu_q7( pOut, size );
+            break;
+
+        case ARM_NN_LAYER_MAXPOOL_Q7:
+            arm_maxpool_q7_HWC( pIn, layer->dim_im_in, layer->ch_im_in, layer->dim_kernel, layer->padding,
+                                layer->stride, layer->dim_im_out, NULL, pOut );
+            break;
+
+        case ARM_NN_LAYER_AVEPOOL_Q7:
+            arm_avepool_q7_HWC( pIn, layer->dim_im_in, layer->ch_im_in, layer->dim_kernel, layer->padding,
+                                layer->stride, layer->dim_im_out, ( q7_t * ) pBuffer, pOut );
+            break;
+
+        case ARM_NN_LAYER_SOFTMAX_Q7:
+            arm_softmax_q7( pIn, size, pOut );
+            break;
+
+        default:
+            status = ARM_MATH_ARGUMENT_ERROR;
+            break;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @} end of NNGraph group
+ */
@@ -0,0 +1,89 @@
+/*
+ * FreeRTOS configuration of the host tests.
+ *
+ * The values that differ between the tests are guarded so they can be set
+ * on the compiler command line by CMakeLists.txt.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+#define configUSE_PREEMPTION              1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_IDLE_HOOK               1
+#define configUSE_TICK_HOOK               0
+#define configMAX_PRIORITIES              (7)
+#define configSUPPORT_STATIC_ALLOCATION   0
+#define configSUPPORT_DYNAMIC_ALLOCATION  1
+#define configCPU_CLOCK_HZ                (1000000UL)
+#define configTICK_RATE_HZ                ((TickType_t)1000)
+#define configMINIMAL_STACK_SIZE          ((uint16_t)128)
+#define configMAX_TASK_NAME_LEN           (16)
+#define configUSE_TRACE_FACILITY          1
+#define configUSE_16_BIT_TICKS            0
+#define configIDLE_SHOULD_YIELD           1
+#define configUSE_MUTEXES                 1
+#define configQUEUE_REGISTRY_SIZE         8
+#define configCHECK_FOR_STACK_OVERFLOW    0
+#define configUSE_RECURSIVE_MUTEXES       1
+#define configUSE_MALLOC_FAILED_HOOK      0
+#define configUSE_APPLICATION_TASK_TAG    0
+#define configUSE_COUNTING_SEMAPHORES     1
+#define configUSE_TASK_NOTIFICATIONS      1
+
+/* Run time counter and trace macros of Utilities/CPU/cpu_profiler.c */
+#if defined(HOST_TEST_CPU_PROFILER)
+extern void CPU_PROF_ConfigureTimer( void );
+extern uint32_t CPU_PROF_GetCounter( void );
+extern void CPU_PROF_TaskReady( void *pxTask, uint32_t Number );
+extern void CPU_PROF_TaskSwitchedIn( uint32_t Number );
+#define configGENERATE_RUN_TIME_STATS            1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() CPU_PROF_ConfigureTimer()
+#define portGET_RUN_TIME_COUNTER_VALUE()         CPU_PROF_GetCounter()
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )  CPU_PROF_TaskReady( pxTCB, ( pxTCB )->uxTCBNumber )
+#define traceTASK_SWITCHED_IN()                  CPU_PROF_TaskSwitchedIn( pxCurrentTCB->uxTCBNumber )
+#else
+#define configGENERATE_RUN_TIME_STATS     0
+#endif
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES           0
+#define configMAX_CO_ROUTINE_PRIORITIES (2)
+
+/* Software timer definitions. */
+#define configUSE_TIMERS             1
+#define configTIMER_TASK_PRIORITY    (2)
+#define configTIMER_QUEUE_LENGTH     10
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+#ifndef configUSE_TIMER_WHEEL
+#define configUSE_TIMER_WHEEL        0
+#endif
+#ifndef configTIMER_WHEEL_SLOT_BITS
+#define configTIMER_WHEEL_SLOT_BITS  4
+#endif
+#ifndef configTIMER_WHEEL_LEVELS
+#define configTIMER_WHEEL_LEVELS     4
+#endif
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet       1
+#define INCLUDE_uxTaskPriorityGet      1
+#define INCLUDE_vTaskDelete            1
+#define INCLUDE_vTaskCleanUpResources  0
+#define INCLUDE_vTaskSuspend           1
+#define INCLUDE_vTaskDelayUntil        1
+#define INCLUDE_vTaskDelay             1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+#define INCLUDE_eTaskGetState          1
+#define INCLUDE_xTimerPendFunctionCall 1
+
+/* A failed assertion ends the test. */
+extern void vAssertCalled( const char *pcFile, int lLine );
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+
+#endif /* FREERTOS_CONFIG_H */
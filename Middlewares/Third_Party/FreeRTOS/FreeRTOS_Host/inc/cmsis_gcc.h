@@ -0,0 +1,20 @@
+/*
+ * Host stand-in of the CMSIS core header included by cmsis_os.c under GCC:
+ * the only intrinsic used there is __get_IPSR(), which tells thread mode
+ * from handler mode. The tests set host_ipsr to a non zero exception number
+ * to call the CMSIS-RTOS functions as an interrupt handler would.
+ */
+
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+#include <stdint.h>
+
+extern volatile uint32_t host_ipsr;
+
+static inline uint32_t __get_IPSR( void )
+{
+    return host_ipsr;
+}
+
+#endif /* __CMSIS_GCC_H */
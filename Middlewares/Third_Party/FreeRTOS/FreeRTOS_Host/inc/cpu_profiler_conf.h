@@ -0,0 +1,54 @@
+/*
+ * cpu_profiler configuration of the host tests: the TIM counter is a
+ * variable advanced by the test, and the records are captured by the test.
+ */
+
+#ifndef  __CPU_PROFILER_CONF_H__
+#define  __CPU_PROFILER_CONF_H__
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define __IO                            volatile
+
+/* Stand-ins for the HAL TIM used by CPU_PROF_ConfigureTimer() */
+typedef enum { HAL_OK = 0x00U } HAL_StatusTypeDef;
+
+typedef struct
+{
+    __IO uint32_t CNT;
+} TIM_TypeDef;
+
+typedef struct
+{
+    uint32_t Prescaler;
+    uint32_t CounterMode;
+    uint32_t Period;
+    uint32_t ClockDivision;
+    uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct
+{
+    TIM_TypeDef          *Instance;
+    TIM_Base_InitTypeDef  Init;
+} TIM_HandleTypeDef;
+
+#define TIM_COUNTERMODE_UP              0U
+#define TIM_CLOCKDIVISION_DIV1          0U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE  0U
+#define HAL_TIM_Base_Init(htim)         HAL_OK
+#define HAL_TIM_Base_Start(htim)        HAL_OK
+
+extern TIM_TypeDef prof_host_timer;
+void prof_host_transmit( const uint8_t *pBuf, uint16_t Len );
+
+#define CPU_PROF_MAX_TASKS              8U
+#define CPU_PROF_TIMER                  ( &prof_host_timer )
+#define CPU_PROF_TIMER_CLK_ENABLE()
+#define CPU_PROF_TIM_PRESCALER          0U
+#define CPU_PROF_COUNTER_CLOCK_HZ       100000U
+#define CPU_PROF_TRANSMIT(pBuf, Len)    prof_host_transmit( (pBuf), (Len) )
+
+#endif /* __CPU_PROFILER_CONF_H__ */
@@ -0,0 +1,195 @@
+/*
+ * Host (Linux) port of the FreeRTOS kernel, see portmacro.h.
+ *
+ * Each task runs on a host stack allocated by pxPortInitialiseStack(), with a
+ * ucontext_t saved when the task is switched out.  The stack allocated by the
+ * kernel is not used to run the task, so the value returned as the top of
+ * stack - the first member of the TCB - is the address of the host context of
+ * the task instead, and configCHECK_FOR_STACK_OVERFLOW must be 0.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Size of the host stack of each task. */
+#ifndef portHOST_STACK_SIZE
+    #define portHOST_STACK_SIZE     ( 256U * 1024U )
+#endif
+
+#if ( configCHECK_FOR_STACK_OVERFLOW != 0 )
+    #error configCHECK_FOR_STACK_OVERFLOW must be 0 with the host port.
+#endif
+
+#if ( configUSE_IDLE_HOOK != 1 )
+    #error configUSE_IDLE_HOOK must be 1 with the host port, the ticks are generated by the idle hook.
+#endif
+
+typedef struct HostTask
+{
+    ucontext_t      xContext;
+    TaskFunction_t  pxCode;
+    void           *pvParameters;
+    void           *pvStack;
+} HostTask_t;
+
+/* The TCB of the running task, its first member points to the HostTask_t. */
+extern void * volatile pxCurrentTCB;
+
+static ucontext_t xSchedulerContext;
+static UBaseType_t uxCriticalNesting = 0;
+static BaseType_t xPortYieldPending = pdFALSE;
+/*-----------------------------------------------------------*/
+
+static HostTask_t *prvCurrentTask( void )
+{
+    return *( ( HostTask_t ** ) pxCurrentTCB );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+    HostTask_t *pxTask = prvCurrentTask();
+
+    pxTask->pxCode( pxTask->pvParameters );
+
+    /* Tasks must not return. */
+    fprintf( stderr, "FreeRTOS host port: a task returned\n" );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+    HostTask_t *pxTask = ( HostTask_t * ) malloc( sizeof( HostTask_t ) );
+
+    ( void ) pxTopOfStack;
+
+    if( pxTask != NULL )
+    {
+        pxTask->pvStack = malloc( portHOST_STACK_SIZE );
+    }
+
+    if( ( pxTask == NULL ) || ( pxTask->pvStack == NULL ) || ( getcontext( &( pxTask->xContext ) ) != 0 ) )
+    {
+        fprintf( stderr, "FreeRTOS host port: cannot allocate a task context\n" );
+        abort();
+    }
+
+    pxTask->pxCode = pxCode;
+    pxTask->pvParameters = pvParameters;
+    pxTask->xContext.uc_stack.ss_sp = pxTask->pvStack;
+    pxTask->xContext.uc_stack.ss_size = portHOST_STACK_SIZE;
+    pxTask->xContext.uc_link = NULL;
+    makecontext( &( pxTask->xContext ), prvTaskEntry, 0 );
+
+    return ( StackType_t * ) pxTask;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void *pxTCB )
+{
+    HostTask_t *pxTask = *( ( HostTask_t ** ) pxTCB );
+
+    /* Tasks that delete themselves are cleaned up by the idle task, so the
+    stack freed here is never the one in use. */
+    free( pxTask->pvStack );
+    free( pxTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+    uxCriticalNesting = 0;
+    xPortYieldPending = pdFALSE;
+
+    /* Returns when vTaskEndScheduler() is called. */
+    if( swapcontext( &xSchedulerContext, &( prvCurrentTask()->xContext ) ) != 0 )
+    {
+        return pdFALSE;
+    }
+
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    ( void ) swapcontext( &( prvCurrentTask()->xContext ), &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    HostTask_t *pxFrom, *pxTo;
+
+    if( uxCriticalNesting != 0U )
+    {
+        xPortYieldPending = pdTRUE;
+    }
+    else
+    {
+        xPortYieldPending = pdFALSE;
+        pxFrom = prvCurrentTask();
+        vTaskSwitchContext();
+        pxTo = prvCurrentTask();
+
+        if( pxFrom != pxTo )
+        {
+            ( void ) swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting != 0U );
+    uxCriticalNesting--;
+
+    if( ( uxCriticalNesting == 0U ) && ( xPortYieldPending != pdFALSE ) )
+    {
+        vPortYield();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortHostTick( void )
+{
+    /* Same processing as the SysTick handler of the Cortex-M ports. */
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        vPortYield();
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Tick handler of the Cortex-M ports, called by osSystickHandler() of the
+   CMSIS-RTOS wrapper. */
+void xPortSysTickHandler( void )
+{
+    vPortHostTick();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+    /* Every task is blocked: move time on to unblock them. */
+    vPortHostTick();
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, int lLine )
+{
+    fprintf( stderr, "FreeRTOS host port: assertion failed at %s:%d\n", pcFile, lLine );
+    abort();
+}
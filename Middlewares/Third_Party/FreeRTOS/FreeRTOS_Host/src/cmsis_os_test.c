@@ -0,0 +1,308 @@
+/*
+ * Host test of the signal flags of the CMSIS-RTOS wrapper (CMSIS_RTOS/cmsis_os.c)
+ * mixed with its semaphores and single slot message queues, built with
+ * configUSE_OS_NOTIFY_OBJECTS, where all of them use the task notification.
+ *
+ * A waiter thread (high priority) waits on a semaphore or on a message queue,
+ * while a setter thread (normal priority) sets a signal of the waiter, before
+ * or during the wait, and releases the semaphore or puts a message, or lets
+ * the wait time out. The setter calls the functions from a thread, or from a
+ * simulated interrupt. After the object wait the waiter checks that:
+ *   - the semaphore or the message is received, or the wait times out,
+ *   - osSignalWait() returns the signal at once, without waiting, when it was
+ *     set, and the signal is then cleared,
+ *   - osSignalWait() does not return a signal when none was set.
+ *
+ * Usage: CmsisOsTest_Host [--quick] [--seed N]
+ *   --quick    200 iterations (used by ctest), 10000 by default
+ *   --seed N   seed of the scenarios
+ *
+ * The program returns 1 when a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmsis_os.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define CT_SIGNAL           0x0001
+#define CT_SIGNAL_GO        0x0002    /* Starts an iteration of the setter */
+#define CT_SIGNAL_TIMEOUT   10U       /* Timeout of the wait for a pending signal, in ms */
+#define CT_ISR_NUMBER       15U       /* SysTick exception, for __get_IPSR() */
+
+static uint32_t ct_iterations = 10000;
+static uint32_t ct_seed = 1;
+static uint32_t ct_failures = 0;
+
+volatile uint32_t host_ipsr = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Scenarios and random numbers */
+/*--------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    CT_SIGNAL_NONE,         /* No signal */
+    CT_SIGNAL_BEFORE,       /* Signal set before the object wait */
+    CT_SIGNAL_DURING        /* Signal set during the object wait */
+} ct_signal_t;
+
+typedef struct
+{
+    uint32_t    message;    /* Message queue, semaphore otherwise */
+    ct_signal_t signal;
+    uint32_t    release;    /* Semaphore released or message put, timeout otherwise */
+    uint32_t    isr;        /* Setter functions called from an interrupt */
+    uint32_t    timeout;    /* Timeout of the object wait, in ms */
+    uint32_t    value;      /* Message */
+} ct_scenario_t;
+
+static ct_scenario_t ct_scenario;
+
+static uint32_t ct_rand_state;
+
+static uint32_t ct_rand( void )
+{
+    /* xorshift32 */
+    ct_rand_state ^= ct_rand_state << 13;
+    ct_rand_state ^= ct_rand_state >> 17;
+    ct_rand_state ^= ct_rand_state << 5;
+    return ct_rand_state;
+}
+
+static void ct_fail( const char *check )
+{
+    fprintf( stderr, "%s (message %u, signal %u, release %u, isr %u)\n", check,
+             ( unsigned ) ct_scenario.message, ( unsigned ) ct_scenario.signal,
+             ( unsigned ) ct_scenario.release, ( unsigned ) ct_scenario.isr );
+    ct_failures++;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Threads */
+/*--------------------------------------------------------------------------------*/
+
+static osThreadId ct_waiter, ct_setter;
+static osSemaphoreId ct_semaphore;
+static osMessageQId ct_queue;
+
+osSemaphoreDef( ct_semaphore );
+osMessageQDef( ct_queue, 1, uint32_t );
+
+/* Calls made by the setter from an interrupt are not preempted by the
+   waiter: the context switch they request happens at the end of the critical
+   section, as PendSV would once the handler returns. */
+static void ct_enter( uint32_t isr )
+{
+    if( isr )
+    {
+        taskENTER_CRITICAL();
+        host_ipsr = CT_ISR_NUMBER;
+    }
+}
+
+static void ct_exit( uint32_t isr )
+{
+    if( isr )
+    {
+        host_ipsr = 0;
+        taskEXIT_CRITICAL();
+    }
+}
+
+static void ct_setter_thread( void const *argument )
+{
+    ct_scenario_t scenario;
+
+    ( void ) argument;
+
+    for( ;; )
+    {
+        /* The waiter is blocked on the object when the setter runs. Once the
+           object is released it may start the next iteration before the
+           setter resumes, hence the copy of the scenario. */
+        ( void ) osSignalWait( CT_SIGNAL_GO, osWaitForever );
+        scenario = ct_scenario;
+
+        if( scenario.signal == CT_SIGNAL_DURING )
+        {
+            ct_enter( scenario.isr );
+
+            if( osSignalSet( ct_waiter, CT_SIGNAL ) < 0 )
+            {
+                ct_fail( "osSignalSet failed" );
+            }
+
+            ct_exit( scenario.isr );
+        }
+
+        if( scenario.release )
+        {
+            ct_enter( scenario.isr );
+
+            if( ( scenario.message ? osMessagePut( ct_queue, scenario.value, 0 ) :
+                    osSemaphoreRelease( ct_semaphore ) ) != osOK )
+            {
+                ct_fail( "release or put failed" );
+            }
+
+            ct_exit( scenario.isr );
+        }
+    }
+}
+
+static void ct_iteration( void )
+{
+    osEvent event;
+    int32_t status;
+    uint32_t start, elapsed;
+
+    ct_scenario.message = ct_rand() & 1U;
+    ct_scenario.signal = ( ct_signal_t )( ct_rand() % 3U );
+    ct_scenario.release = ( ct_rand() % 4U ) != 0U;
+    ct_scenario.isr = ct_rand() & 1U;
+    ct_scenario.timeout = ct_scenario.release ? osWaitForever : 1U + ct_rand() % 5U;
+    ct_scenario.value = ct_rand();
+
+    if( ct_scenario.signal == CT_SIGNAL_BEFORE )
+    {
+        ( void ) osSignalSet( ct_waiter, CT_SIGNAL );
+    }
+
+    ( void ) osSignalSet( ct_setter, CT_SIGNAL_GO );
+    start = osKernelSysTick();
+
+    if( ct_scenario.message )
+    {
+        event = osMessageGet( ct_queue, ct_scenario.timeout );
+
+        if( ct_scenario.release &&
+                ( ( event.status != osEventMessage ) || ( event.value.v != ct_scenario.value ) ) )
+        {
+            ct_fail( "message not received" );
+        }
+        else if( !ct_scenario.release && ( event.status != osEventTimeout ) )
+        {
+            ct_fail( "message wait not timed out" );
+        }
+    }
+    else
+    {
+        status = osSemaphoreWait( ct_semaphore, ct_scenario.timeout );
+
+        if( status != ( ct_scenario.release ? osOK : osErrorOS ) )
+        {
+            ct_fail( ct_scenario.release ? "semaphore not taken" : "semaphore wait not timed out" );
+        }
+    }
+
+    elapsed = osKernelSysTick() - start;
+
+    if( ct_scenario.release ? ( elapsed != 0U ) : ( elapsed < ct_scenario.timeout ) )
+    {
+        ct_fail( "wrong object wait time" );
+    }
+
+    /* The signal is still pending: no wait, whatever the timeout */
+    start = osKernelSysTick();
+    event = osSignalWait( CT_SIGNAL, ( ct_scenario.signal != CT_SIGNAL_NONE ) ? CT_SIGNAL_TIMEOUT : 0 );
+
+    if( ct_scenario.signal != CT_SIGNAL_NONE )
+    {
+        if( ( event.status != osEventSignal ) || ( event.value.signals != CT_SIGNAL ) )
+        {
+            ct_fail( "signal lost by the object wait" );
+        }
+
+        if( osKernelSysTick() != start )
+        {
+            ct_fail( "signal wait blocked" );
+        }
+    }
+    else if( event.status != osOK )
+    {
+        ct_fail( "signal received but not set" );
+    }
+
+    event = osSignalWait( CT_SIGNAL, 0 );
+
+    if( event.status != osOK )
+    {
+        ct_fail( "signal not cleared" );
+    }
+}
+
+static void ct_waiter_thread( void const *argument )
+{
+    uint32_t i;
+
+    ( void ) argument;
+
+    for( i = 0; i < ct_iterations; i++ )
+    {
+        ct_iteration();
+    }
+
+    vTaskEndScheduler();
+    vTaskDelete( NULL );
+}
+
+osThreadDef( Waiter, ct_waiter_thread, osPriorityHigh, 0, configMINIMAL_STACK_SIZE );
+osThreadDef( Setter, ct_setter_thread, osPriorityNormal, 0, configMINIMAL_STACK_SIZE );
+
+/*--------------------------------------------------------------------------------*/
+/* Main */
+/*--------------------------------------------------------------------------------*/
+
+int main( int argc, char **argv )
+{
+    int arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            ct_iterations = 200;
+        }
+        else if( ( strcmp( argv[arg], "--seed" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            ct_seed = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--seed N]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    if( ct_seed == 0U )
+    {
+        fprintf( stderr, "seed not 0\n" );
+        return 1;
+    }
+
+    ct_rand_state = ct_seed;
+    ct_semaphore = osSemaphoreCreate( osSemaphore( ct_semaphore ), 1 );
+    ct_queue = osMessageCreate( osMessageQ( ct_queue ), NULL );
+    ct_waiter = osThreadCreate( osThread( Waiter ), NULL );
+    ct_setter = osThreadCreate( osThread( Setter ), NULL );
+
+    /* The token of the semaphore is taken, the waits block */
+    if( ( ct_semaphore == NULL ) || ( ct_queue == NULL ) || ( ct_waiter == NULL ) || ( ct_setter == NULL ) ||
+            ( osSemaphoreWait( ct_semaphore, 0 ) != osOK ) )
+    {
+        fprintf( stderr, "cannot create the objects\n" );
+        return 1;
+    }
+
+    osKernelStart();
+
+    printf( "%s: %u failure(s), seed %u\n", ct_failures ? "FAILED" : "PASSED", ( unsigned ) ct_failures,
+            ( unsigned ) ct_seed );
+
+    return ct_failures ? 1 : 0;
+}
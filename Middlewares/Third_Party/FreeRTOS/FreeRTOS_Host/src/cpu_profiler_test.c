@@ -0,0 +1,436 @@
+/*
+ * Host test of the cpu_profiler module (Utilities/CPU).
+ *
+ * A control task gives two semaphores, on which tasks A (high priority) and
+ * B (low priority) wait, then runs for a random time, part of it in a
+ * simulated interrupt, and blocks. A then runs for a random time and blocks,
+ * then B. Time is the TIM counter of the profiler, advanced by the tasks as
+ * they "run", so the ready latency of A is the run time of the control task,
+ * and the one of B includes the run time of A. The records sent by
+ * CPU_PROF_ReportNames() and CPU_PROF_Report() are decoded and checked:
+ *   - the task numbers and names match the tasks,
+ *   - the maximum ready latencies of A and B are the expected ones, so they
+ *     are distinct and not zero,
+ *   - the run times, the interrupt time and the window are exact,
+ *   - with more tasks than CPU_PROF_MAX_TASKS the records are flagged as
+ *     truncated instead of being empty, and are complete again once the
+ *     extra tasks are deleted.
+ *
+ * Usage: CpuProfilerTest_Host [--quick] [--seed N]
+ *   --quick    20 iterations (used by ctest), 1000 by default
+ *   --seed N   seed of the run times
+ *
+ * The program returns 1 when a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "cpu_profiler.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define PT_PRIORITY_CTL     4U
+#define PT_PRIORITY_A       3U
+#define PT_PRIORITY_B       1U
+#define PT_EXTRA_TASKS      4U        /* Takes the number of tasks above CPU_PROF_MAX_TASKS */
+#define PT_MAX_RECORD       1024U
+
+static uint32_t pt_iterations = 1000;
+static uint32_t pt_seed = 1;
+static uint32_t pt_failures = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Counter, records and random numbers */
+/*--------------------------------------------------------------------------------*/
+
+TIM_TypeDef prof_host_timer;
+
+static uint8_t  pt_record[PT_MAX_RECORD];
+static uint16_t pt_record_length;
+
+void prof_host_transmit( const uint8_t *pBuf, uint16_t Len )
+{
+    memcpy( pt_record, pBuf, ( Len < PT_MAX_RECORD ) ? Len : PT_MAX_RECORD );
+    pt_record_length = Len;
+}
+
+/* The task running moves time on */
+static void pt_run( uint32_t ticks )
+{
+    prof_host_timer.CNT = ( prof_host_timer.CNT + ticks ) & 0xFFFFU;
+}
+
+static uint32_t pt_rand_state;
+
+static uint32_t pt_rand( void )
+{
+    /* xorshift32 */
+    pt_rand_state ^= pt_rand_state << 13;
+    pt_rand_state ^= pt_rand_state >> 17;
+    pt_rand_state ^= pt_rand_state << 5;
+    return pt_rand_state;
+}
+
+static void pt_fail( const char *check )
+{
+    fprintf( stderr, "%s\n", check );
+    pt_failures++;
+}
+
+static uint32_t pt_get16( const uint8_t *p )
+{
+    return ( uint32_t ) p[0] | ( ( uint32_t ) p[1] << 8 );
+}
+
+static uint32_t pt_get32( const uint8_t *p )
+{
+    return pt_get16( p ) | ( pt_get16( &p[2] ) << 16 );
+}
+
+/* Payload of the last record, NULL when it is not a valid record of the type */
+static const uint8_t *pt_payload( uint8_t type, uint32_t *pLength )
+{
+    uint32_t sum1 = 0, sum2 = 0, i, length;
+
+    length = pt_get16( &pt_record[3] );
+
+    if( ( pt_record_length != CPU_PROF_HEADER_SIZE + length + CPU_PROF_CHECKSUM_SIZE ) ||
+            ( pt_record[0] != CPU_PROF_SYNC0 ) || ( pt_record[1] != CPU_PROF_SYNC1 ) || ( pt_record[2] != type ) )
+    {
+        pt_fail( "malformed record" );
+        return NULL;
+    }
+
+    for( i = 2; i < CPU_PROF_HEADER_SIZE + length; i++ )
+    {
+        sum1 = ( sum1 + pt_record[i] ) % 255U;
+        sum2 = ( sum2 + sum1 ) % 255U;
+    }
+
+    if( pt_get16( &pt_record[i] ) != ( ( sum2 << 8 ) | sum1 ) )
+    {
+        pt_fail( "wrong record checksum" );
+        return NULL;
+    }
+
+    *pLength = length;
+    return &pt_record[CPU_PROF_HEADER_SIZE];
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Tasks */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint32_t run;           /* Run time per iteration */
+    uint32_t run_total;     /* Run time since the last report */
+    uint32_t latency_max;   /* Expected maximum ready latency since the last report */
+    uint32_t number;        /* Task number, from the names record */
+} pt_task_t;
+
+static pt_task_t pt_ctl, pt_a, pt_b;
+static uint32_t pt_isr_total;
+static SemaphoreHandle_t pt_sem_a, pt_sem_b;
+
+static void pt_task_a( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) xSemaphoreTake( pt_sem_a, portMAX_DELAY );
+        pt_run( pt_a.run );
+    }
+}
+
+static void pt_task_b( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) xSemaphoreTake( pt_sem_b, portMAX_DELAY );
+        pt_run( pt_b.run );
+    }
+}
+
+static void pt_task_extra( void *pvParameters )
+{
+    ( void ) pvParameters;
+    vTaskSuspend( NULL );
+}
+
+static void pt_iteration( void )
+{
+    uint32_t isr = 1U + pt_rand() % 20U;
+
+    pt_ctl.run = 1U + pt_rand() % 300U;
+    pt_a.run = 1U + pt_rand() % 300U;
+    pt_b.run = 1U + pt_rand() % 300U;
+
+    /* A and B are made ready, run after the control task, and B after A */
+    ( void ) xSemaphoreGive( pt_sem_a );
+    ( void ) xSemaphoreGive( pt_sem_b );
+
+    CPU_PROF_ISR_Enter();
+    pt_run( isr );
+    CPU_PROF_ISR_Exit();
+    pt_run( pt_ctl.run );
+
+    pt_isr_total += isr;
+    pt_ctl.run_total += isr + pt_ctl.run;
+    pt_a.run_total += pt_a.run;
+    pt_b.run_total += pt_b.run;
+
+    if( isr + pt_ctl.run > pt_a.latency_max )
+    {
+        pt_a.latency_max = isr + pt_ctl.run;
+    }
+
+    if( isr + pt_ctl.run + pt_a.run > pt_b.latency_max )
+    {
+        pt_b.latency_max = isr + pt_ctl.run + pt_a.run;
+    }
+
+    /* Blocks until the idle task generates the next tick */
+    vTaskDelay( 1 );
+}
+
+static void pt_clear( void )
+{
+    pt_ctl.run_total = pt_ctl.latency_max = 0U;
+    pt_a.run_total = pt_a.latency_max = 0U;
+    pt_b.run_total = pt_b.latency_max = 0U;
+    pt_isr_total = 0U;
+}
+
+static void pt_check_names( void )
+{
+    const uint8_t *p;
+    uint32_t length, i, name_length;
+    char name[configMAX_TASK_NAME_LEN + 1];
+
+    CPU_PROF_ReportNames();
+    p = pt_payload( CPU_PROF_RECORD_NAMES, &length );
+
+    if( p == NULL )
+    {
+        return;
+    }
+
+    for( i = 0; i + 2U <= length; i += 2U + name_length )
+    {
+        name_length = p[i + 1U];
+        memcpy( name, &p[i + 2U], name_length );
+        name[name_length] = '\0';
+
+        if( p[i] == 0U )
+        {
+            pt_fail( "names record flagged as truncated" );
+        }
+        else if( strcmp( name, "A" ) == 0 )
+        {
+            pt_a.number = p[i];
+        }
+        else if( strcmp( name, "B" ) == 0 )
+        {
+            pt_b.number = p[i];
+        }
+        else if( strcmp( name, "Ctl" ) == 0 )
+        {
+            pt_ctl.number = p[i];
+        }
+    }
+
+    if( ( pt_a.number == 0U ) || ( pt_b.number == 0U ) || ( pt_ctl.number == 0U ) ||
+            ( pt_a.number == pt_b.number ) || ( pt_a.number == pt_ctl.number ) || ( pt_b.number == pt_ctl.number ) )
+    {
+        pt_fail( "tasks missing from the names record" );
+    }
+}
+
+static void pt_check_stats( uint32_t expected_entries )
+{
+    const uint8_t *p, *entry;
+    const pt_task_t *task;
+    uint32_t length, i, window, entries;
+
+    CPU_PROF_Report();
+    p = pt_payload( CPU_PROF_RECORD_STATS, &length );
+
+    if( p == NULL )
+    {
+        return;
+    }
+
+    window = pt_get32( &p[0] );
+    entries = p[12];
+
+    if( ( entries != expected_entries ) || ( p[13] != 0U ) ||
+            ( length != CPU_PROF_STATS_HEADER_SIZE + entries * CPU_PROF_TASK_ENTRY_SIZE ) )
+    {
+        pt_fail( "wrong number of task entries" );
+        return;
+    }
+
+    if( ( window != pt_ctl.run_total + pt_a.run_total + pt_b.run_total ) || ( pt_get32( &p[4] ) != pt_isr_total ) ||
+            ( pt_get32( &p[8] ) != CPU_PROF_COUNTER_CLOCK_HZ ) )
+    {
+        pt_fail( "wrong window or interrupt time" );
+    }
+
+    for( i = 0; i < entries; i++ )
+    {
+        entry = &p[CPU_PROF_STATS_HEADER_SIZE + i * CPU_PROF_TASK_ENTRY_SIZE];
+        task = ( entry[0] == pt_a.number ) ? &pt_a : ( entry[0] == pt_b.number ) ? &pt_b :
+               ( entry[0] == pt_ctl.number ) ? &pt_ctl : NULL;
+
+        if( task == NULL )
+        {
+            /* Idle and timer tasks */
+            if( pt_get32( &entry[4] ) != 0U )
+            {
+                pt_fail( "run time of a task that did not run" );
+            }
+        }
+        else if( ( pt_get32( &entry[4] ) != task->run_total ) || ( pt_get32( &entry[8] ) != task->latency_max ) )
+        {
+            fprintf( stderr, "task %u: run time %u latency %u, expected %u %u\n", ( unsigned ) entry[0],
+                     ( unsigned ) pt_get32( &entry[4] ), ( unsigned ) pt_get32( &entry[8] ),
+                     ( unsigned ) task->run_total, ( unsigned ) task->latency_max );
+            pt_fail( "wrong run time or ready latency" );
+        }
+    }
+}
+
+static void pt_check_truncated( void )
+{
+    const uint8_t *p;
+    uint32_t length;
+
+    CPU_PROF_Report();
+    p = pt_payload( CPU_PROF_RECORD_STATS, &length );
+
+    if( ( p != NULL ) && ( ( p[12] != 0U ) || ( p[13] != CPU_PROF_FLAG_TRUNCATED ) ||
+                           ( length != CPU_PROF_STATS_HEADER_SIZE ) ) )
+    {
+        pt_fail( "stats record not flagged as truncated" );
+    }
+
+    CPU_PROF_ReportNames();
+    p = pt_payload( CPU_PROF_RECORD_NAMES, &length );
+
+    if( ( p != NULL ) && ( ( length != 2U ) || ( p[0] != 0U ) || ( p[1] != 0U ) ) )
+    {
+        pt_fail( "names record not flagged as truncated" );
+    }
+}
+
+static void pt_task_ctl( void *pvParameters )
+{
+    TaskHandle_t extra[PT_EXTRA_TASKS];
+    uint32_t i;
+
+    ( void ) pvParameters;
+
+    pt_check_names();
+
+    /* A and B run once, from their creation, before the first window */
+    pt_iteration();
+    CPU_PROF_Report();
+    pt_clear();
+
+    for( i = 0; i < pt_iterations; i++ )
+    {
+        pt_iteration();
+    }
+
+    /* A, B, the control, idle and timer tasks */
+    pt_check_stats( 5U );
+
+    for( i = 0; i < PT_EXTRA_TASKS; i++ )
+    {
+        if( xTaskCreate( pt_task_extra, "X", configMINIMAL_STACK_SIZE, NULL, 1, &extra[i] ) != pdPASS )
+        {
+            pt_fail( "cannot create a task" );
+        }
+    }
+
+    if( uxTaskGetNumberOfTasks() <= CPU_PROF_MAX_TASKS )
+    {
+        pt_fail( "not enough tasks to truncate" );
+    }
+
+    pt_check_truncated();
+
+    for( i = 0; i < PT_EXTRA_TASKS; i++ )
+    {
+        vTaskDelete( extra[i] );
+    }
+
+    pt_clear();
+    pt_iteration();
+    pt_check_stats( 5U );
+
+    vTaskEndScheduler();
+    vTaskDelete( NULL );
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Main */
+/*--------------------------------------------------------------------------------*/
+
+int main( int argc, char **argv )
+{
+    int arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            pt_iterations = 20;
+        }
+        else if( ( strcmp( argv[arg], "--seed" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            pt_seed = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--seed N]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    if( pt_seed == 0U )
+    {
+        fprintf( stderr, "seed not 0\n" );
+        return 1;
+    }
+
+    pt_rand_state = pt_seed;
+    pt_sem_a = xSemaphoreCreateBinary();
+    pt_sem_b = xSemaphoreCreateBinary();
+
+    if( ( pt_sem_a == NULL ) || ( pt_sem_b == NULL ) ||
+            ( xTaskCreate( pt_task_a, "A", configMINIMAL_STACK_SIZE, NULL, PT_PRIORITY_A, NULL ) != pdPASS ) ||
+            ( xTaskCreate( pt_task_b, "B", configMINIMAL_STACK_SIZE, NULL, PT_PRIORITY_B, NULL ) != pdPASS ) ||
+            ( xTaskCreate( pt_task_ctl, "Ctl", configMINIMAL_STACK_SIZE, NULL, PT_PRIORITY_CTL, NULL ) != pdPASS ) )
+    {
+        fprintf( stderr, "cannot create the tasks\n" );
+        return 1;
+    }
+
+    vTaskStartScheduler();
+
+    printf( "%s: %u failure(s), seed %u\n", pt_failures ? "FAILED" : "PASSED", ( unsigned ) pt_failures,
+            ( unsigned ) pt_seed );
+
+    return pt_failures ? 1 : 0;
+}
@@ -0,0 +1,692 @@
+/*
+ * Host test and benchmark of the timing wheel of the software timers
+ * (configUSE_TIMER_WHEEL set to 1).
+ *
+ * timers.c is included in this file so its static wheel functions can be
+ * driven directly. Random sequences of timer starts, stops, restarts and time
+ * advances are applied to the wheel with prvWheelInsert(), prvWheelRemove()
+ * and prvWheelAdvance(), with 10, 100 and 1000 active timers, and to a model
+ * of the timers. The periods go up to three times the span of the wheel so
+ * timers are held in the overflow list and cascaded from it, and the tick
+ * count starts three spans before it wraps. Each scenario checks that:
+ *   - every timer expires at its expiry tick, in time order, auto-reload
+ *     timers being reloaded relative to their expiry tick,
+ *   - after each advance no active timer has an expiry tick in the past,
+ *   - prvGetNextExpireTime() never returns a time after the first expiry,
+ *   - ulTimerWheelMap has one bit set for each non-empty slot.
+ * The timers are then started and stopped through the timer API with the
+ * scheduler running on the host port, the tick count starting just before it
+ * wraps, and the tick count is checked in each callback.
+ *
+ * Without --quick, the time per restart (remove and insert) and per expiry is
+ * printed with 10, 100 and 1000 active timers, for the wheel and for the
+ * sorted list used when configUSE_TIMER_WHEEL is 0.
+ *
+ * Usage: TimerWheelTest_Host [--quick] [--ops N] [--seed N]
+ *   --quick    5000 operations per scenario (used by ctest)
+ *   --ops N    operations per scenario, 100000 by default
+ *   --seed N   seed of the random sequences
+ *
+ * The program returns 1 when a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* The wheel functions and lists are static. */
+#include "timers.c"
+
+#if ( configUSE_TIMER_WHEEL != 1 )
+    #error The test is built with configUSE_TIMER_WHEEL set to 1.
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define WT_SPAN             ( ( uint64_t ) 1U << tmrWHEEL_SPAN_SHIFT )
+#define WT_MAX_TIMERS       2000U     /* Twice the largest number of active timers */
+#define WT_SERVICE_TIMERS   64U
+#define WT_SERVICE_PERIOD   300U      /* Largest period of the service scenario */
+#define WT_BENCH_OPS        200000U
+
+static const uint32_t wt_counts[] = { 10, 100, 1000 };
+
+static uint32_t wt_ops = 100000;
+static uint32_t wt_seed = 1;
+static int      wt_quick = 0;
+static uint32_t wt_failures = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Clock and random numbers */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t wt_ns( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( ( uint64_t ) ts.tv_sec * 1000000000U ) + ( uint64_t ) ts.tv_nsec;
+}
+
+static uint32_t wt_rand_state;
+
+static uint32_t wt_rand( void )
+{
+    /* xorshift32 */
+    wt_rand_state ^= wt_rand_state << 13;
+    wt_rand_state ^= wt_rand_state >> 17;
+    wt_rand_state ^= wt_rand_state << 5;
+    return wt_rand_state;
+}
+
+static void wt_fail( const char *scenario, const char *check )
+{
+    fprintf( stderr, "%s: %s\n", scenario, check );
+    wt_failures++;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Timers and their model */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint64_t   expiry;      /* Expiry tick, not wrapped */
+    TickType_t period;
+    uint8_t    active;
+    uint8_t    autoreload;
+    uint8_t    overflowed;  /* Inserted in the overflow list since started */
+} wt_model_t;
+
+static Timer_t    wt_timers[WT_MAX_TIMERS];
+static wt_model_t wt_model[WT_MAX_TIMERS];
+static uint32_t   wt_pool;          /* Timers used by the scenario */
+static uint32_t   wt_active;
+static uint64_t   wt_now;           /* Tick count, not wrapped */
+static uint64_t   wt_wheel_time;    /* xTimerWheelTime, not wrapped */
+static uint64_t   wt_last_expiry;
+static uint32_t   wt_expired;
+static uint32_t   wt_overflow_inserts;
+static uint32_t   wt_overflow_expiries;
+static const char *wt_scenario = "";
+
+static void wt_callback( TimerHandle_t xTimer )
+{
+    Timer_t *pxTimer = ( Timer_t * ) xTimer;
+    wt_model_t *pModel = &wt_model[( uintptr_t ) pxTimer->pvTimerID];
+
+    wt_expired++;
+
+    if( ( pModel->active == 0U ) || ( ( TickType_t ) pModel->expiry != xTimerWheelTime ) ||
+            ( pModel->expiry < wt_last_expiry ) || ( pModel->expiry > wt_now ) )
+    {
+        wt_fail( wt_scenario, "timer expired at the wrong tick" );
+    }
+
+    wt_last_expiry = pModel->expiry;
+    wt_overflow_expiries += pModel->overflowed;
+
+    if( pModel->autoreload != 0U )
+    {
+        pModel->expiry += pModel->period;
+        pModel->overflowed = ( listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) ) == &xTimerWheelOverflowList );
+        wt_overflow_inserts += pModel->overflowed;
+
+        if( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) == 0U )
+        {
+            wt_fail( wt_scenario, "auto-reload timer not active after its expiry" );
+        }
+    }
+    else
+    {
+        pModel->active = 0U;
+        wt_active--;
+
+        if( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) != 0U )
+        {
+            wt_fail( wt_scenario, "one-shot timer active after its expiry" );
+        }
+    }
+}
+
+static void wt_reset( uint32_t pool, uint64_t start )
+{
+    UBaseType_t uxLevel, uxSlot;
+    uint32_t i;
+
+    for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+    {
+        for( uxSlot = 0U; uxSlot < ( UBaseType_t ) tmrWHEEL_SLOTS; uxSlot++ )
+        {
+            vListInitialise( &( xTimerWheel[uxLevel][uxSlot] ) );
+        }
+
+        ulTimerWheelMap[uxLevel] = 0UL;
+    }
+
+    vListInitialise( &xTimerWheelOverflowList );
+    xTimerWheelTime = ( TickType_t ) start;
+
+    for( i = 0; i < pool; i++ )
+    {
+        memset( &wt_timers[i], 0, sizeof( Timer_t ) );
+        wt_timers[i].pcTimerName = "wt";
+        wt_timers[i].pvTimerID = ( void * ) ( uintptr_t ) i;
+        wt_timers[i].pxCallbackFunction = wt_callback;
+        vListInitialiseItem( &( wt_timers[i].xTimerListItem ) );
+        memset( &wt_model[i], 0, sizeof( wt_model_t ) );
+    }
+
+    wt_pool = pool;
+    wt_active = 0;
+    wt_now = start;
+    wt_wheel_time = start;
+    wt_expired = 0;
+    wt_overflow_inserts = 0;
+    wt_overflow_expiries = 0;
+}
+
+/* Random period: mostly within the first levels, some beyond the span */
+static TickType_t wt_period( void )
+{
+    uint32_t r = wt_rand() % 100U;
+
+    if( r < 50U )
+    {
+        return ( TickType_t ) ( 1U + wt_rand() % ( 4U * tmrWHEEL_SLOTS ) );
+    }
+    else if( r < 85U )
+    {
+        return ( TickType_t ) ( 1U + wt_rand() % WT_SPAN );
+    }
+
+    return ( TickType_t ) ( WT_SPAN + wt_rand() % ( 2U * WT_SPAN ) );
+}
+
+static void wt_start( uint32_t i )
+{
+    Timer_t *pxTimer = &wt_timers[i];
+    wt_model_t *pModel = &wt_model[i];
+
+    if( pModel->active == 0U )
+    {
+        pModel->active = 1U;
+        wt_active++;
+    }
+
+    pModel->expiry = wt_now + pModel->period;
+    prvWheelInsert( pxTimer, ( TickType_t ) pModel->expiry );
+    pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+
+    pModel->overflowed = ( listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) ) == &xTimerWheelOverflowList );
+    wt_overflow_inserts += pModel->overflowed;
+}
+
+static void wt_stop( uint32_t i )
+{
+    prvWheelRemove( &wt_timers[i] );
+    wt_timers[i].ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+
+    if( wt_model[i].active != 0U )
+    {
+        wt_model[i].active = 0U;
+        wt_active--;
+    }
+}
+
+/* Random timer, active or not */
+static uint32_t wt_pick( uint8_t active )
+{
+    uint32_t i = wt_rand() % wt_pool;
+
+    while( wt_model[i].active != active )
+    {
+        i = ( i + 1U ) % wt_pool;
+    }
+
+    return i;
+}
+
+static void wt_check_map( void )
+{
+    UBaseType_t uxLevel, uxSlot;
+    uint32_t bit;
+
+    for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+    {
+        for( uxSlot = 0U; uxSlot < ( UBaseType_t ) tmrWHEEL_SLOTS; uxSlot++ )
+        {
+            bit = ( ulTimerWheelMap[uxLevel] >> uxSlot ) & 1UL;
+
+            if( bit != ( listLIST_IS_EMPTY( &( xTimerWheel[uxLevel][uxSlot] ) ) == pdFALSE ) )
+            {
+                wt_fail( wt_scenario, "wheel map does not match the slots" );
+                return;
+            }
+        }
+    }
+}
+
+/* Moves time to wt_now + step and checks the expired timers */
+static void wt_advance( uint64_t step )
+{
+    uint64_t expected = 0, first = UINT64_MAX;
+    BaseType_t xWheelIsEmpty;
+    TickType_t xNext;
+    uint32_t i;
+
+    wt_last_expiry = wt_wheel_time;
+    wt_now += step;
+    wt_expired = 0;
+
+    for( i = 0; i < wt_pool; i++ )
+    {
+        if( ( wt_model[i].active != 0U ) && ( wt_model[i].expiry <= wt_now ) )
+        {
+            expected += ( wt_model[i].autoreload != 0U ) ?
+                        ( ( wt_now - wt_model[i].expiry ) / wt_model[i].period ) + 1U : 1U;
+        }
+    }
+
+    prvWheelAdvance( ( TickType_t ) wt_now );
+    wt_wheel_time = wt_now;
+
+    if( ( wt_expired != expected ) || ( xTimerWheelTime != ( TickType_t ) wt_now ) )
+    {
+        wt_fail( wt_scenario, "wrong number of timers expired" );
+    }
+
+    for( i = 0; i < wt_pool; i++ )
+    {
+        if( wt_model[i].active != 0U )
+        {
+            if( ( wt_model[i].expiry <= wt_now ) ||
+                    ( listLIST_ITEM_CONTAINER( &( wt_timers[i].xTimerListItem ) ) == NULL ) )
+            {
+                wt_fail( wt_scenario, "active timer left behind" );
+            }
+
+            first = ( wt_model[i].expiry < first ) ? wt_model[i].expiry : first;
+        }
+        else if( listLIST_ITEM_CONTAINER( &( wt_timers[i].xTimerListItem ) ) != NULL )
+        {
+            wt_fail( wt_scenario, "inactive timer still in the wheel" );
+        }
+    }
+
+    xNext = prvGetNextExpireTime( &xWheelIsEmpty );
+
+    if( ( xWheelIsEmpty != pdFALSE ) != ( wt_active == 0U ) )
+    {
+        wt_fail( wt_scenario, "wheel emptiness does not match the active timers" );
+    }
+    else if( ( xWheelIsEmpty == pdFALSE ) &&
+             ( ( ( TickType_t ) ( xNext - xTimerWheelTime ) == 0U ) ||
+               ( ( TickType_t ) ( xNext - xTimerWheelTime ) > ( TickType_t ) ( first - wt_now ) ) ) )
+    {
+        wt_fail( wt_scenario, "next expire time after the first expiry" );
+    }
+
+    wt_check_map();
+}
+
+static void wt_test( uint32_t count )
+{
+    static char name[64];
+    uint64_t start = ( ( uint64_t ) 1U << 32 ) - 3U * WT_SPAN;
+    uint32_t op, i, r;
+
+    snprintf( name, sizeof( name ), "wheel %ux%u, %u timers", ( unsigned ) tmrWHEEL_SLOTS,
+              ( unsigned ) configTIMER_WHEEL_LEVELS, ( unsigned ) count );
+    wt_scenario = name;
+    wt_reset( 2U * count, start );
+
+    for( op = 0; op < wt_ops; op++ )
+    {
+        r = wt_rand() % 1000U;
+
+        if( ( r < 400U ) && ( wt_active < count ) )
+        {
+            /* Start, an auto-reload timer 1 time in 10 */
+            i = wt_pick( 0U );
+            wt_model[i].period = wt_period();
+            wt_model[i].autoreload = ( wt_rand() % 10U ) == 0U;
+
+            if( ( wt_model[i].autoreload != 0U ) && ( wt_model[i].period < ( WT_SPAN >> 6 ) + 8U ) )
+            {
+                wt_model[i].period += ( TickType_t ) ( WT_SPAN >> 6 ) + 8U;
+            }
+
+            wt_timers[i].xTimerPeriodInTicks = wt_model[i].period;
+            wt_timers[i].ucStatus = ( wt_model[i].autoreload != 0U ) ? tmrSTATUS_IS_AUTORELOAD : 0U;
+            wt_start( i );
+        }
+        else if( ( r < 600U ) && ( wt_active > 0U ) )
+        {
+            /* Reset, to the same period */
+            i = wt_pick( 1U );
+            prvWheelRemove( &wt_timers[i] );
+            wt_start( i );
+        }
+        else if( ( r < 700U ) && ( wt_active > 0U ) )
+        {
+            wt_stop( wt_pick( 1U ) );
+        }
+        else if( r < 705U )
+        {
+            /* Long idle period, timers come down from the overflow list */
+            wt_advance( WT_SPAN + wt_rand() % ( 2U * WT_SPAN ) );
+        }
+        else if( r < 750U )
+        {
+            /* The timer task is late: time moves on before the wheel does,
+            timers are started in between */
+            wt_now += 1U + wt_rand() % ( 2U * tmrWHEEL_SLOTS );
+        }
+        else
+        {
+            /* Log-uniform steps, from 1 tick to the span */
+            wt_advance( 1U + wt_rand() % ( ( uint64_t ) 1U << ( wt_rand() % ( tmrWHEEL_SPAN_SHIFT + 1U ) ) ) );
+        }
+    }
+
+    /* Stop the auto-reload timers and let the others expire */
+    for( i = 0; i < wt_pool; i++ )
+    {
+        if( ( wt_model[i].active != 0U ) && ( wt_model[i].autoreload != 0U ) )
+        {
+            wt_stop( i );
+        }
+    }
+
+    wt_advance( 3U * WT_SPAN + 1U );
+
+    if( ( wt_active != 0U ) || ( listLIST_IS_EMPTY( &xTimerWheelOverflowList ) == pdFALSE ) )
+    {
+        wt_fail( wt_scenario, "timers left in the wheel" );
+    }
+
+    if( wt_now < ( ( uint64_t ) 1U << 32 ) )
+    {
+        wt_fail( wt_scenario, "the tick count did not wrap" );
+    }
+
+    if( ( wt_overflow_inserts == 0U ) || ( wt_overflow_expiries == 0U ) )
+    {
+        wt_fail( wt_scenario, "overflow list not exercised" );
+    }
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Timer service */
+/*--------------------------------------------------------------------------------*/
+
+static TimerHandle_t wt_service_timers[WT_SERVICE_TIMERS];
+static TickType_t    wt_service_expiry[WT_SERVICE_TIMERS];
+static TickType_t    wt_service_period[WT_SERVICE_TIMERS];
+static uint32_t      wt_service_count[WT_SERVICE_TIMERS];
+
+static void wt_service_callback( TimerHandle_t xTimer )
+{
+    uint32_t i = ( uint32_t ) ( uintptr_t ) pvTimerGetTimerID( xTimer );
+
+    if( xTaskGetTickCount() != wt_service_expiry[i] )
+    {
+        wt_fail( "timer service", "callback at the wrong tick" );
+    }
+
+    wt_service_expiry[i] += wt_service_period[i];
+    wt_service_count[i]++;
+}
+
+static void wt_service_task( void *pvParameters )
+{
+    const TickType_t xStart = xTaskGetTickCount();
+    const TickType_t xDelay = 2U * WT_SERVICE_PERIOD;
+    uint32_t i, expected;
+
+    ( void ) pvParameters;
+
+    for( i = 0; i < WT_SERVICE_TIMERS; i++ )
+    {
+        wt_service_period[i] = ( TickType_t ) ( 1U + wt_rand() % WT_SERVICE_PERIOD );
+        wt_service_timers[i] = xTimerCreate( "wt", wt_service_period[i], ( i & 1U ) ? pdTRUE : pdFALSE,
+                                             ( void * ) ( uintptr_t ) i, wt_service_callback );
+        wt_service_expiry[i] = xStart + wt_service_period[i];
+
+        if( ( wt_service_timers[i] == NULL ) || ( xTimerStart( wt_service_timers[i], 0 ) != pdPASS ) )
+        {
+            wt_fail( "timer service", "cannot start a timer" );
+        }
+    }
+
+    /* Timers 4k and 4k + 1 are stopped before they expire */
+    for( i = 0; i < WT_SERVICE_TIMERS; i += 4U )
+    {
+        ( void ) xTimerStop( wt_service_timers[i], 0 );
+        ( void ) xTimerStop( wt_service_timers[i + 1U], 0 );
+    }
+
+    vTaskDelay( xDelay );
+
+    for( i = 0; i < WT_SERVICE_TIMERS; i++ )
+    {
+        ( void ) xTimerStop( wt_service_timers[i], 0 );
+
+        if( ( i & 2U ) == 0U )
+        {
+            expected = 0U;
+        }
+        else
+        {
+            expected = ( i & 1U ) ? ( xDelay / wt_service_period[i] ) : 1U;
+        }
+
+        if( wt_service_count[i] != expected )
+        {
+            wt_fail( "timer service", "wrong number of callbacks" );
+        }
+    }
+
+    if( xTaskGetTickCount() > xStart )
+    {
+        wt_fail( "timer service", "the tick count did not wrap" );
+    }
+
+    vTaskEndScheduler();
+    vTaskDelete( NULL );
+}
+
+static void wt_service_test( void )
+{
+    if( xTaskCreate( wt_service_task, "wt", configMINIMAL_STACK_SIZE, NULL, 1, NULL ) != pdPASS )
+    {
+        wt_fail( "timer service", "cannot create the test task" );
+        return;
+    }
+
+    vTaskStartScheduler();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Benchmark */
+/*--------------------------------------------------------------------------------*/
+
+static uint32_t   wt_bench_expired;
+static ListItem_t wt_bench_items[WT_MAX_TIMERS];
+static TickType_t wt_bench_periods[WT_MAX_TIMERS];
+
+static void wt_bench_callback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+    wt_bench_expired++;
+}
+
+static void wt_bench( uint32_t count )
+{
+    List_t xList;
+    ListItem_t *pxItem;
+    uint64_t t0, wheel_restart, list_restart, wheel_expiry, list_expiry;
+    TickType_t xNow, xNext;
+    BaseType_t xWheelIsEmpty;
+    uint32_t i, op;
+
+    /* Restart of a random timer, with a random period */
+    wt_reset( count, 0U );
+    vListInitialise( &xList );
+
+    for( i = 0; i < count; i++ )
+    {
+        wt_bench_periods[i] = ( TickType_t ) ( 1U + wt_rand() % ( WT_SPAN - 1U ) );
+        wt_timers[i].pxCallbackFunction = wt_bench_callback;
+        wt_timers[i].xTimerPeriodInTicks = wt_bench_periods[i];
+        wt_timers[i].ucStatus = tmrSTATUS_IS_ACTIVE | tmrSTATUS_IS_AUTORELOAD;
+        prvWheelInsert( &wt_timers[i], wt_bench_periods[i] );
+
+        vListInitialiseItem( &wt_bench_items[i] );
+        listSET_LIST_ITEM_VALUE( &wt_bench_items[i], wt_bench_periods[i] );
+        vListInsert( &xList, &wt_bench_items[i] );
+    }
+
+    wt_rand_state = wt_seed;
+    t0 = wt_ns();
+
+    for( op = 0; op < WT_BENCH_OPS; op++ )
+    {
+        i = wt_rand() % count;
+        prvWheelRemove( &wt_timers[i] );
+        prvWheelInsert( &wt_timers[i], ( TickType_t ) ( wt_rand() % WT_SPAN ) + 1U );
+    }
+
+    wheel_restart = wt_ns() - t0;
+    wt_rand_state = wt_seed;
+    t0 = wt_ns();
+
+    for( op = 0; op < WT_BENCH_OPS; op++ )
+    {
+        i = wt_rand() % count;
+        ( void ) uxListRemove( &wt_bench_items[i] );
+        listSET_LIST_ITEM_VALUE( &wt_bench_items[i], ( TickType_t ) ( wt_rand() % WT_SPAN ) + 1U );
+        vListInsert( &xList, &wt_bench_items[i] );
+    }
+
+    list_restart = wt_ns() - t0;
+
+    /* Expiry of auto-reload timers: the wheel is advanced to each event as
+    the timer task does, the list timers are taken from the head and
+    inserted back one period later as prvProcessExpiredTimer() does */
+    wt_reset( count, 0U );
+    vListInitialise( &xList );
+
+    for( i = 0; i < count; i++ )
+    {
+        wt_timers[i].pxCallbackFunction = wt_bench_callback;
+        wt_timers[i].xTimerPeriodInTicks = wt_bench_periods[i];
+        wt_timers[i].ucStatus = tmrSTATUS_IS_ACTIVE | tmrSTATUS_IS_AUTORELOAD;
+        prvWheelInsert( &wt_timers[i], wt_bench_periods[i] );
+
+        listSET_LIST_ITEM_VALUE( &wt_bench_items[i], wt_bench_periods[i] );
+        listSET_LIST_ITEM_OWNER( &wt_bench_items[i], &wt_bench_periods[i] );
+        vListInsert( &xList, &wt_bench_items[i] );
+    }
+
+    wt_bench_expired = 0;
+    t0 = wt_ns();
+
+    while( wt_bench_expired < WT_BENCH_OPS )
+    {
+        xNext = prvGetNextExpireTime( &xWheelIsEmpty );
+        prvWheelAdvance( xNext );
+    }
+
+    wheel_expiry = wt_ns() - t0;
+    wheel_expiry = wheel_expiry * WT_BENCH_OPS / wt_bench_expired;
+    t0 = wt_ns();
+
+    for( op = 0; op < WT_BENCH_OPS; op++ )
+    {
+        pxItem = listGET_HEAD_ENTRY( &xList );
+        xNow = listGET_LIST_ITEM_VALUE( pxItem );
+        ( void ) uxListRemove( pxItem );
+        wt_bench_callback( NULL );
+        listSET_LIST_ITEM_VALUE( pxItem, xNow + *( ( TickType_t * ) listGET_LIST_ITEM_OWNER( pxItem ) ) );
+        vListInsert( &xList, pxItem );
+    }
+
+    list_expiry = wt_ns() - t0;
+
+    printf( "%-8s %6u %14.1f %14.1f %7.2fx\n", "restart", ( unsigned ) count,
+            ( double ) wheel_restart / WT_BENCH_OPS, ( double ) list_restart / WT_BENCH_OPS,
+            ( double ) list_restart / ( double ) wheel_restart );
+    printf( "%-8s %6u %14.1f %14.1f %7.2fx\n", "expiry", ( unsigned ) count,
+            ( double ) wheel_expiry / WT_BENCH_OPS, ( double ) list_expiry / WT_BENCH_OPS,
+            ( double ) list_expiry / ( double ) wheel_expiry );
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Main */
+/*--------------------------------------------------------------------------------*/
+
+int main( int argc, char **argv )
+{
+    uint32_t n;
+    int arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            wt_quick = 1;
+            wt_ops = 5000;
+        }
+        else if( ( strcmp( argv[arg], "--ops" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            wt_ops = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else if( ( strcmp( argv[arg], "--seed" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            wt_seed = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--ops N] [--seed N]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    if( wt_seed == 0U )
+    {
+        fprintf( stderr, "seed not 0\n" );
+        return 1;
+    }
+
+    wt_rand_state = wt_seed;
+
+    for( n = 0; n < sizeof( wt_counts ) / sizeof( wt_counts[0] ); n++ )
+    {
+        wt_test( wt_counts[n] );
+    }
+
+    if( !wt_quick )
+    {
+        printf( "%-8s %6s %14s %14s %8s\n", "ns/op", "timers", "wheel", "sorted list", "speedup" );
+
+        for( n = 0; n < sizeof( wt_counts ) / sizeof( wt_counts[0] ); n++ )
+        {
+            wt_bench( wt_counts[n] );
+        }
+    }
+
+    /* Last, as it leaves the timer queue and tasks created */
+    wt_rand_state = wt_seed;
+    wt_service_test();
+
+    printf( "%s: %u failure(s), wheel %ux%u, seed %u\n", wt_failures ? "FAILED" : "PASSED",
+            ( unsigned ) wt_failures, ( unsigned ) tmrWHEEL_SLOTS, ( unsigned ) configTIMER_WHEEL_LEVELS,
+            ( unsigned ) wt_seed );
+
+    return wt_failures ? 1 : 0;
+}
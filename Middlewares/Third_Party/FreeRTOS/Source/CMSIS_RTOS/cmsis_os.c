@@ -99,6 +99,45 @@
 
 extern void xPortSysTickHandler( void );
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+/* Task notification bit used to wake up the thread waiting on a semaphore or
+   a single slot message queue, outside of the osFeature_Signals signal flags. */
+#define OS_NOTIFY_OBJECT_BIT    0x80000000UL
+
+/**
+* @brief  Wait for the release of an object owned by the calling thread
+* @param  ticks     maximum time to wait.
+* @param  signaled  set to pdTRUE when the wait consumed a notification of signal flags.
+* @note   A wait woken by signal flags leaves their bits set but clears the
+*         notification state osSignalWait() blocks on: osNotifyObjectEnd()
+*         posts it again once the object wait is over.
+*/
+static void osNotifyObjectWait( TickType_t ticks, BaseType_t *signaled )
+{
+    uint32_t value;
+
+    if( ( xTaskNotifyWait( 0, OS_NOTIFY_OBJECT_BIT, &value, ticks ) == pdTRUE ) &&
+        ( ( value & ~OS_NOTIFY_OBJECT_BIT ) != 0 ) )
+    {
+        *signaled = pdTRUE;
+    }
+}
+
+/**
+* @brief  End the wait for an object, see osNotifyObjectWait()
+* @param  self      handle of the calling thread.
+* @param  signaled  pdTRUE when signal flags were set during the wait.
+*/
+static void osNotifyObjectEnd( TaskHandle_t self, BaseType_t signaled )
+{
+    if( signaled != pdFALSE )
+    {
+        /* The bits are already set, only the notification state is posted */
+        ( void ) xTaskNotify( self, 0, eSetBits );
+    }
+}
+#endif
+
 /* Convert from CMSIS type osPriority to FreeRTOS priority number */
 static unsigned portBASE_TYPE makeFreeRtosPriority( osPriority priority )
 {
@@ -612,7 +651,31 @@ osEvent osSignalWait( int32_t signals, uint32_t millisec )
     }
     else
     {
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+        BaseType_t notified;
+        TimeOut_t timeout;
+        TickType_t remaining = ticks;
+
+        /* Skip the wake ups of the semaphores and message queues, which are
+           not signals */
+        vTaskSetTimeOutState( &timeout );
+
+        for( ;; )
+        {
+            notified = xTaskNotifyWait( OS_NOTIFY_OBJECT_BIT, ( uint32_t ) signals | OS_NOTIFY_OBJECT_BIT, ( uint32_t * )&ret.value.signals, remaining );
+            ret.value.signals &= ( int32_t ) ~OS_NOTIFY_OBJECT_BIT;
+
+            if( ( notified != pdTRUE ) || ( ret.value.signals != 0 ) ||
+                ( xTaskCheckForTimeOut( &timeout, &remaining ) != pdFALSE ) )
+            {
+                break;
+            }
+        }
+
+        if( ( notified != pdTRUE ) || ( ret.value.signals == 0 ) )
+#else
         if( xTaskNotifyWait( 0, ( uint32_t ) signals, ( uint32_t * )&ret.value.signals, ticks ) != pdTRUE )
+#endif
         {
             if( ticks == 0 )
             {
@@ -776,6 +839,8 @@ osStatus osMutexDelete( osMutexId mutex_id )
 
 #if (defined (osFeature_Semaphore)  &&  (osFeature_Semaphore != 0))
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 0 )
+
 /**
 * @brief Create and Initialize a Semaphore object used for managing resources
 * @param semaphore_def semaphore definition referenced with \ref osSemaphore.
@@ -957,219 +1022,740 @@ osStatus osSemaphoreDelete( osSemaphoreId semaphore_id )
     return osOK;
 }
 
-#endif    /* Use Semaphores */
-
-/*******************   Memory Pool Management Functions  ***********************/
-
-#if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0))
-
-//TODO
-//This is a primitive and inefficient wrapper around the existing FreeRTOS memory management.
-//A better implementation will have to modify heap_x.c!
-
-
-typedef struct os_pool_cb
-{
-    void *pool;
-    uint8_t *markers;
-    uint32_t pool_sz;
-    uint32_t item_sz;
-    uint32_t currentIndex;
-} os_pool_cb_t;
+#else /* configUSE_OS_NOTIFY_OBJECTS == 1 */
 
+/* The semaphore tokens are counted in the control block. A single waiting
+   thread registers itself as owner and blocks on its task notification, which
+   releases wake up with OS_NOTIFY_OBJECT_BIT. When a second thread has to wait
+   the tokens are moved to a FreeRTOS counting semaphore used from then on. */
 
 /**
-* @brief Create and Initialize a memory pool
-* @param  pool_def      memory pool definition referenced with \ref osPool.
-* @retval  memory pool ID for reference by other functions or NULL in case of error.
-* @note   MUST REMAIN UNCHANGED: \b osPoolCreate shall be consistent in every CMSIS-RTOS.
+* @brief Create the counting semaphore used once several threads wait
+* @param  semaphore_def  semaphore definition referenced with \ref osSemaphore.
+* @param  max            maximum number of tokens.
+* @retval semaphore handle, empty, or NULL in case of error.
 */
-osPoolId osPoolCreate( const osPoolDef_t *pool_def )
+static QueueHandle_t osSemaphoreCreateQueue( const osSemaphoreDef_t *semaphore_def, UBaseType_t max )
 {
-#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-    osPoolId thePool;
-    int itemSize = 4 * ( ( pool_def->item_sz + 3 ) / 4 );
-    uint32_t i;
-
-    /* First have to allocate memory for the pool control block. */
-    thePool = pvPortMalloc( sizeof( os_pool_cb_t ) );
-
+#if (configUSE_COUNTING_SEMAPHORES == 1 )
+#if( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-    if( thePool )
+    if( semaphore_def->controlblock != NULL )
     {
-        thePool->pool_sz = pool_def->pool_sz;
-        thePool->item_sz = itemSize;
-        thePool->currentIndex = 0;
-
-        /* Memory for markers */
-        thePool->markers = pvPortMalloc( pool_def->pool_sz );
+        return xSemaphoreCreateCountingStatic( max, 0, semaphore_def->controlblock );
+    }
+    else
+    {
+        return xSemaphoreCreateCounting( max, 0 );
+    }
 
-        if( thePool->markers )
-        {
-            /* Now allocate the pool itself. */
-            thePool->pool = pvPortMalloc( pool_def->pool_sz * itemSize );
+#elif ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-            if( thePool->pool )
-            {
-                for( i = 0; i < pool_def->pool_sz; i++ )
-                {
-                    thePool->markers[i] = 0;
-                }
-            }
-            else
-            {
-                vPortFree( thePool->markers );
-                vPortFree( thePool );
-                thePool = NULL;
-            }
-        }
-        else
-        {
-            vPortFree( thePool );
-            thePool = NULL;
-        }
+    if( semaphore_def->controlblock != NULL )
+    {
+        return xSemaphoreCreateCountingStatic( max, 0, semaphore_def->controlblock );
     }
 
-    return thePool;
+    return NULL;
+#else
+    ( void ) semaphore_def;
 
+    return xSemaphoreCreateCounting( max, 0 );
+#endif
 #else
+    ( void ) semaphore_def;
+    ( void ) max;
+
     return NULL;
 #endif
 }
 
 /**
-* @brief Allocate a memory block from a memory pool
-* @param pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
-* @retval  address of the allocated memory block or NULL in case of no memory available.
-* @note   MUST REMAIN UNCHANGED: \b osPoolAlloc shall be consistent in every CMSIS-RTOS.
+* @brief Move the tokens of a semaphore to a counting semaphore
+* @param  semaphore_id  semaphore object referenced with \ref osSemaphore.
+* @retval counting semaphore handle or NULL in case of error.
 */
-void *osPoolAlloc( osPoolId pool_id )
+static QueueHandle_t osSemaphoreFallback( osSemaphoreId semaphore_id )
 {
-    int dummy = 0;
-    void *p = NULL;
-    uint32_t i;
-    uint32_t index;
+    QueueHandle_t queue;
+    TaskHandle_t owner = NULL;
+    UBaseType_t count = 0;
 
-    if( inHandlerMode() )
-    {
-        dummy = portSET_INTERRUPT_MASK_FROM_ISR();
-    }
-    else
-    {
-        vPortEnterCritical();
-    }
+    vTaskSuspendAll();
 
-    for( i = 0; i < pool_id->pool_sz; i++ )
+    queue = semaphore_id->queue;
+
+    if( queue == NULL )
     {
-        index = ( pool_id->currentIndex + i ) % pool_id->pool_sz;
+        queue = osSemaphoreCreateQueue( semaphore_id->def, semaphore_id->max );
 
-        if( pool_id->markers[index] == 0 )
+        if( queue != NULL )
         {
-            pool_id->markers[index] = 1;
-            p = ( void * )( ( uint32_t )( pool_id->pool ) + ( index * pool_id->item_sz ) );
-            pool_id->currentIndex = index;
-            break;
+            taskENTER_CRITICAL();
+            semaphore_id->queue = queue;
+            count = semaphore_id->count;
+            owner = semaphore_id->owner;
+            semaphore_id->count = 0;
+            semaphore_id->owner = NULL;
+            taskEXIT_CRITICAL();
+
+            while( count-- != 0 )
+            {
+                xSemaphoreGive( queue );
+            }
+
+            /* The previous waiter goes on waiting on the counting semaphore */
+            if( owner != NULL )
+            {
+                xTaskNotify( owner, OS_NOTIFY_OBJECT_BIT, eSetBits );
+            }
         }
     }
 
-    if( inHandlerMode() )
-    {
-        portCLEAR_INTERRUPT_MASK_FROM_ISR( dummy );
-    }
-    else
-    {
-        vPortExitCritical();
-    }
+    ( void ) xTaskResumeAll();
 
-    return p;
+    return queue;
 }
 
 /**
-* @brief Allocate a memory block from a memory pool and set memory block to zero
-* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
-* @retval  address of the allocated memory block or NULL in case of no memory available.
-* @note   MUST REMAIN UNCHANGED: \b osPoolCAlloc shall be consistent in every CMSIS-RTOS.
+* @brief Create and Initialize a Semaphore object used for managing resources
+* @param semaphore_def semaphore definition referenced with \ref osSemaphore.
+* @param count         number of available resources.
+* @retval  semaphore ID for reference by other functions or NULL in case of error.
+* @note   MUST REMAIN UNCHANGED: \b osSemaphoreCreate shall be consistent in every CMSIS-RTOS.
 */
-void *osPoolCAlloc( osPoolId pool_id )
+osSemaphoreId osSemaphoreCreate( const osSemaphoreDef_t *semaphore_def, int32_t count )
 {
-    void *p = osPoolAlloc( pool_id );
+    osSemaphoreId semaphore_id = semaphore_def->cb;
 
-    if( p != NULL )
+    if( count <= 0 )
     {
-        memset( p, 0, sizeof( pool_id->pool_sz ) );
+        return NULL;
     }
 
-    return p;
+    semaphore_id->def = semaphore_def;
+    semaphore_id->owner = NULL;
+    semaphore_id->queue = NULL;
+    semaphore_id->count = ( UBaseType_t ) count;
+    semaphore_id->max = ( UBaseType_t ) count;
+
+    return semaphore_id;
 }
 
 /**
-* @brief Return an allocated memory block back to a specific memory pool
-* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
-* @param  block         address of the allocated memory block that is returned to the memory pool.
-* @retval  status code that indicates the execution status of the function.
-* @note   MUST REMAIN UNCHANGED: \b osPoolFree shall be consistent in every CMSIS-RTOS.
+* @brief Wait until a Semaphore token becomes available
+* @param  semaphore_id  semaphore object referenced with \ref osSemaphore.
+* @param  millisec      timeout value or 0 in case of no time-out.
+* @retval  number of available tokens, or -1 in case of incorrect parameters.
+* @note   MUST REMAIN UNCHANGED: \b osSemaphoreWait shall be consistent in every CMSIS-RTOS.
 */
-osStatus osPoolFree( osPoolId pool_id, void *block )
+int32_t osSemaphoreWait( osSemaphoreId semaphore_id, uint32_t millisec )
 {
-    uint32_t index;
+    TickType_t ticks;
+    TimeOut_t timeout;
+    TaskHandle_t self;
+    QueueHandle_t queue;
+    UBaseType_t mask;
+    BaseType_t fallback;
+    BaseType_t signaled = pdFALSE;
+    int32_t result;
+    portBASE_TYPE taskWoken = pdFALSE;
 
-    if( pool_id == NULL )
-    {
-        return osErrorParameter;
-    }
 
-    if( block == NULL )
+    if( semaphore_id == NULL )
     {
         return osErrorParameter;
     }
 
-    if( block < pool_id->pool )
+    ticks = 0;
+
+    if( millisec == osWaitForever )
     {
-        return osErrorParameter;
+        ticks = portMAX_DELAY;
     }
+    else if( millisec != 0 )
+    {
+        ticks = millisec / portTICK_PERIOD_MS;
 
-    index = ( uint32_t )block - ( uint32_t )( pool_id->pool );
+        if( ticks == 0 )
+        {
+            ticks = 1;
+        }
+    }
 
-    if( index % pool_id->item_sz )
+    if( inHandlerMode() )
     {
-        return osErrorParameter;
+        mask = taskENTER_CRITICAL_FROM_ISR();
+        queue = semaphore_id->queue;
+
+        if( ( queue == NULL ) && ( semaphore_id->count != 0 ) )
+        {
+            semaphore_id->count--;
+            taskEXIT_CRITICAL_FROM_ISR( mask );
+            return osOK;
+        }
+
+        taskEXIT_CRITICAL_FROM_ISR( mask );
+
+        if( ( queue == NULL ) || ( xSemaphoreTakeFromISR( queue, &taskWoken ) != pdTRUE ) )
+        {
+            return osErrorOS;
+        }
+
+        portEND_SWITCHING_ISR( taskWoken );
+        return osOK;
     }
 
-    index = index / pool_id->item_sz;
+    self = xTaskGetCurrentTaskHandle();
+    vTaskSetTimeOutState( &timeout );
 
-    if( index >= pool_id->pool_sz )
+    for( ;; )
     {
-        return osErrorParameter;
-    }
+        fallback = pdFALSE;
 
-    pool_id->markers[index] = 0;
+        taskENTER_CRITICAL();
+        queue = semaphore_id->queue;
 
-    return osOK;
-}
+        if( queue == NULL )
+        {
+            if( semaphore_id->count != 0 )
+            {
+                semaphore_id->count--;
+                taskEXIT_CRITICAL();
+                result = osOK;
+                break;
+            }
 
+            if( ticks == 0 )
+            {
+                taskEXIT_CRITICAL();
+                result = osErrorOS;
+                break;
+            }
 
-#endif   /* Use Memory Pool Management */
+            if( semaphore_id->owner == NULL )
+            {
+                semaphore_id->owner = self;
+            }
+            else
+            {
+                fallback = pdTRUE;
+            }
+        }
 
-/*******************   Message Queue Management Functions  *********************/
+        taskEXIT_CRITICAL();
 
-#if (defined (osFeature_MessageQ)  &&  (osFeature_MessageQ != 0)) /* Use Message Queues */
+        if( fallback != pdFALSE )
+        {
+            queue = osSemaphoreFallback( semaphore_id );
 
-/**
-* @brief Create and Initialize a Message Queue
-* @param queue_def     queue definition referenced with \ref osMessageQ.
-* @param  thread_id     thread ID (obtained by \ref osThreadCreate or \ref osThreadGetId) or NULL.
-* @retval  message queue ID for reference by other functions or NULL in case of error.
-* @note   MUST REMAIN UNCHANGED: \b osMessageCreate shall be consistent in every CMSIS-RTOS.
-*/
-osMessageQId osMessageCreate( const osMessageQDef_t *queue_def, osThreadId thread_id )
-{
-    ( void ) thread_id;
+            if( queue == NULL )
+            {
+                result = osErrorOS;
+                break;
+            }
+        }
 
-#if( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        if( queue != NULL )
+        {
+            result = ( xSemaphoreTake( queue, ticks ) == pdTRUE ) ? osOK : osErrorOS;
+            break;
+        }
 
-    if( ( queue_def->buffer != NULL ) && ( queue_def->controlblock != NULL ) )
-    {
-        return xQueueCreateStatic( queue_def->queue_sz, queue_def->item_sz, queue_def->buffer, queue_def->controlblock );
+        /* Woken by a release, a fallback, signal flags or the timeout: check again */
+        osNotifyObjectWait( ticks, &signaled );
+
+        taskENTER_CRITICAL();
+
+        if( semaphore_id->owner == self )
+        {
+            semaphore_id->owner = NULL;
+        }
+
+        taskEXIT_CRITICAL();
+
+        ( void ) xTaskCheckForTimeOut( &timeout, &ticks );
+    }
+
+    osNotifyObjectEnd( self, signaled );
+
+    return result;
+}
+
+/**
+* @brief Release a Semaphore token
+* @param  semaphore_id  semaphore object referenced with \ref osSemaphore.
+* @retval  status code that indicates the execution status of the function.
+* @note   MUST REMAIN UNCHANGED: \b osSemaphoreRelease shall be consistent in every CMSIS-RTOS.
+*/
+osStatus osSemaphoreRelease( osSemaphoreId semaphore_id )
+{
+    osStatus result = osOK;
+    TaskHandle_t owner = NULL;
+    QueueHandle_t queue;
+    UBaseType_t mask;
+    portBASE_TYPE taskWoken = pdFALSE;
+
+
+    if( semaphore_id == NULL )
+    {
+        return osErrorParameter;
+    }
+
+    if( inHandlerMode() )
+    {
+        mask = taskENTER_CRITICAL_FROM_ISR();
+        queue = semaphore_id->queue;
+
+        if( queue == NULL )
+        {
+            if( semaphore_id->count < semaphore_id->max )
+            {
+                semaphore_id->count++;
+                owner = semaphore_id->owner;
+            }
+            else
+            {
+                result = osErrorOS;
+            }
+        }
+
+        taskEXIT_CRITICAL_FROM_ISR( mask );
+
+        if( queue != NULL )
+        {
+            if( xSemaphoreGiveFromISR( queue, &taskWoken ) != pdTRUE )
+            {
+                return osErrorOS;
+            }
+        }
+        else if( owner != NULL )
+        {
+            xTaskNotifyFromISR( owner, OS_NOTIFY_OBJECT_BIT, eSetBits, &taskWoken );
+        }
+
+        portEND_SWITCHING_ISR( taskWoken );
+    }
+    else
+    {
+        taskENTER_CRITICAL();
+        queue = semaphore_id->queue;
+
+        if( queue == NULL )
+        {
+            if( semaphore_id->count < semaphore_id->max )
+            {
+                semaphore_id->count++;
+                owner = semaphore_id->owner;
+            }
+            else
+            {
+                result = osErrorOS;
+            }
+        }
+
+        taskEXIT_CRITICAL();
+
+        if( queue != NULL )
+        {
+            if( xSemaphoreGive( queue ) != pdTRUE )
+            {
+                result = osErrorOS;
+            }
+        }
+        else if( owner != NULL )
+        {
+            xTaskNotify( owner, OS_NOTIFY_OBJECT_BIT, eSetBits );
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief Delete a Semaphore
+* @param  semaphore_id  semaphore object referenced with \ref osSemaphore.
+* @retval  status code that indicates the execution status of the function.
+* @note   MUST REMAIN UNCHANGED: \b osSemaphoreDelete shall be consistent in every CMSIS-RTOS.
+*/
+osStatus osSemaphoreDelete( osSemaphoreId semaphore_id )
+{
+    if( inHandlerMode() )
+    {
+        return osErrorISR;
+    }
+
+    if( semaphore_id->queue != NULL )
+    {
+        vSemaphoreDelete( semaphore_id->queue );
+        semaphore_id->queue = NULL;
+    }
+
+    semaphore_id->count = 0;
+
+    return osOK;
+}
+
+#endif /* configUSE_OS_NOTIFY_OBJECTS */
+
+#endif    /* Use Semaphores */
+
+/*******************   Memory Pool Management Functions  ***********************/
+
+#if (defined (osFeature_Pool)  &&  (osFeature_Pool != 0))
+
+//TODO
+//This is a primitive and inefficient wrapper around the existing FreeRTOS memory management.
+//A better implementation will have to modify heap_x.c!
+
+
+typedef struct os_pool_cb
+{
+    void *pool;
+    uint8_t *markers;
+    uint32_t pool_sz;
+    uint32_t item_sz;
+    uint32_t currentIndex;
+} os_pool_cb_t;
+
+
+/**
+* @brief Create and Initialize a memory pool
+* @param  pool_def      memory pool definition referenced with \ref osPool.
+* @retval  memory pool ID for reference by other functions or NULL in case of error.
+* @note   MUST REMAIN UNCHANGED: \b osPoolCreate shall be consistent in every CMSIS-RTOS.
+*/
+osPoolId osPoolCreate( const osPoolDef_t *pool_def )
+{
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    osPoolId thePool;
+    int itemSize = 4 * ( ( pool_def->item_sz + 3 ) / 4 );
+    uint32_t i;
+
+    /* First have to allocate memory for the pool control block. */
+    thePool = pvPortMalloc( sizeof( os_pool_cb_t ) );
+
+
+    if( thePool )
+    {
+        thePool->pool_sz = pool_def->pool_sz;
+        thePool->item_sz = itemSize;
+        thePool->currentIndex = 0;
+
+        /* Memory for markers */
+        thePool->markers = pvPortMalloc( pool_def->pool_sz );
+
+        if( thePool->markers )
+        {
+            /* Now allocate the pool itself. */
+            thePool->pool = pvPortMalloc( pool_def->pool_sz * itemSize );
+
+            if( thePool->pool )
+            {
+                for( i = 0; i < pool_def->pool_sz; i++ )
+                {
+                    thePool->markers[i] = 0;
+                }
+            }
+            else
+            {
+                vPortFree( thePool->markers );
+                vPortFree( thePool );
+                thePool = NULL;
+            }
+        }
+        else
+        {
+            vPortFree( thePool );
+            thePool = NULL;
+        }
+    }
+
+    return thePool;
+
+#else
+    return NULL;
+#endif
+}
+
+/**
+* @brief Allocate a memory block from a memory pool
+* @param pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @retval  address of the allocated memory block or NULL in case of no memory available.
+* @note   MUST REMAIN UNCHANGED: \b osPoolAlloc shall be consistent in every CMSIS-RTOS.
+*/
+void *osPoolAlloc( osPoolId pool_id )
+{
+    int dummy = 0;
+    void *p = NULL;
+    uint32_t i;
+    uint32_t index;
+
+    if( inHandlerMode() )
+    {
+        dummy = portSET_INTERRUPT_MASK_FROM_ISR();
+    }
+    else
+    {
+        vPortEnterCritical();
+    }
+
+    for( i = 0; i < pool_id->pool_sz; i++ )
+    {
+        index = ( pool_id->currentIndex + i ) % pool_id->pool_sz;
+
+        if( pool_id->markers[index] == 0 )
+        {
+            pool_id->markers[index] = 1;
+            p = ( void * )( ( uint32_t )( pool_id->pool ) + ( index * pool_id->item_sz ) );
+            pool_id->currentIndex = index;
+            break;
+        }
+    }
+
+    if( inHandlerMode() )
+    {
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( dummy );
+    }
+    else
+    {
+        vPortExitCritical();
+    }
+
+    return p;
+}
+
+/**
+* @brief Allocate a memory block from a memory pool and set memory block to zero
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @retval  address of the allocated memory block or NULL in case of no memory available.
+* @note   MUST REMAIN UNCHANGED: \b osPoolCAlloc shall be consistent in every CMSIS-RTOS.
+*/
+void *osPoolCAlloc( osPoolId pool_id )
+{
+    void *p = osPoolAlloc( pool_id );
+
+    if( p != NULL )
+    {
+        memset( p, 0, sizeof( pool_id->pool_sz ) );
+    }
+
+    return p;
+}
+
+/**
+* @brief Return an allocated memory block back to a specific memory pool
+* @param  pool_id       memory pool ID obtain referenced with \ref osPoolCreate.
+* @param  block         address of the allocated memory block that is returned to the memory pool.
+* @retval  status code that indicates the execution status of the function.
+* @note   MUST REMAIN UNCHANGED: \b osPoolFree shall be consistent in every CMSIS-RTOS.
+*/
+osStatus osPoolFree( osPoolId pool_id, void *block )
+{
+    uint32_t index;
+
+    if( pool_id == NULL )
+    {
+        return osErrorParameter;
+    }
+
+    if( block == NULL )
+    {
+        return osErrorParameter;
+    }
+
+    if( block < pool_id->pool )
+    {
+        return osErrorParameter;
+    }
+
+    index = ( uint32_t )block - ( uint32_t )( pool_id->pool );
+
+    if( index % pool_id->item_sz )
+    {
+        return osErrorParameter;
+    }
+
+    index = index / pool_id->item_sz;
+
+    if( index >= pool_id->pool_sz )
+    {
+        return osErrorParameter;
+    }
+
+    pool_id->markers[index] = 0;
+
+    return osOK;
+}
+
+
+#endif   /* Use Memory Pool Management */
+
+/*******************   Message Queue Management Functions  *********************/
+
+#if (defined (osFeature_MessageQ)  &&  (osFeature_MessageQ != 0)) /* Use Message Queues */
+
+#if ( configUSE_OS_NOTIFY_OBJECTS == 0 )
+
+/**
+* @brief Create and Initialize a Message Queue
+* @param queue_def     queue definition referenced with \ref osMessageQ.
+* @param  thread_id     thread ID (obtained by \ref osThreadCreate or \ref osThreadGetId) or NULL.
+* @retval  message queue ID for reference by other functions or NULL in case of error.
+* @note   MUST REMAIN UNCHANGED: \b osMessageCreate shall be consistent in every CMSIS-RTOS.
+*/
+osMessageQId osMessageCreate( const osMessageQDef_t *queue_def, osThreadId thread_id )
+{
+    ( void ) thread_id;
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    if( ( queue_def->buffer != NULL ) && ( queue_def->controlblock != NULL ) )
+    {
+        return xQueueCreateStatic( queue_def->queue_sz, queue_def->item_sz, queue_def->buffer, queue_def->controlblock );
+    }
+    else
+    {
+        return xQueueCreate( queue_def->queue_sz, queue_def->item_sz );
+    }
+
+#elif ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    return xQueueCreateStatic( queue_def->queue_sz, queue_def->item_sz, queue_def->buffer, queue_def->controlblock );
+#else
+    return xQueueCreate( queue_def->queue_sz, queue_def->item_sz );
+#endif
+}
+
+/**
+* @brief Put a Message to a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  info      message information.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval status code that indicates the execution status of the function.
+* @note   MUST REMAIN UNCHANGED: \b osMessagePut shall be consistent in every CMSIS-RTOS.
+*/
+osStatus osMessagePut( osMessageQId queue_id, uint32_t info, uint32_t millisec )
+{
+    portBASE_TYPE taskWoken = pdFALSE;
+    TickType_t ticks;
+
+    ticks = millisec / portTICK_PERIOD_MS;
+
+    if( ticks == 0 )
+    {
+        ticks = 1;
+    }
+
+    if( inHandlerMode() )
+    {
+        if( xQueueSendFromISR( queue_id, &info, &taskWoken ) != pdTRUE )
+        {
+            return osErrorOS;
+        }
+
+        portEND_SWITCHING_ISR( taskWoken );
+    }
+    else
+    {
+        if( xQueueSend( queue_id, &info, ticks ) != pdTRUE )
+        {
+            return osErrorOS;
+        }
+    }
+
+    return osOK;
+}
+
+/**
+* @brief Get a Message or Wait for a Message from a Queue.
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @param  millisec  timeout value or 0 in case of no time-out.
+* @retval event information that includes status code.
+* @note   MUST REMAIN UNCHANGED: \b osMessageGet shall be consistent in every CMSIS-RTOS.
+*/
+osEvent osMessageGet( osMessageQId queue_id, uint32_t millisec )
+{
+    portBASE_TYPE taskWoken;
+    TickType_t ticks;
+    osEvent event;
+
+    event.def.message_id = queue_id;
+    event.value.v = 0;
+
+    if( queue_id == NULL )
+    {
+        event.status = osErrorParameter;
+        return event;
+    }
+
+    taskWoken = pdFALSE;
+
+    ticks = 0;
+
+    if( millisec == osWaitForever )
+    {
+        ticks = portMAX_DELAY;
+    }
+    else if( millisec != 0 )
+    {
+        ticks = millisec / portTICK_PERIOD_MS;
+
+        if( ticks == 0 )
+        {
+            ticks = 1;
+        }
+    }
+
+    if( inHandlerMode() )
+    {
+        if( xQueueReceiveFromISR( queue_id, &event.value.v, &taskWoken ) == pdTRUE )
+        {
+            /* We have mail */
+            event.status = osEventMessage;
+        }
+        else
+        {
+            event.status = osOK;
+        }
+
+        portEND_SWITCHING_ISR( taskWoken );
+    }
+    else
+    {
+        if( xQueueReceive( queue_id, &event.value.v, ticks ) == pdTRUE )
+        {
+            /* We have mail */
+            event.status = osEventMessage;
+        }
+        else
+        {
+            event.status = ( ticks == 0 ) ? osOK : osEventTimeout;
+        }
+    }
+
+    return event;
+}
+
+#else /* configUSE_OS_NOTIFY_OBJECTS == 1 */
+
+/* A queue of one message of at most 32 bits is held in the control block and
+   its single waiting thread blocks on its task notification, as for the
+   semaphores. The message is moved to a FreeRTOS queue, used from then on,
+   when a second thread has to wait or a thread has to wait for free space.
+   Other message queues use a FreeRTOS queue from the start. */
+
+/**
+* @brief Create the FreeRTOS queue of a message queue
+* @param  queue_def  queue definition referenced with \ref osMessageQ.
+* @retval queue handle or NULL in case of error.
+*/
+static QueueHandle_t osMessageCreateQueue( const osMessageQDef_t *queue_def )
+{
+#if( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    if( ( queue_def->buffer != NULL ) && ( queue_def->controlblock != NULL ) )
+    {
+        return xQueueCreateStatic( queue_def->queue_sz, queue_def->item_sz, queue_def->buffer, queue_def->controlblock );
     }
     else
     {
@@ -1183,6 +1769,87 @@ osMessageQId osMessageCreate( const osMessageQDef_t *queue_def, osThreadId threa
 #endif
 }
 
+/**
+* @brief Move the message of a single slot message queue to a FreeRTOS queue
+* @param  queue_id  message queue ID obtained with \ref osMessageCreate.
+* @retval queue handle or NULL in case of error.
+*/
+static QueueHandle_t osMessageFallback( osMessageQId queue_id )
+{
+    QueueHandle_t queue;
+    TaskHandle_t owner = NULL;
+    uint32_t value = 0;
+    uint32_t full = 0;
+
+    vTaskSuspendAll();
+
+    queue = queue_id->queue;
+
+    if( queue == NULL )
+    {
+        queue = osMessageCreateQueue( queue_id->def );
+
+        if( queue != NULL )
+        {
+            taskENTER_CRITICAL();
+            queue_id->queue = queue;
+            value = queue_id->value;
+            full = queue_id->full;
+            owner = queue_id->owner;
+            queue_id->full = 0;
+            queue_id->owner = NULL;
+            taskEXIT_CRITICAL();
+
+            if( full != 0 )
+            {
+                xQueueSend( queue, &value, 0 );
+            }
+
+            /* The previous waiter goes on waiting on the queue */
+            if( owner != NULL )
+            {
+                xTaskNotify( owner, OS_NOTIFY_OBJECT_BIT, eSetBits );
+            }
+        }
+    }
+
+    ( void ) xTaskResumeAll();
+
+    return queue;
+}
+
+/**
+* @brief Create and Initialize a Message Queue
+* @param queue_def     queue definition referenced with \ref osMessageQ.
+* @param  thread_id     thread ID (obtained by \ref osThreadCreate or \ref osThreadGetId) or NULL.
+* @retval  message queue ID for reference by other functions or NULL in case of error.
+* @note   MUST REMAIN UNCHANGED: \b osMessageCreate shall be consistent in every CMSIS-RTOS.
+*/
+osMessageQId osMessageCreate( const osMessageQDef_t *queue_def, osThreadId thread_id )
+{
+    osMessageQId queue_id = queue_def->cb;
+
+    ( void ) thread_id;
+
+    queue_id->def = queue_def;
+    queue_id->owner = NULL;
+    queue_id->queue = NULL;
+    queue_id->value = 0;
+    queue_id->full = 0;
+
+    if( ( queue_def->queue_sz != 1 ) || ( queue_def->item_sz > sizeof( uint32_t ) ) )
+    {
+        queue_id->queue = osMessageCreateQueue( queue_def );
+
+        if( queue_id->queue == NULL )
+        {
+            return NULL;
+        }
+    }
+
+    return queue_id;
+}
+
 /**
 * @brief Put a Message to a Queue.
 * @param  queue_id  message queue ID obtained with \ref osMessageCreate.
@@ -1195,6 +1862,15 @@ osStatus osMessagePut( osMessageQId queue_id, uint32_t info, uint32_t millisec )
 {
     portBASE_TYPE taskWoken = pdFALSE;
     TickType_t ticks;
+    TaskHandle_t owner = NULL;
+    QueueHandle_t queue;
+    UBaseType_t mask;
+    BaseType_t fallback = pdFALSE;
+
+    if( queue_id == NULL )
+    {
+        return osErrorParameter;
+    }
 
     ticks = millisec / portTICK_PERIOD_MS;
 
@@ -1203,20 +1879,87 @@ osStatus osMessagePut( osMessageQId queue_id, uint32_t info, uint32_t millisec )
         ticks = 1;
     }
 
+    /* Keep the bytes a queue of item_sz bytes would have copied */
+    if( queue_id->def->item_sz < sizeof( uint32_t ) )
+    {
+        info &= ( 1UL << ( 8U * queue_id->def->item_sz ) ) - 1UL;
+    }
+
     if( inHandlerMode() )
     {
-        if( xQueueSendFromISR( queue_id, &info, &taskWoken ) != pdTRUE )
+        mask = taskENTER_CRITICAL_FROM_ISR();
+        queue = queue_id->queue;
+
+        if( queue == NULL )
         {
-            return osErrorOS;
+            if( queue_id->full != 0 )
+            {
+                taskEXIT_CRITICAL_FROM_ISR( mask );
+                return osErrorOS;
+            }
+
+            queue_id->value = info;
+            queue_id->full = 1;
+            owner = queue_id->owner;
+        }
+
+        taskEXIT_CRITICAL_FROM_ISR( mask );
+
+        if( queue != NULL )
+        {
+            if( xQueueSendFromISR( queue, &info, &taskWoken ) != pdTRUE )
+            {
+                return osErrorOS;
+            }
+        }
+        else if( owner != NULL )
+        {
+            xTaskNotifyFromISR( owner, OS_NOTIFY_OBJECT_BIT, eSetBits, &taskWoken );
         }
 
         portEND_SWITCHING_ISR( taskWoken );
     }
     else
     {
-        if( xQueueSend( queue_id, &info, ticks ) != pdTRUE )
+        taskENTER_CRITICAL();
+        queue = queue_id->queue;
+
+        if( queue == NULL )
         {
-            return osErrorOS;
+            if( queue_id->full != 0 )
+            {
+                fallback = pdTRUE;
+            }
+            else
+            {
+                queue_id->value = info;
+                queue_id->full = 1;
+                owner = queue_id->owner;
+            }
+        }
+
+        taskEXIT_CRITICAL();
+
+        if( fallback != pdFALSE )
+        {
+            queue = osMessageFallback( queue_id );
+
+            if( queue == NULL )
+            {
+                return osErrorOS;
+            }
+        }
+
+        if( queue != NULL )
+        {
+            if( xQueueSend( queue, &info, ticks ) != pdTRUE )
+            {
+                return osErrorOS;
+            }
+        }
+        else if( owner != NULL )
+        {
+            xTaskNotify( owner, OS_NOTIFY_OBJECT_BIT, eSetBits );
         }
     }
 
@@ -1234,6 +1977,12 @@ osEvent osMessageGet( osMessageQId queue_id, uint32_t millisec )
 {
     portBASE_TYPE taskWoken;
     TickType_t ticks;
+    TimeOut_t timeout;
+    TaskHandle_t self;
+    QueueHandle_t queue;
+    UBaseType_t mask;
+    BaseType_t fallback;
+    BaseType_t signaled = pdFALSE;
     osEvent event;
 
     event.def.message_id = queue_id;
@@ -1265,34 +2014,122 @@ osEvent osMessageGet( osMessageQId queue_id, uint32_t millisec )
 
     if( inHandlerMode() )
     {
-        if( xQueueReceiveFromISR( queue_id, &event.value.v, &taskWoken ) == pdTRUE )
+        mask = taskENTER_CRITICAL_FROM_ISR();
+        queue = queue_id->queue;
+        event.status = osOK;
+
+        if( ( queue == NULL ) && ( queue_id->full != 0 ) )
         {
-            /* We have mail */
+            event.value.v = queue_id->value;
             event.status = osEventMessage;
+            queue_id->full = 0;
         }
-        else
+
+        taskEXIT_CRITICAL_FROM_ISR( mask );
+
+        if( queue != NULL )
         {
-            event.status = osOK;
+            if( xQueueReceiveFromISR( queue, &event.value.v, &taskWoken ) == pdTRUE )
+            {
+                /* We have mail */
+                event.status = osEventMessage;
+            }
+
+            portEND_SWITCHING_ISR( taskWoken );
         }
 
-        portEND_SWITCHING_ISR( taskWoken );
+        return event;
     }
-    else
+
+    self = xTaskGetCurrentTaskHandle();
+    vTaskSetTimeOutState( &timeout );
+
+    for( ;; )
     {
-        if( xQueueReceive( queue_id, &event.value.v, ticks ) == pdTRUE )
+        fallback = pdFALSE;
+
+        taskENTER_CRITICAL();
+        queue = queue_id->queue;
+
+        if( queue == NULL )
         {
-            /* We have mail */
-            event.status = osEventMessage;
+            if( queue_id->full != 0 )
+            {
+                /* We have mail */
+                event.value.v = queue_id->value;
+                event.status = osEventMessage;
+                queue_id->full = 0;
+                taskEXIT_CRITICAL();
+                break;
+            }
+
+            if( ticks == 0 )
+            {
+                taskEXIT_CRITICAL();
+                event.status = ( millisec == 0 ) ? osOK : osEventTimeout;
+                break;
+            }
+
+            if( queue_id->owner == NULL )
+            {
+                queue_id->owner = self;
+            }
+            else
+            {
+                fallback = pdTRUE;
+            }
         }
-        else
+
+        taskEXIT_CRITICAL();
+
+        if( fallback != pdFALSE )
         {
-            event.status = ( ticks == 0 ) ? osOK : osEventTimeout;
+            queue = osMessageFallback( queue_id );
+
+            if( queue == NULL )
+            {
+                event.status = osErrorOS;
+                break;
+            }
+        }
+
+        if( queue != NULL )
+        {
+            if( xQueueReceive( queue, &event.value.v, ticks ) == pdTRUE )
+            {
+                /* We have mail */
+                event.status = osEventMessage;
+            }
+            else
+            {
+                event.status = ( millisec == 0 ) ? osOK : osEventTimeout;
+            }
+
+            break;
+        }
+
+        /* Woken by a message, a fallback, signal flags or the timeout: check again */
+        osNotifyObjectWait( ticks, &signaled );
+
+        taskENTER_CRITICAL();
+
+        if( queue_id->owner == self )
+        {
+            queue_id->owner = NULL;
         }
+
+        taskEXIT_CRITICAL();
+
+        ( void ) xTaskCheckForTimeOut( &timeout, &ticks );
     }
 
+    osNotifyObjectEnd( self, signaled );
+
     return event;
 }
 
+#endif /* configUSE_OS_NOTIFY_OBJECTS */
+
 #endif     /* Use Message Queues */
 
 /********************   Mail Queue Management Functions  ***********************/
@@ -1749,6 +2586,11 @@ osEvent osMessagePeek( osMessageQId queue_id, uint32_t millisec )
 {
     TickType_t ticks;
     osEvent event;
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+    QueueHandle_t queue;
+    UBaseType_t mask;
+    uint32_t full;
+#endif
 
     event.def.message_id = queue_id;
 
@@ -1774,7 +2616,42 @@ osEvent osMessagePeek( osMessageQId queue_id, uint32_t millisec )
         }
     }
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+    mask = taskENTER_CRITICAL_FROM_ISR();
+    queue = queue_id->queue;
+    full = queue_id->full;
+    event.value.v = queue_id->value;
+    taskEXIT_CRITICAL_FROM_ISR( mask );
+
+    if( queue == NULL )
+    {
+        if( full != 0 )
+        {
+            /* We have mail */
+            event.status = osEventMessage;
+            return event;
+        }
+
+        if( ( ticks == 0 ) || inHandlerMode() )
+        {
+            event.status = osOK;
+            return event;
+        }
+
+        /* Waiting without taking the message is left to a FreeRTOS queue */
+        queue = osMessageFallback( queue_id );
+
+        if( queue == NULL )
+        {
+            event.status = osErrorOS;
+            return event;
+        }
+    }
+
+    if( xQueuePeek( queue, &event.value.v, ticks ) == pdTRUE )
+#else
     if( xQueuePeek( queue_id, &event.value.v, ticks ) == pdTRUE )
+#endif
     {
         /* We have mail */
         event.status = osEventMessage;
@@ -1794,6 +2671,24 @@ osEvent osMessagePeek( osMessageQId queue_id, uint32_t millisec )
 */
 uint32_t osMessageWaiting( osMessageQId queue_id )
 {
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+
+    if( queue_id->queue == NULL )
+    {
+        return queue_id->full;
+    }
+
+    if( inHandlerMode() )
+    {
+        return uxQueueMessagesWaitingFromISR( queue_id->queue );
+    }
+    else
+    {
+        return uxQueueMessagesWaiting( queue_id->queue );
+    }
+
+#else
+
     if( inHandlerMode() )
     {
         return uxQueueMessagesWaitingFromISR( queue_id );
@@ -1802,6 +2697,8 @@ uint32_t osMessageWaiting( osMessageQId queue_id )
     {
         return uxQueueMessagesWaiting( queue_id );
     }
+
+#endif
 }
 
 /**
@@ -1811,7 +2708,17 @@ uint32_t osMessageWaiting( osMessageQId queue_id )
 */
 uint32_t osMessageAvailableSpace( osMessageQId queue_id )
 {
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+
+    if( queue_id->queue == NULL )
+    {
+        return 1U - queue_id->full;
+    }
+
+    return uxQueueSpacesAvailable( queue_id->queue );
+#else
     return uxQueueSpacesAvailable( queue_id );
+#endif
 }
 
 /**
@@ -1826,7 +2733,18 @@ osStatus osMessageDelete( osMessageQId queue_id )
         return osErrorISR;
     }
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+
+    if( queue_id->queue != NULL )
+    {
+        vQueueDelete( queue_id->queue );
+        queue_id->queue = NULL;
+    }
+
+    queue_id->full = 0;
+#else
     vQueueDelete( queue_id );
+#endif
 
     return osOK;
 }
@@ -1931,5 +2849,15 @@ osStatus osRecursiveMutexWait( osMutexId mutex_id, uint32_t millisec )
 */
 uint32_t osSemaphoreGetCount( osSemaphoreId semaphore_id )
 {
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+
+    if( semaphore_id->queue == NULL )
+    {
+        return semaphore_id->count;
+    }
+
+    return uxSemaphoreGetCount( semaphore_id->queue );
+#else
     return uxSemaphoreGetCount( semaphore_id );
+#endif
 }
@@ -159,6 +159,21 @@ used throughout the whole project.
 #define osFeature_Wait         0       ///< osWait function: 1=available, 0=not available
 #define osFeature_SysTick      1       ///< osKernelSysTick functions: 1=available, 0=not available
 
+/// Semaphores and single slot message queues implemented on the task notification of
+/// their waiting thread, falling back to a FreeRTOS queue when a second thread waits.
+/// The control block is declared by \ref osSemaphoreDef and \ref osMessageQDef, so each
+/// definition creates one object, and the IDs can no longer be passed to the FreeRTOS API.
+/// The fallback queue uses the static control block of the definition or the heap.
+/// Notification bit 31 is reserved, the signal flags are not affected.
+/// \note CAN BE CHANGED: define \b configUSE_OS_NOTIFY_OBJECTS to 1 in FreeRTOSConfig.h to enable it.
+#ifndef configUSE_OS_NOTIFY_OBJECTS
+#define configUSE_OS_NOTIFY_OBJECTS    0
+#endif
+
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 ) && ( configUSE_TASK_NOTIFICATIONS == 0 )
+#error configUSE_OS_NOTIFY_OBJECTS requires configUSE_TASK_NOTIFICATIONS
+#endif
+
 #ifdef  __cplusplus
 extern "C"
 {
@@ -251,7 +266,11 @@ typedef SemaphoreHandle_t osMutexId;
 
 /// Semaphore ID identifies the semaphore (pointer to a semaphore control block).
 /// \note CAN BE CHANGED: \b os_semaphore_cb is implementation specific in every CMSIS-RTOS.
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+typedef struct os_semaphore_cb *osSemaphoreId;
+#else
 typedef SemaphoreHandle_t osSemaphoreId;
+#endif
 
 /// Pool ID identifies the memory pool (pointer to a memory pool control block).
 /// \note CAN BE CHANGED: \b os_pool_cb is implementation specific in every CMSIS-RTOS.
@@ -259,7 +278,11 @@ typedef struct os_pool_cb *osPoolId;
 
 /// Message ID identifies the message queue (pointer to a message queue control block).
 /// \note CAN BE CHANGED: \b os_messageQ_cb is implementation specific in every CMSIS-RTOS.
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+typedef struct os_messageQ_cb *osMessageQId;
+#else
 typedef QueueHandle_t osMessageQId;
+#endif
 
 /// Mail ID identifies the mail queue (pointer to a mail queue control block).
 /// \note CAN BE CHANGED: \b os_mailQ_cb is implementation specific in every CMSIS-RTOS.
@@ -322,6 +345,9 @@ typedef struct os_semaphore_def
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
     osStaticSemaphoreDef_t     *controlblock;      ///< control block for static allocation; NULL for dynamic allocation
 #endif
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+    struct os_semaphore_cb     *cb;      ///< semaphore control block
+#endif
 } osSemaphoreDef_t;
 
 /// Definition structure for memory block allocation.
@@ -342,6 +368,9 @@ typedef struct os_messageQ_def
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
     uint8_t                 *buffer;      ///< buffer for static allocation; NULL for dynamic allocation
     osStaticMessageQDef_t   *controlblock;     ///< control block to hold queue's data for static allocation; NULL for dynamic allocation
+#endif
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+    struct os_messageQ_cb   *cb;      ///< message queue control block
 #endif
     //void                       *pool;    ///< memory array for messages
 } osMessageQDef_t;
@@ -355,6 +384,35 @@ typedef struct os_mailQ_def
     struct os_mailQ_cb **cb;
 } osMailQDef_t;
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+
+/// Semaphore control block. The tokens are counted here, the task notification of the
+/// waiting thread is only used to wake it up. \b queue is created when a second thread
+/// has to wait and then holds the tokens.
+/// \note CAN BE CHANGED: \b os_semaphore_cb is implementation specific in every CMSIS-RTOS.
+typedef struct os_semaphore_cb
+{
+    const osSemaphoreDef_t   *def;       ///< definition, used to create the fallback queue
+    TaskHandle_t             owner;      ///< thread blocked on the semaphore; NULL when none
+    QueueHandle_t            queue;      ///< fallback counting semaphore; NULL while unused
+    UBaseType_t              count;      ///< available tokens
+    UBaseType_t              max;        ///< maximum number of tokens
+} os_semaphore_cb_t;
+
+/// Message queue control block. A queue of one 32-bit message is held in \b value, any
+/// other queue, or a single slot queue with a second waiting thread, uses \b queue.
+/// \note CAN BE CHANGED: \b os_messageQ_cb is implementation specific in every CMSIS-RTOS.
+typedef struct os_messageQ_cb
+{
+    const osMessageQDef_t    *def;       ///< definition, used to create the fallback queue
+    TaskHandle_t             owner;      ///< thread blocked on the message queue; NULL when none
+    QueueHandle_t            queue;      ///< FreeRTOS queue; NULL while the single slot is used
+    uint32_t                 value;      ///< message held in the single slot
+    uint32_t                 full;       ///< 1 when \b value holds a message
+} os_messageQ_cb_t;
+
+#endif
+
 /// Event structure contains detailed information about an event.
 /// \note MUST REMAIN UNCHANGED: \b os_event shall be consistent in every CMSIS-RTOS.
 ///       However the struct may be extended at the end.
@@ -658,6 +716,22 @@ osStatus osMutexDelete( osMutexId mutex_id );
 extern const osSemaphoreDef_t os_semaphore_def_##name
 #else                            // define the object
 
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+#define osSemaphoreDef(name)  \
+os_semaphore_cb_t os_semaphore_cb_##name; \
+const osSemaphoreDef_t os_semaphore_def_##name = { 0, NULL, &os_semaphore_cb_##name }
+
+#define osSemaphoreStaticDef(name, control)  \
+os_semaphore_cb_t os_semaphore_cb_##name; \
+const osSemaphoreDef_t os_semaphore_def_##name = { 0, (control), &os_semaphore_cb_##name }
+
+#else //configSUPPORT_STATIC_ALLOCATION == 0
+#define osSemaphoreDef(name)  \
+os_semaphore_cb_t os_semaphore_cb_##name; \
+const osSemaphoreDef_t os_semaphore_def_##name = { 0, &os_semaphore_cb_##name }
+#endif
+#else //configUSE_OS_NOTIFY_OBJECTS == 0
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
 #define osSemaphoreDef(name)  \
 const osSemaphoreDef_t os_semaphore_def_##name = { 0, NULL }
@@ -670,6 +744,7 @@ const osSemaphoreDef_t os_semaphore_def_##name = { 0, (control) }
 const osSemaphoreDef_t os_semaphore_def_##name = { 0 }
 #endif
 #endif
+#endif
 
 /// Access a Semaphore definition.
 /// \param         name          name of the semaphore object.
@@ -775,6 +850,25 @@ osStatus osPoolFree( osPoolId pool_id, void *block );
 #define osMessageQDef(name, queue_sz, type)   \
 extern const osMessageQDef_t os_messageQ_def_##name
 #else                            // define the object
+#if ( configUSE_OS_NOTIFY_OBJECTS == 1 )
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+#define osMessageQDef(name, queue_sz, type)   \
+os_messageQ_cb_t os_messageQ_cb_##name; \
+const osMessageQDef_t os_messageQ_def_##name = \
+{ (queue_sz), sizeof (type), NULL, NULL, &os_messageQ_cb_##name }
+
+#define osMessageQStaticDef(name, queue_sz, type, buffer, control)   \
+os_messageQ_cb_t os_messageQ_cb_##name; \
+const osMessageQDef_t os_messageQ_def_##name = \
+{ (queue_sz), sizeof (type) , (buffer), (control), &os_messageQ_cb_##name }
+#else //configSUPPORT_STATIC_ALLOCATION == 1
+#define osMessageQDef(name, queue_sz, type)   \
+os_messageQ_cb_t os_messageQ_cb_##name; \
+const osMessageQDef_t os_messageQ_def_##name = \
+{ (queue_sz), sizeof (type), &os_messageQ_cb_##name }
+
+#endif
+#else //configUSE_OS_NOTIFY_OBJECTS == 0
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
 #define osMessageQDef(name, queue_sz, type)   \
 const osMessageQDef_t os_messageQ_def_##name = \
@@ -788,6 +882,7 @@ const osMessageQDef_t os_messageQ_def_##name = \
 const osMessageQDef_t os_messageQ_def_##name = \
 { (queue_sz), sizeof (type) }
 
+#endif
 #endif
 #endif
 
@@ -142,6 +142,135 @@ extern HeapRegion_t configHEAP_5_REGIONS[];
 #endif /* configAPPLICATION_ALLOCATED_HEAP */
 #endif /* USE_FREERTOS_HEAP_5 */
 
+/*
+  Object arena used when configSUPPORT_DYNAMIC_ALLOCATION is 0
+
+  The objects created without cb_mem (and stack_mem or mq_mem) then take their
+  memory from a single statically sized arena, so that no heap_x.c file needs
+  to be linked. The arena size is computed at build time from the following
+  definitions, to be set in FreeRTOSConfig.h:
+
+    configOS2_ARENA_THREADS         threads created without cb_mem and stack_mem
+    configOS2_ARENA_STACK_SIZE      sum of the stack sizes in bytes of these threads,
+                                    each rounded up to a multiple of 8
+    configOS2_ARENA_TIMERS          timers (the callback information of every
+                                    timer is taken from the arena)
+    configOS2_ARENA_EVENT_FLAGS     event flags created without cb_mem
+    configOS2_ARENA_MUTEXES         mutexes created without cb_mem
+    configOS2_ARENA_SEMAPHORES      semaphores created without cb_mem
+    configOS2_ARENA_MESSAGE_QUEUES  message queues created without cb_mem and mq_mem
+    configOS2_ARENA_MQ_SIZE         sum of the data sizes (msg_count * msg_size) of
+                                    these queues, each rounded up to a multiple of 8
+    configOS2_ARENA_THREAD_ENUM     threads reported by osThreadEnumerate, including
+                                    the idle and timer threads
+
+  Define configOS2_ARENA_ATTRIBUTE to place the arena in a linker section, for
+  instance __attribute__((section(".os2_arena"))), and configOS2_ARENA_BUDGET to
+  stop the build when the arena and the osThreadEnumerate buffer exceed the
+  given number of bytes. Arena memory is not given back when an object is
+  deleted.
+*/
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+#if (configSUPPORT_STATIC_ALLOCATION == 0)
+#error "configSUPPORT_STATIC_ALLOCATION must be 1 when configSUPPORT_DYNAMIC_ALLOCATION is 0"
+#endif
+
+#ifndef configOS2_ARENA_THREADS
+#define configOS2_ARENA_THREADS         0U
+#endif
+#ifndef configOS2_ARENA_STACK_SIZE
+#define configOS2_ARENA_STACK_SIZE      ( configOS2_ARENA_THREADS * configMINIMAL_STACK_SIZE * sizeof( StackType_t ) )
+#endif
+#ifndef configOS2_ARENA_TIMERS
+#define configOS2_ARENA_TIMERS          0U
+#endif
+#ifndef configOS2_ARENA_EVENT_FLAGS
+#define configOS2_ARENA_EVENT_FLAGS     0U
+#endif
+#ifndef configOS2_ARENA_MUTEXES
+#define configOS2_ARENA_MUTEXES         0U
+#endif
+#ifndef configOS2_ARENA_SEMAPHORES
+#define configOS2_ARENA_SEMAPHORES      0U
+#endif
+#ifndef configOS2_ARENA_MESSAGE_QUEUES
+#define configOS2_ARENA_MESSAGE_QUEUES  0U
+#endif
+#ifndef configOS2_ARENA_MQ_SIZE
+#define configOS2_ARENA_MQ_SIZE         0U
+#endif
+#ifndef configOS2_ARENA_THREAD_ENUM
+#define configOS2_ARENA_THREAD_ENUM     ( configOS2_ARENA_THREADS + 2U )
+#endif
+#ifndef configOS2_ARENA_ATTRIBUTE
+#define configOS2_ARENA_ATTRIBUTE
+#endif
+
+#define ARENA_ALIGN(size)         ( ( ( uint32_t )( size ) + 7U ) & ~7U )
+
+#define ARENA_SIZE                ( ( configOS2_ARENA_THREADS        * ARENA_ALIGN( sizeof( StaticTask_t ) ) )       + \
+                                    ARENA_ALIGN( configOS2_ARENA_STACK_SIZE )                                      + \
+                                    ( configOS2_ARENA_TIMERS         * ( ARENA_ALIGN( sizeof( StaticTimer_t ) )     + \
+                                                                         ARENA_ALIGN( sizeof( TimerCallback_t ) ) ) ) + \
+                                    ( configOS2_ARENA_EVENT_FLAGS    * ARENA_ALIGN( sizeof( StaticEventGroup_t ) ) ) + \
+                                    ( configOS2_ARENA_MUTEXES        * ARENA_ALIGN( sizeof( StaticSemaphore_t ) ) )  + \
+                                    ( configOS2_ARENA_SEMAPHORES     * ARENA_ALIGN( sizeof( StaticSemaphore_t ) ) )  + \
+                                    ( configOS2_ARENA_MESSAGE_QUEUES * ARENA_ALIGN( sizeof( StaticQueue_t ) ) )      + \
+                                    ARENA_ALIGN( configOS2_ARENA_MQ_SIZE ) )
+
+#define ARENA_RAM_SIZE            ( ARENA_SIZE + ( configOS2_ARENA_THREAD_ENUM * sizeof( TaskStatus_t ) ) )
+
+#if defined(configOS2_ARENA_BUDGET)
+/* Build time check of the RAM used by the arena */
+typedef char ArenaBudgetCheck[( ARENA_RAM_SIZE <= ( configOS2_ARENA_BUDGET ) ) ? 1 : -1];
+#endif
+
+#if ((configOS2_ARENA_THREADS + configOS2_ARENA_TIMERS + configOS2_ARENA_EVENT_FLAGS + configOS2_ARENA_MUTEXES + \
+      configOS2_ARENA_SEMAPHORES + configOS2_ARENA_MESSAGE_QUEUES) > 0)
+#define ARENA_USED                1
+
+/* Arena, kept 8 byte aligned for the thread stacks */
+static uint64_t Arena[ARENA_SIZE / 8U] configOS2_ARENA_ATTRIBUTE;
+#else
+#define ARENA_USED                0
+#endif
+
+/* Number of bytes taken from the arena */
+static uint32_t ArenaUsed;
+
+#if (configOS2_ARENA_THREAD_ENUM > 0)
+/* Thread status buffer of osThreadEnumerate */
+static TaskStatus_t ArenaThreadEnum[configOS2_ARENA_THREAD_ENUM] configOS2_ARENA_ATTRIBUTE;
+#endif
+
+/*
+  Take size bytes from the arena, return NULL when there is not enough space left
+*/
+static void *ArenaAlloc( uint32_t size )
+{
+    void *p = NULL;
+
+#if (ARENA_USED == 1)
+    size = ARENA_ALIGN( size );
+
+    vTaskSuspendAll();
+
+    if( size <= ( sizeof( Arena ) - ArenaUsed ) )
+    {
+        p = ( uint8_t * )Arena + ArenaUsed;
+        ArenaUsed += size;
+    }
+
+    ( void )xTaskResumeAll();
+#else
+    ( void )size;
+    ( void )ArenaUsed;
+#endif
+
+    return ( p );
+}
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION == 0 */
+
 #if defined(SysTick)
 #undef SysTick_Handler
 
@@ -469,6 +598,9 @@ osThreadId_t osThreadNew( osThreadFunc_t func, void *argument, const osThreadAtt
     TaskHandle_t hTask;
     UBaseType_t prio;
     int32_t mem;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    void *cb;
+#endif
 
     hTask = NULL;
 
@@ -531,10 +663,25 @@ osThreadId_t osThreadNew( osThreadFunc_t func, void *argument, const osThreadAtt
         {
             if( mem == 0 )
             {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+
                 if( xTaskCreate( ( TaskFunction_t )func, name, ( uint16_t )stack, argument, prio, &hTask ) != pdPASS )
                 {
                     hTask = NULL;
                 }
+
+#else
+                /* Control block followed by the stack */
+                cb = ArenaAlloc( ARENA_ALIGN( sizeof( StaticTask_t ) ) + ( stack * sizeof( StackType_t ) ) );
+
+                if( cb != NULL )
+                {
+                    hTask = xTaskCreateStatic( ( TaskFunction_t )func, name, stack, argument, prio,
+                                               ( StackType_t * )( ( uint8_t * )cb + ARENA_ALIGN( sizeof( StaticTask_t ) ) ),
+                                               ( StaticTask_t * )cb );
+                }
+
+#endif
             }
         }
     }
@@ -801,7 +948,13 @@ uint32_t osThreadEnumerate( osThreadId_t *thread_array, uint32_t array_items )
         vTaskSuspendAll();
 
         count = uxTaskGetNumberOfTasks();
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         task  = pvPortMalloc( count * sizeof( TaskStatus_t ) );
+#elif (configOS2_ARENA_THREAD_ENUM > 0)
+        task  = ( count <= configOS2_ARENA_THREAD_ENUM ) ? ArenaThreadEnum : NULL;
+#else
+        task  = NULL;
+#endif
 
         if( task != NULL )
         {
@@ -814,10 +967,16 @@ uint32_t osThreadEnumerate( osThreadId_t *thread_array, uint32_t array_items )
 
             count = i;
         }
+        else
+        {
+            count = 0U;
+        }
 
         ( void )xTaskResumeAll();
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         vPortFree( task );
+#endif
     }
 
     return ( count );
@@ -1091,13 +1250,20 @@ osTimerId_t osTimerNew( osTimerFunc_t func, osTimerType_t type, void *argument,
     TimerCallback_t *callb;
     UBaseType_t reload;
     int32_t mem;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    void *cb;
+#endif
 
     hTimer = NULL;
 
     if( !IS_IRQ() && ( func != NULL ) )
     {
         /* Allocate memory to store callback function and argument */
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
         callb = pvPortMalloc( sizeof( TimerCallback_t ) );
+#else
+        callb = ArenaAlloc( sizeof( TimerCallback_t ) );
+#endif
 
         if( callb != NULL )
         {
@@ -1148,7 +1314,17 @@ osTimerId_t osTimerNew( osTimerFunc_t func, osTimerType_t type, void *argument,
             {
                 if( mem == 0 )
                 {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
                     hTimer = xTimerCreate( name, 1, reload, callb, TimerCallback );
+#else
+                    cb = ArenaAlloc( sizeof( StaticTimer_t ) );
+
+                    if( cb != NULL )
+                    {
+                        hTimer = xTimerCreateStatic( name, 1, reload, callb, TimerCallback, ( StaticTimer_t * )cb );
+                    }
+
+#endif
                 }
             }
         }
@@ -1275,7 +1451,11 @@ osStatus_t osTimerDelete( osTimerId_t timer_id )
 
         if( xTimerDelete( hTimer, 0 ) == pdPASS )
         {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
             vPortFree( callb );
+#else
+            ( void )callb;
+#endif
             stat = osOK;
         }
         else
@@ -1297,6 +1477,9 @@ osEventFlagsId_t osEventFlagsNew( const osEventFlagsAttr_t *attr )
 {
     EventGroupHandle_t hEventGroup;
     int32_t mem;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    void *cb;
+#endif
 
     hEventGroup = NULL;
 
@@ -1331,7 +1514,17 @@ osEventFlagsId_t osEventFlagsNew( const osEventFlagsAttr_t *attr )
         {
             if( mem == 0 )
             {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
                 hEventGroup = xEventGroupCreate();
+#else
+                cb = ArenaAlloc( sizeof( StaticEventGroup_t ) );
+
+                if( cb != NULL )
+                {
+                    hEventGroup = xEventGroupCreateStatic( ( StaticEventGroup_t * )cb );
+                }
+
+#endif
             }
         }
     }
@@ -1524,6 +1717,9 @@ osMutexId_t osMutexNew( const osMutexAttr_t *attr )
     uint32_t type;
     uint32_t rmtx;
     int32_t  mem;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    void *cb;
+#endif
 #if (configQUEUE_REGISTRY_SIZE > 0)
     const char *name;
 #endif
@@ -1588,6 +1784,8 @@ osMutexId_t osMutexNew( const osMutexAttr_t *attr )
             {
                 if( mem == 0 )
                 {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+
                     if( rmtx != 0U )
                     {
                         hMutex = xSemaphoreCreateRecursiveMutex();
@@ -1596,6 +1794,24 @@ osMutexId_t osMutexNew( const osMutexAttr_t *attr )
                     {
                         hMutex = xSemaphoreCreateMutex();
                     }
+
+#else
+                    cb = ArenaAlloc( sizeof( StaticSemaphore_t ) );
+
+                    if( cb == NULL )
+                    {
+                        hMutex = NULL;
+                    }
+                    else if( rmtx != 0U )
+                    {
+                        hMutex = xSemaphoreCreateRecursiveMutexStatic( ( StaticSemaphore_t * )cb );
+                    }
+                    else
+                    {
+                        hMutex = xSemaphoreCreateMutexStatic( ( StaticSemaphore_t * )cb );
+                    }
+
+#endif
                 }
             }
 
@@ -1780,6 +1996,7 @@ osSemaphoreId_t osSemaphoreNew( uint32_t max_count, uint32_t initial_count, cons
 {
     SemaphoreHandle_t hSemaphore;
     int32_t mem;
+    void *cb;
 #if (configQUEUE_REGISTRY_SIZE > 0)
     const char *name;
 #endif
@@ -1789,12 +2006,14 @@ osSemaphoreId_t osSemaphoreNew( uint32_t max_count, uint32_t initial_count, cons
     if( !IS_IRQ() && ( max_count > 0U ) && ( initial_count <= max_count ) )
     {
         mem = -1;
+        cb  = NULL;
 
         if( attr != NULL )
         {
             if( ( attr->cb_mem != NULL ) && ( attr->cb_size >= sizeof( StaticSemaphore_t ) ) )
             {
                 mem = 1;
+                cb  = attr->cb_mem;
             }
             else
             {
@@ -1809,18 +2028,31 @@ osSemaphoreId_t osSemaphoreNew( uint32_t max_count, uint32_t initial_count, cons
             mem = 0;
         }
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+
+        if( mem == 0 )
+        {
+            /* Take the control block from the arena */
+            cb = ArenaAlloc( sizeof( StaticSemaphore_t ) );
+            mem = ( cb != NULL ) ? 1 : -1;
+        }
+
+#endif
+
         if( mem != -1 )
         {
             if( max_count == 1U )
             {
                 if( mem == 1 )
                 {
-                    hSemaphore = xSemaphoreCreateBinaryStatic( ( StaticSemaphore_t * )attr->cb_mem );
+                    hSemaphore = xSemaphoreCreateBinaryStatic( ( StaticSemaphore_t * )cb );
                 }
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
                 else
                 {
                     hSemaphore = xSemaphoreCreateBinary();
                 }
+#endif
 
                 if( ( hSemaphore != NULL ) && ( initial_count != 0U ) )
                 {
@@ -1835,12 +2067,14 @@ osSemaphoreId_t osSemaphoreNew( uint32_t max_count, uint32_t initial_count, cons
             {
                 if( mem == 1 )
                 {
-                    hSemaphore = xSemaphoreCreateCountingStatic( max_count, initial_count, ( StaticSemaphore_t * )attr->cb_mem );
+                    hSemaphore = xSemaphoreCreateCountingStatic( max_count, initial_count, ( StaticSemaphore_t * )cb );
                 }
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
                 else
                 {
                     hSemaphore = xSemaphoreCreateCounting( max_count, initial_count );
                 }
+#endif
             }
 
 #if (configQUEUE_REGISTRY_SIZE > 0)
@@ -2011,6 +2245,9 @@ osMessageQueueId_t osMessageQueueNew( uint32_t msg_count, uint32_t msg_size, con
 {
     QueueHandle_t hQueue;
     int32_t mem;
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+    void *cb;
+#endif
 #if (configQUEUE_REGISTRY_SIZE > 0)
     const char *name;
 #endif
@@ -2050,7 +2287,19 @@ osMessageQueueId_t osMessageQueueNew( uint32_t msg_count, uint32_t msg_size, con
         {
             if( mem == 0 )
             {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
                 hQueue = xQueueCreate( msg_count, msg_size );
+#else
+                /* Control block followed by the message storage */
+                cb = ArenaAlloc( ARENA_ALIGN( sizeof( StaticQueue_t ) ) + ( msg_count * msg_size ) );
+
+                if( cb != NULL )
+                {
+                    hQueue = xQueueCreateStatic( msg_count, msg_size, ( uint8_t * )cb + ARENA_ALIGN( sizeof( StaticQueue_t ) ),
+                                                 ( StaticQueue_t * )cb );
+                }
+
+#endif
             }
         }
 
@@ -262,6 +262,43 @@ extern "C" {
 
 #endif /* configUSE_TIMERS */
 
+/* Set configUSE_TIMER_WHEEL to 1 to hold active software timers in a
+hierarchical timing wheel rather than in sorted lists.  Starting, resetting and
+stopping a timer then costs the same regardless of how many timers are active.
+The wheel has configTIMER_WHEEL_LEVELS levels of ( 1 << configTIMER_WHEEL_SLOT_BITS )
+slots each, every slot being a List_t. */
+#ifndef configUSE_TIMER_WHEEL
+#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SLOT_BITS
+#define configTIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#ifndef configTIMER_WHEEL_LEVELS
+#define configTIMER_WHEEL_LEVELS 4
+#endif
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+#if ( configUSE_TIMERS == 0 )
+#error configUSE_TIMERS must be set to 1 to use configUSE_TIMER_WHEEL.
+#endif
+
+#if ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 )
+#error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5 (at most 32 slots per wheel level).
+#endif
+
+#if ( configTIMER_WHEEL_LEVELS < 1 )
+#error configTIMER_WHEEL_LEVELS must be at least 1.
+#endif
+
+#if ( ( configUSE_16_BIT_TICKS == 1 ) && ( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) >= 16 ) ) || ( ( configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS ) >= 32 )
+#error configTIMER_WHEEL_SLOT_BITS * configTIMER_WHEEL_LEVELS must be less than the number of bits in TickType_t.
+#endif
+
+#endif /* configUSE_TIMER_WHEEL */
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 #define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -84,6 +84,9 @@
 #define configTIMER_TASK_PRIORITY    (2)
 #define configTIMER_QUEUE_LENGTH     10
 #define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+#define configUSE_TIMER_WHEEL        0
+#define configTIMER_WHEEL_SLOT_BITS  4
+#define configTIMER_WHEEL_LEVELS     4
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -69,6 +69,19 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED   ( ( uint8_t ) 0x02 )
 #define tmrSTATUS_IS_AUTORELOAD             ( ( uint8_t ) 0x04 )
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+    /* Geometry of the timing wheel used when configUSE_TIMER_WHEEL is 1. */
+    #define tmrWHEEL_SLOTS                  ( 1U << configTIMER_WHEEL_SLOT_BITS )
+    #define tmrWHEEL_SLOT_MASK              ( ( TickType_t ) ( tmrWHEEL_SLOTS - 1U ) )
+    #define tmrWHEEL_LEVEL_SHIFT( uxLevel ) ( ( UBaseType_t ) ( uxLevel ) * ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS )
+    #define tmrWHEEL_SPAN_SHIFT             tmrWHEEL_LEVEL_SHIFT( configTIMER_WHEEL_LEVELS )
+    #define tmrWHEEL_MAP_MASK               ( ( uint32_t ) 0xffffffffUL >> ( 32U - tmrWHEEL_SLOTS ) )
+
+    /* Index of the lowest bit set in a non-zero slot map, found with a de
+    Bruijn sequence as Cortex-M0 has no count leading zeros instruction. */
+    #define tmrWHEEL_LOWEST_BIT( ulMap )    ( ucTimerWheelLowestBit[ ( uint32_t ) ( ( ( ulMap ) & ( ( uint32_t ) 0U - ( ulMap ) ) ) * ( uint32_t ) 0x077cb531UL ) >> 27 ] )
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 {
@@ -132,10 +145,38 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1 = { 0 };
-PRIVILEGED_DATA static List_t xActiveTimerList2 = { 0 };
-PRIVILEGED_DATA static List_t *pxCurrentTimerList = NULL;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList = NULL;
+#if ( configUSE_TIMER_WHEEL == 0 )
+    PRIVILEGED_DATA static List_t xActiveTimerList1 = { 0 };
+    PRIVILEGED_DATA static List_t xActiveTimerList2 = { 0 };
+    PRIVILEGED_DATA static List_t *pxCurrentTimerList = NULL;
+    PRIVILEGED_DATA static List_t *pxOverflowTimerList = NULL;
+#else
+    /* When configUSE_TIMER_WHEEL is 1 active timers are instead referenced
+    from a hierarchical timing wheel.  A timer that expires d ticks after
+    xTimerWheelTime is held in level l of the wheel, where l is the lowest
+    level that spans d, in the slot selected by bits
+    [ l * configTIMER_WHEEL_SLOT_BITS, ( l + 1 ) * configTIMER_WHEEL_SLOT_BITS )
+    of its expiry time.  Slots are not sorted so timers are inserted and
+    removed in constant time.  When time reaches the start of a slot in a level
+    above 0 the timers in the slot are cascaded down to the lower levels, and
+    when time reaches a slot in level 0 every timer in that slot has expired.
+    Timers that expire beyond the span of the top level are held in
+    xTimerWheelOverflowList until time comes within range.  ulTimerWheelMap
+    has one bit set for each non-empty slot so empty slots are skipped without
+    being accessed.  xTimerWheelTime is the tick up to which the wheel has been
+    processed - all arithmetic is relative to it, so no list switching is
+    needed when the tick count overflows. */
+    PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+    PRIVILEGED_DATA static List_t xTimerWheelOverflowList = { 0 };
+    PRIVILEGED_DATA static uint32_t ulTimerWheelMap[ configTIMER_WHEEL_LEVELS ] = { 0 };
+    PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+
+    static const uint8_t ucTimerWheelLowestBit[ 32 ] =
+    {
+        0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+        31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+    };
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -176,21 +217,52 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow.  When
+ * configUSE_TIMER_WHEEL is 1 the timer is inserted into the timing wheel
+ * instead.
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t *const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
-/*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto reload timer, then call its callback.
- */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMER_WHEEL == 0 )
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+    /*
+     * An active timer has reached its expire time.  Reload the timer if it is an
+     * auto reload timer, then call its callback.
+     */
+    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+    /*
+     * The tick count has overflowed.  Switch the timer lists after ensuring the
+     * current timer list does not still reference some timers.
+     */
+    static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#else
+
+    /*
+     * Reference the timer from the wheel slot (or the overflow list) that
+     * corresponds to xExpiryTime relative to xTimerWheelTime.
+     */
+    static void prvWheelInsert( Timer_t *const pxTimer, const TickType_t xExpiryTime ) PRIVILEGED_FUNCTION;
+
+    /*
+     * Remove the timer from whichever wheel slot references it, if any.
+     */
+    static void prvWheelRemove( Timer_t *const pxTimer ) PRIVILEGED_FUNCTION;
+
+    /*
+     * Re-insert every timer referenced from pxList relative to the current
+     * xTimerWheelTime, moving the timers to lower wheel levels.
+     */
+    static void prvWheelCascade( List_t *const pxList ) PRIVILEGED_FUNCTION;
+
+    /*
+     * Move the wheel forward to xTimeNow, cascading slots and processing every
+     * timer that expires on the way as one batch.
+     */
+    static void prvWheelAdvance( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -202,7 +274,9 @@ static TickType_t prvSampleTimeNow( BaseType_t *const pxTimerListsWereSwitched )
  * If the timer list contains any active timers then return the expire time of
  * the timer that will expire first and set *pxListWasEmpty to false.  If the
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
- * to pdTRUE.
+ * to pdTRUE.  When configUSE_TIMER_WHEEL is 1 the time returned is that of the
+ * next wheel event, which is either a timer expiring or a slot needing to be
+ * cascaded.
  */
 static TickType_t prvGetNextExpireTime( BaseType_t *const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
@@ -481,6 +555,8 @@ const char *pcTimerGetName( TimerHandle_t xTimer )  /*lint !e971 Unqualified cha
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
     BaseType_t xResult;
@@ -520,6 +596,8 @@ static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const Tick
     /* Call the timer callback. */
     pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
@@ -558,6 +636,8 @@ static portTASK_FUNCTION( prvTimerTask, pvParameters )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
     TickType_t xTimeNow;
@@ -708,6 +788,331 @@ static BaseType_t prvInsertTimerInActiveList( Timer_t *const pxTimer, const Tick
 
     return xProcessTimerNow;
 }
+
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+    TickType_t xTimeNow;
+
+    vTaskSuspendAll();
+    {
+        xTimeNow = xTaskGetTickCount();
+
+        /* Times are compared relative to xTimerWheelTime, which never runs
+        ahead of the tick count, so tick count overflows need no special
+        handling. */
+        if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xNextExpireTime - xTimerWheelTime ) <= ( TickType_t ) ( xTimeNow - xTimerWheelTime ) ) )
+        {
+            ( void ) xTaskResumeAll();
+
+            /* Process every event that is now due in one pass, rather than
+            one timer per iteration of the timer task loop. */
+            prvWheelAdvance( xTimeNow );
+        }
+        else
+        {
+            if( xListWasEmpty != pdFALSE )
+            {
+                /* There are no active timers, so the wheel can be moved
+                straight to the current time.  This prevents xTimerWheelTime
+                falling so far behind the tick count that the relative time
+                of the next timer to be started wraps. */
+                xTimerWheelTime = xTimeNow;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+            if( xTaskResumeAll() == pdFALSE )
+            {
+                /* Yield to wait for either a command to arrive, or the
+                block time to expire.  If a command arrived between the
+                critical section being exited and this yield then the yield
+                will not cause the task to block. */
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextExpireTime( BaseType_t *const pxListWasEmpty )
+{
+    TickType_t xNextExpireTime = ( TickType_t ) 0U, xEventTime, xOffset, xBestOffset = ( TickType_t ) 0U;
+    UBaseType_t uxLevel, uxShift;
+    uint32_t ulMap;
+
+    *pxListWasEmpty = pdTRUE;
+
+    /* The slots of a level are visited when xTimerWheelTime enters the range
+    of ticks the slot represents.  For each level find the nearest non-empty
+    slot after the current one - which is between 1 and tmrWHEEL_SLOTS slots
+    ahead - and keep the earliest of the resulting event times. */
+    for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+    {
+        ulMap = ulTimerWheelMap[ uxLevel ];
+
+        if( ulMap != 0UL )
+        {
+            /* Rotate the map so bit 0 is the slot after the current one, and
+            the current slot - a full revolution ahead - the last bit.  The
+            offset of the nearest slot is then its lowest bit set, plus one. */
+            uxShift = ( UBaseType_t ) ( ( ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) + ( TickType_t ) 1U ) & tmrWHEEL_SLOT_MASK );
+
+            if( uxShift != ( UBaseType_t ) 0U )
+            {
+                ulMap = ( ( ulMap >> uxShift ) | ( ulMap << ( ( UBaseType_t ) tmrWHEEL_SLOTS - uxShift ) ) ) & tmrWHEEL_MAP_MASK;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xOffset = ( TickType_t ) tmrWHEEL_LOWEST_BIT( ulMap ) + ( TickType_t ) 1U;
+            xEventTime = ( TickType_t ) ( ( ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) + xOffset ) << tmrWHEEL_LEVEL_SHIFT( uxLevel ) );
+            xOffset = ( TickType_t ) ( xEventTime - xTimerWheelTime );
+
+            if( ( *pxListWasEmpty != pdFALSE ) || ( xOffset < xBestOffset ) )
+            {
+                *pxListWasEmpty = pdFALSE;
+                xBestOffset = xOffset;
+                xNextExpireTime = xEventTime;
+            }
+        }
+    }
+
+    /* Timers beyond the span of the wheel are re-examined each time the top
+    level completes a revolution. */
+    if( listLIST_IS_EMPTY( &xTimerWheelOverflowList ) == pdFALSE )
+    {
+        xEventTime = ( TickType_t ) ( ( ( xTimerWheelTime >> tmrWHEEL_SPAN_SHIFT ) + ( TickType_t ) 1U ) << tmrWHEEL_SPAN_SHIFT );
+        xOffset = ( TickType_t ) ( xEventTime - xTimerWheelTime );
+
+        if( ( *pxListWasEmpty != pdFALSE ) || ( xOffset < xBestOffset ) )
+        {
+            *pxListWasEmpty = pdFALSE;
+            xNextExpireTime = xEventTime;
+        }
+    }
+
+    return xNextExpireTime;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( BaseType_t *const pxTimerListsWereSwitched )
+{
+    /* The wheel does not switch lists when the tick count overflows. */
+    *pxTimerListsWereSwitched = pdFALSE;
+
+    return xTaskGetTickCount();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t *const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+    BaseType_t xProcessTimerNow = pdFALSE;
+
+    /* Has the expiry time elapsed between the command to start/reset a timer
+    was issued, and the time the command was processed?  The subtraction also
+    gives the right answer if the tick count overflowed in between. */
+    if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+    {
+        listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+        xProcessTimerNow = pdTRUE;
+    }
+    else
+    {
+        prvWheelInsert( pxTimer, xNextExpiryTime );
+    }
+
+    return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelInsert( Timer_t *const pxTimer, const TickType_t xExpiryTime )
+{
+    const TickType_t xTicksToExpiry = ( TickType_t ) ( xExpiryTime - xTimerWheelTime );
+    UBaseType_t uxLevel, uxSlot;
+
+    listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+    listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+    for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+    {
+        /* Is the expiry time within the span of this level? */
+        if( ( xTicksToExpiry >> tmrWHEEL_LEVEL_SHIFT( uxLevel + 1U ) ) == ( TickType_t ) 0U )
+        {
+            uxSlot = ( UBaseType_t ) ( ( xExpiryTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK );
+            vListInsertEnd( &( xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+            ulTimerWheelMap[ uxLevel ] |= ( 1UL << uxSlot );
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    if( uxLevel == ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+    {
+        vListInsertEnd( &xTimerWheelOverflowList, &( pxTimer->xTimerListItem ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelRemove( Timer_t *const pxTimer )
+{
+    List_t *const pxList = listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+    UBaseType_t uxIndex;
+
+    if( pxList != NULL )
+    {
+        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+        if( ( pxList != &xTimerWheelOverflowList ) && ( listLIST_IS_EMPTY( pxList ) != pdFALSE ) )
+        {
+            /* The slot is now empty, so clear its bit in the map. */
+            uxIndex = ( UBaseType_t ) ( pxList - &( xTimerWheel[ 0 ][ 0 ] ) );
+            ulTimerWheelMap[ uxIndex >> configTIMER_WHEEL_SLOT_BITS ] &= ~( 1UL << ( uxIndex & ( UBaseType_t ) tmrWHEEL_SLOT_MASK ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelCascade( List_t *const pxList )
+{
+    UBaseType_t uxTimersToMove;
+    Timer_t *pxTimer;
+
+    /* Only the timers that are in the list on entry are moved.  Timers
+    cascaded from the overflow list can be placed back in the overflow list. */
+    uxTimersToMove = listCURRENT_LIST_LENGTH( pxList );
+
+    while( uxTimersToMove > ( UBaseType_t ) 0U )
+    {
+        pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        prvWheelInsert( pxTimer, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+        uxTimersToMove--;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWheelAdvance( const TickType_t xTimeNow )
+{
+    TickType_t xEventTime;
+    BaseType_t xWheelIsEmpty;
+    UBaseType_t uxLevel, uxSlot;
+    List_t *pxSlot;
+    Timer_t *pxTimer;
+
+    for( ;; )
+    {
+        xEventTime = prvGetNextExpireTime( &xWheelIsEmpty );
+
+        if( ( xWheelIsEmpty != pdFALSE ) || ( ( TickType_t ) ( xEventTime - xTimerWheelTime ) > ( TickType_t ) ( xTimeNow - xTimerWheelTime ) ) )
+        {
+            /* Nothing else is due before xTimeNow. */
+            break;
+        }
+
+        xTimerWheelTime = xEventTime;
+
+        /* Bring any timers that are now within range down from the overflow
+        list and the upper levels, top level first. */
+        if( ( xTimerWheelTime & ( ( ( TickType_t ) 1U << tmrWHEEL_SPAN_SHIFT ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+        {
+            prvWheelCascade( &xTimerWheelOverflowList );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( uxLevel = ( UBaseType_t ) configTIMER_WHEEL_LEVELS - 1U; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+        {
+            if( ( xTimerWheelTime & ( ( ( TickType_t ) 1U << tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) == ( TickType_t ) 0U )
+            {
+                uxSlot = ( UBaseType_t ) ( ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK );
+
+                if( ( ulTimerWheelMap[ uxLevel ] & ( 1UL << uxSlot ) ) != 0UL )
+                {
+                    ulTimerWheelMap[ uxLevel ] &= ~( 1UL << uxSlot );
+                    prvWheelCascade( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Every timer in the level 0 slot for this tick has expired. */
+        uxSlot = ( UBaseType_t ) ( xTimerWheelTime & tmrWHEEL_SLOT_MASK );
+
+        if( ( ulTimerWheelMap[ 0 ] & ( 1UL << uxSlot ) ) != 0UL )
+        {
+            ulTimerWheelMap[ 0 ] &= ~( 1UL << uxSlot );
+            pxSlot = &( xTimerWheel[ 0 ][ uxSlot ] );
+
+            while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+            {
+                pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                traceTIMER_EXPIRED( pxTimer );
+
+                if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+                {
+                    /* The reload time is relative to the time the timer
+                    should have expired.  As the period is not zero the timer
+                    cannot be placed back into this slot, and if the reload
+                    time has already passed it is processed later in this same
+                    loop. */
+                    prvWheelInsert( pxTimer, ( xTimerWheelTime + pxTimer->xTimerPeriodInTicks ) );
+                }
+                else
+                {
+                    pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+                }
+
+                pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    /* No event falls between the last one processed and xTimeNow. */
+    xTimerWheelTime = xTimeNow;
+}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvProcessReceivedCommands( void )
@@ -749,15 +1154,24 @@ static void prvProcessReceivedCommands( void )
             software timer. */
             pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-            if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+#if ( configUSE_TIMER_WHEEL == 0 )
             {
-                /* The timer is in a list, remove it. */
-                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+                {
+                    /* The timer is in a list, remove it. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-            else
+#else
             {
-                mtCOVERAGE_TEST_MARKER();
+                /* The timer is in a wheel slot, remove it. */
+                prvWheelRemove( pxTimer );
             }
+#endif /* configUSE_TIMER_WHEEL */
 
             traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
@@ -861,6 +1275,8 @@ static void prvProcessReceivedCommands( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
     TickType_t xNextExpireTime, xReloadTime;
@@ -919,6 +1335,8 @@ static void prvSwitchTimerLists( void )
     pxCurrentTimerList = pxOverflowTimerList;
     pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -930,10 +1348,31 @@ static void prvCheckForValidListAndQueue( void )
     {
         if( xTimerQueue == NULL )
         {
-            vListInitialise( &xActiveTimerList1 );
-            vListInitialise( &xActiveTimerList2 );
-            pxCurrentTimerList = &xActiveTimerList1;
-            pxOverflowTimerList = &xActiveTimerList2;
+#if ( configUSE_TIMER_WHEEL == 0 )
+            {
+                vListInitialise( &xActiveTimerList1 );
+                vListInitialise( &xActiveTimerList2 );
+                pxCurrentTimerList = &xActiveTimerList1;
+                pxOverflowTimerList = &xActiveTimerList2;
+            }
+#else
+            {
+                UBaseType_t uxLevel, uxSlot;
+
+                for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+                {
+                    for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) tmrWHEEL_SLOTS; uxSlot++ )
+                    {
+                        vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+                    }
+
+                    ulTimerWheelMap[ uxLevel ] = 0UL;
+                }
+
+                vListInitialise( &xTimerWheelOverflowList );
+                xTimerWheelTime = xTaskGetTickCount();
+            }
+#endif /* configUSE_TIMER_WHEEL */
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
             {
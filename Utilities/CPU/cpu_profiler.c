@@ -0,0 +1,471 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   Per task run time, interrupt time, ready latency and stack usage
+  *          profiler based on a free running TIM/LPTIM counter
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- copy cpu_profiler_conf_template.h to the application as cpu_profiler_conf.h
+   and select the counter timer and the transmit function.
+
+2- in the _OS_Config.h file (ex. FreeRTOSConfig.h) enable the following macros :
+      - #define configUSE_TRACE_FACILITY         1
+      - #define configGENERATE_RUN_TIME_STATS    1
+
+3- in the _OS_Config.h define the following macros :
+      - #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() extern void CPU_PROF_ConfigureTimer(void); \
+                                                       CPU_PROF_ConfigureTimer()
+      - #define portGET_RUN_TIME_COUNTER_VALUE()         CPU_PROF_GetCounter()
+      - #define traceMOVED_TASK_TO_READY_STATE( pxTCB )  CPU_PROF_TaskReady( pxTCB, ( pxTCB )->uxTCBNumber )
+      - #define traceTASK_SWITCHED_IN()                  CPU_PROF_TaskSwitchedIn( pxCurrentTCB->uxTCBNumber )
+   and declare the functions used in expressions, outside of assembler files :
+      - extern uint32_t CPU_PROF_GetCounter(void);
+      - extern void CPU_PROF_TaskReady(void *pxTask, uint32_t Number);
+      - extern void CPU_PROF_TaskSwitchedIn(uint32_t Number);
+
+4- call CPU_PROF_TickHook() from vApplicationTickHook() so the 16-bit timer
+   counter is extended to 32 bits even when no context switch occurs.
+
+5- optionally bracket the interrupt handlers with CPU_PROF_ISR_Enter() and
+   CPU_PROF_ISR_Exit() to measure the time spent in interrupts. The run time
+   of a task includes the interrupts that occurred while it was running.
+
+6- call CPU_PROF_ReportNames() once, then CPU_PROF_Report() periodically from
+   a low priority task. Each call to CPU_PROF_Report() sends one record
+   covering the time elapsed since the previous call.
+
+Tasks are identified by their task number, which FreeRTOS assigns in creation
+order starting from 1 (uxTCBNumber, reported as TaskStatus_t xTaskNumber). It
+is passed by the trace macros, as the number set with vTaskSetTaskNumber() is
+0 unless the application sets it. Only tasks numbered below CPU_PROF_MAX_TASKS
+are reported. The ready latency is the time between a task being unblocked
+(moved to the Ready state) and the task actually running.
+
+When more than CPU_PROF_MAX_TASKS tasks exist, their state cannot be read:
+CPU_PROF_Report() sends a record without task entries and with the
+CPU_PROF_FLAG_TRUNCATED flag set, and CPU_PROF_ReportNames() a record with
+the single entry of task number 0.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "cpu_profiler.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define CPU_PROF_NAME_ENTRY_SIZE    (2U + configMAX_TASK_NAME_LEN)
+
+#define CPU_PROF_STATS_SIZE         (CPU_PROF_STATS_HEADER_SIZE + (CPU_PROF_MAX_TASKS * CPU_PROF_TASK_ENTRY_SIZE))
+#define CPU_PROF_NAMES_SIZE         (CPU_PROF_MAX_TASKS * CPU_PROF_NAME_ENTRY_SIZE)
+#define CPU_PROF_PAYLOAD_SIZE       ((CPU_PROF_STATS_SIZE > CPU_PROF_NAMES_SIZE) ? CPU_PROF_STATS_SIZE : CPU_PROF_NAMES_SIZE)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t *CPU_PROF_Put16( uint8_t *pBuf, uint16_t Value );
+static uint8_t *CPU_PROF_Put32( uint8_t *pBuf, uint32_t Value );
+static void     CPU_PROF_SendRecord( uint8_t Type, uint16_t Length );
+
+/* Private variables ---------------------------------------------------------*/
+#if defined(CPU_PROF_USE_LPTIM)
+static LPTIM_HandleTypeDef hProfTimer;
+#else
+static TIM_HandleTypeDef   hProfTimer;
+#endif
+
+static uint32_t            ProfCounter = 0;
+static uint16_t            ProfLastCount = 0;
+
+static __IO uint32_t       ProfIsrNesting = 0;
+static uint32_t            ProfIsrStartTime = 0;
+static uint32_t            ProfIsrTime = 0;
+static uint32_t            ProfLastIsrTime = 0;
+static uint32_t            ProfLastReportTime = 0;
+
+static uint32_t            ProfReadyTime[CPU_PROF_MAX_TASKS];
+static uint32_t            ProfMaxLatency[CPU_PROF_MAX_TASKS];
+static uint8_t             ProfReadyPending[CPU_PROF_MAX_TASKS];
+static uint32_t            ProfLastRunTime[CPU_PROF_MAX_TASKS];
+
+static TaskStatus_t        ProfTaskStatus[CPU_PROF_MAX_TASKS];
+static uint8_t             ProfBuffer[CPU_PROF_HEADER_SIZE + CPU_PROF_PAYLOAD_SIZE + CPU_PROF_CHECKSUM_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Configure and start the free running run time counter
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_ConfigureTimer( void )
+{
+    CPU_PROF_TIMER_CLK_ENABLE();
+
+    hProfTimer.Instance = CPU_PROF_TIMER;
+#if defined(CPU_PROF_USE_LPTIM)
+    hProfTimer.Init.Clock.Source = CPU_PROF_LPTIM_CLOCK_SOURCE;
+    hProfTimer.Init.Clock.Prescaler = CPU_PROF_LPTIM_PRESCALER;
+    hProfTimer.Init.Trigger.Source = LPTIM_TRIGSOURCE_SOFTWARE;
+    hProfTimer.Init.OutputPolarity = LPTIM_OUTPUTPOLARITY_HIGH;
+    hProfTimer.Init.UpdateMode = LPTIM_UPDATE_IMMEDIATE;
+    hProfTimer.Init.CounterSource = LPTIM_COUNTERSOURCE_INTERNAL;
+
+    if( HAL_LPTIM_Init( &hProfTimer ) == HAL_OK )
+    {
+        ( void )HAL_LPTIM_Counter_Start( &hProfTimer, 0xFFFFU );
+    }
+#else
+    hProfTimer.Init.Prescaler = CPU_PROF_TIM_PRESCALER;
+    hProfTimer.Init.CounterMode = TIM_COUNTERMODE_UP;
+    hProfTimer.Init.Period = 0xFFFFU;
+    hProfTimer.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    hProfTimer.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+
+    if( HAL_TIM_Base_Init( &hProfTimer ) == HAL_OK )
+    {
+        ( void )HAL_TIM_Base_Start( &hProfTimer );
+    }
+#endif
+
+    ProfLastCount = 0;
+    ProfCounter = 0;
+}
+
+/**
+  * @brief  Return the run time counter extended to 32 bits.
+  *         Can be called from tasks, interrupts and the scheduler.
+  * @param  None
+  * @retval Run time counter value
+  */
+uint32_t CPU_PROF_GetCounter( void )
+{
+    UBaseType_t uxSavedInterruptStatus;
+    uint16_t Count;
+    uint32_t Counter;
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+#if defined(CPU_PROF_USE_LPTIM)
+        /* The LPTIM counter is clocked asynchronously, two consecutive
+           identical reads are needed to get a reliable value. */
+        do
+        {
+            Count = ( uint16_t )CPU_PROF_TIMER->CNT;
+        }
+        while( Count != ( uint16_t )CPU_PROF_TIMER->CNT );
+#else
+        Count = ( uint16_t )CPU_PROF_TIMER->CNT;
+#endif
+
+        ProfCounter += ( uint16_t )( Count - ProfLastCount );
+        ProfLastCount = Count;
+        Counter = ProfCounter;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return Counter;
+}
+
+/**
+  * @brief  Keep the extended counter up to date, to be called from the tick hook
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_TickHook( void )
+{
+    ( void )CPU_PROF_GetCounter();
+}
+
+/**
+  * @brief  Record the time a task is moved to the Ready state
+  * @param  pxTask: handle of the task made ready
+  * @param  Number: task number of the task made ready (uxTCBNumber)
+  * @retval None
+  */
+void CPU_PROF_TaskReady( void *pxTask, uint32_t Number )
+{
+    /* The running task is re-added to the ready list when its priority
+       changes, this is not the end of a blocked period. */
+    if( ( Number < CPU_PROF_MAX_TASKS ) && ( ProfReadyPending[Number] == 0U ) &&
+        ( ( TaskHandle_t )pxTask != xTaskGetCurrentTaskHandle() ) )
+    {
+        ProfReadyTime[Number] = CPU_PROF_GetCounter();
+        ProfReadyPending[Number] = 1U;
+    }
+}
+
+/**
+  * @brief  Update the ready latency of the task being switched in
+  * @param  Number: task number of the task switched in (uxTCBNumber)
+  * @retval None
+  */
+void CPU_PROF_TaskSwitchedIn( uint32_t Number )
+{
+    uint32_t Latency;
+
+    if( ( Number < CPU_PROF_MAX_TASKS ) && ( ProfReadyPending[Number] != 0U ) )
+    {
+        Latency = CPU_PROF_GetCounter() - ProfReadyTime[Number];
+
+        if( Latency > ProfMaxLatency[Number] )
+        {
+            ProfMaxLatency[Number] = Latency;
+        }
+
+        ProfReadyPending[Number] = 0U;
+    }
+}
+
+/**
+  * @brief  Mark the entry in an interrupt handler
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_ISR_Enter( void )
+{
+    if( ProfIsrNesting++ == 0U )
+    {
+        ProfIsrStartTime = CPU_PROF_GetCounter();
+    }
+}
+
+/**
+  * @brief  Mark the exit from an interrupt handler
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_ISR_Exit( void )
+{
+    if( --ProfIsrNesting == 0U )
+    {
+        ProfIsrTime += CPU_PROF_GetCounter() - ProfIsrStartTime;
+    }
+}
+
+/**
+  * @brief  Send a statistics record covering the time since the previous call
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_Report( void )
+{
+    UBaseType_t TaskCount, Index, Number;
+    uint32_t TotalRunTime, Window, IsrTime, RunTime, MaxLatency, Share;
+    configSTACK_DEPTH_TYPE StackLeft;
+    uint8_t *pBuf;
+    uint8_t Entries = 0;
+    uint8_t Flags = 0;
+
+    /* uxTaskGetSystemState() returns no task at all when the array is too
+       small, which a task created after the count is checked also causes. The
+       record is then flagged and the run time counter read directly. */
+    TaskCount = 0;
+
+    if( uxTaskGetNumberOfTasks() <= CPU_PROF_MAX_TASKS )
+    {
+        TaskCount = uxTaskGetSystemState( ProfTaskStatus, CPU_PROF_MAX_TASKS, &TotalRunTime );
+    }
+
+    if( TaskCount == 0U )
+    {
+        TotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+        Flags |= CPU_PROF_FLAG_TRUNCATED;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        IsrTime = ProfIsrTime - ProfLastIsrTime;
+        ProfLastIsrTime = ProfIsrTime;
+    }
+    taskEXIT_CRITICAL();
+
+    Window = TotalRunTime - ProfLastReportTime;
+    ProfLastReportTime = TotalRunTime;
+
+    pBuf = &ProfBuffer[CPU_PROF_HEADER_SIZE + CPU_PROF_STATS_HEADER_SIZE];
+
+    for( Index = 0; Index < TaskCount; Index++ )
+    {
+        Number = ProfTaskStatus[Index].xTaskNumber;
+
+        if( Number >= CPU_PROF_MAX_TASKS )
+        {
+            continue;
+        }
+
+        RunTime = ProfTaskStatus[Index].ulRunTimeCounter - ProfLastRunTime[Number];
+        ProfLastRunTime[Number] = ProfTaskStatus[Index].ulRunTimeCounter;
+
+        taskENTER_CRITICAL();
+        {
+            MaxLatency = ProfMaxLatency[Number];
+            ProfMaxLatency[Number] = 0U;
+        }
+        taskEXIT_CRITICAL();
+
+        Share = ( Window != 0U ) ? ( uint32_t )( ( ( uint64_t )RunTime * 1000U ) / Window ) : 0U;
+        StackLeft = ProfTaskStatus[Index].usStackHighWaterMark;
+
+        *pBuf++ = ( uint8_t )Number;
+        *pBuf++ = ( uint8_t )ProfTaskStatus[Index].uxCurrentPriority;
+        *pBuf++ = ( uint8_t )ProfTaskStatus[Index].eCurrentState;
+        *pBuf++ = 0U;
+        pBuf = CPU_PROF_Put32( pBuf, RunTime );
+        pBuf = CPU_PROF_Put32( pBuf, MaxLatency );
+        pBuf = CPU_PROF_Put16( pBuf, ( ( uint32_t )StackLeft > 0xFFFFU ) ? 0xFFFFU : ( uint16_t )StackLeft );
+        pBuf = CPU_PROF_Put16( pBuf, ( Share > 1000U ) ? 1000U : ( uint16_t )Share );
+        Entries++;
+    }
+
+    pBuf = &ProfBuffer[CPU_PROF_HEADER_SIZE];
+    pBuf = CPU_PROF_Put32( pBuf, Window );
+    pBuf = CPU_PROF_Put32( pBuf, IsrTime );
+    pBuf = CPU_PROF_Put32( pBuf, CPU_PROF_COUNTER_CLOCK_HZ );
+    pBuf[0] = Entries;
+    pBuf[1] = Flags;
+    pBuf[2] = 0U;
+    pBuf[3] = 0U;
+
+    CPU_PROF_SendRecord( CPU_PROF_RECORD_STATS,
+                         ( uint16_t )( CPU_PROF_STATS_HEADER_SIZE + ( Entries * CPU_PROF_TASK_ENTRY_SIZE ) ) );
+}
+
+/**
+  * @brief  Send the task number to task name mapping
+  * @param  None
+  * @retval None
+  */
+void CPU_PROF_ReportNames( void )
+{
+    UBaseType_t TaskCount, Index;
+    uint8_t *pBuf = &ProfBuffer[CPU_PROF_HEADER_SIZE];
+    const char *pName;
+    uint8_t Length;
+
+    TaskCount = 0;
+
+    if( uxTaskGetNumberOfTasks() <= CPU_PROF_MAX_TASKS )
+    {
+        TaskCount = uxTaskGetSystemState( ProfTaskStatus, CPU_PROF_MAX_TASKS, NULL );
+    }
+
+    if( TaskCount == 0U )
+    {
+        /* Too many tasks, see CPU_PROF_Report() */
+        pBuf[0] = 0U;
+        pBuf[1] = 0U;
+        pBuf += 2U;
+    }
+
+    for( Index = 0; Index < TaskCount; Index++ )
+    {
+        if( ProfTaskStatus[Index].xTaskNumber >= CPU_PROF_MAX_TASKS )
+        {
+            continue;
+        }
+
+        pName = ProfTaskStatus[Index].pcTaskName;
+
+        for( Length = 0; ( Length < configMAX_TASK_NAME_LEN ) && ( pName[Length] != '\0' ); Length++ )
+        {
+            pBuf[2U + Length] = ( uint8_t )pName[Length];
+        }
+
+        pBuf[0] = ( uint8_t )ProfTaskStatus[Index].xTaskNumber;
+        pBuf[1] = Length;
+        pBuf += 2U + Length;
+    }
+
+    CPU_PROF_SendRecord( CPU_PROF_RECORD_NAMES, ( uint16_t )( pBuf - &ProfBuffer[CPU_PROF_HEADER_SIZE] ) );
+}
+
+/**
+  * @brief  Frame the payload already in ProfBuffer and transmit it
+  * @param  Type: record type
+  * @param  Length: payload length in bytes
+  * @retval None
+  */
+static void CPU_PROF_SendRecord( uint8_t Type, uint16_t Length )
+{
+    uint32_t Sum1 = 0, Sum2 = 0;
+    uint32_t Index;
+
+    ProfBuffer[0] = CPU_PROF_SYNC0;
+    ProfBuffer[1] = CPU_PROF_SYNC1;
+    ProfBuffer[2] = Type;
+    ( void )CPU_PROF_Put16( &ProfBuffer[3], Length );
+
+    /* Fletcher-16 over type, length and payload */
+    for( Index = 2U; Index < ( CPU_PROF_HEADER_SIZE + ( uint32_t )Length ); Index++ )
+    {
+        Sum1 = ( Sum1 + ProfBuffer[Index] ) % 255U;
+        Sum2 = ( Sum2 + Sum1 ) % 255U;
+    }
+
+    ( void )CPU_PROF_Put16( &ProfBuffer[Index], ( uint16_t )( ( Sum2 << 8 ) | Sum1 ) );
+
+    CPU_PROF_TRANSMIT( ProfBuffer, ( uint16_t )( Index + CPU_PROF_CHECKSUM_SIZE ) );
+}
+
+/**
+  * @brief  Store a 16-bit value little endian
+  * @param  pBuf: destination
+  * @param  Value: value to store
+  * @retval Pointer past the stored value
+  */
+static uint8_t *CPU_PROF_Put16( uint8_t *pBuf, uint16_t Value )
+{
+    pBuf[0] = ( uint8_t )Value;
+    pBuf[1] = ( uint8_t )( Value >> 8 );
+    return &pBuf[2];
+}
+
+/**
+  * @brief  Store a 32-bit value little endian
+  * @param  pBuf: destination
+  * @param  Value: value to store
+  * @retval Pointer past the stored value
+  */
+static uint8_t *CPU_PROF_Put32( uint8_t *pBuf, uint32_t Value )
+{
+    pBuf[0] = ( uint8_t )Value;
+    pBuf[1] = ( uint8_t )( Value >> 8 );
+    pBuf[2] = ( uint8_t )( Value >> 16 );
+    pBuf[3] = ( uint8_t )( Value >> 24 );
+    return &pBuf[4];
+}
+
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
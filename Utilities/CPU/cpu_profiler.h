@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   Header for cpu_profiler module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_PROFILER_H__
+#define _CPU_PROFILER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "cpu_profiler_conf.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/* Record framing. Every record sent through CPU_PROF_TRANSMIT() is:
+     - 2 sync bytes          : CPU_PROF_SYNC0, CPU_PROF_SYNC1
+     - 1 byte record type    : CPU_PROF_RECORD_STATS or CPU_PROF_RECORD_NAMES
+     - 2 bytes payload length (little endian)
+     - payload
+     - 2 bytes Fletcher-16 checksum of type, length and payload (little endian)
+
+   CPU_PROF_RECORD_STATS payload, all fields little endian:
+     - uint32 window length, in run time counter ticks
+     - uint32 time spent in interrupt handlers during the window
+     - uint32 run time counter frequency in Hz
+     - uint8  number of task entries, uint8 flags, then 2 padding bytes.
+       CPU_PROF_FLAG_TRUNCATED: more than CPU_PROF_MAX_TASKS tasks exist,
+       the task entries are omitted
+     - per task entry (CPU_PROF_TASK_ENTRY_SIZE bytes):
+         uint8  task number, uint8 current priority, uint8 eTaskState, uint8 0
+         uint32 run time during the window, in run time counter ticks
+         uint32 maximum ready latency during the window, in run time counter ticks
+         uint16 stack high water mark, in words
+         uint16 CPU share during the window, in 0.1 %
+
+   CPU_PROF_RECORD_NAMES payload: per task uint8 task number, uint8 name
+   length, then the name characters without terminating null. A single entry
+   with task number 0 means that more than CPU_PROF_MAX_TASKS tasks exist. */
+#define CPU_PROF_SYNC0                  0xA5U
+#define CPU_PROF_SYNC1                  0x5AU
+#define CPU_PROF_RECORD_STATS           0x01U
+#define CPU_PROF_RECORD_NAMES           0x02U
+#define CPU_PROF_HEADER_SIZE            5U
+#define CPU_PROF_CHECKSUM_SIZE          2U
+#define CPU_PROF_STATS_HEADER_SIZE      16U
+#define CPU_PROF_TASK_ENTRY_SIZE        16U
+#define CPU_PROF_FLAG_TRUNCATED         0x01U
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     CPU_PROF_ConfigureTimer( void );
+uint32_t CPU_PROF_GetCounter( void );
+void     CPU_PROF_TickHook( void );
+void     CPU_PROF_TaskReady( void *pxTask, uint32_t Number );
+void     CPU_PROF_TaskSwitchedIn( uint32_t Number );
+void     CPU_PROF_ISR_Enter( void );
+void     CPU_PROF_ISR_Exit( void );
+void     CPU_PROF_Report( void );
+void     CPU_PROF_ReportNames( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CPU_PROFILER_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file    cpu_profiler_conf_template.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   cpu_profiler configuration template file.
+  *          This file should be copied to the application folder and modified
+  *          as follows:
+  *            - Rename it to 'cpu_profiler_conf.h'.
+  *            - Select the timer used as run time counter and its clock.
+  *            - Update CPU_PROF_TRANSMIT() with the UART or USB CDC transmit
+  *              function used to export the profiling records.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef  __CPU_PROFILER_CONF_H__
+#define  __CPU_PROFILER_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l0xx_hal.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Maximum number of tasks reported. Tasks are identified by the number
+   FreeRTOS assigns at their creation (TaskStatus_t xTaskNumber), tasks
+   numbered CPU_PROF_MAX_TASKS or above are not reported. No task is reported
+   while more than CPU_PROF_MAX_TASKS tasks exist. */
+#define CPU_PROF_MAX_TASKS              16U
+
+/* Define CPU_PROF_USE_LPTIM to count with LPTIM1 instead of a general purpose
+   TIM. The LPTIM keeps counting in Stop mode when clocked from LSE/LSI. */
+/* #define CPU_PROF_USE_LPTIM */
+
+#if defined(CPU_PROF_USE_LPTIM)
+#define CPU_PROF_TIMER                  LPTIM1
+#define CPU_PROF_TIMER_CLK_ENABLE()     __HAL_RCC_LPTIM1_CLK_ENABLE()
+#define CPU_PROF_LPTIM_CLOCK_SOURCE     LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC
+#define CPU_PROF_LPTIM_PRESCALER        LPTIM_PRESCALER_DIV128
+/* Frequency of the LPTIM1 kernel clock selected in RCC by LPTIM1SEL: APB1 by
+   default, LSE_VALUE, LSI_VALUE or HSI_VALUE otherwise. */
+#define CPU_PROF_LPTIM_CLOCK_HZ         HAL_RCC_GetPCLK1Freq()
+#else
+#define CPU_PROF_TIMER                  TIM2
+#define CPU_PROF_TIMER_CLK_ENABLE()     __HAL_RCC_TIM2_CLK_ENABLE()
+#define CPU_PROF_TIM_PRESCALER          ((SystemCoreClock / CPU_PROF_COUNTER_CLOCK_HZ) - 1U)
+#endif
+
+/* Frequency of the run time counter, exported in the statistics records.
+   10 to 100 times the tick rate is a good compromise between resolution and
+   the 16-bit counter wrap period. The LPTIM prescaler is a power of two, so
+   with the LPTIM the frequency follows from its clock and its prescaler:
+   250 kHz with APB1 at 32 MHz and LPTIM_PRESCALER_DIV128, 256 Hz with the LSE
+   and the same prescaler. */
+#if defined(CPU_PROF_USE_LPTIM)
+#define CPU_PROF_COUNTER_CLOCK_HZ       (CPU_PROF_LPTIM_CLOCK_HZ >> (CPU_PROF_LPTIM_PRESCALER >> LPTIM_CFGR_PRESC_Pos))
+#else
+#define CPU_PROF_COUNTER_CLOCK_HZ       100000U
+#endif
+
+/* Function used to export the profiling records, for instance
+   HAL_UART_Transmit(&huart2, (pBuf), (Len), 100U) or CDC_Transmit_FS((pBuf), (Len)) */
+#define CPU_PROF_TRANSMIT(pBuf, Len)    HAL_UART_Transmit(&huart2, (pBuf), (Len), 100U)
+
+extern UART_HandleTypeDef huart2;
+
+#endif /* __CPU_PROFILER_CONF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   Lightweight event trace recorder for FreeRTOS, storing timestamped
+  *          binary events in a RAM ring buffer
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- copy cpu_trace_conf_template.h to the application as cpu_trace_conf.h and
+   select the timestamp source and the transmit function.
+
+2- in the _OS_Config.h file (ex. FreeRTOSConfig.h) enable the following macro :
+      - #define configUSE_TRACE_FACILITY   1
+   and include cpu_trace.h at the end of the file :
+      - #include "cpu_trace.h"
+   This defines the traceXXX() macros for task switches, ready events, queue,
+   semaphore and mutex operations and priority inheritance. The macros must
+   not be defined elsewhere (cpu_utils and cpu_profiler hooks included).
+
+3- optionally call CPU_TRACE_ISR_ENTER() and CPU_TRACE_ISR_EXIT() at the start
+   and end of the interrupt handlers to trace, and CPU_TRACE_USER() to mark
+   application events.
+
+4- call CPU_TRACE_Start() to start recording and CPU_TRACE_Dump() to send the
+   recorded events. Decode the dump on the host with cpu_trace_decode.py.
+
+Recording one event masks the interrupts for a few cycles: one timestamp read
+and two word stores in the ring buffer.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "cpu_trace.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define CPU_TRACE_NAME_LEN      16U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void CPU_TRACE_SendNames( const char *pNames, const uint8_t *pNumbers, uint32_t Count );
+
+/* Private variables ---------------------------------------------------------*/
+uint32_t           CPU_TraceBuffer[2U * CPU_TRACE_BUFFER_EVENTS];
+volatile uint32_t  CPU_TraceCount = 0;
+volatile uint32_t  CPU_TraceEnabled = 0;
+uint32_t           CPU_TraceQueueCount = 0;
+
+static char        TraceTaskNames[CPU_TRACE_MAX_TASKS][CPU_TRACE_NAME_LEN];
+static uint8_t     TraceTaskNumbers[CPU_TRACE_MAX_TASKS];
+static uint32_t    TraceTaskCount = 0;
+static char        TraceQueueNames[CPU_TRACE_MAX_QUEUES][CPU_TRACE_NAME_LEN];
+static uint8_t     TraceQueueNumbers[CPU_TRACE_MAX_QUEUES];
+static uint32_t    TraceQueueNameCount = 0;
+
+static uint8_t     TraceHeader[CPU_TRACE_DUMP_HEADER_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Clear the buffer and start recording
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Start( void )
+{
+    CPU_TraceEnabled = 0U;
+    CPU_TraceCount = 0U;
+    CPU_TraceEnabled = 1U;
+}
+
+/**
+  * @brief  Stop recording, the buffer content is kept
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Stop( void )
+{
+    CPU_TraceEnabled = 0U;
+}
+
+/**
+  * @brief  Keep the name of a task for the dump, called on task creation
+  * @param  Number: task number
+  * @param  pName: task name
+  * @retval None
+  */
+void CPU_TRACE_TaskName( uint32_t Number, const char *pName )
+{
+    if( TraceTaskCount < CPU_TRACE_MAX_TASKS )
+    {
+        TraceTaskNumbers[TraceTaskCount] = ( uint8_t )Number;
+        strncpy( TraceTaskNames[TraceTaskCount], pName, CPU_TRACE_NAME_LEN );
+        TraceTaskCount++;
+    }
+}
+
+/**
+  * @brief  Keep the name of a queue for the dump, called when the queue is
+  *         added to the queue registry
+  * @param  Number: queue number
+  * @param  pName: queue name
+  * @retval None
+  */
+void CPU_TRACE_QueueName( uint32_t Number, const char *pName )
+{
+    if( ( TraceQueueNameCount < CPU_TRACE_MAX_QUEUES ) && ( pName != NULL ) )
+    {
+        TraceQueueNumbers[TraceQueueNameCount] = ( uint8_t )Number;
+        strncpy( TraceQueueNames[TraceQueueNameCount], pName, CPU_TRACE_NAME_LEN );
+        TraceQueueNameCount++;
+    }
+}
+
+/**
+  * @brief  Send the recorded events, oldest first, and the object names.
+  *         Recording is suspended during the dump.
+  * @param  None
+  * @retval None
+  */
+void CPU_TRACE_Dump( void )
+{
+    uint32_t Enabled = CPU_TraceEnabled;
+    uint32_t Count, First, Index;
+
+    CPU_TraceEnabled = 0U;
+
+    Count = ( CPU_TraceCount < CPU_TRACE_BUFFER_EVENTS ) ? CPU_TraceCount : CPU_TRACE_BUFFER_EVENTS;
+    First = ( CPU_TraceCount - Count ) & ( CPU_TRACE_BUFFER_EVENTS - 1U );
+
+    TraceHeader[0] = 'C';
+    TraceHeader[1] = 'T';
+    TraceHeader[2] = 'R';
+    TraceHeader[3] = 'C';
+    TraceHeader[4] = CPU_TRACE_DUMP_VERSION;
+    TraceHeader[5] = CPU_TRACE_TIMESTAMP_BITS;
+    TraceHeader[6] = CPU_TRACE_EVENT_SIZE;
+    TraceHeader[7] = 0U;
+
+    for( Index = 0; Index < 4U; Index++ )
+    {
+        TraceHeader[8U + Index] = ( uint8_t )( ( uint32_t )CPU_TRACE_TIMESTAMP_HZ >> ( 8U * Index ) );
+        TraceHeader[12U + Index] = ( uint8_t )( CPU_TraceCount >> ( 8U * Index ) );
+        TraceHeader[16U + Index] = ( uint8_t )( Count >> ( 8U * Index ) );
+    }
+
+    CPU_TRACE_TRANSMIT( TraceHeader, CPU_TRACE_DUMP_HEADER_SIZE );
+
+    /* The events are stored as little endian words, the buffer is sent as is
+       in at most two parts when it has wrapped. */
+    if( ( First + Count ) > CPU_TRACE_BUFFER_EVENTS )
+    {
+        CPU_TRACE_TRANSMIT( ( uint8_t * )&CPU_TraceBuffer[2U * First],
+                            ( uint16_t )( ( CPU_TRACE_BUFFER_EVENTS - First ) * CPU_TRACE_EVENT_SIZE ) );
+        Count -= CPU_TRACE_BUFFER_EVENTS - First;
+        First = 0U;
+    }
+
+    if( Count != 0U )
+    {
+        CPU_TRACE_TRANSMIT( ( uint8_t * )&CPU_TraceBuffer[2U * First], ( uint16_t )( Count * CPU_TRACE_EVENT_SIZE ) );
+    }
+
+    CPU_TRACE_SendNames( &TraceTaskNames[0][0], TraceTaskNumbers, TraceTaskCount );
+    CPU_TRACE_SendNames( &TraceQueueNames[0][0], TraceQueueNumbers, TraceQueueNameCount );
+
+    CPU_TraceEnabled = Enabled;
+}
+
+/**
+  * @brief  Send a name table
+  * @param  pNames: CPU_TRACE_NAME_LEN bytes per name, not always null terminated
+  * @param  pNumbers: object numbers
+  * @param  Count: number of names
+  * @retval None
+  */
+static void CPU_TRACE_SendNames( const char *pNames, const uint8_t *pNumbers, uint32_t Count )
+{
+    uint8_t Entry[2U + CPU_TRACE_NAME_LEN];
+    uint32_t Index, Length;
+
+    Entry[0] = ( uint8_t )Count;
+    CPU_TRACE_TRANSMIT( Entry, 1U );
+
+    for( Index = 0; Index < Count; Index++ )
+    {
+        for( Length = 0; ( Length < CPU_TRACE_NAME_LEN ) && ( pNames[Length] != '\0' ); Length++ )
+        {
+            Entry[2U + Length] = ( uint8_t )pNames[Length];
+        }
+
+        Entry[0] = pNumbers[Index];
+        Entry[1] = ( uint8_t )Length;
+        CPU_TRACE_TRANSMIT( Entry, ( uint16_t )( 2U + Length ) );
+        pNames += CPU_TRACE_NAME_LEN;
+    }
+}
+
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   Header for cpu_trace module. Also implements the FreeRTOS trace
+  *          macros when included at the end of FreeRTOSConfig.h
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CPU_TRACE_H__
+#define _CPU_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "cpu_trace_conf.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Event identifiers. Each event is stored as two 32-bit words:
+     - word 0 : timestamp (CPU_TRACE_TIMESTAMP())
+     - word 1 : bits 0-7 event identifier, bits 8-15 object number
+                (task number, queue number or IRQ number), bits 16-31 parameter */
+#define CPU_TRACE_EVT_TASK_SWITCHED_IN      0x01U   /* task, priority         */
+#define CPU_TRACE_EVT_TASK_READY            0x02U   /* task                   */
+#define CPU_TRACE_EVT_TASK_CREATE           0x03U   /* task, priority         */
+#define CPU_TRACE_EVT_TASK_DELETE           0x04U   /* task                   */
+#define CPU_TRACE_EVT_TASK_DELAY            0x05U   /* running task           */
+#define CPU_TRACE_EVT_TASK_PRIO_INHERIT     0x06U   /* task, new priority     */
+#define CPU_TRACE_EVT_TASK_PRIO_DISINHERIT  0x07U   /* task, new priority     */
+#define CPU_TRACE_EVT_ISR_ENTER             0x10U   /* IRQ number + 16 (IPSR) */
+#define CPU_TRACE_EVT_ISR_EXIT              0x11U   /* IRQ number + 16 (IPSR) */
+#define CPU_TRACE_EVT_TICK                  0x12U   /* -, tick count low bits */
+#define CPU_TRACE_EVT_QUEUE_CREATE          0x20U   /* queue, queue type      */
+#define CPU_TRACE_EVT_QUEUE_SEND            0x21U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_SEND_FAILED     0x22U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_RECEIVE         0x23U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_RECEIVE_FAILED  0x24U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_SEND_ISR        0x25U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_RECEIVE_ISR     0x26U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_BLOCK_SEND      0x27U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_QUEUE_BLOCK_RECEIVE   0x28U   /* queue, items waiting   */
+#define CPU_TRACE_EVT_USER                  0x80U   /* user defined           */
+
+/* Dump layout, all fields little endian:
+     - 4 bytes magic "CTRC", uint8 version, uint8 timestamp bits,
+       uint16 event size in bytes, uint32 timestamp frequency in Hz,
+       uint32 number of events recorded, uint32 number of events in the dump
+     - events, oldest first
+     - uint8 number of task names, then uint8 task number, uint8 name length
+       and the name characters for each task
+     - uint8 number of queue names, then uint8 queue number, uint8 name length
+       and the name characters for each queue */
+#define CPU_TRACE_DUMP_VERSION              1U
+#define CPU_TRACE_DUMP_HEADER_SIZE          20U
+#define CPU_TRACE_EVENT_SIZE                8U
+
+#if ((CPU_TRACE_BUFFER_EVENTS & (CPU_TRACE_BUFFER_EVENTS - 1U)) != 0U)
+#error "CPU_TRACE_BUFFER_EVENTS must be a power of 2"
+#endif
+
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+
+/* Exported variables --------------------------------------------------------*/
+extern uint32_t          CPU_TraceBuffer[2U * CPU_TRACE_BUFFER_EVENTS];
+extern volatile uint32_t CPU_TraceCount;
+extern volatile uint32_t CPU_TraceEnabled;
+extern uint32_t          CPU_TraceQueueCount;
+
+/* Exported functions ------------------------------------------------------- */
+void CPU_TRACE_Start( void );
+void CPU_TRACE_Stop( void );
+void CPU_TRACE_Dump( void );
+void CPU_TRACE_TaskName( uint32_t Number, const char *pName );
+void CPU_TRACE_QueueName( uint32_t Number, const char *pName );
+
+/**
+  * @brief  Append one event to the ring buffer
+  * @param  Info: event identifier, object number and parameter, see above
+  * @retval None
+  */
+__STATIC_INLINE void CPU_TRACE_Record( uint32_t Info )
+{
+    uint32_t PriMask;
+    uint32_t Index;
+
+    if( CPU_TraceEnabled != 0U )
+    {
+        PriMask = __get_PRIMASK();
+        __disable_irq();
+
+#if (CPU_TRACE_STOP_WHEN_FULL == 1U)
+        if( CPU_TraceCount >= CPU_TRACE_BUFFER_EVENTS )
+        {
+            CPU_TraceEnabled = 0U;
+        }
+        else
+#endif
+        {
+            Index = ( CPU_TraceCount & ( CPU_TRACE_BUFFER_EVENTS - 1U ) ) * 2U;
+            CPU_TraceCount++;
+            CPU_TraceBuffer[Index] = ( uint32_t )CPU_TRACE_TIMESTAMP();
+            CPU_TraceBuffer[Index + 1U] = Info;
+        }
+
+        __set_PRIMASK( PriMask );
+    }
+}
+
+#endif /* __ICCARM__ || __CC_ARM || __GNUC__ */
+
+/* Exported macro ------------------------------------------------------------*/
+#define CPU_TRACE_EVENT(Event, Number, Param)                                   \
+    CPU_TRACE_Record( ( uint32_t )( Event ) |                                   \
+                      ( ( uint32_t )( uint8_t )( Number ) << 8 ) |              \
+                      ( ( uint32_t )( uint16_t )( Param ) << 16 ) )
+
+#define CPU_TRACE_ISR_ENTER()   CPU_TRACE_EVENT( CPU_TRACE_EVT_ISR_ENTER, __get_IPSR(), 0U )
+#define CPU_TRACE_ISR_EXIT()    CPU_TRACE_EVENT( CPU_TRACE_EVT_ISR_EXIT, __get_IPSR(), 0U )
+#define CPU_TRACE_USER(Number, Param) CPU_TRACE_EVENT( CPU_TRACE_EVT_USER, ( Number ), ( Param ) )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CPU_TRACE_H__ */
+
+/* FreeRTOS trace macros. They are only defined when this file is included
+   from FreeRTOSConfig.h, and are expanded inside tasks.c and queue.c where the
+   task and queue structures are visible. configUSE_TRACE_FACILITY must be 1.
+   They are kept out of the _CPU_TRACE_H__ guard so that they are still
+   defined when this file was included before FreeRTOS.h. */
+#if defined(INC_FREERTOS_H) && !defined(_CPU_TRACE_HOOKS__) && (defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__))
+#define _CPU_TRACE_HOOKS__
+
+#define traceTASK_SWITCHED_IN()                                                 \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber, pxCurrentTCB->uxPriority )
+
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )                                 \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_READY, ( pxTCB )->uxTCBNumber, 0U )
+
+#define traceTASK_CREATE( pxNewTCB )                                            \
+    do {                                                                        \
+        CPU_TRACE_TaskName( ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName ); \
+        CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_CREATE, ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->uxPriority ); \
+    } while( 0 )
+
+#define traceTASK_DELETE( pxTCB )                                               \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_DELETE, ( pxTCB )->uxTCBNumber, 0U )
+
+#define traceTASK_DELAY()                                                       \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_DELAY, pxCurrentTCB->uxTCBNumber, 0U )
+
+#define traceTASK_DELAY_UNTIL( x )                                              \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_DELAY, pxCurrentTCB->uxTCBNumber, 0U )
+
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )  \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_PRIO_INHERIT, ( pxTCBOfMutexHolder )->uxTCBNumber, ( uxInheritedPriority ) )
+
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TASK_PRIO_DISINHERIT, ( pxTCBOfMutexHolder )->uxTCBNumber, ( uxOriginalPriority ) )
+
+#if (CPU_TRACE_TICK_EVENTS == 1U)
+#define traceTASK_INCREMENT_TICK( xTickCount )                                  \
+    CPU_TRACE_EVENT( CPU_TRACE_EVT_TICK, 0U, ( xTickCount ) )
+#endif
+
+/* Queues are numbered in creation order, number 0 means not numbered. */
+#define traceQUEUE_CREATE( pxNewQueue )                                         \
+    do {                                                                        \
+        ( pxNewQueue )->uxQueueNumber = ++CPU_TraceQueueCount;                  \
+        CPU_TRACE_EVENT( CPU_TRACE_EVT_QUEUE_CREATE, ( pxNewQueue )->uxQueueNumber, ( pxNewQueue )->ucQueueType ); \
+    } while( 0 )
+
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )                          \
+    CPU_TRACE_QueueName( ( xQueue )->uxQueueNumber, ( pcQueueName ) )
+
+#define CPU_TRACE_QUEUE_EVENT( Event, pxQueue )                                 \
+    CPU_TRACE_EVENT( ( Event ), ( pxQueue )->uxQueueNumber, ( pxQueue )->uxMessagesWaiting )
+
+#define traceQUEUE_SEND( pxQueue )                 CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_SEND, pxQueue )
+#define traceQUEUE_SEND_FAILED( pxQueue )          CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_SEND_FAILED, pxQueue )
+#define traceQUEUE_RECEIVE( pxQueue )              CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_RECEIVE, pxQueue )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )       CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_RECEIVE_FAILED, pxQueue )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )        CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_SEND_ISR, pxQueue )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )     CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_RECEIVE_ISR, pxQueue )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )     CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_BLOCK_SEND, pxQueue )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )  CPU_TRACE_QUEUE_EVENT( CPU_TRACE_EVT_QUEUE_BLOCK_RECEIVE, pxQueue )
+
+#endif /* INC_FREERTOS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
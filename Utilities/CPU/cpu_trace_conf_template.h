@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    cpu_trace_conf_template.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-October-2026
+  * @brief   cpu_trace configuration template file.
+  *          This file should be copied to the application folder and modified
+  *          as follows:
+  *            - Rename it to 'cpu_trace_conf.h'.
+  *            - Select the timestamp source and its frequency.
+  *            - Update CPU_TRACE_TRANSMIT() with the UART or USB CDC transmit
+  *              function used to dump the trace.
+  *          This file is included from FreeRTOSConfig.h, it must not include
+  *          any FreeRTOS header.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef  __CPU_TRACE_CONF_H__
+#define  __CPU_TRACE_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l0xx.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Number of events held in the ring buffer, must be a power of 2.
+   Each event takes 8 bytes of RAM. */
+#define CPU_TRACE_BUFFER_EVENTS         256U
+
+/* Set to 1 to stop recording when the buffer is full (first events kept),
+   0 to overwrite the oldest events (last events kept). */
+#define CPU_TRACE_STOP_WHEN_FULL        0U
+
+/* Number of task names and queue names kept for the dump. */
+#define CPU_TRACE_MAX_TASKS             16U
+#define CPU_TRACE_MAX_QUEUES            16U
+
+/* Set to 1 to record an event on each tick. Needed with a 16-bit timestamp
+   when the application can run for a full timer period without any event. */
+#define CPU_TRACE_TICK_EVENTS           0U
+
+/* Timestamp source, read once per event. A free running timer counter is the
+   cheapest source on Cortex-M0+. CPU_TRACE_TIMESTAMP_BITS tells the decoder
+   how the value wraps. The timer must be configured and started by the
+   application. */
+#define CPU_TRACE_TIMESTAMP()           (TIM2->CNT)
+#define CPU_TRACE_TIMESTAMP_BITS        16U
+#define CPU_TRACE_TIMESTAMP_HZ          1000000U
+
+/* Function used to dump the trace, for instance
+   HAL_UART_Transmit(&huart2, (pBuf), (Len), 1000U) or CDC_Transmit_FS((pBuf), (Len)) */
+#define CPU_TRACE_TRANSMIT(pBuf, Len)   CPU_TRACE_UartTransmit((pBuf), (Len))
+
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+extern void CPU_TRACE_UartTransmit(uint8_t *pBuf, uint16_t Len);
+#endif
+
+#endif /* __CPU_TRACE_CONF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
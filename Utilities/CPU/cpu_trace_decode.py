@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+#
+# Host side decoder for the dumps produced by CPU_TRACE_Dump() (cpu_trace.c).
+#
+# Reconstructs the timeline of task switches, interrupts and queue operations
+# and prints per task run time, ready latency and activation period
+# histograms, interrupt durations and queue/mutex contention.
+#
+# Usage: cpu_trace_decode.py dump.bin [--timeline] [--csv timeline.csv]
+#
+
+import argparse
+import struct
+import sys
+
+EVT_TASK_SWITCHED_IN     = 0x01
+EVT_TASK_READY           = 0x02
+EVT_TASK_CREATE          = 0x03
+EVT_TASK_DELETE          = 0x04
+EVT_TASK_DELAY           = 0x05
+EVT_TASK_PRIO_INHERIT    = 0x06
+EVT_TASK_PRIO_DISINHERIT = 0x07
+EVT_ISR_ENTER            = 0x10
+EVT_ISR_EXIT             = 0x11
+EVT_TICK                 = 0x12
+EVT_QUEUE_CREATE         = 0x20
+EVT_QUEUE_SEND           = 0x21
+EVT_QUEUE_SEND_FAILED    = 0x22
+EVT_QUEUE_RECEIVE        = 0x23
+EVT_QUEUE_RECEIVE_FAILED = 0x24
+EVT_QUEUE_SEND_ISR       = 0x25
+EVT_QUEUE_RECEIVE_ISR    = 0x26
+EVT_QUEUE_BLOCK_SEND     = 0x27
+EVT_QUEUE_BLOCK_RECEIVE  = 0x28
+EVT_USER                 = 0x80
+
+EVENT_NAMES = {
+    EVT_TASK_SWITCHED_IN:     "switched in",
+    EVT_TASK_READY:           "ready",
+    EVT_TASK_CREATE:          "created",
+    EVT_TASK_DELETE:          "deleted",
+    EVT_TASK_DELAY:           "delay",
+    EVT_TASK_PRIO_INHERIT:    "priority inherit",
+    EVT_TASK_PRIO_DISINHERIT: "priority disinherit",
+    EVT_ISR_ENTER:            "isr enter",
+    EVT_ISR_EXIT:             "isr exit",
+    EVT_TICK:                 "tick",
+    EVT_QUEUE_CREATE:         "create",
+    EVT_QUEUE_SEND:           "send",
+    EVT_QUEUE_SEND_FAILED:    "send failed",
+    EVT_QUEUE_RECEIVE:        "receive",
+    EVT_QUEUE_RECEIVE_FAILED: "receive failed",
+    EVT_QUEUE_SEND_ISR:       "send from isr",
+    EVT_QUEUE_RECEIVE_ISR:    "receive from isr",
+    EVT_QUEUE_BLOCK_SEND:     "blocked on send",
+    EVT_QUEUE_BLOCK_RECEIVE:  "blocked on receive",
+    EVT_USER:                 "user",
+}
+
+# ucQueueType values from queue.h
+QUEUE_TYPES = {0: "queue", 1: "mutex", 2: "counting semaphore", 3: "binary semaphore", 4: "recursive mutex"}
+MUTEX_TYPES = (1, 4)
+
+HEADER = struct.Struct("<4sBBHIII")
+
+
+class Histogram(object):
+    """Power of two bucketed histogram of durations in microseconds."""
+
+    def __init__(self):
+        self.values = []
+
+    def add(self, value):
+        self.values.append(value)
+
+    def summary(self):
+        v = self.values
+        return "n={0} min={1:.1f} avg={2:.1f} max={3:.1f} us".format(len(v), min(v), sum(v) / len(v), max(v))
+
+    def lines(self, indent="      "):
+        buckets = {}
+        for value in self.values:
+            upper = 1
+            while upper < value:
+                upper *= 2
+            buckets[upper] = buckets.get(upper, 0) + 1
+        width = max(buckets.values())
+        out = []
+        for upper in sorted(buckets):
+            bar = "#" * max(1, (40 * buckets[upper]) // width)
+            out.append("{0}<= {1:>8} us {2:>6} {3}".format(indent, upper, buckets[upper], bar))
+        return out
+
+
+def read_names(data, offset):
+    count = data[offset]
+    offset += 1
+    names = {}
+    for _ in range(count):
+        number, length = data[offset], data[offset + 1]
+        names[number] = data[offset + 2:offset + 2 + length].decode("ascii", "replace")
+        offset += 2 + length
+    return names, offset
+
+
+def parse(data):
+    magic, version, ts_bits, event_size, ts_hz, recorded, count = HEADER.unpack_from(data, 0)
+    if magic != b"CTRC":
+        raise ValueError("not a cpu_trace dump")
+    if version != 1 or event_size != 8:
+        raise ValueError("unsupported dump version {0}".format(version))
+
+    offset = HEADER.size
+    events = []
+    ts_mask = (1 << ts_bits) - 1
+    last_raw = None
+    time = 0
+    for _ in range(count):
+        raw, info = struct.unpack_from("<II", data, offset)
+        offset += event_size
+        raw &= ts_mask
+        # Timestamps are unwrapped assuming consecutive events are less than
+        # one timer period apart.
+        if last_raw is not None:
+            time += (raw - last_raw) & ts_mask
+        last_raw = raw
+        events.append((time * 1e6 / ts_hz, info & 0xFF, (info >> 8) & 0xFF, info >> 16))
+
+    task_names, offset = read_names(data, offset)
+    queue_names, offset = read_names(data, offset)
+    return {"recorded": recorded, "events": events, "tasks": task_names, "queues": queue_names}
+
+
+def task_name(trace, number):
+    return trace["tasks"].get(number, "task#{0}".format(number))
+
+
+def queue_name(trace, number, types):
+    name = trace["queues"].get(number, "#{0}".format(number))
+    return "{0} {1}".format(QUEUE_TYPES.get(types.get(number), "queue"), name)
+
+
+def describe(trace, event, types):
+    time, evt, number, param = event
+    text = EVENT_NAMES.get(evt, "event 0x{0:02X}".format(evt))
+    if evt < EVT_ISR_ENTER:
+        obj = task_name(trace, number)
+    elif evt in (EVT_ISR_ENTER, EVT_ISR_EXIT):
+        obj = "IRQ{0}".format(number - 16)
+    elif EVT_QUEUE_CREATE <= evt <= EVT_QUEUE_BLOCK_RECEIVE:
+        obj = queue_name(trace, number, types)
+    else:
+        obj = "#{0}".format(number)
+    return "{0:12.1f} us  {1:<24} {2:<20} {3}".format(time, obj, text, param)
+
+
+def analyse(trace, out):
+    events = trace["events"]
+    if not events:
+        out.write("no events\n")
+        return
+
+    start, end = events[0][0], events[-1][0]
+    span = max(end - start, 1e-9)
+
+    run_time = {}
+    switches = {}
+    latency = {}
+    period = {}
+    ready_at = {}
+    last_activation = {}
+    isr_time = {}
+    isr_stack = []
+    queue_ops = {}
+    types = {}
+    current = None
+    current_since = start
+
+    for time, evt, number, param in events:
+        if evt == EVT_TASK_SWITCHED_IN:
+            if current is not None:
+                run_time[current] = run_time.get(current, 0.0) + time - current_since
+            current, current_since = number, time
+            switches[number] = switches.get(number, 0) + 1
+            if number in ready_at:
+                latency.setdefault(number, Histogram()).add(time - ready_at.pop(number))
+                if number in last_activation:
+                    period.setdefault(number, Histogram()).add(time - last_activation[number])
+                last_activation[number] = time
+        elif evt == EVT_TASK_READY:
+            ready_at.setdefault(number, time)
+        elif evt == EVT_ISR_ENTER:
+            isr_stack.append((number, time))
+        elif evt == EVT_ISR_EXIT:
+            if isr_stack and isr_stack[-1][0] == number:
+                isr_time.setdefault(number, Histogram()).add(time - isr_stack.pop()[1])
+        elif evt == EVT_QUEUE_CREATE:
+            types[number] = param
+        elif EVT_QUEUE_SEND <= evt <= EVT_QUEUE_BLOCK_RECEIVE:
+            ops = queue_ops.setdefault(number, {})
+            ops[evt] = ops.get(evt, 0) + 1
+
+    if current is not None:
+        run_time[current] = run_time.get(current, 0.0) + end - current_since
+
+    out.write("{0} events decoded ({1} recorded), {2:.1f} us\n\n".format(len(events), trace["recorded"], span))
+
+    out.write("Tasks\n")
+    for number in sorted(set(run_time) | set(switches)):
+        out.write("  {0:<20} run {1:6.2f} %  switched in {2} times\n".format(
+            task_name(trace, number), 100.0 * run_time.get(number, 0.0) / span, switches.get(number, 0)))
+        if number in latency:
+            out.write("    ready latency     {0}\n".format(latency[number].summary()))
+            for line in latency[number].lines():
+                out.write(line + "\n")
+        if number in period:
+            out.write("    activation period {0}\n".format(period[number].summary()))
+
+    if isr_time:
+        out.write("\nInterrupts\n")
+        for number in sorted(isr_time):
+            total = sum(isr_time[number].values)
+            out.write("  IRQ{0:<4} {1:6.2f} %  {2}\n".format(number - 16, 100.0 * total / span, isr_time[number].summary()))
+
+    if queue_ops:
+        out.write("\nQueues, semaphores and mutexes\n")
+        for number in sorted(queue_ops):
+            ops = queue_ops[number]
+            out.write("  {0:<32} send {1} receive {2} failed {3} blocked {4}".format(
+                queue_name(trace, number, types),
+                ops.get(EVT_QUEUE_SEND, 0) + ops.get(EVT_QUEUE_SEND_ISR, 0),
+                ops.get(EVT_QUEUE_RECEIVE, 0) + ops.get(EVT_QUEUE_RECEIVE_ISR, 0),
+                ops.get(EVT_QUEUE_SEND_FAILED, 0) + ops.get(EVT_QUEUE_RECEIVE_FAILED, 0),
+                ops.get(EVT_QUEUE_BLOCK_SEND, 0) + ops.get(EVT_QUEUE_BLOCK_RECEIVE, 0)))
+            if types.get(number) in MUTEX_TYPES and ops.get(EVT_QUEUE_BLOCK_RECEIVE, 0):
+                out.write("  <- contended")
+            out.write("\n")
+
+    return types
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a cpu_trace dump")
+    parser.add_argument("dump", help="binary dump received from CPU_TRACE_Dump()")
+    parser.add_argument("--timeline", action="store_true", help="print every event")
+    parser.add_argument("--csv", help="write the timeline to a CSV file")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        trace = parse(f.read())
+
+    types = analyse(trace, sys.stdout) or {}
+
+    if args.timeline:
+        sys.stdout.write("\nTimeline\n")
+        for event in trace["events"]:
+            sys.stdout.write(describe(trace, event, types) + "\n")
+
+    if args.csv:
+        with open(args.csv, "w") as f:
+            f.write("time_us,event,object,param\n")
+            for time, evt, number, param in trace["events"]:
+                f.write("{0:.3f},{1},{2},{3}\n".format(time, EVENT_NAMES.get(evt, evt), number, param))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
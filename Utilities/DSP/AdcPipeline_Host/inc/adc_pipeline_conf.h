@@ -0,0 +1,22 @@
+/*
+ * adc_pipeline configuration of the host simulation: the half buffer
+ * notifications are counted, and the cycles are nanoseconds of the host
+ * monotonic clock.
+ */
+
+#ifndef  __ADC_PIPELINE_CONF_H__
+#define  __ADC_PIPELINE_CONF_H__
+
+#include <stdint.h>
+
+#define __IO                            volatile
+#define __weak                          __attribute__((weak))
+#define UNUSED(X)                       (void)X
+
+extern uint32_t sim_notifications;
+uint32_t sim_get_cycles( void );
+
+#define ADC_PIPE_NOTIFY(hpipe)          ( sim_notifications++ )
+#define ADC_PIPE_GET_CYCLES()           sim_get_cycles()
+
+#endif /* __ADC_PIPELINE_CONF_H__ */
@@ -0,0 +1,670 @@
+/*
+ * Host simulation of the adc_pipeline module.
+ *
+ * A simulated DMA writes synthetic 12-bit ADC codes into the two halves of
+ * the circular buffer and calls the half transfer and transfer complete
+ * callbacks, while the simulated application calls ADC_PIPE_Process() on a
+ * schedule that depends on the scenario: after every half buffer, late, with
+ * the DMA interrupt preempting the processing, with missed callbacks, or at
+ * random. The pipeline runs the convert, biquad (50 Hz and 150 Hz notches),
+ * decimate by 4, FIR and statistics stages.
+ *
+ * Each scenario checks that:
+ *   - the outputs are bit exact with the same CMSIS-DSP functions applied out
+ *     of place, with their own instances, to the half buffers the pipeline
+ *     processed, in the same order,
+ *   - the outputs are at the start of their half buffer (zero copy),
+ *   - the number of dropped half buffers is the expected one, and every
+ *     completed half buffer is either output or counted in Overruns,
+ *   - the statistics and the cycle accounting are consistent.
+ *
+ * Without --quick, the cycle accounting of the nominal scenario is printed:
+ * nanoseconds of the host per half buffer and per input sample for each stage.
+ *
+ * Usage: AdcPipelineSim_Host [--quick] [--halves N] [--seed N]
+ *   --quick    200 half buffers per scenario (used by ctest)
+ *   --halves N half buffers per scenario, 3000 by default
+ *   --seed N   seed of the noise and of the random scenario
+ *
+ * The program returns 1 when a check fails.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "adc_pipeline.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Configuration */
+/*--------------------------------------------------------------------------------*/
+
+#define SIM_FS              16000.0   /* ADC sampling frequency, Hz */
+#define SIM_BITS            12U       /* ADC resolution */
+#define SIM_LENGTH          512U      /* DMA buffer, samples */
+#define SIM_HALF            ( SIM_LENGTH / 2U )
+#define SIM_M               4U        /* Decimation factor */
+#define SIM_OUT             ( SIM_HALF / SIM_M )
+#define SIM_DEC_TAPS        32U
+#define SIM_FIR_TAPS        16U
+#define SIM_NOTCHES         2U
+#define SIM_MAX_HALVES      100000U
+
+static uint32_t sim_halves = 3000;
+static uint32_t sim_seed = 1;
+static int      sim_quick = 0;
+static uint32_t sim_failures = 0;
+
+uint32_t sim_notifications = 0;
+
+/*--------------------------------------------------------------------------------*/
+/* Clock and random numbers */
+/*--------------------------------------------------------------------------------*/
+
+uint32_t sim_get_cycles( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( uint32_t ) ( ( ( uint64_t ) ts.tv_sec * 1000000000U ) + ( uint64_t ) ts.tv_nsec );
+}
+
+static uint32_t sim_rand_state;
+
+static uint32_t sim_rand( void )
+{
+    /* xorshift32 */
+    sim_rand_state ^= sim_rand_state << 13;
+    sim_rand_state ^= sim_rand_state >> 17;
+    sim_rand_state ^= sim_rand_state << 5;
+    return sim_rand_state;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Filters */
+/*--------------------------------------------------------------------------------*/
+
+static q15_t sim_notch_coeffs[6 * SIM_NOTCHES];
+static q15_t sim_dec_coeffs[SIM_DEC_TAPS];
+static q15_t sim_fir_coeffs[SIM_FIR_TAPS];
+
+static q15_t sim_q15( double x )
+{
+    x = floor( x * 32768.0 + 0.5 );
+    return ( q15_t ) ( ( x > 32767.0 ) ? 32767.0 : ( ( x < -32768.0 ) ? -32768.0 : x ) );
+}
+
+/*
+ * Notch at f Hz with poles of radius r, unity gain at Nyquist. The biquad
+ * coefficients {b0, 0, b1, b2, a1, a2} are halved for a postShift of 1, the
+ * feedback coefficients negated.
+ */
+static void sim_design_notch( q15_t *pCoeffs, double f, double r )
+{
+    double c = cos( 2.0 * M_PI * f / SIM_FS );
+    double g = ( 1.0 + 2.0 * r * c + r * r ) / ( 2.0 + 2.0 * c );
+
+    pCoeffs[0] = sim_q15( g / 2.0 );
+    pCoeffs[1] = 0;
+    pCoeffs[2] = sim_q15( -2.0 * c * g / 2.0 );
+    pCoeffs[3] = sim_q15( g / 2.0 );
+    pCoeffs[4] = sim_q15( 2.0 * r * c / 2.0 );
+    pCoeffs[5] = sim_q15( -r * r / 2.0 );
+}
+
+/* Hamming windowed sinc low-pass, cutoff fc relative to the sampling frequency, unity DC gain */
+static void sim_design_lowpass( q15_t *pCoeffs, uint32_t numTaps, double fc )
+{
+    double h[SIM_DEC_TAPS + SIM_FIR_TAPS];
+    double sum = 0.0;
+    double t;
+    uint32_t i;
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        t = ( double ) i - ( numTaps - 1U ) / 2.0;
+        h[i] = ( ( t == 0.0 ) ? 2.0 * fc : sin( 2.0 * M_PI * fc * t ) / ( M_PI * t ) ) *
+               ( 0.54 - 0.46 * cos( 2.0 * M_PI * i / ( numTaps - 1U ) ) );
+        sum += h[i];
+    }
+
+    for( i = 0; i < numTaps; i++ )
+    {
+        pCoeffs[i] = sim_q15( h[i] / sum );
+    }
+}
+
+static void sim_design( void )
+{
+    sim_design_notch( &sim_notch_coeffs[0], 50.0, 0.99 );
+    sim_design_notch( &sim_notch_coeffs[6], 150.0, 0.99 );
+    sim_design_lowpass( sim_dec_coeffs, SIM_DEC_TAPS, 0.8 / ( 2.0 * SIM_M ) );
+    sim_design_lowpass( sim_fir_coeffs, SIM_FIR_TAPS, 600.0 / ( SIM_FS / SIM_M ) );
+}
+
+/* A set of stage instances, for the pipeline or for the reference */
+typedef struct
+{
+    arm_biquad_casd_df1_inst_q15  notch;
+    arm_fir_decimate_instance_q15 dec;
+    arm_fir_instance_q15          fir;
+    q15_t                         notch_state[4 * SIM_NOTCHES];
+    q15_t                         dec_state[SIM_DEC_TAPS + SIM_HALF - 1U];
+    q15_t                         fir_state[SIM_FIR_TAPS + SIM_OUT];
+} sim_filters;
+
+static int sim_filters_init( sim_filters *f )
+{
+    arm_biquad_cascade_df1_init_q15( &f->notch, SIM_NOTCHES, sim_notch_coeffs, f->notch_state, 1 );
+
+    return ( arm_fir_decimate_init_q15( &f->dec, SIM_DEC_TAPS, SIM_M, sim_dec_coeffs, f->dec_state, SIM_HALF ) ==
+             ARM_MATH_SUCCESS ) &&
+           ( arm_fir_init_q15( &f->fir, SIM_FIR_TAPS, sim_fir_coeffs, f->fir_state, SIM_OUT ) == ARM_MATH_SUCCESS );
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Simulated ADC, DMA and application */
+/*--------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    SIM_NOMINAL,        /* Processing after every half buffer */
+    SIM_LATE,           /* Processing after every third half buffer */
+    SIM_PREEMPTED,      /* DMA interrupt during every fifth processing */
+    SIM_MISSED,         /* Callback missed for every seventh half buffer */
+    SIM_RANDOM          /* Random processing delays, preemptions and missed callbacks */
+} sim_scenario;
+
+static const char *sim_scenario_names[] = { "nominal", "late", "preempted", "missed callbacks", "random" };
+
+typedef struct
+{
+    ADC_PIPE_HandleTypeDef  hpipe;
+    ADC_PIPE_StageTypeDef   stages[6];
+    ADC_PIPE_ConvertTypeDef convert;
+    ADC_PIPE_StatsTypeDef   stats;
+    sim_filters             filters;
+    uint16_t                buffer[SIM_LENGTH];
+
+    sim_scenario            scenario;
+    uint32_t                dma_half;           /* Half buffers written by the DMA */
+    uint32_t                missed;             /* Callbacks not called */
+    uint32_t                missed_last;        /* Half buffer following the last missed callback */
+    uint32_t                preempt;            /* DMA interrupts to simulate in the next processing */
+    uint32_t                preemptions;        /* DMA interrupts simulated during a processing */
+    uint32_t                runs;               /* Calls of the probe stage */
+    uint32_t                errors;             /* Checks failed in the callbacks */
+
+    uint16_t               *history;            /* ADC codes of each half buffer */
+    uint32_t               *processed;          /* Half buffer numbers in the order they were processed */
+    uint8_t                *output_valid;
+    q15_t                  *outputs;            /* Output of each half buffer */
+} sim_context;
+
+static sim_context sim;
+
+/* Next half buffer of the ADC: a 200 Hz tone with 50 Hz and 150 Hz hum, a 5 kHz interference and noise */
+static void sim_adc_codes( uint16_t *pCodes, uint32_t half )
+{
+    double t, x;
+    uint32_t i;
+
+    for( i = 0; i < SIM_HALF; i++ )
+    {
+        t = ( double ) ( half * SIM_HALF + i ) / SIM_FS;
+        x = 2078.0 + 700.0 * sin( 2.0 * M_PI * 200.0 * t ) + 300.0 * sin( 2.0 * M_PI * 50.0 * t ) +
+            100.0 * sin( 2.0 * M_PI * 150.0 * t + 1.0 ) + 250.0 * sin( 2.0 * M_PI * 5000.0 * t ) +
+            ( double ) ( ( int32_t ) ( sim_rand() % 33U ) - 16 );
+        pCodes[i] = ( uint16_t ) ( ( x < 0.0 ) ? 0.0 : ( ( x > 4095.0 ) ? 4095.0 : x ) );
+    }
+}
+
+/* The DMA completes the next half buffer, and calls the callback unless it is missed */
+static void sim_dma_complete( int callback )
+{
+    uint16_t *pCodes = &sim.history[sim.dma_half * SIM_HALF];
+
+    sim_adc_codes( pCodes, sim.dma_half );
+    memcpy( &sim.buffer[( sim.dma_half & 1U ) * SIM_HALF], pCodes, SIM_HALF * sizeof( uint16_t ) );
+
+    if( callback == 0 )
+    {
+        sim.missed++;
+        sim.missed_last = sim.dma_half + 1U;
+    }
+    else if( ( sim.dma_half & 1U ) == 0U )
+    {
+        ADC_PIPE_HalfCpltCallback( &sim.hpipe );
+    }
+    else
+    {
+        ADC_PIPE_CpltCallback( &sim.hpipe );
+    }
+
+    sim.dma_half++;
+}
+
+/*
+ * Last stage: records which half buffer is processed, and simulates the DMA
+ * interrupts that occur during the processing.
+ */
+static uint32_t sim_probe( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    sim_context *ctx = ( sim_context * ) pInstance;
+
+    ( void ) pData;
+
+    ctx->processed[ctx->runs++] = ctx->hpipe.Next;
+
+    while( ( ctx->preempt > 0U ) && ( ctx->dma_half < sim_halves ) )
+    {
+        sim_dma_complete( 1 );
+        ctx->preemptions++;
+        ctx->preempt--;
+    }
+    ctx->preempt = 0U;
+
+    return BlockSize;
+}
+
+void ADC_PIPE_OutputCallback( ADC_PIPE_HandleTypeDef *hpipe, q15_t *pData, uint32_t BlockSize )
+{
+    uint32_t half = hpipe->Next;
+    q15_t minVal = 32767, maxVal = -32768;
+    double mean = 0.0;
+    double power = 0.0;
+    uint32_t i;
+
+    /* In place, at the start of the half buffer */
+    if( ( ( uint16_t * ) pData != &sim.buffer[( half & 1U ) * SIM_HALF] ) || ( BlockSize != SIM_OUT ) ||
+            sim.output_valid[half] )
+    {
+        sim.errors++;
+        return;
+    }
+
+    for( i = 0; i < BlockSize; i++ )
+    {
+        minVal = ( pData[i] < minVal ) ? pData[i] : minVal;
+        maxVal = ( pData[i] > maxVal ) ? pData[i] : maxVal;
+        mean += pData[i];
+        power += ( double ) pData[i] * pData[i];
+    }
+    mean /= BlockSize;
+    power /= BlockSize;
+
+    if( ( sim.stats.Min != minVal ) || ( sim.stats.Max != maxVal ) || ( pData[sim.stats.MinIndex] != minVal ) ||
+            ( pData[sim.stats.MaxIndex] != maxVal ) || ( fabs( sim.stats.Mean - mean ) > 1.0 ) ||
+            ( fabs( sim.stats.Rms - sqrt( power ) ) > 2.0 + sqrt( power ) / 1024.0 ) )
+    {
+        sim.errors++;
+    }
+
+    memcpy( &sim.outputs[half * SIM_OUT], pData, BlockSize * sizeof( q15_t ) );
+    sim.output_valid[half] = 1U;
+}
+
+static void sim_fail( const char *scenario, const char *check )
+{
+    fprintf( stderr, "%s: %s\n", scenario, check );
+    sim_failures++;
+}
+
+static int sim_setup( sim_scenario scenario )
+{
+    ADC_PIPE_StageTypeDef stages[] =
+    {
+        { ADC_PIPE_Convert,  &sim.convert,       0U, 0U, 0U },
+        { ADC_PIPE_Biquad,   &sim.filters.notch, 0U, 0U, 0U },
+        { ADC_PIPE_Decimate, &sim.filters.dec,   0U, 0U, 0U },
+        { ADC_PIPE_FIR,      &sim.filters.fir,   0U, 0U, 0U },
+        { ADC_PIPE_Stats,    &sim.stats,         0U, 0U, 0U },
+        { sim_probe,         &sim,               0U, 0U, 0U },
+    };
+
+    memset( sim.buffer, 0, sizeof( sim.buffer ) );
+    memset( sim.output_valid, 0, sim_halves );
+    memcpy( sim.stages, stages, sizeof( stages ) );
+
+    sim.scenario = scenario;
+    sim.dma_half = 0U;
+    sim.missed = 0U;
+    sim.missed_last = 0U;
+    sim.preempt = 0U;
+    sim.preemptions = 0U;
+    sim.runs = 0U;
+    sim.errors = 0U;
+    sim_notifications = 0U;
+    sim_rand_state = sim_seed;
+
+    sim.convert.Resolution = SIM_BITS;
+    sim.hpipe.pBuffer = sim.buffer;
+    sim.hpipe.Length = SIM_LENGTH;
+    sim.hpipe.pStages = sim.stages;
+    sim.hpipe.NbStages = 6U;
+
+    return sim_filters_init( &sim.filters ) && ( ADC_PIPE_Init( &sim.hpipe ) == ADC_PIPE_OK );
+}
+
+/* Simulates the scenario until the DMA has written sim_halves half buffers */
+static void sim_run( sim_scenario scenario )
+{
+    uint32_t event = 0U;
+    int callback;
+    int process;
+
+    while( sim.dma_half < sim_halves )
+    {
+        callback = 1;
+        process = 1;
+
+        switch( scenario )
+        {
+            case SIM_LATE:
+                process = ( ( event % 3U ) == 2U );
+                break;
+
+            case SIM_PREEMPTED:
+                sim.preempt = ( ( event % 5U ) == 4U ) ? 1U : 0U;
+                break;
+
+            case SIM_MISSED:
+                /* Not on the last half buffer, which would never be counted */
+                callback = ( ( event % 7U ) != 6U ) || ( sim.dma_half + 1U == sim_halves );
+                break;
+
+            case SIM_RANDOM:
+                /* Two consecutive missed callbacks, a whole buffer, can not be detected */
+                callback = ( ( sim_rand() % 50U ) != 0U ) || ( sim.dma_half + 1U == sim_halves ) ||
+                           ( sim.missed_last == sim.dma_half );
+                process = ( ( sim_rand() % 2U ) == 0U );
+                sim.preempt = ( ( sim_rand() % 10U ) == 0U ) ? 1U + ( sim_rand() % 2U ) : 0U;
+                break;
+
+            default:
+                break;
+        }
+
+        sim_dma_complete( callback );
+        event++;
+
+        if( process )
+        {
+            ( void ) ADC_PIPE_Process( &sim.hpipe );
+        }
+    }
+
+    sim.preempt = 0U;
+    ( void ) ADC_PIPE_Process( &sim.hpipe );
+}
+
+/* Runs the reference on the half buffers processed by the pipeline, and compares the outputs */
+static uint32_t sim_check_outputs( void )
+{
+    static q15_t data[SIM_HALF];
+    static q15_t notched[SIM_HALF];
+    static q15_t decimated[SIM_OUT];
+    static q15_t out[SIM_OUT];
+    sim_filters *ref = ( sim_filters * ) malloc( sizeof( sim_filters ) );
+    uint32_t mismatches = 0U;
+    uint32_t r, i, half;
+
+    if( ( ref == NULL ) || !sim_filters_init( ref ) )
+    {
+        free( ref );
+        return 1U;
+    }
+
+    for( r = 0; r < sim.runs; r++ )
+    {
+        half = sim.processed[r];
+
+        for( i = 0; i < SIM_HALF; i++ )
+        {
+            data[i] = ( q15_t ) ( ( ( int32_t ) sim.history[half * SIM_HALF + i] - 2048 ) * 16 );
+        }
+
+        arm_biquad_cascade_df1_q15( &ref->notch, data, notched, SIM_HALF );
+        arm_fir_decimate_q15( &ref->dec, notched, decimated, SIM_HALF );
+        arm_fir_q15( &ref->fir, decimated, out, SIM_OUT );
+
+        if( sim.output_valid[half] && ( memcmp( out, &sim.outputs[half * SIM_OUT], sizeof( out ) ) != 0 ) )
+        {
+            mismatches++;
+        }
+    }
+
+    free( ref );
+    return mismatches;
+}
+
+static void sim_test( sim_scenario scenario )
+{
+    const char *name = sim_scenario_names[scenario];
+    ADC_PIPE_HandleTypeDef *hpipe = &sim.hpipe;
+    uint32_t delivered = 0U;
+    uint32_t expected;
+    uint64_t stageCycles = 0U;
+    uint32_t lastCycles = 0U;
+    uint32_t i;
+
+    if( !sim_setup( scenario ) )
+    {
+        sim_fail( name, "initialization failed" );
+        return;
+    }
+
+    sim_run( scenario );
+
+    for( i = 0; i < sim_halves; i++ )
+    {
+        delivered += sim.output_valid[i];
+    }
+
+    if( sim.errors != 0U )
+    {
+        sim_fail( name, "output not in place, or inconsistent statistics" );
+    }
+
+    if( sim_check_outputs() != 0U )
+    {
+        sim_fail( name, "outputs differ from the reference" );
+    }
+
+    /* Every half buffer is counted, and either output or dropped */
+    if( ( hpipe->Completed != sim_halves ) || ( hpipe->Next != sim_halves ) ||
+            ( delivered + hpipe->Overruns != sim_halves ) || ( hpipe->Processed != sim.runs ) ||
+            ( sim_notifications != sim_halves - sim.missed ) )
+    {
+        sim_fail( name, "half buffer counts" );
+    }
+
+    switch( scenario )
+    {
+        case SIM_LATE:
+            /* Two half buffers dropped per processing, and one at the end after two more */
+            expected = ( sim_halves / 3U ) * 2U + ( ( ( sim_halves % 3U ) == 2U ) ? 1U : 0U );
+            break;
+
+        case SIM_PREEMPTED:
+            expected = sim.preemptions;
+            break;
+
+        case SIM_MISSED:
+            expected = sim.missed;
+            break;
+
+        case SIM_RANDOM:
+            expected = hpipe->Overruns;
+            break;
+
+        default:
+            expected = 0U;
+            break;
+    }
+
+    if( hpipe->Overruns != expected )
+    {
+        sim_fail( name, "number of dropped half buffers" );
+    }
+
+    /* Cycle accounting */
+    for( i = 0; i < hpipe->NbStages; i++ )
+    {
+        stageCycles += hpipe->pStages[i].TotalCycles;
+        lastCycles += hpipe->pStages[i].LastCycles;
+
+        if( ( hpipe->pStages[i].MaxCycles < hpipe->pStages[i].LastCycles ) ||
+                ( hpipe->pStages[i].TotalCycles < hpipe->pStages[i].MaxCycles ) )
+        {
+            sim_fail( name, "stage cycle accounting" );
+        }
+    }
+
+    if( ( lastCycles != hpipe->LastCycles ) || ( hpipe->MaxCycles < hpipe->LastCycles ) ||
+            ( stageCycles < hpipe->MaxCycles ) || ( stageCycles == 0U ) )
+    {
+        sim_fail( name, "pipeline cycle accounting" );
+    }
+
+    printf( "%-18s %8u halves %8u output %8u dropped %8u preemptions %8u missed\n", name,
+            ( unsigned ) sim_halves, ( unsigned ) delivered, ( unsigned ) hpipe->Overruns,
+            ( unsigned ) sim.preemptions, ( unsigned ) sim.missed );
+}
+
+static void sim_test_init( void )
+{
+    ADC_PIPE_HandleTypeDef hpipe;
+    ADC_PIPE_StageTypeDef stage = { NULL, NULL, 0U, 0U, 0U };
+    uint16_t buffer[4];
+
+    memset( &hpipe, 0, sizeof( hpipe ) );
+    hpipe.pBuffer = buffer;
+    hpipe.Length = 3U;
+
+    if( ADC_PIPE_Init( &hpipe ) != ADC_PIPE_ERROR )
+    {
+        sim_fail( "init", "odd buffer length accepted" );
+    }
+
+    hpipe.Length = 4U;
+    hpipe.pStages = &stage;
+    hpipe.NbStages = 1U;
+
+    if( ADC_PIPE_Init( &hpipe ) != ADC_PIPE_ERROR )
+    {
+        sim_fail( "init", "stage without processing function accepted" );
+    }
+
+    hpipe.pBuffer = NULL;
+    hpipe.NbStages = 0U;
+
+    if( ADC_PIPE_Init( &hpipe ) != ADC_PIPE_ERROR )
+    {
+        sim_fail( "init", "missing buffer accepted" );
+    }
+
+    hpipe.pBuffer = buffer;
+
+    if( ADC_PIPE_Init( &hpipe ) != ADC_PIPE_OK )
+    {
+        sim_fail( "init", "valid pipeline rejected" );
+    }
+}
+
+static void sim_print_cycles( void )
+{
+    static const char *names[] = { "convert", "biquad (2 notches)", "decimate (32 taps, /4)",
+                                   "fir (16 taps)", "statistics", "probe" };
+    ADC_PIPE_HandleTypeDef *hpipe = &sim.hpipe;
+    const ADC_PIPE_StageTypeDef *s;
+    double average;
+    uint64_t total = 0U;
+    uint32_t i;
+
+    printf( "\nnominal scenario, %u samples per half buffer, host nanoseconds\n", ( unsigned ) SIM_HALF );
+    printf( "%-24s %12s %12s %12s\n", "stage", "avg/half", "max/half", "avg/sample" );
+
+    for( i = 0; i < hpipe->NbStages; i++ )
+    {
+        s = &hpipe->pStages[i];
+        average = ( double ) s->TotalCycles / hpipe->Processed;
+        total += s->TotalCycles;
+        printf( "%-24s %12.0f %12u %12.2f\n", names[i], average, ( unsigned ) s->MaxCycles, average / SIM_HALF );
+    }
+
+    average = ( double ) total / hpipe->Processed;
+    printf( "%-24s %12.0f %12u %12.2f\n", "pipeline", average, ( unsigned ) hpipe->MaxCycles, average / SIM_HALF );
+    printf( "half buffer period %.0f ns, load %.3f %%\n", SIM_HALF * 1e9 / SIM_FS,
+            100.0 * average / ( SIM_HALF * 1e9 / SIM_FS ) );
+}
+
+int main( int argc, char *argv[] )
+{
+    int arg;
+
+    for( arg = 1; arg < argc; arg++ )
+    {
+        if( strcmp( argv[arg], "--quick" ) == 0 )
+        {
+            sim_quick = 1;
+            sim_halves = 200;
+        }
+        else if( ( strcmp( argv[arg], "--halves" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            sim_halves = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else if( ( strcmp( argv[arg], "--seed" ) == 0 ) && ( arg + 1 < argc ) )
+        {
+            sim_seed = ( uint32_t ) strtoul( argv[++arg], NULL, 0 );
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [--quick] [--halves N] [--seed N]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    if( ( sim_halves < 2U ) || ( sim_halves > SIM_MAX_HALVES ) || ( sim_seed == 0U ) )
+    {
+        fprintf( stderr, "halves must be in [2 %u], seed not 0\n", ( unsigned ) SIM_MAX_HALVES );
+        return 1;
+    }
+
+    sim.history = ( uint16_t * ) malloc( sim_halves * SIM_HALF * sizeof( uint16_t ) );
+    sim.processed = ( uint32_t * ) malloc( sim_halves * sizeof( uint32_t ) );
+    sim.output_valid = ( uint8_t * ) malloc( sim_halves );
+    sim.outputs = ( q15_t * ) malloc( sim_halves * SIM_OUT * sizeof( q15_t ) );
+
+    if( ( sim.history == NULL ) || ( sim.processed == NULL ) || ( sim.output_valid == NULL ) ||
+            ( sim.outputs == NULL ) )
+    {
+        fprintf( stderr, "out of memory\n" );
+        return 1;
+    }
+
+    sim_design();
+    sim_test_init();
+
+    sim_test( SIM_LATE );
+    sim_test( SIM_PREEMPTED );
+    sim_test( SIM_MISSED );
+    sim_test( SIM_RANDOM );
+    sim_test( SIM_NOMINAL );
+
+    if( !sim_quick )
+    {
+        sim_print_cycles();
+    }
+
+    printf( "%s: %u failure(s), seed %u\n", sim_failures ? "FAILED" : "PASSED", ( unsigned ) sim_failures,
+            ( unsigned ) sim_seed );
+
+    free( sim.history );
+    free( sim.processed );
+    free( sim.output_valid );
+    free( sim.outputs );
+
+    return sim_failures ? 1 : 0;
+}
@@ -0,0 +1,456 @@
+/**
+  ******************************************************************************
+  * @file    adc_pipeline.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    19-October-2026
+  * @brief   Zero-copy processing of a circular ADC DMA buffer by a chain of
+  *          CMSIS-DSP stages, with overrun detection and per stage cycle
+  *          accounting
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- copy adc_pipeline_conf_template.h to the application as adc_pipeline_conf.h
+   and select how the processing context is notified.
+
+2- configure the ADC DMA channel in circular mode, with half word peripheral
+   and memory data widths, and the ADC in continuous or triggered conversion
+   mode with DMA circular requests (ADC_InitStruct.DMAContinuousRequests).
+
+3- initialize the CMSIS-DSP instances of the stages for blocks of Length / 2
+   samples, the decimation factors dividing the block size of their stage, and
+   fill the handle:
+      - pBuffer, Length : the DMA buffer and its number of samples, even
+      - pStages, NbStages : the stages, for instance
+          { ADC_PIPE_Convert, &Convert }, { ADC_PIPE_Biquad, &Biquad },
+          { ADC_PIPE_Decimate, &Decimator }, { ADC_PIPE_Stats, &Stats }
+   then call ADC_PIPE_Init().
+
+4- call ADC_PIPE_HalfCpltCallback() from HAL_ADC_ConvHalfCpltCallback() and
+   ADC_PIPE_CpltCallback() from HAL_ADC_ConvCpltCallback().
+
+5- start the acquisition with ADC_PIPE_Start(), and call ADC_PIPE_Process()
+   from the main loop, a task or a low priority interrupt. Each half buffer is
+   processed in place, then passed to ADC_PIPE_OutputCallback(), to be
+   implemented by the application.
+
+The DMA interrupt only counts the completed half buffers: all the processing
+runs in the context calling ADC_PIPE_Process(). The samples of a half buffer
+are valid until the DMA completes the other half buffer and wraps back onto
+it, that is, for the duration of one half buffer. A half buffer that is not
+processed in time is dropped and counted in Overruns: either it was already
+being overwritten when ADC_PIPE_Process() got to it, or it was overwritten
+while the stages were running, in which case it is not output. The filter
+states have then seen the corrupted samples, as after a glitch of the input.
+ADC_PIPE_OutputCallback() must copy out the samples it keeps before returning.
+A missed DMA interrupt is detected at the next one, which completes a half
+buffer of the same parity, and the half buffer it missed is dropped. Missing
+two interrupts in a row, a whole buffer period, can not be detected.
+
+The cycles spent by each stage are counted on every half buffer, to compare
+with the half buffer period: LastCycles, MaxCycles and TotalCycles / Processed
+for the average.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "adc_pipeline.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#if !defined(ADC_PIPE_NOTIFY)
+#define ADC_PIPE_NOTIFY(hpipe)
+#endif
+
+#if !defined(ADC_PIPE_GET_CYCLES)
+#define ADC_PIPE_GET_CYCLES()   ADC_PIPE_GetSysTickCycles()
+#define ADC_PIPE_USE_SYSTICK
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+#if defined(ADC_PIPE_USE_SYSTICK)
+static uint32_t ADC_PIPE_GetSysTickCycles( void );
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+#if defined(ADC_PIPE_USE_SYSTICK)
+static uint32_t ADC_PIPE_LastSysTickCycles = 0U;
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+#if defined(ADC_PIPE_USE_SYSTICK)
+/**
+  * @brief  Return the number of core clock cycles since the start of the HAL
+  *         tick, from the tick count and the SysTick down counter
+  * @note   When the caller masks the SysTick interrupt, for instance from an
+  *         interrupt of the same or a higher priority, the counter reloads
+  *         without the tick being incremented. A pending SysTick interrupt
+  *         accounts for one reload: intervals up to one tick period are
+  *         measured, longer ones are underestimated.
+  * @param  None
+  * @retval Cycle count
+  */
+static uint32_t ADC_PIPE_GetSysTickCycles( void )
+{
+    uint32_t Tick;
+    uint32_t Value;
+    uint32_t Reload;
+    uint32_t Cycles;
+
+    /* Read again if the tick was incremented between the two reads */
+    do
+    {
+        Tick = HAL_GetTick();
+        Value = SysTick->VAL;
+        Reload = 0U;
+
+        /* The counter reloaded and the tick is not incremented yet. Read the
+           counter again, as the reload may have followed the first read */
+        if( ( SCB->ICSR & SCB_ICSR_PENDSTSET_Msk ) != 0U )
+        {
+            Value = SysTick->VAL;
+            Reload = SysTick->LOAD + 1U;
+        }
+    }
+    while( Tick != HAL_GetTick() );
+
+    Cycles = ( Tick * ( SystemCoreClock / 1000U ) ) + Reload + ( SysTick->LOAD - Value );
+
+    /* A second missed reload takes the count back by up to one tick period:
+       hold the count, so that the differences do not wrap around */
+    if( ( ADC_PIPE_LastSysTickCycles - Cycles ) <= SysTick->LOAD )
+    {
+        Cycles = ADC_PIPE_LastSysTickCycles;
+    }
+    ADC_PIPE_LastSysTickCycles = Cycles;
+
+    return Cycles;
+}
+#endif
+
+/**
+  * @brief  Check the handle and clear the counters and the cycle accounting
+  * @param  hpipe: pipeline handle, with the buffer and the stages filled in
+  * @retval ADC_PIPE_OK, or ADC_PIPE_ERROR if the buffer or the stages are invalid
+  */
+ADC_PIPE_StatusTypeDef ADC_PIPE_Init( ADC_PIPE_HandleTypeDef *hpipe )
+{
+    uint32_t i;
+
+    if( ( hpipe->pBuffer == NULL ) || ( hpipe->Length < 2U ) || ( ( hpipe->Length & 1U ) != 0U ) ||
+            ( ( hpipe->NbStages > 0U ) && ( hpipe->pStages == NULL ) ) )
+    {
+        return ADC_PIPE_ERROR;
+    }
+
+    for( i = 0U; i < hpipe->NbStages; i++ )
+    {
+        if( hpipe->pStages[i].Process == NULL )
+        {
+            return ADC_PIPE_ERROR;
+        }
+    }
+
+    hpipe->Completed = 0U;
+    hpipe->Next = 0U;
+    hpipe->Overruns = 0U;
+    ADC_PIPE_ResetStats( hpipe );
+
+    return ADC_PIPE_OK;
+}
+
+/**
+  * @brief  Clear the cycle accounting of the pipeline and of its stages
+  * @param  hpipe: pipeline handle
+  * @retval None
+  */
+void ADC_PIPE_ResetStats( ADC_PIPE_HandleTypeDef *hpipe )
+{
+    uint32_t i;
+
+    for( i = 0U; i < hpipe->NbStages; i++ )
+    {
+        hpipe->pStages[i].LastCycles = 0U;
+        hpipe->pStages[i].MaxCycles = 0U;
+        hpipe->pStages[i].TotalCycles = 0U;
+    }
+
+    hpipe->Processed = 0U;
+    hpipe->LastCycles = 0U;
+    hpipe->MaxCycles = 0U;
+}
+
+/**
+  * @brief  First half of the buffer written, to be called from HAL_ADC_ConvHalfCpltCallback()
+  * @param  hpipe: pipeline handle
+  * @retval None
+  */
+void ADC_PIPE_HalfCpltCallback( ADC_PIPE_HandleTypeDef *hpipe )
+{
+    /* The even half buffers are in the first half: if a transfer complete
+       was missed, it is counted here, and dropped by ADC_PIPE_Process(). */
+    hpipe->Completed += ( ( hpipe->Completed & 1U ) == 0U ) ? 1U : 2U;
+
+    ADC_PIPE_NOTIFY( hpipe );
+}
+
+/**
+  * @brief  Second half of the buffer written, to be called from HAL_ADC_ConvCpltCallback()
+  * @param  hpipe: pipeline handle
+  * @retval None
+  */
+void ADC_PIPE_CpltCallback( ADC_PIPE_HandleTypeDef *hpipe )
+{
+    hpipe->Completed += ( ( hpipe->Completed & 1U ) != 0U ) ? 1U : 2U;
+
+    ADC_PIPE_NOTIFY( hpipe );
+}
+
+/**
+  * @brief  Run the stages on the half buffers completed since the last call,
+  *         and pass the results to ADC_PIPE_OutputCallback()
+  * @param  hpipe: pipeline handle
+  * @retval ADC_PIPE_OK, or ADC_PIPE_OVERRUN if half buffers were dropped
+  */
+ADC_PIPE_StatusTypeDef ADC_PIPE_Process( ADC_PIPE_HandleTypeDef *hpipe )
+{
+    ADC_PIPE_StatusTypeDef Status = ADC_PIPE_OK;
+    ADC_PIPE_StageTypeDef *pStage;
+    uint32_t HalfLength = hpipe->Length / 2U;
+    uint32_t Completed;
+    uint32_t BlockSize;
+    uint32_t Start, Cycles, TotalCycles;
+    uint32_t i;
+    q15_t *pData;
+
+    /* Completed is only written by the DMA interrupt, and Next by this function */
+    Completed = hpipe->Completed;
+
+    while( hpipe->Next != Completed )
+    {
+        /* The DMA writes half buffer Completed over half buffer Completed - 2:
+           only the last completed half buffer is still intact. */
+        if( ( Completed - hpipe->Next ) > 1U )
+        {
+            hpipe->Overruns += ( Completed - 1U ) - hpipe->Next;
+            hpipe->Next = Completed - 1U;
+            Status = ADC_PIPE_OVERRUN;
+        }
+
+        pData = ( q15_t * )&hpipe->pBuffer[( hpipe->Next & 1U ) * HalfLength];
+        BlockSize = HalfLength;
+        TotalCycles = 0U;
+
+        for( i = 0U; i < hpipe->NbStages; i++ )
+        {
+            pStage = &hpipe->pStages[i];
+
+            Start = ADC_PIPE_GET_CYCLES();
+            BlockSize = pStage->Process( pStage->pInstance, pData, BlockSize );
+            Cycles = ADC_PIPE_GET_CYCLES() - Start;
+
+            pStage->LastCycles = Cycles;
+            pStage->TotalCycles += Cycles;
+            if( Cycles > pStage->MaxCycles )
+            {
+                pStage->MaxCycles = Cycles;
+            }
+            TotalCycles += Cycles;
+        }
+
+        hpipe->LastCycles = TotalCycles;
+        if( TotalCycles > hpipe->MaxCycles )
+        {
+            hpipe->MaxCycles = TotalCycles;
+        }
+        hpipe->Processed++;
+
+        /* Output the half buffer if the DMA did not wrap back onto it meanwhile */
+        Completed = hpipe->Completed;
+
+        if( ( Completed - hpipe->Next ) > 1U )
+        {
+            hpipe->Overruns++;
+            Status = ADC_PIPE_OVERRUN;
+        }
+        else
+        {
+            ADC_PIPE_OutputCallback( hpipe, pData, BlockSize );
+        }
+
+        hpipe->Next++;
+    }
+
+    return Status;
+}
+
+/**
+  * @brief  Output of the stages for a half buffer, valid until the DMA wraps
+  *         back onto it: the samples must be used or copied before returning
+  * @param  hpipe: pipeline handle
+  * @param  pData: processed samples, at the start of the half buffer
+  * @param  BlockSize: number of processed samples
+  * @retval None
+  */
+__weak void ADC_PIPE_OutputCallback( ADC_PIPE_HandleTypeDef *hpipe, q15_t *pData, uint32_t BlockSize )
+{
+    /* Prevent unused argument(s) compilation warning */
+    UNUSED( hpipe );
+    UNUSED( pData );
+    UNUSED( BlockSize );
+
+    /* NOTE : This function should not be modified, when the callback is needed,
+              the ADC_PIPE_OutputCallback could be implemented in the user file
+     */
+}
+
+#if defined(HAL_ADC_MODULE_ENABLED)
+/**
+  * @brief  Start the ADC conversions to the circular DMA buffer
+  * @param  hpipe: pipeline handle, initialized with ADC_PIPE_Init()
+  * @param  hadc: ADC handle, with its DMA channel in circular mode
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_PIPE_Start( ADC_PIPE_HandleTypeDef *hpipe, ADC_HandleTypeDef *hadc )
+{
+    hpipe->Completed = 0U;
+    hpipe->Next = 0U;
+
+    return HAL_ADC_Start_DMA( hadc, ( uint32_t * )hpipe->pBuffer, hpipe->Length );
+}
+
+/**
+  * @brief  Stop the ADC conversions. The half buffers already completed can
+  *         still be processed.
+  * @param  hpipe: pipeline handle
+  * @param  hadc: ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_PIPE_Stop( ADC_PIPE_HandleTypeDef *hpipe, ADC_HandleTypeDef *hadc )
+{
+    UNUSED( hpipe );
+
+    return HAL_ADC_Stop_DMA( hadc );
+}
+#endif /* HAL_ADC_MODULE_ENABLED */
+
+/**
+  * @brief  Convert stage: right aligned offset binary ADC codes to Q15, the
+  *         mid-scale code giving 0
+  * @param  pInstance: ADC_PIPE_ConvertTypeDef
+  * @param  pData: ADC codes, replaced by Q15 samples
+  * @param  BlockSize: number of samples
+  * @retval BlockSize
+  */
+uint32_t ADC_PIPE_Convert( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    uint32_t Shift = 16U - ( ( ADC_PIPE_ConvertTypeDef * )pInstance )->Resolution;
+    uint16_t *pCode = ( uint16_t * )pData;
+    uint32_t i;
+
+    for( i = 0U; i < BlockSize; i++ )
+    {
+        /* Scale to 16 bits, and flip the sign bit: 0x8000 + x becomes x */
+        pData[i] = ( q15_t )( uint16_t )( ( ( uint32_t )pCode[i] << Shift ) ^ 0x8000U );
+    }
+
+    return BlockSize;
+}
+
+/**
+  * @brief  FIR filter stage
+  * @param  pInstance: arm_fir_instance_q15, initialized for blocks of BlockSize samples
+  * @param  pData: samples, filtered in place
+  * @param  BlockSize: number of samples
+  * @retval BlockSize
+  */
+uint32_t ADC_PIPE_FIR( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    arm_fir_q15( ( arm_fir_instance_q15 * )pInstance, pData, pData, BlockSize );
+
+    return BlockSize;
+}
+
+/**
+  * @brief  Biquad cascade stage, direct form I
+  * @param  pInstance: arm_biquad_casd_df1_inst_q15
+  * @param  pData: samples, filtered in place
+  * @param  BlockSize: number of samples
+  * @retval BlockSize
+  */
+uint32_t ADC_PIPE_Biquad( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    arm_biquad_cascade_df1_q15( ( arm_biquad_casd_df1_inst_q15 * )pInstance, pData, pData, BlockSize );
+
+    return BlockSize;
+}
+
+/**
+  * @brief  FIR decimator stage
+  * @param  pInstance: arm_fir_decimate_instance_q15, initialized for blocks of
+  *         BlockSize samples
+  * @param  pData: samples, replaced by the decimated samples
+  * @param  BlockSize: number of samples, multiple of the decimation factor
+  * @retval BlockSize divided by the decimation factor
+  */
+uint32_t ADC_PIPE_Decimate( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    arm_fir_decimate_instance_q15 *S = ( arm_fir_decimate_instance_q15 * )pInstance;
+
+    arm_fir_decimate_q15( S, pData, pData, BlockSize );
+
+    return BlockSize / S->M;
+}
+
+/**
+  * @brief  Statistics stage: mean, RMS value, minimum and maximum of the
+  *         samples, which are left unchanged
+  * @param  pInstance: ADC_PIPE_StatsTypeDef, receiving the statistics
+  * @param  pData: samples
+  * @param  BlockSize: number of samples
+  * @retval BlockSize
+  */
+uint32_t ADC_PIPE_Stats( void *pInstance, q15_t *pData, uint32_t BlockSize )
+{
+    ADC_PIPE_StatsTypeDef *pStats = ( ADC_PIPE_StatsTypeDef * )pInstance;
+
+    arm_mean_q15( pData, BlockSize, &pStats->Mean );
+    arm_rms_q15( pData, BlockSize, &pStats->Rms );
+    arm_min_q15( pData, BlockSize, &pStats->Min, &pStats->MinIndex );
+    arm_max_q15( pData, BlockSize, &pStats->Max, &pStats->MaxIndex );
+
+    return BlockSize;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
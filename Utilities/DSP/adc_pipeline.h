@@ -0,0 +1,133 @@
+/**
+  ******************************************************************************
+  * @file    adc_pipeline.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    19-October-2026
+  * @brief   Header for adc_pipeline module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ADC_PIPELINE_H__
+#define _ADC_PIPELINE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "adc_pipeline_conf.h"
+#include "arm_math.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+    ADC_PIPE_OK       = 0x00U,
+    ADC_PIPE_ERROR    = 0x01U,
+    ADC_PIPE_OVERRUN  = 0x02U
+} ADC_PIPE_StatusTypeDef;
+
+/* Stage processing function: processes the BlockSize samples of pData in
+   place, and returns the number of samples left in pData for the next stage,
+   at most BlockSize. */
+typedef uint32_t ( *ADC_PIPE_StageFunc )( void *pInstance, q15_t *pData, uint32_t BlockSize );
+
+typedef struct
+{
+    ADC_PIPE_StageFunc  Process;         /*!< Processing function, ADC_PIPE_Convert, ADC_PIPE_FIR, ...  */
+    void               *pInstance;       /*!< Parameters of the stage, CMSIS-DSP instance for filters   */
+    uint32_t            LastCycles;      /*!< Cycles spent on the last half buffer                      */
+    uint32_t            MaxCycles;       /*!< Maximum cycles spent on a half buffer                     */
+    uint64_t            TotalCycles;     /*!< Cycles spent on the Processed half buffers                */
+} ADC_PIPE_StageTypeDef;
+
+typedef struct
+{
+    uint32_t            Resolution;      /*!< Bits of the right aligned ADC codes, 6 to 12, or 16 for
+                                              the oversampler and for left aligned codes                */
+} ADC_PIPE_ConvertTypeDef;
+
+typedef struct
+{
+    q15_t               Mean;            /*!< Statistics of the input of the stage, last half buffer    */
+    q15_t               Rms;
+    q15_t               Min;
+    q15_t               Max;
+    uint32_t            MinIndex;
+    uint32_t            MaxIndex;
+} ADC_PIPE_StatsTypeDef;
+
+typedef struct
+{
+    uint16_t              *pBuffer;      /*!< Circular DMA buffer, ADC codes then processed samples     */
+    uint32_t               Length;       /*!< Number of samples of the buffer, even                     */
+    ADC_PIPE_StageTypeDef *pStages;      /*!< Stages, applied in order to each half buffer              */
+    uint32_t               NbStages;     /*!< Number of stages                                          */
+
+    __IO uint32_t          Completed;    /*!< Number of half buffers written by the DMA                 */
+    uint32_t               Next;         /*!< Number of the next half buffer to process                 */
+    uint32_t               Processed;    /*!< Number of half buffers run through the stages             */
+    uint32_t               Overruns;     /*!< Number of half buffers overwritten by the DMA before or
+                                              during their processing, and not output                   */
+    uint32_t               LastCycles;   /*!< Cycles spent by all the stages on the last half buffer    */
+    uint32_t               MaxCycles;    /*!< Maximum cycles spent by all the stages on a half buffer   */
+} ADC_PIPE_HandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+ADC_PIPE_StatusTypeDef ADC_PIPE_Init( ADC_PIPE_HandleTypeDef *hpipe );
+void                   ADC_PIPE_ResetStats( ADC_PIPE_HandleTypeDef *hpipe );
+void                   ADC_PIPE_HalfCpltCallback( ADC_PIPE_HandleTypeDef *hpipe );
+void                   ADC_PIPE_CpltCallback( ADC_PIPE_HandleTypeDef *hpipe );
+ADC_PIPE_StatusTypeDef ADC_PIPE_Process( ADC_PIPE_HandleTypeDef *hpipe );
+void                   ADC_PIPE_OutputCallback( ADC_PIPE_HandleTypeDef *hpipe, q15_t *pData, uint32_t BlockSize );
+
+#if defined(HAL_ADC_MODULE_ENABLED)
+HAL_StatusTypeDef      ADC_PIPE_Start( ADC_PIPE_HandleTypeDef *hpipe, ADC_HandleTypeDef *hadc );
+HAL_StatusTypeDef      ADC_PIPE_Stop( ADC_PIPE_HandleTypeDef *hpipe, ADC_HandleTypeDef *hadc );
+#endif
+
+/* Stages */
+uint32_t ADC_PIPE_Convert( void *pInstance, q15_t *pData, uint32_t BlockSize );
+uint32_t ADC_PIPE_FIR( void *pInstance, q15_t *pData, uint32_t BlockSize );
+uint32_t ADC_PIPE_Biquad( void *pInstance, q15_t *pData, uint32_t BlockSize );
+uint32_t ADC_PIPE_Decimate( void *pInstance, q15_t *pData, uint32_t BlockSize );
+uint32_t ADC_PIPE_Stats( void *pInstance, q15_t *pData, uint32_t BlockSize );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ADC_PIPELINE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    adc_pipeline_conf_template.h
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    19-October-2026
+  * @brief   adc_pipeline configuration template file.
+  *          This file should be copied to the application folder and modified
+  *          as follows:
+  *            - Rename it to 'adc_pipeline_conf.h'.
+  *            - Update ADC_PIPE_NOTIFY() with the way the processing context
+  *              is woken up when a half buffer is ready.
+  *            - Optionally select the counter used for the cycle accounting.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2026 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef  __ADC_PIPELINE_CONF_H__
+#define  __ADC_PIPELINE_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l0xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Called from the DMA interrupt when a half buffer is ready, to wake up the
+   context calling ADC_PIPE_Process(). Leave it empty when ADC_PIPE_Process()
+   is polled from the main loop. With FreeRTOS, for instance:
+     #define ADC_PIPE_NOTIFY(hpipe)  vTaskNotifyGiveFromISR(xDspTask, NULL)
+   With a software interrupt of lower priority than the DMA interrupt:
+     #define ADC_PIPE_NOTIFY(hpipe)  HAL_NVIC_SetPendingIRQ(ADC_PIPE_SW_IRQn)
+   The software interrupt must then also have a lower priority than the
+   SysTick interrupt, or ADC_PIPE_GET_CYCLES() be defined: see below. */
+#define ADC_PIPE_NOTIFY(hpipe)
+
+/* Counter used for the per stage cycle accounting. The Cortex-M0+ has no DWT
+   cycle counter: when ADC_PIPE_GET_CYCLES() is not defined, the cycles are
+   computed from HAL_GetTick() and the SysTick counter. When the SysTick
+   interrupt can not preempt ADC_PIPE_Process(), as with TICK_INT_PRIORITY at
+   the lowest priority and ADC_PIPE_Process() called from an interrupt, the
+   stages are only measured up to one tick period: longer stages are
+   underestimated. Define it as a function returning a free running
+   32-bit count of core clock cycles to use another counter. */
+/* #define ADC_PIPE_GET_CYCLES()   BSP_GetCycles() */
+
+#endif /* __ADC_PIPELINE_CONF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/